@@ -39,6 +39,7 @@
 #include "commonutils.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
@@ -602,23 +603,14 @@ class LayerTranslator
     double m_dfGeomOpParam = 0;
 
     OGRGeometry *m_poClipSrcOri = nullptr;
-    bool m_bWarnedClipSrcSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipSrcReprojectedToSrcSRS{};
-    const OGRSpatialReference *m_poClipSrcReprojectedToSrcSRS_SRS = nullptr;
-    OGREnvelope m_oClipSrcEnv{};
-    bool m_bClipSrcIsRectangle = false;
+    std::atomic<bool> m_bWarnedClipSrcSRS = false;
 
     OGRGeometry *m_poClipDstOri = nullptr;
-    bool m_bWarnedClipDstSRS = false;
-    std::unique_ptr<OGRGeometry> m_poClipDstReprojectedToDstSRS{};
-    const OGRSpatialReference *m_poClipDstReprojectedToDstSRS_SRS = nullptr;
-    OGREnvelope m_oClipDstEnv{};
-    bool m_bClipDstIsRectangle = false;
+    std::atomic<bool> m_bWarnedClipDstSRS = false;
 
     bool m_bExplodeCollections = false;
     bool m_bNativeData = false;
     GIntBig m_nLimit = -1;
-    OGRGeometryFactory::TransformWithOptionsCache m_transformWithOptionsCache{};
 
     bool Translate(std::unique_ptr<OGRFeature> poFeatureIn,
                    TargetLayerInfo *psInfo, GIntBig nCountLayerFeatures,
@@ -634,8 +626,108 @@ class LayerTranslator
         bool bGeomIsRectangle = false;
     };
 
-    ClipGeomDesc GetDstClipGeom(const OGRSpatialReference *poGeomSRS);
-    ClipGeomDesc GetSrcClipGeom(const OGRSpatialReference *poGeomSRS);
+    // Clip geometry reprojected to the SRS of the last feature geometry
+    struct ClipGeomCache
+    {
+        std::unique_ptr<OGRGeometry> m_poReprojected{};
+        const OGRSpatialReference *m_poSRS = nullptr;
+        OGREnvelope m_oEnv{};
+        bool m_bIsRectangle = false;
+    };
+
+    // State of the geometry processing stage, of which there is one per
+    // worker thread in TranslateMultiThreaded()
+    struct GeomStageState
+    {
+        OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache{};
+        ClipGeomCache m_oClipSrc{};
+        ClipGeomCache m_oClipDst{};
+        // Clones of TargetLayerInfo::m_aoReprojectionInfo for worker threads
+        std::vector<TargetLayerInfo::ReprojectionInfo> m_aoReprojectionInfo{};
+    };
+
+    GeomStageState m_oGeomStageState{};
+
+    enum class FeatureStatus
+    {
+        OK,
+        SKIP,
+        FAILURE,
+    };
+
+    // Settings of the geometry processing stage that are constant for a layer
+    struct GeomStageParams
+    {
+        const OGRSpatialReference *poOutputSRS = nullptr;
+        std::string osSrcLayerName{};
+        bool bKeepWKBGeoms = false;
+        bool bRunSetPrecision = false;
+    };
+
+    struct TranslateCounters
+    {
+        GIntBig nCount = 0;
+        GIntBig nFeaturesWritten = 0;
+        int nFeaturesInTransaction = 0;
+    };
+
+    struct PendingFeature
+    {
+        std::unique_ptr<OGRFeature> poSrcFeature{};
+        std::unique_ptr<OGRFeature> poDstFeature{};
+        GIntBig nSrcFID = OGRNullFID;
+        GIntBig nDesiredFID = OGRNullFID;
+        FeatureStatus ePrepareStatus = FeatureStatus::OK;
+        FeatureStatus eGeomStatus = FeatureStatus::OK;
+    };
+
+    ClipGeomDesc GetDstClipGeom(const OGRSpatialReference *poGeomSRS,
+                                ClipGeomCache &oCache);
+    ClipGeomDesc GetSrcClipGeom(const OGRSpatialReference *poGeomSRS,
+                                ClipGeomCache &oCache);
+
+    FeatureStatus
+    PrepareDstFeature(TargetLayerInfo *psInfo,
+                      std::unique_ptr<OGRFeature> &poFeature,
+                      std::unique_ptr<OGRFeature> &poDstFeature,
+                      GIntBig nDesiredFID, const GeomStageParams &oParams,
+                      const GDALVectorTranslateOptions *psOptions);
+
+    FeatureStatus TransformGeometries(
+        TargetLayerInfo *psInfo,
+        std::vector<TargetLayerInfo::ReprojectionInfo> &aoReprojectionInfo,
+        GeomStageState &oState, OGRFeature *poDstFeature,
+        const OGRFeature *poSrcFeature, GIntBig nSrcFID,
+        const GeomStageParams &oParams,
+        const GDALVectorTranslateOptions *psOptions);
+
+    bool WriteFeature(TargetLayerInfo *psInfo, OGRFeature *poDstFeature,
+                      GIntBig nSrcFID, GIntBig nDesiredFID,
+                      TranslateCounters &oCounters,
+                      const GDALVectorTranslateOptions *psOptions);
+
+    bool AdvanceTransaction(TargetLayerInfo *psInfo,
+                            TranslateCounters &oCounters,
+                            GIntBig &nTotalEventsDone,
+                            const GDALVectorTranslateOptions *psOptions);
+
+    void ReportPrepareFailure(TargetLayerInfo *psInfo, GIntBig nSrcFID,
+                              const GDALVectorTranslateOptions *psOptions);
+
+    bool
+    HandleReprojectionFailure(TargetLayerInfo *psInfo,
+                              const GDALVectorTranslateOptions *psOptions);
+
+    bool TranslateMultiThreaded(TargetLayerInfo *psInfo,
+                                const GeomStageParams &oParams, int nThreads,
+                                GIntBig nCountLayerFeatures,
+                                GIntBig *pnReadFeatureCount,
+                                GIntBig &nTotalEventsDone,
+                                TranslateCounters &oCounters,
+                                GDALProgressFunc pfnProgress,
+                                void *pProgressArg,
+                                const GDALVectorTranslateOptions *psOptions,
+                                bool &bRet);
 };
 
 static OGRLayer *GetLayerAndOverwriteIfNecessary(GDALDataset *poDstDS,
@@ -6158,6 +6250,23 @@ SetupCT(TargetLayerInfo *psInfo, OGRLayer *poSrcLayer, bool bTransform,
     return true;
 }
 
+/************************************************************************/
+/*                      GetTranslateThreadCount()                       */
+/************************************************************************/
+
+/** Returns the number of threads to use for geometry processing, from the
+ * GDAL_NUM_THREADS configuration option, or half of the CPUs by default. */
+static int GetTranslateThreadCount()
+{
+    const char *pszNumThreads = nullptr;
+    int nVal =
+        GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT,
+                          /* bDefaultToAllCPUs = */ false, &pszNumThreads);
+    if (!pszNumThreads)
+        nVal = std::max(1, CPLGetNumCPUs() / 2);
+    return nVal;
+}
+
 /************************************************************************/
 /*                  LayerTranslator::TranslateArrow()                   */
 /************************************************************************/
@@ -6201,16 +6310,7 @@ bool LayerTranslator::TranslateArrow(
     GIntBig nCount = 0;
     bool bGoOn = true;
     std::vector<GByte> abyModifiedWKB;
-    const int nNumReprojectionThreads = []()
-    {
-        const char *pszNumThreads = nullptr;
-        int nVal =
-            GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT,
-                              /* bDefaultToAllCPUs = */ false, &pszNumThreads);
-        if (!pszNumThreads)
-            nVal = std::max(1, CPLGetNumCPUs() / 2);
-        return nVal;
-    }();
+    const int nNumReprojectionThreads = GetTranslateThreadCount();
 
     // Somewhat arbitrary threshold (config option only/mostly for autotest purposes)
     const int MIN_FEATURES_FOR_THREADED_REPROJ = atoi(CPLGetConfigOption(
@@ -6500,11 +6600,11 @@ bool LayerTranslator::Translate(
     }
 
     const int eGType = m_eGType;
-    const OGRSpatialReference *poOutputSRS = m_poOutputSRS;
+    GeomStageParams oParams;
+    oParams.poOutputSRS = m_poOutputSRS;
 
     OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
     OGRLayer *poDstLayer = psInfo->m_poDstLayer;
-    const int *const panMap = psInfo->m_anMap.data();
     const int iSrcZField = psInfo->m_iSrcZField;
     const bool bPreserveFID = psInfo->m_bPreserveFID;
     const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
@@ -6515,17 +6615,17 @@ bool LayerTranslator::Translate(
         m_bExplodeCollections && nDstGeomFieldCount <= 1;
     const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
 
-    if (poOutputSRS == nullptr && !m_bNullifyOutputSRS)
+    if (oParams.poOutputSRS == nullptr && !m_bNullifyOutputSRS)
     {
         if (nSrcGeomFieldCount == 1)
         {
-            poOutputSRS = poSrcLayer->GetSpatialRef();
+            oParams.poOutputSRS = poSrcLayer->GetSpatialRef();
         }
         else if (iRequestedSrcGeomField > 0)
         {
-            poOutputSRS = poSrcLayer->GetLayerDefn()
-                              ->GetGeomFieldDefn(iRequestedSrcGeomField)
-                              ->GetSpatialRef();
+            oParams.poOutputSRS = poSrcLayer->GetLayerDefn()
+                                      ->GetGeomFieldDefn(iRequestedSrcGeomField)
+                                      ->GetSpatialRef();
         }
     }
 
@@ -6545,11 +6645,32 @@ bool LayerTranslator::Translate(
 
     std::unique_ptr<OGRFeature> poFeature;
     auto poDstFeature = std::make_unique<OGRFeature>(poDstFDefn);
-    int nFeaturesInTransaction = 0;
-    GIntBig nCount = 0; /* written + failed */
-    GIntBig nFeaturesWritten = 0;
-    bool bRunSetPrecisionEvaluated = false;
-    bool bRunSetPrecision = false;
+    TranslateCounters oCounters;
+
+    // Whether source geometries still in their WKB representation can be
+    // kept undecoded, because no geometry processing is requested. This
+    // saves decoding and re-encoding them when the output driver consumes
+    // WKB. Reprojection is checked per geometry field in the loop.
+    oParams.bKeepWKBGeoms =
+        !bExplodeCollections && iSrcZField == -1 &&
+        m_nCoordDim == COORD_DIM_UNCHANGED && m_eGeomOp == GEOMOP_NONE &&
+        !m_poClipSrcOri && !m_poClipDstOri && m_poOutputSRS == nullptr &&
+        !m_bNullifyOutputSRS &&
+        psOptions->dfXYRes == OGRGeomCoordinatePrecision::UNKNOWN &&
+        !m_bMakeValid && !m_bSkipInvalidGeom &&
+        m_eGeomTypeConversion == GTC_DEFAULT && eGType == GEOMTYPE_UNCHANGED &&
+        (psOptions->bQuiet || (psInfo->m_bSupportCurves &&
+                               psInfo->m_bSupportZ && psInfo->m_bSupportM));
+
+    // OGR_APPLY_GEOM_SET_PRECISION default value for OGRLayer::CreateFeature()
+    // purposes, but here in the ogr2ogr -xyRes context, we force calling
+    // SetPrecision(), unless the user explicitly asks not to do it by setting
+    // the config option to NO.
+    oParams.bRunSetPrecision =
+        psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+        CPLTestBool(
+            CPLGetConfigOption("OGR_APPLY_GEOM_SET_PRECISION", "YES"));
+    oParams.osSrcLayerName = poSrcLayer->GetName();
 
     bool bRet = true;
     CPLErrorReset();
@@ -6560,10 +6681,26 @@ bool LayerTranslator::Translate(
     {
         bSetupCTOK = SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
                              m_osDateLineOffset, m_poUserSourceSRS, nullptr,
-                             poOutputSRS, m_poGCPCoordTrans, false);
+                             oParams.poOutputSRS, m_poGCPCoordTrans, false);
     }
 
     const bool bSingleIteration = poFeatureIn != nullptr;
+
+    // Number of threads for the geometry processing stage, if there is
+    // geometry processing worth being parallelized.
+    int nGeomStageThreads = 1;
+    if (!bSingleIteration && psOptions->nFIDToFetch == OGRNullFID &&
+        !bExplodeCollections && nDstGeomFieldCount > 0 &&
+        // Clip geometry caches of worker threads are seeded for a single
+        // geometry field.
+        (nDstGeomFieldCount == 1 || (!m_poClipSrcOri && !m_poClipDstOri)) &&
+        (m_bTransform || m_bWrapDateline || m_poClipSrcOri || m_poClipDstOri ||
+         m_bMakeValid || m_bSkipInvalidGeom || m_eGeomOp != GEOMOP_NONE ||
+         psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN))
+    {
+        nGeomStageThreads = GetTranslateThreadCount();
+    }
+
     while (true)
     {
         if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
@@ -6576,7 +6713,16 @@ bool LayerTranslator::Translate(
         else if (psOptions->nFIDToFetch != OGRNullFID)
             poFeature.reset(poSrcLayer->GetFeature(psOptions->nFIDToFetch));
         else
-            poFeature.reset(poSrcLayer->GetNextFeature());
+        {
+            if (psInfo->m_bCanAvoidSetFrom && !poFeature && poDstFeature)
+            {
+                // Hand the previous feature back to the source layer so
+                // that it can recycle it.
+                poDstFeature->SetFDefnUnsafe(poSrcFDefn);
+                poFeature = std::move(poDstFeature);
+            }
+            poFeature = poSrcLayer->GetNextFeatureReusing(std::move(poFeature));
+        }
 
         if (poFeature == nullptr)
         {
@@ -6592,7 +6738,7 @@ bool LayerTranslator::Translate(
         {
             if (!SetupCT(psInfo, poSrcLayer, m_bTransform, m_bWrapDateline,
                          m_osDateLineOffset, m_poUserSourceSRS, poFeature.get(),
-                         poOutputSRS, m_poGCPCoordTrans, true))
+                         oParams.poOutputSRS, m_poGCPCoordTrans, true))
             {
                 return false;
             }
@@ -6643,777 +6789,1264 @@ bool LayerTranslator::Translate(
 
         for (int iPart = 0; iPart < nIters; iPart++)
         {
-            if (psOptions->nLayerTransaction &&
-                ++nFeaturesInTransaction == psOptions->nGroupTransactions)
-            {
-                if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
-                    poDstLayer->StartTransaction() == OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nFeaturesInTransaction = 0;
-            }
-            else if (!psOptions->nLayerTransaction &&
-                     psOptions->nGroupTransactions > 0 &&
-                     ++nTotalEventsDone >= psOptions->nGroupTransactions)
+            if (!AdvanceTransaction(psInfo, oCounters, nTotalEventsDone,
+                                    psOptions))
             {
-                if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
-                    m_poODS->StartTransaction(psOptions->bForceTransaction) ==
-                        OGRERR_FAILURE)
-                {
-                    return false;
-                }
-                nTotalEventsDone = 0;
+                return false;
             }
 
             CPLErrorReset();
-            if (psInfo->m_bCanAvoidSetFrom)
+            const auto eStatus = PrepareDstFeature(
+                psInfo, poFeature, poDstFeature, nDesiredFID, oParams,
+                psOptions);
+            if (eStatus == FeatureStatus::SKIP)
+                continue;
+            if (eStatus == FeatureStatus::FAILURE)
             {
-                poDstFeature = std::move(poFeature);
-                // From now on, poFeature is null !
-                poDstFeature->SetFDefnUnsafe(poDstFDefn);
-                poDstFeature->SetFID(nDesiredFID);
+                ReportPrepareFailure(psInfo, nSrcFID, psOptions);
+                return false;
             }
-            else
-            {
-                /* Optimization to avoid duplicating the source geometry in the
-                 */
-                /* target feature : we steal it from the source feature for
-                 * now... */
-                std::unique_ptr<OGRGeometry> poStolenGeometry;
-                if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
-                    (nDstGeomFieldCount == 1 ||
-                     (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
-                {
-                    poStolenGeometry.reset(poFeature->StealGeometry());
-                }
-                else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
-                {
-                    poStolenGeometry.reset(
-                        poFeature->StealGeometry(iRequestedSrcGeomField));
-                }
-
-                if (nDstGeomFieldCount == 0 && poStolenGeometry &&
-                    m_poClipSrcOri)
-                {
-                    if (poStolenGeometry->IsEmpty())
-                        goto end_loop;
-
-                    const auto clipGeomDesc =
-                        GetSrcClipGeom(poStolenGeometry->getSpatialReference());
-
-                    if (clipGeomDesc.poGeom && clipGeomDesc.poEnv)
-                    {
-                        OGREnvelope oEnv;
-                        poStolenGeometry->getEnvelope(&oEnv);
-                        if (!clipGeomDesc.poEnv->Contains(oEnv) &&
-                            !(clipGeomDesc.poEnv->Intersects(oEnv) &&
-                              clipGeomDesc.poGeom->Intersects(
-                                  poStolenGeometry.get())))
-                        {
-                            goto end_loop;
-                        }
-                    }
-                }
-
-                poDstFeature->Reset();
 
-                if (poDstFeature->SetFrom(
-                        poFeature.get(), panMap, /* bForgiving = */ TRUE,
-                        /* bUseISO8601ForDateTimeAsString = */ true) !=
-                    OGRERR_NONE)
+            if (poCollToExplode && iGeomCollToExplode < nDstGeomFieldCount)
+            {
+                std::unique_ptr<OGRGeometry> poPart;
+                if (poSrcGeometry && poCollToExplode->IsEmpty())
                 {
-                    if (psOptions->nGroupTransactions)
+                    const OGRwkbGeometryType eSrcType =
+                        poSrcGeometry->getGeometryType();
+                    const OGRwkbGeometryType eSrcFlattenType =
+                        wkbFlatten(eSrcType);
+                    OGRwkbGeometryType eDstType = eSrcType;
+                    switch (eSrcFlattenType)
                     {
-                        if (psOptions->nLayerTransaction)
-                        {
-                            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
-                            {
-                                return false;
-                            }
-                        }
+                        case wkbMultiPoint:
+                            eDstType = wkbPoint;
+                            break;
+                        case wkbMultiLineString:
+                            eDstType = wkbLineString;
+                            break;
+                        case wkbMultiPolygon:
+                            eDstType = wkbPolygon;
+                            break;
+                        case wkbMultiCurve:
+                            eDstType = wkbCompoundCurve;
+                            break;
+                        case wkbMultiSurface:
+                            eDstType = wkbCurvePolygon;
+                            break;
+                        default:
+                            break;
                     }
-
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Unable to translate feature " CPL_FRMT_GIB
-                             " from layer %s.",
-                             nSrcFID, poSrcLayer->GetName());
-
-                    return false;
-                }
-
-                /* ... and now we can attach the stolen geometry */
-                if (poStolenGeometry)
-                {
-                    poDstFeature->SetGeometryDirectly(
-                        poStolenGeometry.release());
+                    eDstType =
+                        OGR_GT_SetModifier(eDstType, OGR_GT_HasZ(eSrcType),
+                                           OGR_GT_HasM(eSrcType));
+                    poPart.reset(OGRGeometryFactory::createGeometry(eDstType));
                 }
-
-                if (!psInfo->m_oMapResolved.empty())
+                else
                 {
-                    for (const auto &kv : psInfo->m_oMapResolved)
-                    {
-                        const int nDstField = kv.first;
-                        const int nSrcField = kv.second.nSrcField;
-                        if (poFeature->IsFieldSetAndNotNull(nSrcField))
-                        {
-                            const auto poDomain = kv.second.poDomain;
-                            const auto &oMapKV =
-                                psInfo->m_oMapDomainToKV[poDomain];
-                            const auto iter = oMapKV.find(
-                                poFeature->GetFieldAsString(nSrcField));
-                            if (iter != oMapKV.end())
-                            {
-                                poDstFeature->SetField(nDstField,
-                                                       iter->second.c_str());
-                            }
-                        }
-                    }
+                    poPart.reset(poCollToExplode->getGeometryRef(0));
+                    poCollToExplode->removeGeometry(0, FALSE);
                 }
-
-                if (nDesiredFID != OGRNullFID)
-                    poDstFeature->SetFID(nDesiredFID);
+                poDstFeature->SetGeomField(iGeomCollToExplode,
+                                           std::move(poPart));
             }
 
-            if (psOptions->bEmptyStrAsNull)
+            const auto eGeomStatus = TransformGeometries(
+                psInfo, psInfo->m_aoReprojectionInfo, m_oGeomStageState,
+                poDstFeature.get(), poFeature.get(), nSrcFID, oParams,
+                psOptions);
+            if (eGeomStatus == FeatureStatus::SKIP)
+                continue;
+            if (eGeomStatus == FeatureStatus::FAILURE &&
+                !HandleReprojectionFailure(psInfo, psOptions))
             {
-                for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
-                {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto fieldDef = poDstFeature->GetFieldDefnRef(i);
-                    if (fieldDef->GetType() != OGRFieldType::OFTString)
-                        continue;
-                    auto str = poDstFeature->GetFieldAsString(i);
-                    if (strcmp(str, "") == 0)
-                        poDstFeature->SetFieldNull(i);
-                }
+                return false;
             }
 
-            if (!psInfo->m_anDateTimeFieldIdx.empty())
+            if (!WriteFeature(psInfo, poDstFeature.get(), nSrcFID, nDesiredFID,
+                              oCounters, psOptions))
             {
-                for (int i : psInfo->m_anDateTimeFieldIdx)
-                {
-                    if (!poDstFeature->IsFieldSetAndNotNull(i))
-                        continue;
-                    auto psField = poDstFeature->GetRawFieldRef(i);
-                    if (psField->Date.TZFlag == 0 || psField->Date.TZFlag == 1)
-                        continue;
+                return false;
+            }
+        }
 
-                    const int nTZOffsetInSec =
-                        (psField->Date.TZFlag - 100) * 15 * 60;
-                    if (nTZOffsetInSec == psOptions->nTZOffsetInSec)
-                        continue;
+        /* Report progress */
+        oCounters.nCount++;
+        bool bGoOn = true;
+        if (pfnProgress)
+        {
+            bGoOn = pfnProgress(nCountLayerFeatures
+                                    ? oCounters.nCount * 1.0 /
+                                          nCountLayerFeatures
+                                    : 1.0,
+                                "", pProgressArg) != FALSE;
+        }
+        if (!bGoOn)
+        {
+            bRet = false;
+            break;
+        }
 
-                    struct tm brokendowntime;
-                    memset(&brokendowntime, 0, sizeof(brokendowntime));
-                    brokendowntime.tm_year = psField->Date.Year - 1900;
-                    brokendowntime.tm_mon = psField->Date.Month - 1;
-                    brokendowntime.tm_mday = psField->Date.Day;
-                    GIntBig nUnixTime = CPLYMDHMSToUnixTime(&brokendowntime);
-                    int nSec = psField->Date.Hour * 3600 +
-                               psField->Date.Minute * 60 +
-                               static_cast<int>(psField->Date.Second);
-                    nSec += psOptions->nTZOffsetInSec - nTZOffsetInSec;
-                    nUnixTime += nSec;
-                    CPLUnixTimeToYMDHMS(nUnixTime, &brokendowntime);
+        if (pnReadFeatureCount)
+            *pnReadFeatureCount = oCounters.nCount;
 
-                    psField->Date.Year =
-                        static_cast<GInt16>(brokendowntime.tm_year + 1900);
-                    psField->Date.Month =
-                        static_cast<GByte>(brokendowntime.tm_mon + 1);
-                    psField->Date.Day =
-                        static_cast<GByte>(brokendowntime.tm_mday);
-                    psField->Date.Hour =
-                        static_cast<GByte>(brokendowntime.tm_hour);
-                    psField->Date.Minute =
-                        static_cast<GByte>(brokendowntime.tm_min);
-                    psField->Date.Second = static_cast<float>(
-                        brokendowntime.tm_sec + fmod(psField->Date.Second, 1));
-                    psField->Date.TZFlag = static_cast<GByte>(
-                        100 + psOptions->nTZOffsetInSec / (15 * 60));
-                }
-            }
+        if (psOptions->nFIDToFetch != OGRNullFID)
+            break;
+        if (bSingleIteration)
+            break;
 
-            /* Erase native data if asked explicitly */
-            if (!m_bNativeData)
+        if (nGeomStageThreads >= 2 && !psInfo->m_bPerFeatureCT)
+        {
+            // Now that the first feature has set up the coordinate
+            // transformation, switch to the multi-threaded pipeline for
+            // the remaining features.
+            if (!TranslateMultiThreaded(psInfo, oParams, nGeomStageThreads,
+                                        nCountLayerFeatures, pnReadFeatureCount,
+                                        nTotalEventsDone, oCounters,
+                                        pfnProgress, pProgressArg, psOptions,
+                                        bRet))
             {
-                poDstFeature->SetNativeData(nullptr);
-                poDstFeature->SetNativeMediaType(nullptr);
+                return false;
             }
+            break;
+        }
+    }
 
-            for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
-            {
-                std::unique_ptr<OGRGeometry> poDstGeometry;
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+                bRet = false;
+        }
+    }
 
-                if (poCollToExplode && iGeom == iGeomCollToExplode)
-                {
-                    if (poSrcGeometry && poCollToExplode->IsEmpty())
-                    {
-                        const OGRwkbGeometryType eSrcType =
-                            poSrcGeometry->getGeometryType();
-                        const OGRwkbGeometryType eSrcFlattenType =
-                            wkbFlatten(eSrcType);
-                        OGRwkbGeometryType eDstType = eSrcType;
-                        switch (eSrcFlattenType)
-                        {
-                            case wkbMultiPoint:
-                                eDstType = wkbPoint;
-                                break;
-                            case wkbMultiLineString:
-                                eDstType = wkbLineString;
-                                break;
-                            case wkbMultiPolygon:
-                                eDstType = wkbPolygon;
-                                break;
-                            case wkbMultiCurve:
-                                eDstType = wkbCompoundCurve;
-                                break;
-                            case wkbMultiSurface:
-                                eDstType = wkbCurvePolygon;
-                                break;
-                            default:
-                                break;
-                        }
-                        eDstType =
-                            OGR_GT_SetModifier(eDstType, OGR_GT_HasZ(eSrcType),
-                                               OGR_GT_HasM(eSrcType));
-                        poDstGeometry.reset(
-                            OGRGeometryFactory::createGeometry(eDstType));
-                    }
-                    else
-                    {
-                        OGRGeometry *poPart =
-                            poCollToExplode->getGeometryRef(0);
-                        poCollToExplode->removeGeometry(0, FALSE);
-                        poDstGeometry.reset(poPart);
-                    }
-                }
-                else
-                {
-                    poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
-                }
-                if (poDstGeometry == nullptr)
-                    continue;
+    if (!bSingleIteration)
+    {
+        CPLDebug("GDALVectorTranslate",
+                 CPL_FRMT_GIB " features written in layer '%s'",
+                 oCounters.nFeaturesWritten, poDstLayer->GetName());
+    }
 
-                // poFeature hasn't been moved if iSrcZField != -1
-                // cppcheck-suppress accessMoved
-                if (iSrcZField != -1 && poFeature != nullptr)
-                {
-                    SetZ(poDstGeometry.get(),
-                         poFeature->GetFieldAsDouble(iSrcZField));
-                    /* This will correct the coordinate dimension to 3 */
-                    poDstGeometry.reset(poDstGeometry->clone());
-                }
+    return bRet;
+}
 
-                if (m_nCoordDim == 2 || m_nCoordDim == 3)
-                {
-                    poDstGeometry->setCoordinateDimension(m_nCoordDim);
-                }
-                else if (m_nCoordDim == 4)
-                {
-                    poDstGeometry->set3D(TRUE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_XYM)
-                {
-                    poDstGeometry->set3D(FALSE);
-                    poDstGeometry->setMeasured(TRUE);
-                }
-                else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
-                {
-                    const OGRwkbGeometryType eDstLayerGeomType =
-                        poDstLayer->GetLayerDefn()
-                            ->GetGeomFieldDefn(iGeom)
-                            ->GetType();
-                    poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
-                    poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
-                }
+/************************************************************************/
+/*                 LayerTranslator::PrepareDstFeature()                 */
+/************************************************************************/
 
-                if (m_eGeomOp == GEOMOP_SEGMENTIZE)
-                {
-                    if (m_dfGeomOpParam > 0)
-                        poDstGeometry->segmentize(m_dfGeomOpParam);
-                }
-                else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
-                {
-                    if (m_dfGeomOpParam > 0)
-                    {
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->SimplifyPreserveTopology(
-                                m_dfGeomOpParam));
-                        if (poNewGeom)
-                        {
-                            poDstGeometry = std::move(poNewGeom);
-                        }
-                    }
-                }
+/** Set the fields of poDstFeature from poFeature, as well as its geometries,
+ * which still have to go through TransformGeometries().
+ *
+ * When psInfo->m_bCanAvoidSetFrom is set, poFeature is moved into
+ * poDstFeature.
+ *
+ * @return FeatureStatus::SKIP if the feature must not be written, or
+ * FeatureStatus::FAILURE if its fields could not be translated.
+ */
+LayerTranslator::FeatureStatus LayerTranslator::PrepareDstFeature(
+    TargetLayerInfo *psInfo, std::unique_ptr<OGRFeature> &poFeature,
+    std::unique_ptr<OGRFeature> &poDstFeature, GIntBig nDesiredFID,
+    const GeomStageParams &oParams, const GDALVectorTranslateOptions *psOptions)
+{
+    const int *const panMap = psInfo->m_anMap.data();
+    const auto poSrcFDefn = psInfo->m_poSrcLayer->GetLayerDefn();
+    const auto poDstFDefn = psInfo->m_poDstLayer->GetLayerDefn();
+    const int nSrcGeomFieldCount = poSrcFDefn->GetGeomFieldCount();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
+    const bool bExplodeCollections =
+        m_bExplodeCollections && nDstGeomFieldCount <= 1;
+    const int iRequestedSrcGeomField = psInfo->m_iRequestedSrcGeomField;
 
-                if (m_poClipSrcOri)
-                {
-                    if (poDstGeometry->IsEmpty())
-                        goto end_loop;
+    if (psInfo->m_bCanAvoidSetFrom)
+    {
+        poDstFeature = std::move(poFeature);
+        // From now on, poFeature is null !
+        poDstFeature->SetFDefnUnsafe(poDstFDefn);
+        poDstFeature->SetFID(nDesiredFID);
+    }
+    else
+    {
+        // Optimization to avoid duplicating the source geometry in the
+        // target feature : we steal it from the source feature for now...
+        std::unique_ptr<OGRGeometry> poStolenGeometry;
+        size_t nSrcWKBSize = 0;
+        if (oParams.bKeepWKBGeoms && nSrcGeomFieldCount == 1 &&
+            nDstGeomFieldCount == 1 &&
+            poFeature->GetGeomFieldWKB(0, nSrcWKBSize))
+        {
+            // SetFrom() copies the WKB without decoding it
+        }
+        else if (!bExplodeCollections && nSrcGeomFieldCount == 1 &&
+                 (nDstGeomFieldCount == 1 ||
+                  (nDstGeomFieldCount == 0 && m_poClipSrcOri)))
+        {
+            poStolenGeometry.reset(poFeature->StealGeometry());
+        }
+        else if (!bExplodeCollections && iRequestedSrcGeomField >= 0)
+        {
+            poStolenGeometry.reset(
+                poFeature->StealGeometry(iRequestedSrcGeomField));
+        }
 
-                    const auto clipGeomDesc =
-                        GetSrcClipGeom(poDstGeometry->getSpatialReference());
+        if (nDstGeomFieldCount == 0 && poStolenGeometry && m_poClipSrcOri)
+        {
+            if (poStolenGeometry->IsEmpty())
+                return FeatureStatus::SKIP;
 
-                    if (!(clipGeomDesc.poGeom && clipGeomDesc.poEnv))
-                        goto end_loop;
+            const auto clipGeomDesc =
+                GetSrcClipGeom(poStolenGeometry->getSpatialReference(),
+                               m_oGeomStageState.m_oClipSrc);
 
-                    OGREnvelope oDstEnv;
-                    poDstGeometry->getEnvelope(&oDstEnv);
+            if (clipGeomDesc.poGeom && clipGeomDesc.poEnv)
+            {
+                OGREnvelope oEnv;
+                poStolenGeometry->getEnvelope(&oEnv);
+                if (!clipGeomDesc.poEnv->Contains(oEnv) &&
+                    !(clipGeomDesc.poEnv->Intersects(oEnv) &&
+                      clipGeomDesc.poGeom->Intersects(
+                          poStolenGeometry.get())))
+                {
+                    return FeatureStatus::SKIP;
+                }
+            }
+        }
 
-                    if (!(clipGeomDesc.bGeomIsRectangle &&
-                          clipGeomDesc.poEnv->Contains(oDstEnv)))
-                    {
-                        std::unique_ptr<OGRGeometry> poClipped;
-                        if (clipGeomDesc.poEnv->Intersects(oDstEnv))
-                        {
-                            poClipped.reset(clipGeomDesc.poGeom->Intersection(
-                                poDstGeometry.get()));
-                        }
-                        if (poClipped == nullptr || poClipped->IsEmpty())
-                        {
-                            goto end_loop;
-                        }
+        poDstFeature->Reset();
 
-                        const int nDim = poDstGeometry->getDimension();
-                        if (poClipped->getDimension() < nDim &&
-                            wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                           ->GetType()) != wkbUnknown)
-                        {
-                            CPLDebug(
-                                "OGR2OGR",
-                                "Discarding feature " CPL_FRMT_GIB
-                                " of layer %s, "
-                                "as its intersection with -clipsrc is a %s "
-                                "whereas the input is a %s",
-                                nSrcFID, poSrcLayer->GetName(),
-                                OGRToOGCGeomType(poClipped->getGeometryType()),
-                                OGRToOGCGeomType(
-                                    poDstGeometry->getGeometryType()));
-                            goto end_loop;
-                        }
+        if (poDstFeature->SetFrom(
+                poFeature.get(), panMap, /* bForgiving = */ TRUE,
+                /* bUseISO8601ForDateTimeAsString = */ true) !=
+            OGRERR_NONE)
+        {
+            return FeatureStatus::FAILURE;
+        }
 
-                        poDstGeometry = OGRGeometryFactory::makeCompatibleWith(
-                            std::move(poClipped),
-                            poDstFDefn->GetGeomFieldDefn(iGeom)->GetType());
-                    }
-                }
+        /* ... and now we can attach the stolen geometry */
+        if (poStolenGeometry)
+        {
+            poDstFeature->SetGeometryDirectly(poStolenGeometry.release());
+        }
 
-                OGRCoordinateTransformation *const poCT =
-                    psInfo->m_aoReprojectionInfo[iGeom].m_poCT.get();
-                char **const papszTransformOptions =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_aosTransformOptions.List();
-                const bool bReprojCanInvalidateValidity =
-                    psInfo->m_aoReprojectionInfo[iGeom]
-                        .m_bCanInvalidateValidity;
-
-                if (poCT != nullptr || papszTransformOptions != nullptr)
-                {
-                    // If we need to change the geometry type to linear, and
-                    // we have a geometry with curves, then convert it to
-                    // linear first, to avoid invalidities due to the fact
-                    // that validity of arc portions isn't always kept while
-                    // reprojecting and then discretizing.
-                    if (bReprojCanInvalidateValidity &&
-                        (!psInfo->m_bSupportCurves ||
-                         m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
-                         m_eGeomTypeConversion ==
-                             GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
-                    {
-                        if (poDstGeometry->hasCurveGeometry(TRUE))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            poDstGeometry = OGRGeometryFactory::forceTo(
-                                std::move(poDstGeometry), eTargetType);
-                        }
-                    }
-                    else if (bReprojCanInvalidateValidity &&
-                             eGType != GEOMTYPE_UNCHANGED &&
-                             !OGR_GT_IsNonLinear(
-                                 static_cast<OGRwkbGeometryType>(eGType)) &&
-                             poDstGeometry->hasCurveGeometry(TRUE))
+        if (!psInfo->m_oMapResolved.empty())
+        {
+            for (const auto &kv : psInfo->m_oMapResolved)
+            {
+                const int nDstField = kv.first;
+                const int nSrcField = kv.second.nSrcField;
+                if (poFeature->IsFieldSetAndNotNull(nSrcField))
+                {
+                    const auto poDomain = kv.second.poDomain;
+                    const auto &oMapKV = psInfo->m_oMapDomainToKV[poDomain];
+                    const auto iter =
+                        oMapKV.find(poFeature->GetFieldAsString(nSrcField));
+                    if (iter != oMapKV.end())
                     {
-                        poDstGeometry = OGRGeometryFactory::forceTo(
-                            std::move(poDstGeometry),
-                            static_cast<OGRwkbGeometryType>(eGType));
+                        poDstFeature->SetField(nDstField, iter->second.c_str());
                     }
+                }
+            }
+        }
 
-                    // Collect left-most, right-most, top-most, bottom-most coordinates.
-                    if (psInfo->m_aoReprojectionInfo[iGeom]
-                            .m_bWarnAboutDifferentCoordinateOperations)
-                    {
-                        struct Visitor : public OGRDefaultConstGeometryVisitor
-                        {
-                            TargetLayerInfo::ReprojectionInfo &m_info;
+        if (nDesiredFID != OGRNullFID)
+            poDstFeature->SetFID(nDesiredFID);
+    }
 
-                            explicit Visitor(
-                                TargetLayerInfo::ReprojectionInfo &info)
-                                : m_info(info)
-                            {
-                            }
+    if (psOptions->bEmptyStrAsNull)
+    {
+        for (int i = 0; i < poDstFeature->GetFieldCount(); i++)
+        {
+            if (!poDstFeature->IsFieldSetAndNotNull(i))
+                continue;
+            auto fieldDef = poDstFeature->GetFieldDefnRef(i);
+            if (fieldDef->GetType() != OGRFieldType::OFTString)
+                continue;
+            auto str = poDstFeature->GetFieldAsString(i);
+            if (strcmp(str, "") == 0)
+                poDstFeature->SetFieldNull(i);
+        }
+    }
 
-                            using OGRDefaultConstGeometryVisitor::visit;
+    if (!psInfo->m_anDateTimeFieldIdx.empty())
+    {
+        for (int i : psInfo->m_anDateTimeFieldIdx)
+        {
+            if (!poDstFeature->IsFieldSetAndNotNull(i))
+                continue;
+            auto psField = poDstFeature->GetRawFieldRef(i);
+            if (psField->Date.TZFlag == 0 || psField->Date.TZFlag == 1)
+                continue;
 
-                            void visit(const OGRPoint *point) override
-                            {
-                                m_info.UpdateExtremePoints(point->getX(),
-                                                           point->getY(),
-                                                           point->getZ());
-                            }
-                        };
+            const int nTZOffsetInSec = (psField->Date.TZFlag - 100) * 15 * 60;
+            if (nTZOffsetInSec == psOptions->nTZOffsetInSec)
+                continue;
 
-                        Visitor oVisit(psInfo->m_aoReprojectionInfo[iGeom]);
-                        poDstGeometry->accept(&oVisit);
-                    }
+            struct tm brokendowntime;
+            memset(&brokendowntime, 0, sizeof(brokendowntime));
+            brokendowntime.tm_year = psField->Date.Year - 1900;
+            brokendowntime.tm_mon = psField->Date.Month - 1;
+            brokendowntime.tm_mday = psField->Date.Day;
+            GIntBig nUnixTime = CPLYMDHMSToUnixTime(&brokendowntime);
+            int nSec = psField->Date.Hour * 3600 + psField->Date.Minute * 60 +
+                       static_cast<int>(psField->Date.Second);
+            nSec += psOptions->nTZOffsetInSec - nTZOffsetInSec;
+            nUnixTime += nSec;
+            CPLUnixTimeToYMDHMS(nUnixTime, &brokendowntime);
 
-                    for (int iIter = 0; iIter < 2; ++iIter)
-                    {
-                        auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
-                            OGRGeometryFactory::transformWithOptions(
-                                poDstGeometry.get(), poCT,
-                                papszTransformOptions,
-                                m_transformWithOptionsCache));
-                        if (poReprojectedGeom == nullptr)
-                        {
-                            if (psOptions->nGroupTransactions)
-                            {
-                                if (psOptions->nLayerTransaction)
-                                {
-                                    if (poDstLayer->CommitTransaction() !=
-                                            OGRERR_NONE &&
-                                        !psOptions->bSkipFailures)
-                                    {
-                                        return false;
-                                    }
-                                }
-                            }
+            psField->Date.Year =
+                static_cast<GInt16>(brokendowntime.tm_year + 1900);
+            psField->Date.Month = static_cast<GByte>(brokendowntime.tm_mon + 1);
+            psField->Date.Day = static_cast<GByte>(brokendowntime.tm_mday);
+            psField->Date.Hour = static_cast<GByte>(brokendowntime.tm_hour);
+            psField->Date.Minute = static_cast<GByte>(brokendowntime.tm_min);
+            psField->Date.Second = static_cast<float>(
+                brokendowntime.tm_sec + fmod(psField->Date.Second, 1));
+            psField->Date.TZFlag = static_cast<GByte>(
+                100 + psOptions->nTZOffsetInSec / (15 * 60));
+        }
+    }
 
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Failed to reproject feature " CPL_FRMT_GIB
-                                     " (geometry probably out of source or "
-                                     "destination SRS).",
-                                     nSrcFID);
-                            if (!psOptions->bSkipFailures)
-                            {
-                                return false;
-                            }
-                        }
+    /* Erase native data if asked explicitly */
+    if (!m_bNativeData)
+    {
+        poDstFeature->SetNativeData(nullptr);
+        poDstFeature->SetNativeMediaType(nullptr);
+    }
 
-                        // Check if a curve geometry is no longer valid after
-                        // reprojection
-                        const auto eType = poDstGeometry->getGeometryType();
-                        const auto eFlatType = wkbFlatten(eType);
-
-                        std::string osReason;
-                        if (iIter == 0 && bReprojCanInvalidateValidity &&
-                            OGRGeometryFactory::haveGEOS() &&
-                            (eFlatType == wkbCurvePolygon ||
-                             eFlatType == wkbCompoundCurve ||
-                             eFlatType == wkbMultiCurve ||
-                             eFlatType == wkbMultiSurface) &&
-                            poDstGeometry->hasCurveGeometry(TRUE) &&
-                            poDstGeometry->IsValid(&osReason))
-                        {
-                            OGRwkbGeometryType eTargetType = OGR_GT_GetLinear(
-                                poDstGeometry->getGeometryType());
-                            auto poDstGeometryTmp = OGRGeometryFactory::forceTo(
-                                std::unique_ptr<OGRGeometry>(
-                                    poReprojectedGeom->clone()),
-                                eTargetType);
-                            if (!poDstGeometryTmp->IsValid(&osReason))
-                            {
-                                CPLDebug("OGR2OGR",
-                                         "Curve geometry no longer valid (%s) "
-                                         "after reprojection: transforming it "
-                                         "into linear one before reprojecting",
-                                         osReason.c_str());
-                                poDstGeometry = OGRGeometryFactory::forceTo(
-                                    std::move(poDstGeometry), eTargetType);
-                                poDstGeometry = OGRGeometryFactory::forceTo(
-                                    std::move(poDstGeometry), eType);
-                            }
-                            else
-                            {
-                                poDstGeometry = std::move(poReprojectedGeom);
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            poDstGeometry = std::move(poReprojectedGeom);
-                            break;
-                        }
-                    }
-                }
-                else if (poOutputSRS != nullptr)
+    return FeatureStatus::OK;
+}
+
+/************************************************************************/
+/*                LayerTranslator::TransformGeometries()                */
+/************************************************************************/
+
+/** Apply the requested geometry operations (reprojection, clipping,
+ * validation, etc.) to the geometries of poDstFeature.
+ *
+ * This may be called concurrently from several threads, provided that each
+ * thread uses its own oState, and its own clones of the coordinate
+ * transformations in aoReprojectionInfo.
+ *
+ * @return FeatureStatus::SKIP if the feature must not be written, or
+ * FeatureStatus::FAILURE if a geometry could not be reprojected.
+ */
+LayerTranslator::FeatureStatus LayerTranslator::TransformGeometries(
+    TargetLayerInfo *psInfo,
+    std::vector<TargetLayerInfo::ReprojectionInfo> &aoReprojectionInfo,
+    GeomStageState &oState, OGRFeature *poDstFeature,
+    const OGRFeature *poSrcFeature, GIntBig nSrcFID,
+    const GeomStageParams &oParams, const GDALVectorTranslateOptions *psOptions)
+{
+    const int eGType = m_eGType;
+    const int iSrcZField = psInfo->m_iSrcZField;
+    // Not psInfo->m_poDstLayer->GetLayerDefn(), as the layer may be in use
+    // by the calling thread.
+    const auto poDstFDefn = poDstFeature->GetDefnRef();
+    const int nDstGeomFieldCount = poDstFDefn->GetGeomFieldCount();
+    bool bReprojectionFailed = false;
+
+    for (int iGeom = 0; iGeom < nDstGeomFieldCount; iGeom++)
+    {
+        std::unique_ptr<OGRGeometry> poDstGeometry;
+
+        size_t nWKBSize = 0;
+        if (oParams.bKeepWKBGeoms && !aoReprojectionInfo[iGeom].m_poCT &&
+            aoReprojectionInfo[iGeom].m_aosTransformOptions.empty() &&
+            poDstFeature->GetGeomFieldWKB(iGeom, nWKBSize))
+        {
+            continue;
+        }
+        poDstGeometry.reset(poDstFeature->StealGeometry(iGeom));
+        if (poDstGeometry == nullptr)
+            continue;
+
+        if (iSrcZField != -1 && poSrcFeature != nullptr)
+        {
+            SetZ(poDstGeometry.get(),
+                 poSrcFeature->GetFieldAsDouble(iSrcZField));
+            /* This will correct the coordinate dimension to 3 */
+            poDstGeometry.reset(poDstGeometry->clone());
+        }
+
+        if (m_nCoordDim == 2 || m_nCoordDim == 3)
+        {
+            poDstGeometry->setCoordinateDimension(m_nCoordDim);
+        }
+        else if (m_nCoordDim == 4)
+        {
+            poDstGeometry->set3D(TRUE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_XYM)
+        {
+            poDstGeometry->set3D(FALSE);
+            poDstGeometry->setMeasured(TRUE);
+        }
+        else if (m_nCoordDim == COORD_DIM_LAYER_DIM)
+        {
+            const OGRwkbGeometryType eDstLayerGeomType =
+                poDstFDefn->GetGeomFieldDefn(iGeom)->GetType();
+            poDstGeometry->set3D(wkbHasZ(eDstLayerGeomType));
+            poDstGeometry->setMeasured(wkbHasM(eDstLayerGeomType));
+        }
+
+        if (m_eGeomOp == GEOMOP_SEGMENTIZE)
+        {
+            if (m_dfGeomOpParam > 0)
+                poDstGeometry->segmentize(m_dfGeomOpParam);
+        }
+        else if (m_eGeomOp == GEOMOP_SIMPLIFY_PRESERVE_TOPOLOGY)
+        {
+            if (m_dfGeomOpParam > 0)
+            {
+                auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                    poDstGeometry->SimplifyPreserveTopology(m_dfGeomOpParam));
+                if (poNewGeom)
                 {
-                    poDstGeometry->assignSpatialReference(poOutputSRS);
+                    poDstGeometry = std::move(poNewGeom);
                 }
+            }
+        }
+
+        if (m_poClipSrcOri)
+        {
+            if (poDstGeometry->IsEmpty())
+                return FeatureStatus::SKIP;
+
+            const auto clipGeomDesc =
+                GetSrcClipGeom(poDstGeometry->getSpatialReference(),
+                               oState.m_oClipSrc);
 
-                if (poDstGeometry != nullptr)
+            if (!(clipGeomDesc.poGeom && clipGeomDesc.poEnv))
+                return FeatureStatus::SKIP;
+
+            OGREnvelope oDstEnv;
+            poDstGeometry->getEnvelope(&oDstEnv);
+
+            if (!(clipGeomDesc.bGeomIsRectangle &&
+                  clipGeomDesc.poEnv->Contains(oDstEnv)))
+            {
+                std::unique_ptr<OGRGeometry> poClipped;
+                if (clipGeomDesc.poEnv->Intersects(oDstEnv))
                 {
-                    if (m_poClipDstOri)
-                    {
-                        if (poDstGeometry->IsEmpty())
-                            goto end_loop;
+                    poClipped.reset(clipGeomDesc.poGeom->Intersection(
+                        poDstGeometry.get()));
+                }
+                if (poClipped == nullptr || poClipped->IsEmpty())
+                {
+                    return FeatureStatus::SKIP;
+                }
 
-                        const auto clipGeomDesc = GetDstClipGeom(
-                            poDstGeometry->getSpatialReference());
-                        if (!clipGeomDesc.poGeom || !clipGeomDesc.poEnv)
-                        {
-                            goto end_loop;
-                        }
+                const int nDim = poDstGeometry->getDimension();
+                if (poClipped->getDimension() < nDim &&
+                    wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
+                                   ->GetType()) != wkbUnknown)
+                {
+                    CPLDebug(
+                        "OGR2OGR",
+                        "Discarding feature " CPL_FRMT_GIB
+                        " of layer %s, "
+                        "as its intersection with -clipsrc is a %s "
+                        "whereas the input is a %s",
+                        nSrcFID, oParams.osSrcLayerName.c_str(),
+                        OGRToOGCGeomType(poClipped->getGeometryType()),
+                        OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                    return FeatureStatus::SKIP;
+                }
 
-                        OGREnvelope oDstEnv;
-                        poDstGeometry->getEnvelope(&oDstEnv);
+                poDstGeometry = OGRGeometryFactory::makeCompatibleWith(
+                    std::move(poClipped),
+                    poDstFDefn->GetGeomFieldDefn(iGeom)->GetType());
+            }
+        }
 
-                        if (!(clipGeomDesc.bGeomIsRectangle &&
-                              clipGeomDesc.poEnv->Contains(oDstEnv)))
-                        {
-                            std::unique_ptr<OGRGeometry> poClipped;
-                            if (clipGeomDesc.poEnv->Intersects(oDstEnv))
-                            {
-                                poClipped.reset(
-                                    clipGeomDesc.poGeom->Intersection(
-                                        poDstGeometry.get()));
-                            }
+        OGRCoordinateTransformation *const poCT =
+            aoReprojectionInfo[iGeom].m_poCT.get();
+        char **const papszTransformOptions =
+            aoReprojectionInfo[iGeom].m_aosTransformOptions.List();
+        const bool bReprojCanInvalidateValidity =
+            aoReprojectionInfo[iGeom].m_bCanInvalidateValidity;
 
-                            if (poClipped == nullptr || poClipped->IsEmpty())
-                            {
-                                goto end_loop;
-                            }
+        if (poCT != nullptr || papszTransformOptions != nullptr)
+        {
+            // If we need to change the geometry type to linear, and
+            // we have a geometry with curves, then convert it to
+            // linear first, to avoid invalidities due to the fact
+            // that validity of arc portions isn't always kept while
+            // reprojecting and then discretizing.
+            if (bReprojCanInvalidateValidity &&
+                (!psInfo->m_bSupportCurves ||
+                 m_eGeomTypeConversion == GTC_CONVERT_TO_LINEAR ||
+                 m_eGeomTypeConversion ==
+                     GTC_PROMOTE_TO_MULTI_AND_CONVERT_TO_LINEAR))
+            {
+                if (poDstGeometry->hasCurveGeometry(TRUE))
+                {
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    poDstGeometry = OGRGeometryFactory::forceTo(
+                        std::move(poDstGeometry), eTargetType);
+                }
+            }
+            else if (bReprojCanInvalidateValidity &&
+                     eGType != GEOMTYPE_UNCHANGED &&
+                     !OGR_GT_IsNonLinear(
+                         static_cast<OGRwkbGeometryType>(eGType)) &&
+                     poDstGeometry->hasCurveGeometry(TRUE))
+            {
+                poDstGeometry = OGRGeometryFactory::forceTo(
+                    std::move(poDstGeometry),
+                    static_cast<OGRwkbGeometryType>(eGType));
+            }
 
-                            const int nDim = poDstGeometry->getDimension();
-                            if (poClipped->getDimension() < nDim &&
-                                wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
-                                               ->GetType()) != wkbUnknown)
-                            {
-                                CPLDebug(
-                                    "OGR2OGR",
-                                    "Discarding feature " CPL_FRMT_GIB
-                                    " of layer %s, "
-                                    "as its intersection with -clipdst is a %s "
-                                    "whereas the input is a %s",
-                                    nSrcFID, poSrcLayer->GetName(),
-                                    OGRToOGCGeomType(
-                                        poClipped->getGeometryType()),
-                                    OGRToOGCGeomType(
-                                        poDstGeometry->getGeometryType()));
-                                goto end_loop;
-                            }
+            // Collect left-most, right-most, top-most, bottom-most coordinates.
+            if (aoReprojectionInfo[iGeom]
+                    .m_bWarnAboutDifferentCoordinateOperations)
+            {
+                struct Visitor : public OGRDefaultConstGeometryVisitor
+                {
+                    TargetLayerInfo::ReprojectionInfo &m_info;
 
-                            poDstGeometry =
-                                OGRGeometryFactory::makeCompatibleWith(
-                                    std::move(poClipped),
-                                    poDstFDefn->GetGeomFieldDefn(iGeom)
-                                        ->GetType());
-                        }
+                    explicit Visitor(TargetLayerInfo::ReprojectionInfo &info)
+                        : m_info(info)
+                    {
                     }
 
-                    if (psOptions->dfXYRes !=
-                            OGRGeomCoordinatePrecision::UNKNOWN &&
-                        OGRGeometryFactory::haveGEOS() &&
-                        !poDstGeometry->hasCurveGeometry())
+                    using OGRDefaultConstGeometryVisitor::visit;
+
+                    void visit(const OGRPoint *point) override
                     {
-                        // OGR_APPLY_GEOM_SET_PRECISION default value for
-                        // OGRLayer::CreateFeature() purposes, but here in the
-                        // ogr2ogr -xyRes context, we force calling SetPrecision(),
-                        // unless the user explicitly asks not to do it by
-                        // setting the config option to NO.
-                        if (!bRunSetPrecisionEvaluated)
-                        {
-                            bRunSetPrecisionEvaluated = true;
-                            bRunSetPrecision = CPLTestBool(CPLGetConfigOption(
-                                "OGR_APPLY_GEOM_SET_PRECISION", "YES"));
-                        }
-                        if (bRunSetPrecision)
-                        {
-                            auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                                poDstGeometry->SetPrecision(psOptions->dfXYRes,
-                                                            /* nFlags = */ 0));
-                            if (!poNewGeom)
-                                goto end_loop;
-                            poDstGeometry = std::move(poNewGeom);
-                        }
+                        m_info.UpdateExtremePoints(point->getX(), point->getY(),
+                                                   point->getZ());
                     }
+                };
+
+                Visitor oVisit(aoReprojectionInfo[iGeom]);
+                poDstGeometry->accept(&oVisit);
+            }
 
-                    if (m_bMakeValid)
+            for (int iIter = 0; iIter < 2; ++iIter)
+            {
+                auto poReprojectedGeom = std::unique_ptr<OGRGeometry>(
+                    OGRGeometryFactory::transformWithOptions(
+                        poDstGeometry.get(), poCT, papszTransformOptions,
+                        oState.m_oTransformCache));
+                if (poReprojectedGeom == nullptr)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined,
+                             "Failed to reproject feature " CPL_FRMT_GIB
+                             " (geometry probably out of source or "
+                             "destination SRS).",
+                             nSrcFID);
+                    if (!psOptions->bSkipFailures)
                     {
-                        const bool bIsGeomCollection =
-                            wkbFlatten(poDstGeometry->getGeometryType()) ==
-                            wkbGeometryCollection;
-                        auto poNewGeom = std::unique_ptr<OGRGeometry>(
-                            poDstGeometry->MakeValid());
-                        if (!poNewGeom)
-                            goto end_loop;
-                        poDstGeometry = std::move(poNewGeom);
-                        if (!bIsGeomCollection)
-                        {
-                            poDstGeometry.reset(
-                                OGRGeometryFactory::
-                                    removeLowerDimensionSubGeoms(
-                                        poDstGeometry.get()));
-                        }
+                        return FeatureStatus::FAILURE;
                     }
+                    bReprojectionFailed = true;
+                }
 
-                    if (m_bSkipInvalidGeom && !poDstGeometry->IsValid())
-                        goto end_loop;
+                // Check if a curve geometry is no longer valid after
+                // reprojection
+                const auto eType = poDstGeometry->getGeometryType();
+                const auto eFlatType = wkbFlatten(eType);
 
-                    if (m_eGeomTypeConversion != GTC_DEFAULT)
+                std::string osReason;
+                if (iIter == 0 && bReprojCanInvalidateValidity &&
+                    OGRGeometryFactory::haveGEOS() &&
+                    (eFlatType == wkbCurvePolygon ||
+                     eFlatType == wkbCompoundCurve ||
+                     eFlatType == wkbMultiCurve ||
+                     eFlatType == wkbMultiSurface) &&
+                    poDstGeometry->hasCurveGeometry(TRUE) &&
+                    poDstGeometry->IsValid(&osReason))
+                {
+                    OGRwkbGeometryType eTargetType =
+                        OGR_GT_GetLinear(poDstGeometry->getGeometryType());
+                    auto poDstGeometryTmp = OGRGeometryFactory::forceTo(
+                        std::unique_ptr<OGRGeometry>(
+                            poReprojectedGeom->clone()),
+                        eTargetType);
+                    if (!poDstGeometryTmp->IsValid(&osReason))
                     {
-                        OGRwkbGeometryType eTargetType =
-                            poDstGeometry->getGeometryType();
-                        eTargetType =
-                            ConvertType(m_eGeomTypeConversion, eTargetType);
+                        CPLDebug("OGR2OGR",
+                                 "Curve geometry no longer valid (%s) "
+                                 "after reprojection: transforming it "
+                                 "into linear one before reprojecting",
+                                 osReason.c_str());
                         poDstGeometry = OGRGeometryFactory::forceTo(
                             std::move(poDstGeometry), eTargetType);
+                        poDstGeometry = OGRGeometryFactory::forceTo(
+                            std::move(poDstGeometry), eType);
                     }
-                    else if (eGType != GEOMTYPE_UNCHANGED)
+                    else
                     {
-                        poDstGeometry = OGRGeometryFactory::forceTo(
-                            std::move(poDstGeometry),
-                            static_cast<OGRwkbGeometryType>(eGType));
+                        poDstGeometry = std::move(poReprojectedGeom);
+                        break;
                     }
                 }
+                else
+                {
+                    poDstGeometry = std::move(poReprojectedGeom);
+                    break;
+                }
+            }
+        }
+        else if (oParams.poOutputSRS != nullptr)
+        {
+            poDstGeometry->assignSpatialReference(oParams.poOutputSRS);
+        }
+
+        if (poDstGeometry != nullptr)
+        {
+            if (m_poClipDstOri)
+            {
+                if (poDstGeometry->IsEmpty())
+                    return FeatureStatus::SKIP;
+
+                const auto clipGeomDesc =
+                    GetDstClipGeom(poDstGeometry->getSpatialReference(),
+                                   oState.m_oClipDst);
+                if (!clipGeomDesc.poGeom || !clipGeomDesc.poEnv)
+                {
+                    return FeatureStatus::SKIP;
+                }
+
+                OGREnvelope oDstEnv;
+                poDstGeometry->getEnvelope(&oDstEnv);
 
-                if (poDstGeometry && !psOptions->bQuiet)
+                if (!(clipGeomDesc.bGeomIsRectangle &&
+                      clipGeomDesc.poEnv->Contains(oDstEnv)))
                 {
-                    if (!psInfo->m_bHasWarnedAboutCurves &&
-                        !psInfo->m_bSupportCurves &&
-                        OGR_GT_IsNonLinear(poDstGeometry->getGeometryType()))
+                    std::unique_ptr<OGRGeometry> poClipped;
+                    if (clipGeomDesc.poEnv->Intersects(oDstEnv))
                     {
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Attempt to write curve geometries to layer "
-                                 "%s that does not support them. They will be "
-                                 "linearized",
-                                 poDstLayer->GetDescription());
-                        psInfo->m_bHasWarnedAboutCurves = true;
+                        poClipped.reset(clipGeomDesc.poGeom->Intersection(
+                            poDstGeometry.get()));
                     }
-                    if (!psInfo->m_bHasWarnedAboutZ && !psInfo->m_bSupportZ &&
-                        OGR_GT_HasZ(poDstGeometry->getGeometryType()))
+
+                    if (poClipped == nullptr || poClipped->IsEmpty())
                     {
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Attempt to write Z geometries to layer %s "
-                                 "that does not support them. Z component will "
-                                 "be discarded",
-                                 poDstLayer->GetDescription());
-                        psInfo->m_bHasWarnedAboutZ = true;
+                        return FeatureStatus::SKIP;
                     }
-                    if (!psInfo->m_bHasWarnedAboutM && !psInfo->m_bSupportM &&
-                        OGR_GT_HasM(poDstGeometry->getGeometryType()))
+
+                    const int nDim = poDstGeometry->getDimension();
+                    if (poClipped->getDimension() < nDim &&
+                        wkbFlatten(poDstFDefn->GetGeomFieldDefn(iGeom)
+                                       ->GetType()) != wkbUnknown)
                     {
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Attempt to write M geometries to layer %s "
-                                 "that does not support them. M component will "
-                                 "be discarded",
-                                 poDstLayer->GetDescription());
-                        psInfo->m_bHasWarnedAboutM = true;
+                        CPLDebug(
+                            "OGR2OGR",
+                            "Discarding feature " CPL_FRMT_GIB
+                            " of layer %s, "
+                            "as its intersection with -clipdst is a %s "
+                            "whereas the input is a %s",
+                            nSrcFID, oParams.osSrcLayerName.c_str(),
+                            OGRToOGCGeomType(poClipped->getGeometryType()),
+                            OGRToOGCGeomType(poDstGeometry->getGeometryType()));
+                        return FeatureStatus::SKIP;
                     }
-                }
 
-                poDstFeature->SetGeomField(iGeom, std::move(poDstGeometry));
+                    poDstGeometry = OGRGeometryFactory::makeCompatibleWith(
+                        std::move(poClipped),
+                        poDstFDefn->GetGeomFieldDefn(iGeom)->GetType());
+                }
             }
 
-            CPLErrorReset();
-            if ((psOptions->bUpsert
-                     ? poDstLayer->UpsertFeature(poDstFeature.get())
-                     : poDstLayer->CreateFeature(poDstFeature.get())) ==
-                OGRERR_NONE)
+            if (psOptions->dfXYRes != OGRGeomCoordinatePrecision::UNKNOWN &&
+                OGRGeometryFactory::haveGEOS() &&
+                !poDstGeometry->hasCurveGeometry())
             {
-                nFeaturesWritten++;
-                if (nDesiredFID != OGRNullFID &&
-                    poDstFeature->GetFID() != nDesiredFID)
+                if (oParams.bRunSetPrecision)
                 {
-                    CPLError(CE_Warning, CPLE_AppDefined,
-                             "Feature id " CPL_FRMT_GIB " not preserved",
-                             nDesiredFID);
+                    auto poNewGeom = std::unique_ptr<OGRGeometry>(
+                        poDstGeometry->SetPrecision(psOptions->dfXYRes,
+                                                    /* nFlags = */ 0));
+                    if (!poNewGeom)
+                        return FeatureStatus::SKIP;
+                    poDstGeometry = std::move(poNewGeom);
                 }
             }
-            else if (!psOptions->bSkipFailures)
+
+            if (m_bMakeValid)
             {
-                if (psOptions->nGroupTransactions)
+                const bool bIsGeomCollection =
+                    wkbFlatten(poDstGeometry->getGeometryType()) ==
+                    wkbGeometryCollection;
+                auto poNewGeom =
+                    std::unique_ptr<OGRGeometry>(poDstGeometry->MakeValid());
+                if (!poNewGeom)
+                    return FeatureStatus::SKIP;
+                poDstGeometry = std::move(poNewGeom);
+                if (!bIsGeomCollection)
                 {
-                    if (psOptions->nLayerTransaction)
-                        poDstLayer->RollbackTransaction();
+                    poDstGeometry.reset(
+                        OGRGeometryFactory::removeLowerDimensionSubGeoms(
+                            poDstGeometry.get()));
                 }
+            }
 
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " from layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
+            if (m_bSkipInvalidGeom && !poDstGeometry->IsValid())
+                return FeatureStatus::SKIP;
 
-                return false;
+            if (m_eGeomTypeConversion != GTC_DEFAULT)
+            {
+                OGRwkbGeometryType eTargetType =
+                    poDstGeometry->getGeometryType();
+                eTargetType = ConvertType(m_eGeomTypeConversion, eTargetType);
+                poDstGeometry = OGRGeometryFactory::forceTo(
+                    std::move(poDstGeometry), eTargetType);
             }
-            else
+            else if (eGType != GEOMTYPE_UNCHANGED)
             {
-                CPLDebug("GDALVectorTranslate",
-                         "Unable to write feature " CPL_FRMT_GIB
-                         " into layer %s.",
-                         nSrcFID, poSrcLayer->GetName());
-                if (psOptions->nGroupTransactions)
-                {
-                    if (psOptions->nLayerTransaction)
-                    {
-                        poDstLayer->RollbackTransaction();
-                        CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
-                    }
-                    else
-                    {
-                        m_poODS->RollbackTransaction();
-                        m_poODS->StartTransaction(psOptions->bForceTransaction);
-                    }
-                }
+                poDstGeometry = OGRGeometryFactory::forceTo(
+                    std::move(poDstGeometry),
+                    static_cast<OGRwkbGeometryType>(eGType));
             }
+        }
+        poDstFeature->SetGeomField(iGeom, std::move(poDstGeometry));
+    }
+
+    return bReprojectionFailed ? FeatureStatus::FAILURE : FeatureStatus::OK;
+}
+
+/************************************************************************/
+/*                   WarnAboutUnsupportedGeometries()                   */
+/************************************************************************/
 
-        end_loop:;  // nothing
+static void WarnAboutUnsupportedGeometries(TargetLayerInfo *psInfo,
+                                           const OGRFeature *poDstFeature)
+{
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    for (int iGeom = 0; iGeom < poDstFeature->GetGeomFieldCount(); iGeom++)
+    {
+        // Geometries kept in their WKB representation have been checked
+        // to need no warning.
+        size_t nWKBSize = 0;
+        if (poDstFeature->GetGeomFieldWKB(iGeom, nWKBSize))
+            continue;
+        const OGRGeometry *poGeom = poDstFeature->GetGeomFieldRef(iGeom);
+        if (!poGeom)
+            continue;
+        if (!psInfo->m_bHasWarnedAboutCurves && !psInfo->m_bSupportCurves &&
+            OGR_GT_IsNonLinear(poGeom->getGeometryType()))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Attempt to write curve geometries to layer "
+                     "%s that does not support them. They will be "
+                     "linearized",
+                     poDstLayer->GetDescription());
+            psInfo->m_bHasWarnedAboutCurves = true;
+        }
+        if (!psInfo->m_bHasWarnedAboutZ && !psInfo->m_bSupportZ &&
+            OGR_GT_HasZ(poGeom->getGeometryType()))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Attempt to write Z geometries to layer %s "
+                     "that does not support them. Z component will "
+                     "be discarded",
+                     poDstLayer->GetDescription());
+            psInfo->m_bHasWarnedAboutZ = true;
+        }
+        if (!psInfo->m_bHasWarnedAboutM && !psInfo->m_bSupportM &&
+            OGR_GT_HasM(poGeom->getGeometryType()))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Attempt to write M geometries to layer %s "
+                     "that does not support them. M component will "
+                     "be discarded",
+                     poDstLayer->GetDescription());
+            psInfo->m_bHasWarnedAboutM = true;
         }
+    }
+}
 
-        /* Report progress */
-        nCount++;
-        bool bGoOn = true;
-        if (pfnProgress)
+/************************************************************************/
+/*                   LayerTranslator::WriteFeature()                    */
+/************************************************************************/
+
+/** Write poDstFeature into the target layer.
+ *
+ * @return false if the translation must be stopped.
+ */
+bool LayerTranslator::WriteFeature(TargetLayerInfo *psInfo,
+                                   OGRFeature *poDstFeature, GIntBig nSrcFID,
+                                   GIntBig nDesiredFID,
+                                   TranslateCounters &oCounters,
+                                   const GDALVectorTranslateOptions *psOptions)
+{
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+
+    if (!psOptions->bQuiet)
+        WarnAboutUnsupportedGeometries(psInfo, poDstFeature);
+
+    CPLErrorReset();
+    if ((psOptions->bUpsert ? poDstLayer->UpsertFeature(poDstFeature)
+                            : poDstLayer->CreateFeature(poDstFeature)) ==
+        OGRERR_NONE)
+    {
+        oCounters.nFeaturesWritten++;
+        if (nDesiredFID != OGRNullFID && poDstFeature->GetFID() != nDesiredFID)
         {
-            bGoOn = pfnProgress(nCountLayerFeatures
-                                    ? nCount * 1.0 / nCountLayerFeatures
-                                    : 1.0,
-                                "", pProgressArg) != FALSE;
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Feature id " CPL_FRMT_GIB " not preserved",
+                     nDesiredFID);
         }
-        if (!bGoOn)
+    }
+    else if (!psOptions->bSkipFailures)
+    {
+        if (psOptions->nGroupTransactions)
         {
-            bRet = false;
-            break;
+            if (psOptions->nLayerTransaction)
+                poDstLayer->RollbackTransaction();
         }
 
-        if (pnReadFeatureCount)
-            *pnReadFeatureCount = nCount;
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Unable to write feature " CPL_FRMT_GIB " from layer %s.",
+                 nSrcFID, psInfo->m_poSrcLayer->GetName());
 
-        if (psOptions->nFIDToFetch != OGRNullFID)
-            break;
-        if (bSingleIteration)
-            break;
+        return false;
     }
+    else
+    {
+        CPLDebug("GDALVectorTranslate",
+                 "Unable to write feature " CPL_FRMT_GIB " into layer %s.",
+                 nSrcFID, psInfo->m_poSrcLayer->GetName());
+        if (psOptions->nGroupTransactions)
+        {
+            if (psOptions->nLayerTransaction)
+            {
+                poDstLayer->RollbackTransaction();
+                CPL_IGNORE_RET_VAL(poDstLayer->StartTransaction());
+            }
+            else
+            {
+                m_poODS->RollbackTransaction();
+                m_poODS->StartTransaction(psOptions->bForceTransaction);
+            }
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                LayerTranslator::AdvanceTransaction()                 */
+/************************************************************************/
 
+/** Account for a new feature to be written, and commit the current
+ * transaction and start a new one when -gt features have been written.
+ *
+ * @return false in case of error.
+ */
+bool LayerTranslator::AdvanceTransaction(
+    TargetLayerInfo *psInfo, TranslateCounters &oCounters,
+    GIntBig &nTotalEventsDone, const GDALVectorTranslateOptions *psOptions)
+{
+    OGRLayer *poDstLayer = psInfo->m_poDstLayer;
+    if (psOptions->nLayerTransaction &&
+        ++oCounters.nFeaturesInTransaction == psOptions->nGroupTransactions)
+    {
+        if (poDstLayer->CommitTransaction() == OGRERR_FAILURE ||
+            poDstLayer->StartTransaction() == OGRERR_FAILURE)
+        {
+            return false;
+        }
+        oCounters.nFeaturesInTransaction = 0;
+    }
+    else if (!psOptions->nLayerTransaction &&
+             psOptions->nGroupTransactions > 0 &&
+             ++nTotalEventsDone >= psOptions->nGroupTransactions)
+    {
+        if (m_poODS->CommitTransaction() == OGRERR_FAILURE ||
+            m_poODS->StartTransaction(psOptions->bForceTransaction) ==
+                OGRERR_FAILURE)
+        {
+            return false;
+        }
+        nTotalEventsDone = 0;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*               LayerTranslator::ReportPrepareFailure()                */
+/************************************************************************/
+
+/** Commit the current transaction and report that the fields of a feature
+ * could not be translated. */
+void LayerTranslator::ReportPrepareFailure(
+    TargetLayerInfo *psInfo, GIntBig nSrcFID,
+    const GDALVectorTranslateOptions *psOptions)
+{
     if (psOptions->nGroupTransactions)
     {
         if (psOptions->nLayerTransaction)
         {
-            if (poDstLayer->CommitTransaction() != OGRERR_NONE)
+            if (psInfo->m_poDstLayer->CommitTransaction() != OGRERR_NONE)
+            {
+                return;
+            }
+        }
+    }
+
+    CPLError(CE_Failure, CPLE_AppDefined,
+             "Unable to translate feature " CPL_FRMT_GIB " from layer %s.",
+             nSrcFID, psInfo->m_poSrcLayer->GetName());
+}
+
+/************************************************************************/
+/*             LayerTranslator::HandleReprojectionFailure()             */
+/************************************************************************/
+
+/** Commit the current transaction after a geometry could not be reprojected.
+ *
+ * @return false if the translation must be stopped.
+ */
+bool LayerTranslator::HandleReprojectionFailure(
+    TargetLayerInfo *psInfo, const GDALVectorTranslateOptions *psOptions)
+{
+    if (psOptions->nGroupTransactions)
+    {
+        if (psOptions->nLayerTransaction)
+        {
+            if (psInfo->m_poDstLayer->CommitTransaction() != OGRERR_NONE &&
+                !psOptions->bSkipFailures)
+            {
+                return false;
+            }
+        }
+    }
+    return psOptions->bSkipFailures;
+}
+
+/************************************************************************/
+/*              LayerTranslator::TranslateMultiThreaded()               */
+/************************************************************************/
+
+/** Translate the remaining features of the source layer with a pipeline
+ * where the geometry processing of a batch of features runs in worker
+ * threads, while the calling thread reads the next batch.
+ *
+ * Features are read and written by the calling thread, in their original
+ * order, as datasets cannot be accessed concurrently, and the source and
+ * target layers may belong to the same dataset.
+ *
+ * @return false in case of fatal error. bRet is set to false in case of
+ * read error or interruption.
+ */
+bool LayerTranslator::TranslateMultiThreaded(
+    TargetLayerInfo *psInfo, const GeomStageParams &oParams, int nThreads,
+    GIntBig nCountLayerFeatures, GIntBig *pnReadFeatureCount,
+    GIntBig &nTotalEventsDone, TranslateCounters &oCounters,
+    GDALProgressFunc pfnProgress, void *pProgressArg,
+    const GDALVectorTranslateOptions *psOptions, bool &bRet)
+{
+    OGRLayer *poSrcLayer = psInfo->m_poSrcLayer;
+    const auto poSrcFDefn = poSrcLayer->GetLayerDefn();
+    const auto poDstFDefn = psInfo->m_poDstLayer->GetLayerDefn();
+
+    // The clip geometry caches of worker threads are seeded from the ones of
+    // the calling thread, and for the target SRS of their coordinate
+    // transformations, so that worker threads do not have to compare
+    // spatial references, which is not thread-safe.
+    const auto NewState = [this]()
+    {
+        auto poState = std::make_unique<GeomStageState>();
+        for (int i = 0; i < 2; ++i)
+        {
+            const auto &oSrc = i == 0 ? m_oGeomStageState.m_oClipSrc
+                                      : m_oGeomStageState.m_oClipDst;
+            auto &oDst = i == 0 ? poState->m_oClipSrc : poState->m_oClipDst;
+            if (oSrc.m_poReprojected)
+                oDst.m_poReprojected.reset(oSrc.m_poReprojected->clone());
+            oDst.m_poSRS = oSrc.m_poSRS;
+            oDst.m_oEnv = oSrc.m_oEnv;
+            oDst.m_bIsRectangle = oSrc.m_bIsRectangle;
+        }
+        return poState;
+    };
+    const auto SeedDstClipGeomCache =
+        [this](const std::vector<TargetLayerInfo::ReprojectionInfo> &aoInfo,
+               GeomStageState &oState)
+    {
+        if (!m_poClipDstOri)
+            return;
+        for (const auto &oInfo : aoInfo)
+        {
+            if (oInfo.m_poCT)
+                GetDstClipGeom(oInfo.m_poCT->GetTargetCS(), oState.m_oClipDst);
+        }
+    };
+
+    // Each worker thread uses its own clone of the coordinate
+    // transformations, which are not thread-safe.
+    std::vector<std::unique_ptr<GeomStageState>> apoStates;
+    for (int iThread = 0; iThread < nThreads; ++iThread)
+    {
+        auto poState = NewState();
+        for (const auto &oInfo : psInfo->m_aoReprojectionInfo)
+        {
+            TargetLayerInfo::ReprojectionInfo oThreadInfo;
+            if (oInfo.m_poCT)
+            {
+                oThreadInfo.m_poCT.reset(oInfo.m_poCT->Clone());
+                if (!oThreadInfo.m_poCT)
+                    break;
+            }
+            oThreadInfo.m_aosTransformOptions = oInfo.m_aosTransformOptions;
+            oThreadInfo.m_bCanInvalidateValidity =
+                oInfo.m_bCanInvalidateValidity;
+            oThreadInfo.m_bWarnAboutDifferentCoordinateOperations =
+                oInfo.m_bWarnAboutDifferentCoordinateOperations;
+            poState->m_aoReprojectionInfo.push_back(std::move(oThreadInfo));
+        }
+        if (poState->m_aoReprojectionInfo.size() !=
+            psInfo->m_aoReprojectionInfo.size())
+        {
+            // A single worker thread can use the transformations of psInfo,
+            // which are not used by the calling thread meanwhile.
+            CPLDebug("GDALVectorTranslate",
+                     "Cannot clone coordinate transformation: using a single "
+                     "geometry processing thread");
+            apoStates.clear();
+            apoStates.push_back(NewState());
+            SeedDstClipGeomCache(psInfo->m_aoReprojectionInfo, *apoStates[0]);
+            break;
+        }
+        SeedDstClipGeomCache(poState->m_aoReprojectionInfo, *poState);
+        apoStates.push_back(std::move(poState));
+    }
+    nThreads = static_cast<int>(apoStates.size());
+
+    // Config option only/mostly for autotest purposes
+    const int nBatchSize = std::max(
+        1, atoi(CPLGetConfigOption("OGR2OGR_MT_BATCH_SIZE",
+                                   CPLSPrintf("%d", 256 * nThreads))));
+
+    std::vector<PendingFeature> aoBatches[2];
+    aoBatches[0].resize(nBatchSize);
+    aoBatches[1].resize(nBatchSize);
+
+    // Read features into aoBatch and prepare the fields of their target
+    // feature, and return the number of features read.
+    bool bEOF = false;
+    const auto ReadBatch = [this, psInfo, poSrcLayer, poSrcFDefn, poDstFDefn,
+                            &oParams, psOptions, &bEOF,
+                            &bRet](std::vector<PendingFeature> &aoBatch)
+    {
+        size_t nItems = 0;
+        while (!bEOF && nItems < aoBatch.size())
+        {
+            if (m_nLimit >= 0 && psInfo->m_nFeaturesRead >= m_nLimit)
+            {
+                bEOF = true;
+                break;
+            }
+
+            auto &oItem = aoBatch[nItems];
+            if (psInfo->m_bCanAvoidSetFrom && oItem.poDstFeature)
+            {
+                // Hand the previous feature back to the source layer so
+                // that it can recycle it.
+                oItem.poDstFeature->SetFDefnUnsafe(poSrcFDefn);
+                oItem.poSrcFeature = std::move(oItem.poDstFeature);
+            }
+            CPLErrorReset();
+            oItem.poSrcFeature = poSrcLayer->GetNextFeatureReusing(
+                std::move(oItem.poSrcFeature));
+            if (oItem.poSrcFeature == nullptr)
+            {
+                if (CPLGetLastErrorType() == CE_Failure)
+                {
+                    bRet = false;
+                }
+                bEOF = true;
+                break;
+            }
+
+            psInfo->m_nFeaturesRead++;
+
+            oItem.nSrcFID = oItem.poSrcFeature->GetFID();
+            oItem.nDesiredFID = OGRNullFID;
+            if (psInfo->m_bPreserveFID)
+                oItem.nDesiredFID = oItem.nSrcFID;
+            else if (psInfo->m_iSrcFIDField >= 0 &&
+                     oItem.poSrcFeature->IsFieldSetAndNotNull(
+                         psInfo->m_iSrcFIDField))
+                oItem.nDesiredFID = oItem.poSrcFeature->GetFieldAsInteger64(
+                    psInfo->m_iSrcFIDField);
+
+            if (!psInfo->m_bCanAvoidSetFrom && !oItem.poDstFeature)
+                oItem.poDstFeature = std::make_unique<OGRFeature>(poDstFDefn);
+
+            CPLErrorReset();
+            oItem.ePrepareStatus = PrepareDstFeature(
+                psInfo, oItem.poSrcFeature, oItem.poDstFeature,
+                oItem.nDesiredFID, oParams, psOptions);
+            oItem.eGeomStatus = FeatureStatus::OK;
+            ++nItems;
+
+            // Reported when the batch is written, after the features that
+            // precede it.
+            if (oItem.ePrepareStatus == FeatureStatus::FAILURE)
+                bEOF = true;
+        }
+        return nItems;
+    };
+
+    // Worker threads inherit the thread-local configuration options of
+    // the calling thread.
+    const CPLStringList aosTLConfigOptions(CPLGetThreadLocalConfigOptions());
+    const auto oGeomStageLambda =
+        [this, psInfo, &oParams, psOptions, &apoStates, &aosTLConfigOptions](
+            std::vector<PendingFeature> *paoBatch, size_t iStart, size_t iEnd,
+            int iThread, CPLErrorAccumulator *poErrorAccumulator)
+    {
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptions.List());
+        {
+            auto oAccumulatorContext =
+                poErrorAccumulator->InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulatorContext);
+
+            auto &oState = *(apoStates[iThread]);
+            auto &aoReprojectionInfo = oState.m_aoReprojectionInfo.empty()
+                                           ? psInfo->m_aoReprojectionInfo
+                                           : oState.m_aoReprojectionInfo;
+            for (size_t i = iStart; i < iEnd; ++i)
+            {
+                auto &oItem = (*paoBatch)[i];
+                if (oItem.ePrepareStatus != FeatureStatus::OK)
+                    continue;
+                oItem.eGeomStatus = TransformGeometries(
+                    psInfo, aoReprojectionInfo, oState,
+                    oItem.poDstFeature.get(), oItem.poSrcFeature.get(),
+                    oItem.nSrcFID, oParams, psOptions);
+                // Next features will not be written
+                if (oItem.eGeomStatus == FeatureStatus::FAILURE &&
+                    !psOptions->bSkipFailures)
+                    break;
+            }
+        }
+        CPLSetThreadLocalConfigOptions(nullptr);
+    };
+
+    int iCur = 0;
+    size_t nCurItems = ReadBatch(aoBatches[iCur]);
+    bool bStop = false;
+    while (nCurItems > 0 && !bStop)
+    {
+        auto &aoBatch = aoBatches[iCur];
+
+        const int nChunks = static_cast<int>(
+            std::min(static_cast<size_t>(nThreads), nCurItems));
+        std::vector<std::unique_ptr<CPLErrorAccumulator>> apoErrorAccumulators;
+        std::vector<std::future<void>> aoTasks;
+        for (int iChunk = 0; iChunk < nChunks; ++iChunk)
+        {
+            apoErrorAccumulators.push_back(
+                std::make_unique<CPLErrorAccumulator>());
+            aoTasks.emplace_back(std::async(
+                std::launch::async, oGeomStageLambda, &aoBatch,
+                iChunk * nCurItems / nChunks,
+                (iChunk + 1) * nCurItems / nChunks, iChunk,
+                apoErrorAccumulators.back().get()));
+        }
+
+        // Read the next batch while the current one is being processed
+        const size_t nNextItems = ReadBatch(aoBatches[1 - iCur]);
+
+        for (auto &oTask : aoTasks)
+        {
+            oTask.get();
+        }
+        for (auto &poErrorAccumulator : apoErrorAccumulators)
+        {
+            poErrorAccumulator->ReplayErrors();
+        }
+
+        for (size_t i = 0; i < nCurItems; ++i)
+        {
+            auto &oItem = aoBatch[i];
+            if (!AdvanceTransaction(psInfo, oCounters, nTotalEventsDone,
+                                    psOptions))
+            {
+                return false;
+            }
+
+            if (oItem.ePrepareStatus == FeatureStatus::FAILURE)
+            {
+                ReportPrepareFailure(psInfo, oItem.nSrcFID, psOptions);
+                return false;
+            }
+            if (oItem.ePrepareStatus == FeatureStatus::OK &&
+                oItem.eGeomStatus != FeatureStatus::SKIP)
+            {
+                if (oItem.eGeomStatus == FeatureStatus::FAILURE &&
+                    !HandleReprojectionFailure(psInfo, psOptions))
+                {
+                    return false;
+                }
+
+                if (!WriteFeature(psInfo, oItem.poDstFeature.get(),
+                                  oItem.nSrcFID, oItem.nDesiredFID, oCounters,
+                                  psOptions))
+                {
+                    return false;
+                }
+            }
+
+            /* Report progress */
+            oCounters.nCount++;
+            bool bGoOn = true;
+            if (pfnProgress)
+            {
+                bGoOn = pfnProgress(nCountLayerFeatures
+                                        ? oCounters.nCount * 1.0 /
+                                              nCountLayerFeatures
+                                        : 1.0,
+                                    "", pProgressArg) != FALSE;
+            }
+            if (!bGoOn)
+            {
                 bRet = false;
+                bStop = true;
+                break;
+            }
+
+            if (pnReadFeatureCount)
+                *pnReadFeatureCount = oCounters.nCount;
         }
+
+        iCur = 1 - iCur;
+        nCurItems = nNextItems;
     }
 
-    if (!bSingleIteration)
+    // Merge the extreme points collected by the worker threads, used by
+    // TargetLayerInfo::CheckSameCoordinateOperation()
+    for (const auto &poState : apoStates)
     {
-        CPLDebug("GDALVectorTranslate",
-                 CPL_FRMT_GIB " features written in layer '%s'",
-                 nFeaturesWritten, poDstLayer->GetName());
+        for (size_t i = 0; i < poState->m_aoReprojectionInfo.size(); ++i)
+        {
+            const auto &oThreadInfo = poState->m_aoReprojectionInfo[i];
+            if (oThreadInfo.m_dfLeftX > oThreadInfo.m_dfRightX)
+                continue;  // no point collected
+            auto &oInfo = psInfo->m_aoReprojectionInfo[i];
+            oInfo.UpdateExtremePoints(oThreadInfo.m_dfLeftX,
+                                      oThreadInfo.m_dfLeftY,
+                                      oThreadInfo.m_dfLeftZ);
+            oInfo.UpdateExtremePoints(oThreadInfo.m_dfRightX,
+                                      oThreadInfo.m_dfRightY,
+                                      oThreadInfo.m_dfRightZ);
+            oInfo.UpdateExtremePoints(oThreadInfo.m_dfBottomX,
+                                      oThreadInfo.m_dfBottomY,
+                                      oThreadInfo.m_dfBottomZ);
+            oInfo.UpdateExtremePoints(oThreadInfo.m_dfTopX,
+                                      oThreadInfo.m_dfTopY,
+                                      oThreadInfo.m_dfTopZ);
+        }
     }
 
-    return bRet;
+    return true;
 }
 
 /************************************************************************/
@@ -7424,30 +8057,31 @@ bool LayerTranslator::Translate(
  *
  * @param poGeomSRS The SRS into which the destination clip geometry should be
  *                  expressed.
+ * @param oCache Cache of the clip geometry reprojected to poGeomSRS.
  * @return the destination clip geometry and its envelope, or (nullptr, nullptr)
  */
 LayerTranslator::ClipGeomDesc
-LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS,
+                                ClipGeomCache &oCache)
 {
-    if (m_poClipDstReprojectedToDstSRS_SRS != poGeomSRS)
+    if (oCache.m_poSRS != poGeomSRS)
     {
+        oCache.m_poReprojected.reset();
         auto poClipDstSRS = m_poClipDstOri->getSpatialReference();
         if (poClipDstSRS && poGeomSRS && !poClipDstSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipDstReprojectedToDstSRS.reset(m_poClipDstOri->clone());
-            if (m_poClipDstReprojectedToDstSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oCache.m_poReprojected.reset(m_poClipDstOri->clone());
+            if (oCache.m_poReprojected->transformTo(poGeomSRS) != OGRERR_NONE)
             {
+                oCache.m_poReprojected.reset();
                 return ClipGeomDesc();
             }
-            m_poClipDstReprojectedToDstSRS_SRS = poGeomSRS;
         }
         else if (!poClipDstSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipDstSRS)
+            if (!m_bWarnedClipDstSRS.exchange(true))
             {
-                m_bWarnedClipDstSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip destination geometry has no "
                          "attached SRS, but the feature's "
@@ -7456,21 +8090,21 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
                          "same as the feature's geometry");
             }
         }
-        m_oClipDstEnv = OGREnvelope();
+        oCache.m_poSRS = poGeomSRS;
+        oCache.m_oEnv = OGREnvelope();
     }
 
-    const auto poGeom = m_poClipDstReprojectedToDstSRS
-                            ? m_poClipDstReprojectedToDstSRS.get()
-                            : m_poClipDstOri;
-    if (poGeom && !m_oClipDstEnv.IsInit())
+    const auto poGeom = oCache.m_poReprojected ? oCache.m_poReprojected.get()
+                                               : m_poClipDstOri;
+    if (poGeom && !oCache.m_oEnv.IsInit())
     {
-        poGeom->getEnvelope(&m_oClipDstEnv);
-        m_bClipDstIsRectangle = poGeom->IsRectangle();
+        poGeom->getEnvelope(&oCache.m_oEnv);
+        oCache.m_bIsRectangle = poGeom->IsRectangle();
     }
     ClipGeomDesc ret;
     ret.poGeom = poGeom;
-    ret.poEnv = poGeom ? &m_oClipDstEnv : nullptr;
-    ret.bGeomIsRectangle = m_bClipDstIsRectangle;
+    ret.poEnv = poGeom ? &oCache.m_oEnv : nullptr;
+    ret.bGeomIsRectangle = oCache.m_bIsRectangle;
     return ret;
 }
 
@@ -7482,30 +8116,31 @@ LayerTranslator::GetDstClipGeom(const OGRSpatialReference *poGeomSRS)
  *
  * @param poGeomSRS The SRS into which the source clip geometry should be
  *                  expressed.
+ * @param oCache Cache of the clip geometry reprojected to poGeomSRS.
  * @return the source clip geometry and its envelope, or (nullptr, nullptr)
  */
 LayerTranslator::ClipGeomDesc
-LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
+LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS,
+                                ClipGeomCache &oCache)
 {
-    if (m_poClipSrcReprojectedToSrcSRS_SRS != poGeomSRS)
+    if (oCache.m_poSRS != poGeomSRS)
     {
+        oCache.m_poReprojected.reset();
         auto poClipSrcSRS = m_poClipSrcOri->getSpatialReference();
         if (poClipSrcSRS && poGeomSRS && !poClipSrcSRS->IsSame(poGeomSRS))
         {
             // Transform clip geom to geometry SRS
-            m_poClipSrcReprojectedToSrcSRS.reset(m_poClipSrcOri->clone());
-            if (m_poClipSrcReprojectedToSrcSRS->transformTo(poGeomSRS) !=
-                OGRERR_NONE)
+            oCache.m_poReprojected.reset(m_poClipSrcOri->clone());
+            if (oCache.m_poReprojected->transformTo(poGeomSRS) != OGRERR_NONE)
             {
+                oCache.m_poReprojected.reset();
                 return ClipGeomDesc();
             }
-            m_poClipSrcReprojectedToSrcSRS_SRS = poGeomSRS;
         }
         else if (!poClipSrcSRS && poGeomSRS)
         {
-            if (!m_bWarnedClipSrcSRS)
+            if (!m_bWarnedClipSrcSRS.exchange(true))
             {
-                m_bWarnedClipSrcSRS = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Clip source geometry has no attached SRS, "
                          "but the feature's geometry has one. "
@@ -7513,21 +8148,21 @@ LayerTranslator::GetSrcClipGeom(const OGRSpatialReference *poGeomSRS)
                          "same as the feature's geometry");
             }
         }
-        m_oClipSrcEnv = OGREnvelope();
+        oCache.m_poSRS = poGeomSRS;
+        oCache.m_oEnv = OGREnvelope();
     }
 
-    const auto poGeom = m_poClipSrcReprojectedToSrcSRS
-                            ? m_poClipSrcReprojectedToSrcSRS.get()
-                            : m_poClipSrcOri;
-    if (poGeom && !m_oClipSrcEnv.IsInit())
+    const auto poGeom = oCache.m_poReprojected ? oCache.m_poReprojected.get()
+                                               : m_poClipSrcOri;
+    if (poGeom && !oCache.m_oEnv.IsInit())
     {
-        poGeom->getEnvelope(&m_oClipSrcEnv);
-        m_bClipSrcIsRectangle = poGeom->IsRectangle();
+        poGeom->getEnvelope(&oCache.m_oEnv);
+        oCache.m_bIsRectangle = poGeom->IsRectangle();
     }
     ClipGeomDesc ret;
     ret.poGeom = poGeom;
-    ret.poEnv = poGeom ? &m_oClipSrcEnv : nullptr;
-    ret.bGeomIsRectangle = m_bClipDstIsRectangle;
+    ret.poEnv = poGeom ? &oCache.m_oEnv : nullptr;
+    ret.bGeomIsRectangle = oCache.m_bIsRectangle;
     return ret;
 }
 
@@ -164,3 +164,25 @@ def test_gtiff_build_overviews(tmp_vsimem, source_ds_2048x2048_filename, ovr_alg
     ds = gdal.Open(filename, gdal.GA_Update)
     ds.BuildOverviews(ovr_alg, [2, 4, 8])
     ds.Close()
+
+
+@pytest.fixture(scope="module")
+def rgb_jpeg_cog_filename():
+    filename = "/vsimem/benchmark_rgb_jpeg_cog.tif"
+    src_ds = gdal.GetDriverByName("MEM").Create("", 4096, 4096, 3)
+    for i in range(3):
+        # Non-constant content, so that JPEG decoding is not trivial
+        line = bytes(((x * (i + 1)) ^ (x >> 3)) % 256 for x in range(4096))
+        src_ds.GetRasterBand(i + 1).WriteRaster(0, 0, 4096, 4096, line * 4096)
+    gdal.GetDriverByName("COG").CreateCopy(
+        filename, src_ds, options=["COMPRESS=JPEG", "OVERVIEWS=NONE"]
+    )
+    yield filename
+    gdal.Unlink(filename)
+
+
+@pytest.mark.parametrize("num_threads", ["1", "2", "4", "ALL_CPUS"])
+def test_gtiff_read_rgb_jpeg_cog(rgb_jpeg_cog_filename, num_threads):
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.Open(rgb_jpeg_cog_filename)
+        ds.ReadRaster()
@@ -51,11 +51,20 @@
 #include <limits>
 #include <fstream>
 #include <string>
+#include <thread>
+#include <vector>
 
 #if !defined(_WIN32)
 #include <unistd.h>
 #endif
 
+#if defined(HAVE_CURL) && !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#endif
+
 #include "test_data.h"
 
 #include "gtest_include.h"
@@ -4034,6 +4043,100 @@ TEST_F(test_cpl, VSIGetMemFileBuffer_unlink_and_size)
     ASSERT_TRUE(VSIFSeekL(fp.get(), 0, SEEK_END) == 0);
 }
 
+// Test that read-only /vsimem/ handles see modifications made through
+// handles opened in update mode, and concurrent reads
+TEST_F(test_cpl, vsimem_read_only_handles)
+{
+    const char *pszFilename = "/vsimem/test_vsimem_read_only_handles.bin";
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "wb"));
+        ASSERT_TRUE(fp != nullptr);
+        ASSERT_EQ(VSIFWriteL("0123456789", 1, 10, fp.get()), 10U);
+    }
+
+    VSIVirtualHandleUniquePtr fpRead(VSIFOpenL(pszFilename, "rb"));
+    ASSERT_TRUE(fpRead != nullptr);
+    char szBuffer[11] = {0};
+    ASSERT_EQ(VSIFReadL(szBuffer, 1, 5, fpRead.get()), 5U);
+    EXPECT_STREQ(szBuffer, "01234");
+
+    {
+        VSIVirtualHandleUniquePtr fpUpdate(VSIFOpenL(pszFilename, "r+b"));
+        ASSERT_TRUE(fpUpdate != nullptr);
+        ASSERT_EQ(VSIFSeekL(fpUpdate.get(), 5, SEEK_SET), 0);
+        ASSERT_EQ(VSIFWriteL("ABCDEFGHIJ", 1, 10, fpUpdate.get()), 10U);
+
+        memset(szBuffer, 0, sizeof(szBuffer));
+        ASSERT_EQ(VSIFReadL(szBuffer, 1, 10, fpRead.get()), 10U);
+        EXPECT_STREQ(szBuffer, "ABCDEFGHIJ");
+
+        ASSERT_EQ(VSIFSeekL(fpUpdate.get(), 0, SEEK_SET), 0);
+        ASSERT_EQ(VSIFWriteL("abc", 1, 3, fpUpdate.get()), 3U);
+    }
+
+    // Once the update handle is closed, the read-only handle reads again
+    // without locking, the latest content.
+    ASSERT_EQ(VSIFSeekL(fpRead.get(), 0, SEEK_END), 0);
+    EXPECT_EQ(VSIFTellL(fpRead.get()), 15U);
+    ASSERT_EQ(VSIFSeekL(fpRead.get(), 0, SEEK_SET), 0);
+    memset(szBuffer, 0, sizeof(szBuffer));
+    ASSERT_EQ(VSIFReadL(szBuffer, 1, 5, fpRead.get()), 5U);
+    EXPECT_STREQ(szBuffer, "abc34");
+
+    // Seize the buffer while a read-only handle is opened
+    vsi_l_offset nLength = 0;
+    std::unique_ptr<GByte, VSIFreeReleaser> pRawData(
+        VSIGetMemFileBuffer(pszFilename, &nLength, true));
+    ASSERT_EQ(nLength, 15U);
+    EXPECT_EQ(memcmp(pRawData.get(), "abc34ABCDEFGHIJ", 15), 0);
+    pRawData.reset();
+    EXPECT_EQ(VSIFReadL(szBuffer, 1, 5, fpRead.get()), 0U);
+    fpRead.reset();
+
+    // Concurrent readers
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "wb"));
+        ASSERT_TRUE(fp != nullptr);
+        std::vector<GByte> abyData(100000);
+        for (size_t i = 0; i < abyData.size(); ++i)
+            abyData[i] = static_cast<GByte>(i % 251);
+        ASSERT_EQ(VSIFWriteL(abyData.data(), 1, abyData.size(), fp.get()),
+                  abyData.size());
+    }
+    std::atomic<bool> bOK{true};
+    std::vector<std::thread> aoThreads;
+    for (int iThread = 0; iThread < 4; ++iThread)
+    {
+        aoThreads.emplace_back(
+            [pszFilename, &bOK]()
+            {
+                for (int iIter = 0; iIter < 100; ++iIter)
+                {
+                    VSIVirtualHandleUniquePtr fp(VSIFOpenL(pszFilename, "rb"));
+                    GByte abyBuffer[1000];
+                    const vsi_l_offset nOffset = (iIter * 997) % 99000;
+                    if (!fp || VSIFSeekL(fp.get(), nOffset, SEEK_SET) != 0 ||
+                        VSIFReadL(abyBuffer, 1, sizeof(abyBuffer), fp.get()) !=
+                            sizeof(abyBuffer))
+                    {
+                        bOK = false;
+                        return;
+                    }
+                    for (size_t i = 0; i < sizeof(abyBuffer); ++i)
+                    {
+                        if (abyBuffer[i] != (nOffset + i) % 251)
+                            bOK = false;
+                    }
+                }
+            });
+    }
+    for (auto &oThread : aoThreads)
+        oThread.join();
+    EXPECT_TRUE(bOK);
+
+    VSIUnlink(pszFilename);
+}
+
 // Test CPLLoadConfigOptionsFromFile() for VSI credentials
 TEST_F(test_cpl, CPLLoadConfigOptionsFromFile_VSI_credentials)
 {
@@ -5937,4 +6040,280 @@ TEST_F(test_cpl, CPLLaunderForFilenameSafe)
     EXPECT_STREQ(CPLLaunderForFilenameSafe("CON", ';').c_str(), "CON;");
 }
 
+
+TEST_F(test_cpl, VSIFSubmitReadBatchL)
+{
+    const auto Test = [](const std::string &osFilename)
+    {
+        constexpr int N_REQUESTS = 100;
+        constexpr size_t REQUEST_SIZE = 1000;
+        std::vector<GByte> abyData(N_REQUESTS * REQUEST_SIZE);
+        for (size_t i = 0; i < abyData.size(); ++i)
+            abyData[i] = static_cast<GByte>(i * 7);
+
+        const auto Completion = [](VSIAsyncRequest *psRequest, void *pUserData)
+        {
+            static_cast<std::atomic<int> *>(pUserData)->fetch_add(
+                psRequest->bError ? 1000 : 1);
+        };
+
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb+");
+        ASSERT_NE(fp, nullptr);
+
+        // Write requests in reverse order
+        std::vector<VSIAsyncRequest> asRequests(N_REQUESTS);
+        for (int i = 0; i < N_REQUESTS; ++i)
+        {
+            const int iBlock = N_REQUESTS - 1 - i;
+            asRequests[i].nOffset = iBlock * REQUEST_SIZE;
+            asRequests[i].nSize = REQUEST_SIZE;
+            asRequests[i].pBuffer = abyData.data() + iBlock * REQUEST_SIZE;
+        }
+        std::atomic<int> nCompleted{0};
+        VSIAsyncBatch *poBatch =
+            VSIFSubmitWriteBatchL(fp, N_REQUESTS, asRequests.data(),
+                                  Completion, &nCompleted);
+        ASSERT_NE(poBatch, nullptr);
+        EXPECT_TRUE(VSIAsyncBatchWait(poBatch, -1));
+        EXPECT_EQ(VSIAsyncBatchGetCompletedCount(poBatch), N_REQUESTS);
+        EXPECT_EQ(VSIAsyncBatchGetErrorCount(poBatch), 0);
+        VSIAsyncBatchFree(poBatch);
+        EXPECT_EQ(nCompleted.load(), N_REQUESTS);
+
+        // Read back, with a last request crossing the end of file
+        std::vector<GByte> abyRead(abyData.size() + REQUEST_SIZE);
+        for (int i = 0; i < N_REQUESTS; ++i)
+        {
+            asRequests[i].nOffset = i * REQUEST_SIZE + 10;
+            asRequests[i].nSize = REQUEST_SIZE;
+            asRequests[i].pBuffer = abyRead.data() + i * REQUEST_SIZE + 10;
+        }
+        nCompleted = 0;
+        poBatch = VSIFSubmitReadBatchL(fp, N_REQUESTS, asRequests.data(),
+                                       Completion, &nCompleted);
+        ASSERT_NE(poBatch, nullptr);
+        VSIAsyncBatchFree(poBatch);
+        EXPECT_EQ(nCompleted.load(), N_REQUESTS);
+        for (int i = 0; i < N_REQUESTS - 1; ++i)
+        {
+            EXPECT_EQ(asRequests[i].nTransferred, REQUEST_SIZE);
+        }
+        EXPECT_EQ(asRequests[N_REQUESTS - 1].nTransferred, REQUEST_SIZE - 10);
+        EXPECT_TRUE(memcmp(abyRead.data() + 10, abyData.data() + 10,
+                           abyData.size() - 10) == 0);
+
+        // Check that the handle is still usable with regular calls
+        GByte abyByte[1] = {0};
+        EXPECT_EQ(VSIFSeekL(fp, 1, SEEK_SET), 0);
+        EXPECT_EQ(VSIFReadL(abyByte, 1, 1, fp), 1U);
+        EXPECT_EQ(abyByte[0], abyData[1]);
+
+        VSIFCloseL(fp);
+        VSIUnlink(osFilename.c_str());
+    };
+
+    Test(VSIMemGenerateHiddenFilename("async.bin"));
+
+    const std::string osTmpFilename =
+        CPLGenerateTempFilenameSafe("async") + ".bin";
+    Test(osTmpFilename);
+    {
+        CPLConfigOptionSetter oSetter("CPL_VSIL_USE_IO_URING", "NO", false);
+        Test(osTmpFilename);
+    }
+}
+
+// Test VSIFSubmitReadBatchL() on /vsicurl/ with a server that does not
+// support range requests
+TEST_F(test_cpl, VSIFSubmitReadBatchL_vsicurl_no_range_support)
+{
+#if defined(HAVE_CURL) && !defined(_WIN32)
+    std::string osContent;
+    for (int i = 0; i < 1000; ++i)
+        osContent += static_cast<char>('A' + i % 26);
+
+    const int nListenSock = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(nListenSock, 0);
+    sockaddr_in sAddr;
+    memset(&sAddr, 0, sizeof(sAddr));
+    sAddr.sin_family = AF_INET;
+    sAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    socklen_t nAddrLen = sizeof(sAddr);
+    if (bind(nListenSock, reinterpret_cast<sockaddr *>(&sAddr),
+             sizeof(sAddr)) != 0 ||
+        listen(nListenSock, 16) != 0 ||
+        getsockname(nListenSock, reinterpret_cast<sockaddr *>(&sAddr),
+                    &nAddrLen) != 0)
+    {
+        close(nListenSock);
+        GTEST_SKIP() << "Cannot listen on a local port";
+    }
+
+    // Minimal HTTP server ignoring the Range header, and returning the whole
+    // content for each request
+    std::atomic<bool> bStop{false};
+    std::thread oServer(
+        [nListenSock, &bStop, &osContent]()
+        {
+            while (!bStop)
+            {
+                pollfd sPollFD{nListenSock, POLLIN, 0};
+                if (poll(&sPollFD, 1, 100) <= 0)
+                    continue;
+                const int nSock = accept(nListenSock, nullptr, nullptr);
+                if (nSock < 0)
+                    continue;
+                std::string osRequest;
+                char szBuffer[1024];
+                while (osRequest.find("\r\n\r\n") == std::string::npos)
+                {
+                    const auto nRead =
+                        recv(nSock, szBuffer, sizeof(szBuffer), 0);
+                    if (nRead <= 0)
+                        break;
+                    osRequest.append(szBuffer, static_cast<size_t>(nRead));
+                }
+                std::string osResponse(
+                    CPLSPrintf("HTTP/1.1 200 OK\r\n"
+                               "Content-Length: %d\r\n"
+                               "Connection: close\r\n\r\n",
+                               static_cast<int>(osContent.size())));
+                if (!STARTS_WITH(osRequest.c_str(), "HEAD"))
+                    osResponse += osContent;
+                CPL_IGNORE_RET_VAL(send(nSock, osResponse.data(),
+                                        osResponse.size(), MSG_NOSIGNAL));
+                close(nSock);
+            }
+        });
+
+    {
+        CPLConfigOptionSetter oSetter("GDAL_DISABLE_READDIR_ON_OPEN",
+                                      "EMPTY_DIR", false);
+        const std::string osFilename(
+            CPLSPrintf("/vsicurl/http://127.0.0.1:%d/no_range_support.bin",
+                       static_cast<int>(ntohs(sAddr.sin_port))));
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+        EXPECT_NE(fp, nullptr);
+        if (fp)
+        {
+            constexpr size_t REQUEST_SIZE = 200;
+            std::vector<GByte> abyRead(2 * REQUEST_SIZE);
+            VSIAsyncRequest asRequests[2];
+            memset(asRequests, 0, sizeof(asRequests));
+            asRequests[0].nOffset = 0;
+            asRequests[0].nSize = REQUEST_SIZE;
+            asRequests[0].pBuffer = abyRead.data();
+            asRequests[1].nOffset = 500;
+            asRequests[1].nSize = REQUEST_SIZE;
+            asRequests[1].pBuffer = abyRead.data() + REQUEST_SIZE;
+            {
+                CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+                VSIAsyncBatch *poBatch = VSIFSubmitReadBatchL(
+                    fp, 2, asRequests, nullptr, nullptr);
+                EXPECT_NE(poBatch, nullptr);
+                if (poBatch)
+                {
+                    EXPECT_TRUE(VSIAsyncBatchWait(poBatch, -1));
+                    EXPECT_EQ(VSIAsyncBatchGetErrorCount(poBatch), 1);
+                    VSIAsyncBatchFree(poBatch);
+                }
+            }
+
+            // Served from the start of the whole content
+            EXPECT_FALSE(asRequests[0].bError);
+            EXPECT_EQ(asRequests[0].nTransferred, REQUEST_SIZE);
+            EXPECT_TRUE(memcmp(abyRead.data(), osContent.data(),
+                               REQUEST_SIZE) == 0);
+
+            // Cannot be served
+            EXPECT_TRUE(asRequests[1].bError);
+
+            VSIFCloseL(fp);
+        }
+    }
+
+    bStop = true;
+    oServer.join();
+    close(nListenSock);
+    VSICurlClearCache();
+#else
+    GTEST_SKIP() << "CURL not available";
+#endif
+}
+
+TEST_F(test_cpl, VSIFReadMultiRangeL_local_file)
+{
+    const std::string osFilename =
+        CPLGenerateTempFilenameSafe("multirange") + ".bin";
+    std::vector<GByte> abyData(100 * 1000);
+    for (size_t i = 0; i < abyData.size(); ++i)
+        abyData[i] = static_cast<GByte>(i * 7);
+    {
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
+        ASSERT_NE(fp, nullptr);
+        EXPECT_EQ(VSIFWriteL(abyData.data(), 1, abyData.size(), fp),
+                  abyData.size());
+        VSIFCloseL(fp);
+    }
+
+    const auto Test = [&osFilename, &abyData]()
+    {
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+        ASSERT_NE(fp, nullptr);
+        EXPECT_EQ(VSIFSeekL(fp, 123, SEEK_SET), 0);
+
+        const vsi_l_offset anOffsets[] = {5000, 1, 4096, 70000, 99990, 50};
+        const size_t anSizes[] = {10000, 4095, 0, 8192, 10, 1};
+        constexpr int N_RANGES = static_cast<int>(CPL_ARRAYSIZE(anOffsets));
+        std::vector<std::vector<GByte>> aabyBuffers(N_RANGES);
+        void *apData[N_RANGES];
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            aabyBuffers[i].resize(anSizes[i] + 1);
+            apData[i] = aabyBuffers[i].data();
+        }
+        EXPECT_EQ(VSIFReadMultiRangeL(N_RANGES, apData, anOffsets, anSizes, fp),
+                  0);
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            EXPECT_TRUE(memcmp(apData[i], abyData.data() + anOffsets[i],
+                               anSizes[i]) == 0)
+                << i;
+        }
+
+        // Range crossing the end of file
+        const vsi_l_offset nOffsetEOF = 99990;
+        const size_t nSizeEOF = 11;
+        EXPECT_NE(
+            VSIFReadMultiRangeL(1, apData, &nOffsetEOF, &nSizeEOF, fp), 0);
+
+        // The file position is preserved
+        EXPECT_EQ(VSIFTellL(fp), 123U);
+        GByte abyByte[1] = {0};
+        EXPECT_EQ(VSIFReadL(abyByte, 1, 1, fp), 1U);
+        EXPECT_EQ(abyByte[0], abyData[123]);
+
+        VSIFCloseL(fp);
+    };
+
+    Test();
+    {
+        CPLConfigOptionSetter oSetter("CPL_VSIL_USE_IO_URING", "NO", false);
+        Test();
+    }
+    {
+        CPLConfigOptionSetter oSetter("CPL_VSIL_IO_URING_QUEUE_DEPTH", "2",
+                                      false);
+        Test();
+    }
+    {
+        // Falls back to regular reads if O_DIRECT is not supported
+        CPLConfigOptionSetter oSetter("CPL_VSIL_LOCAL_DIRECT_IO", "YES",
+                                      false);
+        Test();
+    }
+
+    VSIUnlink(osFilename.c_str());
+}
+
 }  // namespace
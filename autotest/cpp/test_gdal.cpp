@@ -27,6 +27,7 @@
 #include <array>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "test_data.h"
 
@@ -779,6 +780,41 @@ TEST_F(test_gdal, GDALSwapWords_unaligned_buffers)
     GDALSwapWords(abyBuffer, 4, 2, 9);
 }
 
+// Test GDALSwapWords() on packed words, with word counts that are and are
+// not multiple of the SIMD vector size, and buffers of any alignment
+TEST_F(test_gdal, GDALSwapWords_packed)
+{
+    constexpr int MAX_WORD_COUNT = 40;
+    constexpr int MAX_OFFSET = 16;
+    std::vector<GByte> abyBuffer(MAX_OFFSET + 8 * MAX_WORD_COUNT);
+    std::vector<GByte> abyExpected(abyBuffer.size());
+    for (const int nWordSize : {2, 4, 8})
+    {
+        for (int nOffset = 0; nOffset < MAX_OFFSET; ++nOffset)
+        {
+            for (int nWordCount = 0; nWordCount <= MAX_WORD_COUNT;
+                 ++nWordCount)
+            {
+                for (size_t i = 0; i < abyBuffer.size(); ++i)
+                    abyBuffer[i] = static_cast<GByte>(i * 7 + 3);
+                abyExpected = abyBuffer;
+                for (int iWord = 0; iWord < nWordCount; ++iWord)
+                {
+                    GByte *pabyWord =
+                        abyExpected.data() + nOffset + iWord * nWordSize;
+                    std::reverse(pabyWord, pabyWord + nWordSize);
+                }
+
+                GDALSwapWords(abyBuffer.data() + nOffset, nWordSize,
+                              nWordCount, nWordSize);
+                ASSERT_EQ(abyBuffer, abyExpected)
+                    << "nWordSize=" << nWordSize << ", nOffset=" << nOffset
+                    << ", nWordCount=" << nWordCount;
+            }
+        }
+    }
+}
+
 // Test ARE_REAL_EQUAL()
 TEST_F(test_gdal, ARE_REAL_EQUAL)
 {
@@ -271,4 +271,120 @@ TEST_F(test_gdal_gtiff, image_structure_pam)
     EXPECT_EQ(poDS->GetMetadataItem("foo", "IMAGE_STRUCTURE"), nullptr);
 }
 
+// Test GDALRasterBand::GetBlockVirtualMem()
+TEST_F(test_gdal_gtiff, block_virtual_mem)
+{
+    if (!CPLIsVirtualMemFileMapAvailable())
+        GTEST_SKIP() << "File memory mapping not available";
+
+    const std::string osTmpFile(data_tmp_ + "/block_virtual_mem.tif");
+    constexpr int BLOCK_SIZE = 16;
+    constexpr int WIDTH = 40;
+    constexpr int HEIGHT = 20;
+    for (const char *pszLayout : {"TILED=YES", "TILED=NO"})
+    {
+        SCOPED_TRACE(pszLayout);
+        {
+            CPLStringList aosOptions;
+            aosOptions.AddString(pszLayout);
+            aosOptions.SetNameValue("BLOCKXSIZE", CPLSPrintf("%d", BLOCK_SIZE));
+            aosOptions.SetNameValue("BLOCKYSIZE", CPLSPrintf("%d", BLOCK_SIZE));
+            auto poDS = std::unique_ptr<GDALDataset>(
+                GDALDriver::FromHandle(drv_)->Create(osTmpFile.c_str(), WIDTH,
+                                                     HEIGHT, 3, GDT_UInt16,
+                                                     aosOptions.List()));
+            ASSERT_NE(poDS, nullptr);
+            std::vector<GUInt16> anValues(WIDTH * HEIGHT * 3);
+            for (size_t i = 0; i < anValues.size(); ++i)
+                anValues[i] = static_cast<GUInt16>(i);
+            ASSERT_EQ(poDS->RasterIO(GF_Write, 0, 0, WIDTH, HEIGHT,
+                                     anValues.data(), WIDTH, HEIGHT,
+                                     GDT_UInt16, 3, nullptr, 0, 0, 0, nullptr),
+                      CE_None);
+        }
+
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(osTmpFile.c_str(), GDAL_OF_RASTER));
+        ASSERT_NE(poDS, nullptr);
+        auto poBand = poDS->GetRasterBand(2);
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        const int nXBlockOff = nBlockXSize == BLOCK_SIZE ? 1 : 0;
+        const int nYBlockOff = 1;
+        int nActualXSize = 0;
+        int nActualYSize = 0;
+        ASSERT_EQ(poBand->GetActualBlockSize(nXBlockOff, nYBlockOff,
+                                             &nActualXSize, &nActualYSize),
+                  CE_None);
+
+        int nPixelSpace = 0;
+        GIntBig nLineSpace = 0;
+        CPLVirtualMem *psVMem = poBand->GetBlockVirtualMem(
+            nXBlockOff, nYBlockOff, &nPixelSpace, &nLineSpace, nullptr);
+        ASSERT_NE(psVMem, nullptr);
+        EXPECT_EQ(nPixelSpace, 3 * static_cast<int>(sizeof(GUInt16)));
+        EXPECT_EQ(nLineSpace, static_cast<GIntBig>(nPixelSpace) * nBlockXSize);
+
+        std::vector<GUInt16> anExpected(static_cast<size_t>(nActualXSize) *
+                                        nActualYSize);
+        ASSERT_EQ(poBand->RasterIO(GF_Read, nXBlockOff * nBlockXSize,
+                                   nYBlockOff * nBlockYSize, nActualXSize,
+                                   nActualYSize, anExpected.data(),
+                                   nActualXSize, nActualYSize, GDT_UInt16, 0,
+                                   0, nullptr),
+                  CE_None);
+
+        // The view must remain valid after the dataset is closed
+        poDS.reset();
+
+        const GByte *pabyView =
+            static_cast<const GByte *>(CPLVirtualMemGetAddr(psVMem));
+        for (int y = 0; y < nActualYSize; ++y)
+        {
+            for (int x = 0; x < nActualXSize; ++x)
+            {
+                GUInt16 nVal = 0;
+                memcpy(&nVal, pabyView + x * nPixelSpace + y * nLineSpace,
+                       sizeof(nVal));
+                ASSERT_EQ(nVal, anExpected[y * nActualXSize + x]);
+            }
+        }
+        CPLVirtualMemFree(psVMem);
+
+        // Out of range block
+        poDS.reset(GDALDataset::Open(osTmpFile.c_str(), GDAL_OF_RASTER));
+        ASSERT_NE(poDS, nullptr);
+        CPLErrorStateBackuper oErrorHandler(CPLQuietErrorHandler);
+        EXPECT_EQ(poDS->GetRasterBand(1)->GetBlockVirtualMem(
+                      1000, 0, &nPixelSpace, &nLineSpace, nullptr),
+                  nullptr);
+        poDS.reset();
+        GDALDeleteDataset(drv_, osTmpFile.c_str());
+    }
+
+    // Compressed files cannot be exposed without a copy
+    {
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("COMPRESS", "DEFLATE");
+        auto poDS =
+            std::unique_ptr<GDALDataset>(GDALDriver::FromHandle(drv_)->Create(
+                osTmpFile.c_str(), WIDTH, HEIGHT, 1, GDT_Byte,
+                aosOptions.List()));
+        ASSERT_NE(poDS, nullptr);
+        ASSERT_EQ(poDS->GetRasterBand(1)->Fill(1), CE_None);
+    }
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(osTmpFile.c_str(), GDAL_OF_RASTER));
+        ASSERT_NE(poDS, nullptr);
+        int nPixelSpace = 0;
+        GIntBig nLineSpace = 0;
+        EXPECT_EQ(poDS->GetRasterBand(1)->GetBlockVirtualMem(
+                      0, 0, &nPixelSpace, &nLineSpace, nullptr),
+                  nullptr);
+    }
+    GDALDeleteDataset(drv_, osTmpFile.c_str());
+}
+
 }  // namespace
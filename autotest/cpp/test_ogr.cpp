@@ -4625,6 +4625,195 @@ TEST_F(test_ogr, OGRFeature_SetGeomField)
     poFeatureDefn->Release();
 }
 
+// Test OGRFeature::SetGeomFieldFromWKB()
+TEST_F(test_ogr, OGRFeature_SetGeomFieldFromWKB)
+{
+    OGRFeatureDefn *poFeatureDefn = new OGRFeatureDefn();
+    poFeatureDefn->Reference();
+    {
+        auto poSRS = OGRSpatialReferenceRefCountedPtr::makeInstance();
+        poSRS->SetFromUserInput("WGS84");
+        poFeatureDefn->GetGeomFieldDefn(0)->SetSpatialRef(poSRS.get());
+    }
+
+    OGRPoint oPoint(3, 7);
+    std::vector<GByte> abyWKB(oPoint.WkbSize());
+    oPoint.exportToWkb(abyWKB.data());
+
+    OGRFeature oFeat(poFeatureDefn);
+    EXPECT_EQ(oFeat.SetGeomFieldFromWKB(1, abyWKB.data(), abyWKB.size()),
+              OGRERR_FAILURE);
+    EXPECT_EQ(oFeat.SetGeomFieldFromWKB(0, abyWKB.data(), abyWKB.size()),
+              OGRERR_NONE);
+    EXPECT_TRUE(oFeat.IsFieldSet(oFeat.GetFieldCount() + SPF_OGR_GEOMETRY));
+
+    size_t nWKBSize = 0;
+    EXPECT_NE(oFeat.GetGeomFieldWKB(0, nWKBSize), nullptr);
+    EXPECT_EQ(nWKBSize, abyWKB.size());
+
+    // Copies keep the WKB undecoded
+    {
+        auto poClone = std::unique_ptr<OGRFeature>(oFeat.Clone());
+        EXPECT_NE(poClone->GetGeomFieldWKB(0, nWKBSize), nullptr);
+        OGRFeature oOther(poFeatureDefn);
+        EXPECT_EQ(oOther.SetFrom(&oFeat), OGRERR_NONE);
+        EXPECT_NE(oOther.GetGeomFieldWKB(0, nWKBSize), nullptr);
+        ASSERT_NE(oOther.GetGeometryRef(), nullptr);
+        EXPECT_TRUE(oOther.GetGeometryRef()->Equals(&oPoint));
+    }
+
+    // Decoded on first access
+    const OGRGeometry *poGeom = oFeat.GetGeometryRef();
+    ASSERT_NE(poGeom, nullptr);
+    EXPECT_TRUE(poGeom->Equals(&oPoint));
+    ASSERT_NE(poGeom->getSpatialReference(), nullptr);
+    EXPECT_EQ(oFeat.GetGeomFieldWKB(0, nWKBSize), nullptr);
+    EXPECT_EQ(nWKBSize, 0);
+
+    // Setting a geometry discards the WKB
+    EXPECT_EQ(oFeat.SetGeomFieldFromWKB(0, std::move(abyWKB)), OGRERR_NONE);
+    EXPECT_EQ(oFeat.SetGeomField(0, nullptr), OGRERR_NONE);
+    EXPECT_EQ(oFeat.GetGeomFieldWKB(0, nWKBSize), nullptr);
+    EXPECT_EQ(oFeat.GetGeometryRef(), nullptr);
+
+    // Corrupted WKB
+    const GByte abyCorrupted[] = {1, 1, 0, 0, 0};
+    EXPECT_EQ(oFeat.SetGeomFieldFromWKB(0, abyCorrupted, sizeof(abyCorrupted)),
+              OGRERR_NONE);
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        EXPECT_EQ(oFeat.GetGeometryRef(), nullptr);
+    }
+
+    poFeatureDefn->Release();
+}
+
+// Test OGRLayer::GetNextFeatureReusing()
+TEST_F(test_ogr, OGRLayer_GetNextFeatureReusing)
+{
+    const auto Check = [](OGRLayer *poLayer, bool bExpectReuse)
+    {
+        poLayer->ResetReading();
+        std::unique_ptr<OGRFeature> poFeature;
+        const OGRFeature *poPrevFeature = nullptr;
+        int nCount = 0;
+        while ((poFeature =
+                    poLayer->GetNextFeatureReusing(std::move(poFeature))))
+        {
+            if (bExpectReuse && poPrevFeature)
+            {
+                EXPECT_EQ(poFeature.get(), poPrevFeature);
+            }
+            poPrevFeature = poFeature.get();
+            EXPECT_EQ(poFeature->GetFieldAsInteger(0), 2 * nCount);
+            // Odd features have no geometry: check nothing leaks from the
+            // previous one.
+            const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+            if (nCount % 2 == 0)
+            {
+                ASSERT_NE(poGeom, nullptr);
+                EXPECT_EQ(poGeom->toPoint()->getX(), 2 * nCount);
+            }
+            else
+            {
+                EXPECT_EQ(poGeom, nullptr);
+                EXPECT_FALSE(poFeature->IsFieldSet(1));
+            }
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 4);
+
+        // With an attribute filter rejecting some features
+        poLayer->SetAttributeFilter("val >= 4");
+        poLayer->ResetReading();
+        nCount = 0;
+        while ((poFeature =
+                    poLayer->GetNextFeatureReusing(std::move(poFeature))))
+        {
+            EXPECT_GE(poFeature->GetFieldAsInteger(0), 4);
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 2);
+        poLayer->SetAttributeFilter(nullptr);
+
+        // Through the C API and the C++ iterator
+        poLayer->ResetReading();
+        OGRFeatureH hFeat = nullptr;
+        nCount = 0;
+        while ((hFeat = OGR_L_GetNextFeatureReusing(OGRLayer::ToHandle(poLayer),
+                                                    hFeat)) != nullptr)
+        {
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 4);
+        nCount = 0;
+        for (const auto &poIterFeature : poLayer)
+        {
+            EXPECT_EQ(poIterFeature->GetFieldAsInteger(0), 2 * nCount);
+            ++nCount;
+        }
+        EXPECT_EQ(nCount, 4);
+    };
+
+    const auto Fill = [](OGRLayer *poLayer)
+    {
+        OGRFieldDefn oFieldVal("val", OFTInteger);
+        ASSERT_EQ(poLayer->CreateField(&oFieldVal), OGRERR_NONE);
+        OGRFieldDefn oFieldStr("str", OFTString);
+        ASSERT_EQ(poLayer->CreateField(&oFieldStr), OGRERR_NONE);
+        for (int i = 0; i < 4; ++i)
+        {
+            OGRFeature oFeat(poLayer->GetLayerDefn());
+            oFeat.SetField(0, 2 * i);
+            if (i % 2 == 0)
+            {
+                oFeat.SetField(1, "foo");
+                oFeat.SetGeometry(std::make_unique<OGRPoint>(2 * i, 0));
+            }
+            ASSERT_EQ(poLayer->CreateFeature(&oFeat), OGRERR_NONE);
+        }
+    };
+
+    // Default implementation
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GetGDALDriverManager()->GetDriverByName("MEM")->Create(
+                "", 0, 0, 0, GDT_Unknown, nullptr));
+        auto poLayer = poDS->CreateLayer("test", nullptr, wkbPoint);
+        Fill(poLayer);
+        Check(poLayer, false);
+    }
+
+    if (GDALGetDriverByName("GPKG") == nullptr)
+    {
+        GTEST_SKIP() << "GPKG driver missing";
+    }
+
+    const std::string osFilename(
+        VSIMemGenerateHiddenFilename("test_reuse.gpkg"));
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(
+            GetGDALDriverManager()->GetDriverByName("GPKG")->Create(
+                osFilename.c_str(), 0, 0, 0, GDT_Unknown, nullptr));
+        ASSERT_NE(poDS, nullptr);
+        auto poLayer = poDS->CreateLayer("test", nullptr, wkbPoint);
+        Fill(poLayer);
+        Check(poLayer, true);
+
+        // A feature not created from the layer definition is not reused
+        OGRFeatureDefn *poOtherDefn = new OGRFeatureDefn();
+        poOtherDefn->Reference();
+        poLayer->ResetReading();
+        auto poFeature = poLayer->GetNextFeatureReusing(
+            std::make_unique<OGRFeature>(poOtherDefn));
+        ASSERT_NE(poFeature, nullptr);
+        EXPECT_EQ(poFeature->GetDefnRef(), poLayer->GetLayerDefn());
+        poFeature.reset();
+        poOtherDefn->Release();
+    }
+    VSIUnlink(osFilename.c_str());
+}
+
 TEST_F(test_ogr, GetArrowStream_DateTime_As_String)
 {
     auto poDS = std::unique_ptr<GDALDataset>(
@@ -13,6 +13,7 @@
 ###############################################################################
 
 import os
+import random
 import struct
 import sys
 
@@ -862,6 +863,143 @@ def test_cog_invalidation_by_metadata_change():
         gdal.GetDriverByName("GTiff").Delete(filename)
 
 
+###############################################################################
+# Test updating a COG with COG_INCREMENTAL_UPDATE=YES
+
+
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_cog_incremental_update(tmp_vsimem, with_mask):
+
+    filename = str(tmp_vsimem / "cog.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1024, 1024)
+    src_ds.GetRasterBand(1).Fill(10)
+    if with_mask:
+        src_ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        src_ds.GetRasterBand(1).GetMaskBand().Fill(255)
+        # The internal mask is compressed: start with a noisy area, so that
+        # the compressed size of the modified mask striles does not grow.
+        src_ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            300,
+            700,
+            20,
+            20,
+            bytes(random.Random(0).choice((0, 255)) for _ in range(400)),
+        )
+    options = ["BLOCKSIZE=256", "RESAMPLING=AVERAGE"]
+    gdal.GetDriverByName("COG").CreateCopy(filename, src_ds, options=options)
+
+    # Reference COG regenerated from scratch
+    byte_data = gdal.Open("data/byte.tif").ReadRaster()
+    src_ds.GetRasterBand(1).WriteRaster(300, 700, 20, 20, byte_data)
+    if with_mask:
+        src_ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            300, 700, 20, 20, b"\x00" * 400
+        )
+    ref_filename = str(tmp_vsimem / "ref.tif")
+    gdal.GetDriverByName("COG").CreateCopy(ref_filename, src_ds, options=options)
+
+    ds = gdal.OpenEx(
+        filename, gdal.OF_UPDATE, open_options=["COG_INCREMENTAL_UPDATE=YES"]
+    )
+    assert ds.GetMetadataItem("LAYOUT", "IMAGE_STRUCTURE") == "COG"
+    ds.GetRasterBand(1).WriteRaster(300, 700, 20, 20, byte_data)
+    if with_mask:
+        ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            300, 700, 20, 20, b"\x00" * 400
+        )
+    ds = None
+
+    ds = gdal.Open(filename)
+    ref_ds = gdal.Open(ref_filename)
+    assert ds.GetMetadataItem("LAYOUT", "IMAGE_STRUCTURE") == "COG"
+    assert ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
+    assert ds.GetRasterBand(1).GetOverviewCount() == 2
+    for i in range(2):
+        assert (
+            ds.GetRasterBand(1).GetOverview(i).Checksum()
+            == ref_ds.GetRasterBand(1).GetOverview(i).Checksum()
+        )
+        if with_mask:
+            assert (
+                ds.GetRasterBand(1).GetOverview(i).GetMaskBand().Checksum()
+                == ref_ds.GetRasterBand(1).GetOverview(i).GetMaskBand().Checksum()
+            )
+    ds = None
+    ref_ds = None
+
+    _check_cog(filename)
+
+
+###############################################################################
+# Test updating a compressed COG with COG_INCREMENTAL_UPDATE=YES
+
+
+def test_cog_incremental_update_compressed(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "cog.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 512, 512)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, 512, 512, random.Random(0).randbytes(512 * 512)
+    )
+    options = ["BLOCKSIZE=256", "COMPRESS=DEFLATE", "RESAMPLING=AVERAGE"]
+    gdal.GetDriverByName("COG").CreateCopy(filename, src_ds, options=options)
+    size_before = gdal.VSIStatL(filename).size
+
+    # Striles that shrink are rewritten in place
+    src_ds.GetRasterBand(1).WriteRaster(100, 100, 50, 50, b"\x00" * 2500)
+    ref_filename = str(tmp_vsimem / "ref.tif")
+    gdal.GetDriverByName("COG").CreateCopy(ref_filename, src_ds, options=options)
+
+    ds = gdal.OpenEx(
+        filename, gdal.OF_UPDATE, open_options=["COG_INCREMENTAL_UPDATE=YES"]
+    )
+    ds.GetRasterBand(1).WriteRaster(100, 100, 50, 50, b"\x00" * 2500)
+    with gdaltest.error_raised(gdal.CE_None):
+        ds.Close()
+
+    assert gdal.VSIStatL(filename).size == size_before
+    ds = gdal.Open(filename)
+    ref_ds = gdal.Open(ref_filename)
+    assert ds.GetMetadataItem("LAYOUT", "IMAGE_STRUCTURE") == "COG"
+    assert ds.GetRasterBand(1).Checksum() == ref_ds.GetRasterBand(1).Checksum()
+    assert (
+        ds.GetRasterBand(1).GetOverview(0).Checksum()
+        == ref_ds.GetRasterBand(1).GetOverview(0).Checksum()
+    )
+    checksums_before = [
+        ds.GetRasterBand(1).Checksum(),
+        ds.GetRasterBand(1).GetOverview(0).Checksum(),
+    ]
+    ds = None
+    ref_ds = None
+    _check_cog(filename)
+
+    # Striles that grow cannot be relocated without breaking the layout:
+    # the update is refused, and the file is left untouched
+    ds = gdal.OpenEx(
+        filename, gdal.OF_UPDATE, open_options=["COG_INCREMENTAL_UPDATE=YES"]
+    )
+    ds.GetRasterBand(1).WriteRaster(
+        100, 100, 50, 50, random.Random(1).randbytes(50 * 50)
+    )
+    with gdaltest.error_raised(gdal.CE_Failure, "cannot be rewritten in place"):
+        ds.Close()
+
+    assert gdal.VSIStatL(filename).size == size_before
+    f = gdal.VSIFOpenL(filename, "rb")
+    data = gdal.VSIFReadL(1, 1000, f).decode("LATIN1")
+    gdal.VSIFCloseL(f)
+    assert "KNOWN_INCOMPATIBLE_EDITION=NO\n " in data
+    ds = gdal.Open(filename)
+    assert ds.GetMetadataItem("LAYOUT", "IMAGE_STRUCTURE") == "COG"
+    assert [
+        ds.GetRasterBand(1).Checksum(),
+        ds.GetRasterBand(1).GetOverview(0).Checksum(),
+    ] == checksums_before
+    ds = None
+    _check_cog(filename)
+
+
 ###############################################################################
 # Test a tiling scheme with a CRS with northing/easting axis order
 # and non power-of-two ratios of scales.
@@ -2342,3 +2480,34 @@ def test_cog_algorithm_driver_cog_validate():
         Exception, match="data/byte.tif is NOT a valid cloud optimized GeoTIFF"
     ):
         gdal.alg.driver.cog.validate(dataset="data/byte.tif")
+
+
+###############################################################################
+# Test COMPRESS=AUTO
+
+
+def test_cog_compress_auto(tmp_vsimem):
+
+    src_ds = gdal.Open("data/byte.tif")
+    report_filename = tmp_vsimem / "report.csv"
+    out_filename = tmp_vsimem / "out.tif"
+    ds = gdal.GetDriverByName("COG").CreateCopy(
+        out_filename,
+        src_ds,
+        options=[
+            "COMPRESS=AUTO",
+            "BLOCKSIZE=16",
+            "COMPRESS_AUTO_OBJECTIVE=SIZE",
+            "COMPRESS_AUTO_REPORT=" + str(report_filename),
+        ],
+    )
+    assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+    compression = ds.GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE")
+    ds = None
+    _check_cog(out_filename)
+
+    with gdal.VSIFile(report_filename, "rb") as f:
+        lines = f.read().decode().splitlines()
+    selected = [line for line in lines[1:] if line.endswith(",YES")]
+    assert len(selected) == 1
+    assert selected[0].split(",")[0] == compression
@@ -2414,6 +2414,54 @@ def test_tiff_ovr_multithreading_singleband():
     gdal.Unlink("/vsimem/test.tif")
 
 
+###############################################################################
+# Test that band interleaved files get their bands resampled concurrently,
+# with the same result as the pixel interleaved code path
+
+
+@pytest.mark.parametrize("external", [False, True])
+def test_tiff_ovr_multithreading_band_interleaved(tmp_vsimem, external):
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", width=200, height=200
+    )
+
+    checksums = {}
+    for interleave, num_threads in (("PIXEL", "1"), ("BAND", "4")):
+        filename = str(tmp_vsimem / f"test_{interleave}.tif")
+        gdal.Translate(
+            filename,
+            src_ds,
+            creationOptions=[
+                "INTERLEAVE=" + interleave,
+                "COMPRESS=DEFLATE",
+                "TILED=YES",
+                "BLOCKXSIZE=32",
+                "BLOCKYSIZE=32",
+            ],
+        )
+        ds = gdal.Open(filename, gdal.GA_ReadOnly if external else gdal.GA_Update)
+        with gdaltest.config_options(
+            {"GDAL_OVR_CHUNK_MAX_SIZE": "1000", "COMPRESS_OVERVIEW": "DEFLATE"}
+        ):
+            ds.BuildOverviews(
+                "AVERAGE", [2, 4, 8], options=["NUM_THREADS=" + num_threads]
+            )
+        ds = None
+
+        if external:
+            assert gdal.VSIStatL(filename + ".ovr") is not None
+        ds = gdal.Open(filename)
+        checksums[interleave] = [
+            ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            for i in range(3)
+            for j in range(3)
+        ]
+        ds = None
+
+    assert checksums["BAND"] == checksums["PIXEL"]
+
+
 ###############################################################################
 
 
@@ -5001,6 +5001,48 @@ def test_tiff_read_multi_threaded(
     ds = None
 
 
+###############################################################################
+# Test that multi-threaded decoding of many lossy compressed striles (with
+# re-use of decoding contexts across striles, and direct decoding into the
+# destination buffer) gives the same result as single-threaded decoding
+
+
+@pytest.mark.parametrize(
+    "creation_options",
+    [
+        ["COMPRESS=JPEG", "TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+        ["COMPRESS=JPEG", "PHOTOMETRIC=YCBCR", "BLOCKYSIZE=16"],
+        ["COMPRESS=JPEG", "INTERLEAVE=BAND", "BLOCKYSIZE=16"],
+        ["COMPRESS=WEBP", "TILED=YES", "BLOCKXSIZE=32", "BLOCKYSIZE=32"],
+    ],
+)
+def test_tiff_read_multi_threaded_lossy_many_striles(tmp_vsimem, creation_options):
+
+    method = creation_options[0][len("COMPRESS=") :]
+    if method not in gdal.GetDriverByName("GTiff").GetMetadataItem(
+        "DMD_CREATIONOPTIONLIST"
+    ):
+        pytest.skip(f"Compression method {method} not supported in this build")
+
+    src_ds = gdal.Open("data/rgbsmall.tif")
+    tmpfile = tmp_vsimem / "test_tiff_read_multi_threaded_lossy_many_striles.tif"
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        tmpfile, src_ds, options=creation_options
+    )
+
+    def read(num_threads, **kwargs):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.Open(tmpfile)
+            return ds.ReadRaster(**kwargs)
+
+    for kwargs in [
+        {},
+        {"buf_pixel_space": 3, "buf_band_space": 1},
+        {"xoff": 3, "yoff": 5, "xsize": 40, "ysize": 33},
+    ]:
+        assert read("4", **kwargs) == read("1", **kwargs)
+
+
 ###############################################################################
 # Test multi-threaded decoding with /vsicurl
 
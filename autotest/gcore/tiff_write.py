@@ -12676,3 +12676,58 @@ def test_tiff_no_get_sibling_files(tmp_vsimem):
             with gdal.Open(tmp_vsimem / "foo.tif") as ds:
                 ds.GetRasterBand(1).GetDefaultRAT()
     assert res[0]
+
+
+###############################################################################
+# Test COMPRESS=AUTO
+
+
+@pytest.mark.parametrize("objective", ["SIZE", "BALANCED", "SPEED"])
+def test_tiff_write_compress_auto(tmp_vsimem, objective):
+
+    src_ds = gdal.Open("data/byte.tif")
+    report_filename = tmp_vsimem / "report.csv"
+    out_filename = tmp_vsimem / "out.tif"
+    ds = gdaltest.tiff_drv.CreateCopy(
+        out_filename,
+        src_ds,
+        options=[
+            "COMPRESS=AUTO",
+            "TILED=YES",
+            "BLOCKXSIZE=16",
+            "BLOCKYSIZE=16",
+            "COMPRESS_AUTO_OBJECTIVE=" + objective,
+            "COMPRESS_AUTO_SAMPLE_TILES=4",
+            "COMPRESS_AUTO_REPORT=" + str(report_filename),
+        ],
+    )
+    assert ds.GetMetadataItem("COMPRESSION", "IMAGE_STRUCTURE") is not None
+    assert ds.GetRasterBand(1).Checksum() == src_ds.GetRasterBand(1).Checksum()
+    ds = None
+
+    with gdal.VSIFile(report_filename, "rb") as f:
+        lines = f.read().decode().splitlines()
+    assert lines[0].startswith("COMPRESS,PREDICTOR,LEVEL,SIZE,")
+    assert lines[1].startswith("NONE,")
+    selected = [line for line in lines[1:] if line.endswith(",YES")]
+    assert len(selected) == 1
+    assert not selected[0].startswith("NONE,")
+
+
+###############################################################################
+# Test COMPRESS=AUTO error cases
+
+
+def test_tiff_write_compress_auto_errors(tmp_vsimem):
+
+    with pytest.raises(Exception, match="only supported by CreateCopy"):
+        gdaltest.tiff_drv.Create(
+            tmp_vsimem / "out.tif", 1, 1, options=["COMPRESS=AUTO"]
+        )
+
+    with pytest.raises(Exception, match="COMPRESS_AUTO_OBJECTIVE"):
+        gdaltest.tiff_drv.CreateCopy(
+            tmp_vsimem / "out.tif",
+            gdal.Open("data/byte.tif"),
+            options=["COMPRESS=AUTO", "COMPRESS_AUTO_OBJECTIVE=invalid"],
+        )
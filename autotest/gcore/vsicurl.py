@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -1931,3 +1932,239 @@ def test_vsicurl_head_accept_ranges_but_no_content_length(server):
             "/vsicurl/http://localhost:%d/test_head_accept_ranges_but_no_content_length"
             % server.port
         ).size == 3
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+    gdal.NetworkStatsReset()
+
+    path = "/test_vsicurl_disk_cache/test.txt"
+    filename = "/vsicurl/http://localhost:%d%s" % (server.port, path)
+    options = {
+        "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path / "cache"),
+        "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+    }
+    with gdal.config_options(options, thread_local=False):
+
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", path, 200, {"Content-Length": "3", "ETag": '"1234"'})
+        handler.add("GET", path, 200, {}, "foo")
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read(3) == b"foo"
+
+        # Simulate a new process: only the HEAD request is needed, since the
+        # content is in the disk cache.
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", path, 200, {"Content-Length": "3", "ETag": '"1234"'})
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read(3) == b"foo"
+
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+        assert j["disk_cache"] == {
+            "hit": {"count": 1, "bytes": 3},
+            "miss": {"count": 1},
+        }
+
+        # Changed ETag: the cached content must not be used
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", path, 200, {"Content-Length": "3", "ETag": '"5678"'})
+        handler.add("GET", path, 200, {}, "bar")
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read(3) == b"bar"
+
+    gdal.VSICurlClearCache()
+    gdal.NetworkStatsReset()
+
+
+###############################################################################
+# Test eviction of CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+def test_vsicurl_disk_cache_eviction(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    cache_dir = tmp_path / "cache"
+    options = {
+        "CPL_VSIL_CURL_DISK_CACHE_DIR": str(cache_dir),
+        "CPL_VSIL_CURL_DISK_CACHE_SIZE": "20000",
+    }
+    with gdal.config_options(options, thread_local=False):
+        for i in range(3):
+            path = "/test_vsicurl_disk_cache_eviction/test%d.txt" % i
+            handler = webserver.SequentialHandler()
+            handler.add(
+                "HEAD", path, 200, {"Content-Length": "10000", "ETag": '"1234"'}
+            )
+            handler.add("GET", path, 200, {}, "x" * 10000)
+            with webserver.install_http_handler(handler):
+                with gdal.VSIFile(
+                    "/vsicurl/http://localhost:%d%s" % (server.port, path), "rb"
+                ) as f:
+                    assert f.read(10000) == b"x" * 10000
+
+    cached_size = sum(
+        f.stat().st_size
+        for f in cache_dir.glob("*/*")
+        if f.is_file() and ".tmp." not in f.name
+    )
+    assert 0 < cached_size <= 20000
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test GDAL_HTTP_MERGE_RANGES_MAX_GAP
+
+
+def test_vsicurl_readmultirange_merge_gap(server):
+
+    with open("../gdrivers/data/utm.tif", "rb") as f:
+        content = f.read()
+
+    class RangeHandler:
+        def __init__(self):
+            self.get_count = 0
+
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", len(content))
+            request.end_headers()
+
+        def do_GET(self, request):
+            self.get_count += 1
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), len(content) - 1)
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(content))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+    expected_data = gdal.Open("../gdrivers/data/utm.tif").ReadRaster(
+        0, 0, 512, 512, 128, 128
+    )
+
+    def read(max_gap):
+        gdal.VSICurlClearCache()
+        gdal.NetworkStatsReset()
+
+        handler = RangeHandler()
+        with webserver.install_http_handler(handler), gdal.config_options(
+            {
+                "GTIFF_DIRECT_IO": "YES",
+                "CPL_VSIL_CURL_ALLOWED_EXTENSIONS": ".tif",
+                "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+                "GDAL_HTTP_MERGE_RANGES_MAX_GAP": max_gap,
+                "CPL_VSIL_NETWORK_STATS_ENABLED": "YES",
+            },
+            thread_local=False,
+        ):
+            ds = gdal.Open(
+                "/vsicurl/http://localhost:%d/test_merge_gap.tif" % server.port
+            )
+            assert ds.ReadRaster(0, 0, 512, 512, 128, 128) == expected_data
+            ds = None
+            j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+
+        gdal.NetworkStatsReset()
+        gdal.VSICurlClearCache()
+        return handler.get_count, j["methods"]["GET"].get("wasted_bytes", 0)
+
+    get_count_no_gap, wasted_bytes_no_gap = read("0")
+    assert wasted_bytes_no_gap == 0
+
+    get_count_gap, wasted_bytes_gap = read("1MB")
+    assert get_count_gap < get_count_no_gap
+    assert wasted_bytes_gap > 0
+
+    read("AUTO")
+
+
+###############################################################################
+# Test GDAL_HTTP_PARALLEL_READAHEAD
+
+
+@pytest.mark.parametrize("connections", [0, 4])
+def test_vsicurl_parallel_readahead(server, connections):
+
+    content = bytes([(i * 7) % 251 for i in range(1000 * 1000)])
+
+    class RangeHandler:
+        def __init__(self):
+            self.ranges = []
+
+        def final_check(self):
+            pass
+
+        def do_HEAD(self, request):
+            request.send_response(200)
+            request.send_header("Content-Length", len(content))
+            request.end_headers()
+
+        def do_GET(self, request):
+            rng = request.headers["Range"][len("bytes=") :]
+            start = int(rng.split("-")[0])
+            end = min(int(rng.split("-")[1]), len(content) - 1)
+            self.ranges.append((start, end))
+            request.protocol_version = "HTTP/1.1"
+            request.send_response(206)
+            request.send_header(
+                "Content-Range", "bytes %d-%d/%d" % (start, end, len(content))
+            )
+            request.send_header("Content-Length", end - start + 1)
+            request.send_header("Connection", "close")
+            request.end_headers()
+            request.wfile.write(content[start : end + 1])
+
+    prefix = "/vsicurl/http://localhost:%d/test_parallel_readahead" % server.port
+    filename = prefix + "/test.bin"
+    gdal.VSICurlClearCache()
+    gdal.SetPathSpecificOption(
+        prefix, "GDAL_HTTP_PARALLEL_READAHEAD", str(connections)
+    )
+    gdal.SetPathSpecificOption(prefix, "GDAL_HTTP_PARALLEL_READAHEAD_SIZE", "64KB")
+    handler = RangeHandler()
+    try:
+        with webserver.install_http_handler(handler), gdal.config_options(
+            {"GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR"}, thread_local=False
+        ):
+            with gdal.VSIFile(filename, "rb") as f:
+                data = b""
+                while True:
+                    chunk = f.read(10000)
+                    if not chunk:
+                        break
+                    data += chunk
+                assert data == content
+
+                # Random read after the sequential ones
+                f.seek(12345)
+                assert f.read(100) == content[12345:12445]
+    finally:
+        gdal.ClearPathSpecificOptions(prefix)
+        gdal.VSICurlClearCache()
+
+    if connections:
+        # Most of the file is read with ranges of 64 KB
+        assert sum(
+            1 for (start, end) in handler.ranges if end - start + 1 == 65536
+        ) >= (len(content) // 65536) - 2
@@ -919,6 +919,76 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test random-access index of /vsigzip/ files
+
+
+def test_vsigzip_index(tmp_path):
+
+    import gzip
+
+    data = b"".join(b"%09d\n" % i for i in range(300000))
+    gz_filename = str(tmp_path / "test.gz")
+    # Two members, to test concatenated gzip streams
+    with open(gz_filename, "wb") as f:
+        f.write(gzip.compress(data[0:1000000]))
+        f.write(gzip.compress(data[1000000:]))
+
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_WRITE_INDEX": "YES", "CPL_VSIL_GZIP_INDEX_SPACING": "64KB"}
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "rb")
+        assert f
+        gdal.VSIFCloseL(f)
+    assert os.path.exists(gz_filename + ".gzidx")
+
+    assert gdal.VSIStatL("/vsigzip/" + gz_filename).size == len(data)
+
+    f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "rb")
+    assert f
+    try:
+        for offset, size in [
+            (2500000, 100),
+            (10, 100),
+            (999990, 20),
+            (1500000, 50000),
+            (len(data) - 5, 10),
+        ]:
+            gdal.VSIFSeekL(f, offset, 0)
+            assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+
+        with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+            gdal.VSIFSeekL(f, 12345, 0)
+            assert gdal.VSIFReadL(1, 2000000, f) == data[12345:2012345]
+            # Sequential reading can continue after a parallel read
+            assert gdal.VSIFReadL(1, 100, f) == data[2012345:2012445]
+
+            # Segments reaching the end of the last member must not make
+            # parallel decompression fail
+            messages = []
+
+            def my_handler(errorClass, errno, msg):
+                messages.append(msg)
+
+            with gdaltest.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(
+                my_handler
+            ):
+                gdal.VSIFSeekL(f, 1000000, 0)
+                assert gdal.VSIFReadL(1, len(data), f) == data[1000000:]
+            assert gdal.VSIFEofL(f)
+            assert not any("Falling back" in msg for msg in messages)
+    finally:
+        gdal.VSIFCloseL(f)
+
+    # Index disabled
+    with gdaltest.config_option("CPL_VSIL_GZIP_USE_INDEX", "NO"):
+        f = gdal.VSIFOpenL("/vsigzip/" + gz_filename, "rb")
+        assert f
+        gdal.VSIFSeekL(f, 2500000, 0)
+        assert gdal.VSIFReadL(1, 100, f) == data[2500000:2500100]
+        gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -3218,6 +3218,101 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test multipart upload with parts uploaded in parallel
+
+
+def test_vsis3_write_multipart_parallel(aws_test_config, webserver_port):
+
+    gdal.NetworkStatsReset()
+
+    filename = "/vsis3/s3_fake_bucket4/parallel_upload.bin"
+    path = "/s3_fake_bucket4/parallel_upload.bin"
+    options = ["CHUNK_SIZE=1", "NUM_THREADS=2", "MAX_MEMORY=3MB"]
+    size = 3 * 1024 * 1024 + 1
+    big_buffer = "a" * size
+
+    response = """<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>"""
+
+    # Parts may be received in any order, but must be listed in order
+    # when completing the upload
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add("POST", path + "?uploads", 200, {}, response)
+    for i in range(1, 5):
+        handler.add(
+            "PUT",
+            path + "?partNumber=%d&uploadId=my_id" % i,
+            200,
+            {"ETag": '"etag%d"' % i, "Content-Length": "0"},
+            b"",
+            expected_headers={"Content-Length": "1048576" if i < 4 else "1"},
+        )
+    handler.add(
+        "POST",
+        path + "?uploadId=my_id",
+        200,
+        {},
+        b"",
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+<Part>
+<PartNumber>4</PartNumber><ETag>"etag4"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    with gdaltest.config_option(
+        "CPL_VSIL_NETWORK_STATS_ENABLED", "YES", thread_local=False
+    ):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenExL(filename, "wb", False, options)
+            assert f is not None
+            assert gdal.VSIFWriteL(big_buffer, 1, size, f) == size
+            gdal.ErrorReset()
+            assert gdal.VSIFCloseL(f) == 0
+            assert gdal.GetLastErrorMsg() == ""
+
+    j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+    file_stats = j["handlers"]["vsis3"]["files"][filename]
+    put_stats = file_stats["actions"]["UploadPart"]["methods"]["PUT"]
+    assert put_stats["count"] == 4
+    assert put_stats["uploaded_bytes"] == size
+    assert "throughput_bytes_per_sec" in put_stats
+
+    gdal.NetworkStatsReset()
+
+    # Failure of a part aborts the upload
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add("POST", path + "?uploads", 200, {}, response)
+    handler.add(
+        "PUT",
+        path + "?partNumber=1&uploadId=my_id",
+        200,
+        {"ETag": '"etag1"', "Content-Length": "0"},
+        b"",
+    )
+    handler.add("PUT", path + "?partNumber=2&uploadId=my_id", 400)
+    handler.add("DELETE", path + "?uploadId=my_id", 204)
+
+    size = 1024 * 1024 + 1
+    with webserver.install_http_handler(handler):
+        f = gdal.VSIFOpenExL(filename, "wb", False, options)
+        assert f is not None
+        assert gdal.VSIFWriteL(big_buffer, 1, size, f) == size
+        gdal.ErrorReset()
+        with gdal.quiet_errors():
+            assert gdal.VSIFCloseL(f) != 0
+        assert "UploadPart(2)" in gdal.GetLastErrorMsg()
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
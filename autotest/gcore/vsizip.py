@@ -947,6 +947,158 @@ def test_vsizip_byte_sozip(tmp_path):
         assert len(os.listdir("/proc/self/fd")) == fds_open
 
 
+###############################################################################
+# Test multi-threaded decompression of SOZip files
+
+
+def test_vsizip_sozip_multi_thread(tmp_path):
+
+    data = b"".join(b"%09d\n" % i for i in range(100000))
+    srcfilename = str(tmp_path / "test.bin")
+    with open(srcfilename, "wb") as f:
+        f.write(data)
+    zipfilename = str(tmp_path / "test_vsizip_sozip_multi_thread.zip")
+    dstfilename = f"/vsizip/{zipfilename}/test.bin"
+    options = ["SOZIP_ENABLED=YES", "SOZIP_CHUNK_SIZE=1024"]
+    assert gdal.CopyFile(srcfilename, dstfilename, options=options) == 0
+
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        # Large reads
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        assert f
+        try:
+            gdal.VSIFSeekL(f, 12345, 0)
+            assert gdal.VSIFReadL(1, 500000, f) == data[12345:512345]
+            gdal.VSIFSeekL(f, 0, 0)
+            assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+        finally:
+            gdal.VSIFCloseL(f)
+
+        # Small sequential reads, which trigger read-ahead
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        assert f
+        try:
+            got = []
+            while True:
+                chunk = gdal.VSIFReadL(1, 100, f)
+                if not chunk:
+                    break
+                got.append(chunk)
+                if len(got) == 2000:
+                    # Break the sequential pattern
+                    gdal.VSIFSeekL(f, 500000, 0)
+            assert b"".join(got) == data[0:200000] + data[500000:]
+        finally:
+            gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test random-access index of members of ZIP files without SOZip index
+
+
+def test_vsizip_member_index(tmp_path):
+
+    data = b"".join(b"%09d\n" % i for i in range(300000))
+    srcfilename = str(tmp_path / "test.bin")
+    with open(srcfilename, "wb") as f:
+        f.write(data)
+    zipfilename = str(tmp_path / "test_vsizip_member_index.zip")
+    dstfilename = f"/vsizip/{zipfilename}/test.bin"
+    assert (
+        gdal.CopyFile(srcfilename, dstfilename, options=["SOZIP_ENABLED=NO"]) == 0
+    )
+    assert gdal.GetFileMetadata(dstfilename, "ZIP").get("SOZIP_VALID") != "YES"
+
+    index_dir = str(tmp_path / "index")
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_INDEX_DIR": index_dir,
+            "CPL_VSIL_GZIP_WRITE_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_SPACING": "64KB",
+        }
+    ):
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        assert f
+        gdal.VSIFCloseL(f)
+    assert len(os.listdir(index_dir)) == 1
+
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_INDEX_DIR": index_dir, "GDAL_NUM_THREADS": "4"}
+    ):
+        f = gdal.VSIFOpenL(dstfilename, "rb")
+        assert f
+        try:
+            for offset, size in [(2500000, 100), (10, 100), (1500000, 1500000)]:
+                gdal.VSIFSeekL(f, offset, 0)
+                assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+        finally:
+            gdal.VSIFCloseL(f)
+
+
+###############################################################################
+# Test persistence of the content of archives in
+# CPL_VSIL_ARCHIVE_CATALOG_CACHE_DIR
+
+
+@pytest.mark.parametrize("archive_type", ["zip", "tar"])
+def test_vsizip_archive_catalog_cache(tmp_path, archive_type):
+
+    import tarfile
+    import zipfile
+
+    archive = str(tmp_path / f"test.{archive_type}")
+    if archive_type == "zip":
+        with zipfile.ZipFile(archive, "w") as z:
+            z.writestr("a/b.txt", "foo")
+            z.writestr("c.txt", "bar")
+    else:
+        with open(tmp_path / "b.txt", "wb") as f:
+            f.write(b"foo")
+        with open(tmp_path / "c.txt", "wb") as f:
+            f.write(b"bar")
+        with tarfile.open(archive, "w") as t:
+            t.add(tmp_path / "b.txt", arcname="a/b.txt")
+            t.add(tmp_path / "c.txt", arcname="c.txt")
+    prefix = f"/vsi{archive_type}/"
+
+    cache_dir = str(tmp_path / "cache")
+    with gdal.config_option("CPL_VSIL_ARCHIVE_CATALOG_CACHE_DIR", cache_dir):
+        assert set(gdal.ReadDirRecursive(prefix + archive)) == set(
+            ["a/", "a/b.txt", "c.txt"]
+        )
+    assert len(os.listdir(cache_dir)) == 1
+
+    # The content cached in memory by this process is not available to
+    # another one, which must use the catalog.
+    script = str(tmp_path / "script.py")
+    with open(script, "wt") as f:
+        f.write(f"""from osgeo import gdal
+gdal.SetConfigOption("CPL_DEBUG", "VSIArchive")
+gdal.SetConfigOption("CPL_VSIL_ARCHIVE_CATALOG_CACHE_DIR", {repr(cache_dir)})
+print(sorted(gdal.ReadDirRecursive({repr(prefix + archive)})))
+f = gdal.VSIFOpenL({repr(prefix + archive + "/a/b.txt")}, "rb")
+print(gdal.VSIFReadL(1, 3, f).decode("ascii"))
+gdal.VSIFCloseL(f)
+""")
+    out, err = gdaltest.runexternal_out_and_err(f'"{sys.executable}" "{script}"')
+    assert "read from catalog" in err
+    assert "['a/', 'a/b.txt', 'c.txt']" in out
+    assert "foo" in out
+
+    # Modify the archive: the catalog is stale and rewritten
+    if archive_type == "zip":
+        with zipfile.ZipFile(archive, "a") as z:
+            z.writestr("d.txt", "baz")
+    else:
+        with tarfile.open(archive, "a") as t:
+            t.add(tmp_path / "c.txt", arcname="d.txt")
+    out, err = gdaltest.runexternal_out_and_err(f'"{sys.executable}" "{script}"')
+    assert "is stale" in err
+    assert "written in catalog" in err
+    assert "['a/', 'a/b.txt', 'c.txt', 'd.txt']" in out
+    assert "foo" in out
+
+
 ###############################################################################
 
 
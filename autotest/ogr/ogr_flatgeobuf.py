@@ -1148,6 +1148,93 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that the columnar evaluation of attribute filters on Arrow batches
+# returns the same features as the per-feature evaluation
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "int32 > 5",
+        "5 < int32",
+        "int32 >= 5 AND int32 < 10",
+        "NOT (int32 < 5)",
+        "int32 IS NULL",
+        "int32 IS NOT NULL",
+        "int32 IN (1, 3, 100)",
+        "int32 NOT IN (1, 3, 100)",
+        "int32 BETWEEN 3 AND 7",
+        "int32 = 2.5",
+        "int32 <> 4",
+        "int64 > 10000000000",
+        "float64 < 3.5",
+        "float64 IN (1.5, 2.5)",
+        "float32 >= 2",
+        "str = 'ABC'",
+        "str <> 'abc'",
+        "str > 'b'",
+        "str IN ('abc', 'DEF')",
+        "str BETWEEN 'a' AND 'c'",
+        "flag",
+        "NOT flag",
+        "flag = 1",
+        "int32 > 5 OR str = 'xyz'",
+        "NOT (int32 > 5 OR str IS NULL)",
+        "NOT (int32 > 5 AND str IS NULL)",
+        "FID >= 3",
+        "str LIKE 'a%'",
+        "int32 + 1 > 5",
+    ],
+)
+@pytest.mark.parametrize("vectorized", ["YES", "NO"])
+def test_ogr_flatgeobuf_arrow_stream_numpy_attribute_filter(
+    tmp_vsimem, where, vectorized
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    field = ogr.FieldDefn("flag", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    field = ogr.FieldDefn("float32", ogr.OFTReal)
+    field.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    strings = ["abc", "ABC", "def", None, "b", "xyz", "ab\u00e9", ""]
+    for i in range(20):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 7 != 3:
+            f["int32"] = i
+            f["int64"] = i * 1000000000
+            f["float32"] = i * 0.5
+            f["float64"] = i * 0.5
+            f["flag"] = i % 2
+        f["str"] = strings[i % len(strings)]
+        f.SetGeometry(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    ds = ogr.Open(filename)
+    lyr = ds.GetLayer(0)
+    assert lyr.SetAttributeFilter(where) == ogr.OGRERR_NONE
+    expected_fids = [f.GetFID() for f in lyr]
+
+    with gdal.config_option("OGR_ARROW_VECTORIZED_FILTER", vectorized):
+        for options in (["USE_MASKED_ARRAYS=NO"], ["MAX_FEATURES_IN_BATCH=7"]):
+            stream = lyr.GetArrowStreamAsNumPy(options)
+            got_fids = []
+            for batch in stream:
+                got_fids += [fid for fid in batch["OGC_FID"]]
+            assert got_fids == expected_fids
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -11501,3 +11501,87 @@ def test_ogr_gpkg_algorithm_driver_gpkg_validate():
 
     with pytest.raises(Exception, match="Validation failed"):
         gdal.alg.driver.gpkg.validate(dataset="data/gpkg/poly_non_conformant.gpkg")
+
+
+###############################################################################
+# Test that geometries kept in their WKB representation while reading, and
+# written without being decoded, give the same result as decoded ones.
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_lazy_geometry(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.gpkg")
+    with ogr.GetDriverByName("GPKG").CreateDataSource(src_filename) as ds:
+        srs = osr.SpatialReference()
+        srs.ImportFromEPSG(4326)
+        lyr = ds.CreateLayer("test", srs, geom_type=ogr.wkbUnknown)
+        lyr.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+        for i, wkt in enumerate(
+            [
+                "POINT (1 2)",
+                "POINT EMPTY",
+                "LINESTRING Z (0 0 1,10 20 2)",
+                "POLYGON ((0 0,0 1,1 1,0 0))",
+                "MULTIPOLYGON (((5 5,5 6,6 6,5 5)),((7 7,7 8,8 8,7 7)))",
+                "POLYGON M ((0 0 1,0 1 2,1 1 3,0 0 1))",
+                "CURVEPOLYGON (CIRCULARSTRING (0 0,1 1,2 0,1 -1,0 0))",
+                "GEOMETRYCOLLECTION (POINT (3 4),LINESTRING (3 4,5 6))",
+                None,
+            ]
+        ):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["id"] = i
+            if wkt:
+                f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+            lyr.CreateFeature(f)
+
+    def translate(lazy):
+        out_filename = str(tmp_vsimem / f"out_{lazy}.gpkg")
+        # Disable the Arrow code path to go through OGRFeature
+        with gdaltest.config_options(
+            {"OGR_GPKG_LAZY_GEOMETRY": lazy, "OGR2OGR_USE_ARROW_API": "NO"}
+        ):
+            gdal.VectorTranslate(out_filename, src_filename)
+        return out_filename
+
+    out_lazy = translate("YES")
+    out_not_lazy = translate("NO")
+
+    def get_blobs(filename):
+        with ogr.Open(filename) as ds:
+            sql = "SELECT id, hex(geom) FROM test ORDER BY id"
+            with ds.ExecuteSQL(sql) as sql_lyr:
+                return [(f["id"], f.GetField(1)) for f in sql_lyr]
+
+    assert get_blobs(out_lazy) == get_blobs(out_not_lazy)
+    assert get_blobs(out_lazy) == get_blobs(src_filename)
+
+    filtered_ids = {}
+    for lazy in ("YES", "NO"):
+        with gdaltest.config_option("OGR_GPKG_LAZY_GEOMETRY", lazy):
+            with ogr.Open(out_lazy) as ds:
+                lyr = ds.GetLayer(0)
+                assert lyr.GetExtent() == pytest.approx((0, 10, -1, 20))
+
+                lyr.SetSpatialFilterRect(4.5, 4.5, 6.5, 6.5)
+                filtered_ids[lazy] = [f["id"] for f in lyr]
+
+                lyr.SetSpatialFilter(None)
+                f = lyr.GetNextFeature()
+                assert f.GetGeometryRef().ExportToWkt() == "POINT (1 2)"
+                srs = f.GetGeometryRef().GetSpatialReference()
+                assert srs.GetAuthorityCode(None) == "4326"
+                assert f.Clone().GetGeometryRef().ExportToWkt() == "POINT (1 2)"
+                f = lyr.GetNextFeature()
+                assert f.GetGeometryRef().IsEmpty()
+                f = lyr.GetNextFeature()
+                assert f.GetGeometryRef().ExportToIsoWkt() == (
+                    "LINESTRING Z (0 0 1,10 20 2)"
+                )
+                f = lyr.GetFeature(9)
+                assert f.GetGeometryRef() is None
+
+    assert 4 in filtered_ids["YES"]
+    assert 7 in filtered_ids["YES"]
+    assert filtered_ids["YES"] == filtered_ids["NO"]
@@ -27,6 +27,7 @@
 ###############################################################################
 
 
+import gdaltest
 import ogrtest
 import pytest
 
@@ -546,3 +547,128 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test the hash join, compared to the nested loop join, and its fallback to
+# storing only FIDs when exceeding OGR_SQL_HASH_JOIN_MAX_MEMORY
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        {},
+        {"OGR_SQL_HASH_JOIN": "NO"},
+        {"OGR_SQL_HASH_JOIN_MAX_MEMORY": "1"},
+    ],
+)
+def test_ogr_join_hash_join(options):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    lyr.CreateField(ogr.FieldDefn("int_key", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    for int_key, str_key in [(1, "A"), (2, "b"), (3, "c"), (None, "a"), (4, None)]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["int_key"] = int_key
+        f["str_key"] = str_key
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second")
+    lyr.CreateField(ogr.FieldDefn("real_key", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("flag", ogr.OFTInteger))
+    for real_key, str_key, val, flag in [
+        (1.0, "a", "first_a", 1),
+        (1.0, "a", "second_a", 1),
+        (2.0, "B", "b_not_flagged", 0),
+        (2.0, "B", "b", 1),
+        (3.5, "c", "c", 1),
+        (None, "a", "null_key", 1),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["real_key"] = real_key
+        f["str_key"] = str_key
+        f["val"] = val
+        f["flag"] = flag
+        lyr.CreateFeature(f)
+
+    with gdaltest.config_options(options):
+        with ds.ExecuteSQL(
+            "SELECT first.int_key, second.val FROM first "
+            "LEFT JOIN second ON first.int_key = second.real_key AND "
+            "second.str_key = first.str_key AND second.flag = 1"
+        ) as sql_lyr:
+            assert [f["val"] for f in sql_lyr] == ["first_a", "b", None, None, None]
+
+        # Expression that cannot be resolved with a hash table
+        with ds.ExecuteSQL(
+            "SELECT first.int_key, second.val FROM first "
+            "LEFT JOIN second ON first.int_key < second.real_key"
+        ) as sql_lyr:
+            assert [f["val"] for f in sql_lyr][0:3] == ["b_not_flagged", "c", "c"]
+
+
+###############################################################################
+# Test that the hash join compares string keys like the attribute filter of
+# the secondary layer does: case insensitively for layers evaluated by OGR SQL,
+# case sensitively for drivers that translate filters to SQL.
+
+
+@pytest.mark.parametrize("driver_name", ["MEM", "GPKG"])
+def test_ogr_join_hash_join_string_case(tmp_vsimem, driver_name):
+
+    drv = ogr.GetDriverByName(driver_name)
+    if drv is None:
+        pytest.skip(f"{driver_name} driver not available")
+    ds = drv.CreateDataSource(
+        "" if driver_name == "MEM" else str(tmp_vsimem / "test.gpkg")
+    )
+    lyr = ds.CreateLayer("first", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    for str_key in ["abc", "ABC", "Def", "ghi"]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str_key"] = str_key
+        lyr.CreateFeature(f)
+
+    lyr = ds.CreateLayer("second", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("str_key", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTString))
+    for str_key, val in [
+        ("ABC", "upper_abc"),
+        ("def", "lower_def"),
+        ("ghi", "ghi"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["str_key"] = str_key
+        f["val"] = val
+        lyr.CreateFeature(f)
+
+    sql = (
+        "SELECT first.str_key, second.val FROM first "
+        "LEFT JOIN second ON first.str_key = second.str_key"
+    )
+
+    def get_result():
+        with ds.ExecuteSQL(sql, dialect="OGRSQL") as sql_lyr:
+            return [(f["str_key"], f["val"]) for f in sql_lyr]
+
+    with gdaltest.config_option("OGR_SQL_HASH_JOIN", "NO"):
+        expected = get_result()
+    assert get_result() == expected
+
+    if driver_name == "MEM":
+        assert expected == [
+            ("abc", "upper_abc"),
+            ("ABC", "upper_abc"),
+            ("Def", "lower_def"),
+            ("ghi", "ghi"),
+        ]
+    else:
+        assert expected == [
+            ("abc", None),
+            ("ABC", "upper_abc"),
+            ("Def", None),
+            ("ghi", "ghi"),
+        ]
@@ -2257,3 +2257,435 @@ def test_ogr_sql_test_spatial_filter_on_summary_result_set():
     ) as sql_lyr:
         f = sql_lyr.GetNextFeature()
         assert f.GetField(0) == 2
+
+
+###############################################################################
+# Test GROUP BY
+
+
+@pytest.fixture()
+def group_by_ds():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("cat", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("v", ogr.OFTInteger))
+    for cat, v, wkt in [
+        ("a", 1, "POINT (0 0)"),
+        ("b", 10, "POINT (5 5)"),
+        ("a", 3, "POINT (2 1)"),
+        (None, 100, None),
+        ("b", None, "POINT (6 7)"),
+        ("a", 5, "POINT (1 3)"),
+        ("c", 7, "POINT (9 9)"),
+    ]:
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["cat"] = cat
+        f["v"] = v
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        lyr.CreateFeature(f)
+    return ds
+
+
+@pytest.mark.parametrize("max_memory", [None, "1"])
+def test_ogr_sql_group_by(group_by_ds, max_memory):
+
+    with gdal.config_option("OGR_SQL_GROUP_BY_MAX_MEMORY", max_memory):
+        with group_by_ds.ExecuteSQL(
+            "SELECT cat, COUNT(*), COUNT(v), SUM(v), AVG(v), MIN(v), MAX(v) "
+            "FROM test GROUP BY cat ORDER BY cat"
+        ) as sql_lyr:
+            assert sql_lyr.GetLayerDefn().GetGeomFieldCount() == 0
+            assert [
+                sql_lyr.GetLayerDefn().GetFieldDefn(i).GetName()
+                for i in range(sql_lyr.GetLayerDefn().GetFieldCount())
+            ] == ["cat", "COUNT_*", "COUNT_v", "SUM_v", "AVG_v", "MIN_v", "MAX_v"]
+            assert sql_lyr.GetFeatureCount() == 4
+            res = [
+                [f.GetField(i) for i in range(f.GetFieldCount())] for f in sql_lyr
+            ]
+            assert res == [
+                [None, 1, 1, 100, 100, 100, 100],
+                ["a", 3, 3, 9, 3, 1, 5],
+                ["b", 2, 1, 10, 10, 10, 10],
+                ["c", 1, 1, 7, 7, 7, 7],
+            ]
+
+
+def test_ogr_sql_group_by_having(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, SUM(v) AS total FROM test "
+        "GROUP BY cat HAVING COUNT(*) > 1 ORDER BY total DESC"
+    ) as sql_lyr:
+        assert sql_lyr.GetLayerDefn().GetFieldCount() == 2
+        assert [(f["cat"], f["total"]) for f in sql_lyr] == [("b", 10), ("a", 9)]
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, SUM(v) AS total FROM test WHERE v < 100 "
+        "GROUP BY cat HAVING COUNT(*) > 1"
+    ) as sql_lyr:
+        assert [(f["cat"], f["total"]) for f in sql_lyr] == [("a", 9)]
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, SUM(v) AS total FROM test GROUP BY cat "
+        "HAVING total > 8 AND cat <> 'b'"
+    ) as sql_lyr:
+        assert [f["cat"] for f in sql_lyr] == ["a"]
+
+
+def test_ogr_sql_group_by_limit_offset_and_filter(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, COUNT(*) AS n FROM test GROUP BY cat ORDER BY n DESC, cat "
+        "LIMIT 2 OFFSET 1"
+    ) as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 2
+        assert [f["cat"] for f in sql_lyr] == ["b", None]
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, COUNT(*) AS n FROM test GROUP BY cat ORDER BY cat"
+    ) as sql_lyr:
+        sql_lyr.SetAttributeFilter("n = 1")
+        assert sql_lyr.GetFeatureCount() == 2
+        assert [f["cat"] for f in sql_lyr] == [None, "c"]
+
+
+def test_ogr_sql_group_by_spill_many_groups():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbNone)
+    lyr.CreateField(ogr.FieldDefn("k", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("v", ogr.OFTReal))
+    for i in range(2000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        f["k"] = i % 500
+        f["v"] = i
+        lyr.CreateFeature(f)
+
+    with gdal.config_option("OGR_SQL_GROUP_BY_MAX_MEMORY", "1000"):
+        with ds.ExecuteSQL(
+            "SELECT k, COUNT(*), SUM(v) FROM test GROUP BY k ORDER BY k"
+        ) as sql_lyr:
+            res = [(f["k"], f["COUNT_*"], f["SUM_v"]) for f in sql_lyr]
+    assert res == [(k, 4, 4 * k + 3000) for k in range(500)]
+
+
+def test_ogr_sql_group_by_st_extent(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, ST_EXTENT(_ogr_geometry_) AS ext FROM test "
+        "GROUP BY cat ORDER BY cat"
+    ) as sql_lyr:
+        assert sql_lyr.GetLayerDefn().GetGeomFieldCount() == 1
+        assert sql_lyr.GetLayerDefn().GetGeomFieldDefn(0).GetName() == "ext"
+        assert sql_lyr.GetLayerDefn().GetGeomType() == ogr.wkbPolygon
+        res = [(f["cat"], f.GetGeometryRef()) for f in sql_lyr]
+        assert res[0][1] is None
+        assert res[1][1].ExportToWkt() == "POLYGON ((0 0,0 3,2 3,2 0,0 0))"
+        assert res[2][1].ExportToWkt() == "POLYGON ((5 5,5 7,6 7,6 5,5 5))"
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT ST_EXTENT(_ogr_geometry_), COUNT(*) FROM test"
+    ) as sql_lyr:
+        f = sql_lyr.GetNextFeature()
+        assert f.GetGeometryRef().ExportToWkt() == "POLYGON ((0 0,0 9,9 9,9 0,0 0))"
+        assert f["COUNT_*"] == 7
+
+
+def test_ogr_sql_group_by_st_extent_spatial_filter(group_by_ds):
+
+    sql = (
+        "SELECT cat, ST_EXTENT(_ogr_geometry_) AS ext, COUNT(*) AS n "
+        "FROM test GROUP BY cat ORDER BY cat"
+    )
+    with group_by_ds.ExecuteSQL(sql) as sql_lyr:
+        sql_lyr.SetSpatialFilterRect(4, 4, 8, 8)
+        assert sql_lyr.GetFeatureCount() == 1
+        assert [f["cat"] for f in sql_lyr] == ["b"]
+        assert sql_lyr.TestCapability(ogr.OLCFastSetNextByIndex) == 0
+
+        # Only one of the 3 points of group "a" intersects the filter:
+        # the group is kept as a whole
+        sql_lyr.SetSpatialFilterRect(1.5, 0.5, 4, 4)
+        assert sql_lyr.GetFeatureCount() == 1
+        f = sql_lyr.GetNextFeature()
+        assert f["cat"] == "a"
+        assert f["n"] == 3
+        assert f.GetGeometryRef().ExportToWkt() == "POLYGON ((0 0,0 3,2 3,2 0,0 0))"
+        assert sql_lyr.GetNextFeature() is None
+
+        sql_lyr.SetSpatialFilter(None)
+        assert sql_lyr.GetFeatureCount() == 4
+        assert sql_lyr.TestCapability(ogr.OLCFastSetNextByIndex) == 1
+
+    # The spatial filter of ExecuteSQL() applies to the source features
+    with group_by_ds.ExecuteSQL(
+        sql,
+        spatialFilter=ogr.CreateGeometryFromWkt(
+            "POLYGON ((1.5 0.5,1.5 4,4 4,4 0.5,1.5 0.5))"
+        ),
+    ) as sql_lyr:
+        assert [(f["cat"], f["n"]) for f in sql_lyr] == [("a", 1)]
+
+
+@pytest.mark.require_geos
+def test_ogr_sql_group_by_st_union(group_by_ds):
+
+    with group_by_ds.ExecuteSQL(
+        "SELECT cat, ST_UNION(_ogr_geometry_) FROM test GROUP BY cat ORDER BY cat"
+    ) as sql_lyr:
+        res = [f.GetGeometryRef() for f in sql_lyr]
+        assert res[0] is None
+        assert res[1].GetGeometryType() == ogr.wkbMultiPoint
+        assert res[1].GetGeometryCount() == 3
+        assert res[3].ExportToWkt() == "POINT (9 9)"
+
+
+@pytest.mark.parametrize(
+    "sql,error_msg",
+    [
+        (
+            "SELECT cat, v FROM test GROUP BY cat",
+            "Field v should appear in the GROUP BY clause or be used in an aggregate function",
+        ),
+        ("SELECT COUNT(*) FROM test GROUP BY foo", "foo"),
+        ("SELECT cat FROM test GROUP BY cat HAVING foo > 0", "foo"),
+        ("SELECT cat FROM test GROUP BY cat ORDER BY v", "ORDER BY item v"),
+        (
+            "SELECT cat, ST_UNION(_ogr_geometry_) FROM test GROUP BY cat "
+            "HAVING ST_EXTENT(_ogr_geometry_) IS NOT NULL",
+            "HAVING",
+        ),
+        ("SELECT cat, ST_EXTENT(v) FROM test GROUP BY cat", None),
+    ],
+)
+def test_ogr_sql_group_by_errors(group_by_ds, sql, error_msg):
+
+    with pytest.raises(Exception, match=error_msg):
+        group_by_ds.ExecuteSQL(sql)
+
+
+###############################################################################
+# Test ORDER BY with an external merge sort
+
+
+@pytest.mark.parametrize("carry_rows", ["AUTO", "YES", "NO"])
+def test_ogr_sql_order_by_external_sort(carry_rows):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("l", ogr.OFTIntegerList))
+    for n in range(3000):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if n % 7 != 0:
+            f["s"] = "val%d" % ((n * 37) % 101)
+        f["i"] = (n * 13) % 1000
+        f["l"] = [n, n + 1]
+        f.SetGeometry(ogr.CreateGeometryFromWkt("POINT (%d 0)" % n))
+        lyr.CreateFeature(f)
+
+    sql = "SELECT * FROM test ORDER BY s DESC, i"
+
+    def get_result(sql_lyr):
+        return [
+            (f.GetFID(), f["s"], f["i"], f["l"], f.GetGeometryRef().GetX())
+            for f in sql_lyr
+        ]
+
+    with ds.ExecuteSQL(sql) as sql_lyr:
+        expected = get_result(sql_lyr)
+    assert len(expected) == 3000
+
+    with gdal.config_options(
+        {
+            "OGR_SQL_ORDER_BY_MAX_MEMORY": "2000",
+            "OGR_SQL_ORDER_BY_CARRY_ROWS": carry_rows,
+        }
+    ):
+        with ds.ExecuteSQL(sql) as sql_lyr:
+            assert get_result(sql_lyr) == expected
+            sql_lyr.ResetReading()
+            assert get_result(sql_lyr) == expected
+
+            sql_lyr.SetNextByIndex(2990)
+            assert get_result(sql_lyr) == expected[2990:]
+            sql_lyr.SetNextByIndex(5)
+            assert sql_lyr.GetNextFeature().GetFID() == expected[5][0]
+
+        with ds.ExecuteSQL(sql + " LIMIT 10 OFFSET 1000") as sql_lyr:
+            assert get_result(sql_lyr) == expected[1000:1010]
+
+
+@pytest.mark.parametrize(
+    "option,sql",
+    [
+        ("OGR_SQL_ORDER_BY_MAX_MEMORY", "SELECT cat FROM test ORDER BY v DESC"),
+        (
+            "OGR_SQL_GROUP_BY_MAX_MEMORY",
+            "SELECT cat, COUNT(*) FROM test GROUP BY cat ORDER BY cat",
+        ),
+    ],
+)
+def test_ogr_sql_invalid_max_memory(group_by_ds, option, sql):
+
+    with group_by_ds.ExecuteSQL(sql) as sql_lyr:
+        expected = [f["cat"] for f in sql_lyr]
+
+    with gdal.config_option(option, "invalid"), gdal.quiet_errors():
+        gdal.ErrorReset()
+        with group_by_ds.ExecuteSQL(sql) as sql_lyr:
+            assert [f["cat"] for f in sql_lyr] == expected
+        assert gdal.GetLastErrorType() == gdal.CE_Warning
+        assert f"Invalid value for {option}" in gdal.GetLastErrorMsg()
+
+
+###############################################################################
+# Test in-memory attribute indexes created with CREATE INDEX on layers
+# without index support of their own
+
+
+def test_ogr_sql_create_index_in_memory():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("test")
+    lyr.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("r", ogr.OFTReal))
+    lyr.CreateField(ogr.FieldDefn("s", ogr.OFTString))
+    for n in range(200):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if n % 11 != 0:
+            f["i"] = (n * 37) % 50
+            f["r"] = ((n * 13) % 40) / 4.0
+        f["s"] = ("Val%d" if n % 2 else "VAL%d") % (n % 17)
+        lyr.CreateFeature(f)
+
+    queries = [
+        "i = 7",
+        "i IN (3, 8, 49, 100)",
+        "i BETWEEN 10 AND 20",
+        "i < 5",
+        "i >= 45",
+        "i > 4.5",
+        "i <= 4.5",
+        "12 < i",
+        "i = 7.5",
+        "r = 2.5",
+        "r BETWEEN 1 AND 2.25",
+        "r > 9",
+        "r < 0.5 OR i = 3",
+        "r >= 5 AND i < 20",
+        "s = 'val3'",
+        "s IN ('VAL1', 'val16')",
+        "s >= 'val5'",
+        "i IS NULL",
+        "i <> 7",
+    ]
+
+    def get_result(where):
+        with ds.ExecuteSQL("SELECT * FROM test WHERE " + where) as sql_lyr:
+            return [f.GetFID() for f in sql_lyr]
+
+    expected = {where: get_result(where) for where in queries}
+    assert len(expected["i = 7"]) > 0
+    assert len(expected["s = 'val3'"]) > 0
+
+    for field in ("i", "r", "s"):
+        ds.ExecuteSQL("CREATE INDEX ON test USING " + field)
+    assert lyr.GetIndex() is not None
+
+    with pytest.raises(Exception, match="already have an index"):
+        ds.ExecuteSQL("CREATE INDEX ON test USING i")
+    with pytest.raises(Exception):
+        ds.ExecuteSQL("CREATE INDEX ON test USING non_existing")
+
+    for where in queries:
+        assert get_result(where) == expected[where], where
+
+    # Check that the candidates come from the indexes, both through OGR SQL
+    # and with a direct attribute filter on the layer
+    def get_index_debug_messages(func):
+        messages = []
+
+        def handler(err_type, err_no, msg):
+            if "evaluated with attribute indexes" in msg:
+                messages.append(msg)
+
+        with gdaltest.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(
+            handler
+        ):
+            ret = func()
+        return ret, messages
+
+    ret, messages = get_index_debug_messages(lambda: get_result("i = 7"))
+    assert ret == expected["i = 7"]
+    assert messages
+
+    def get_result_direct(where):
+        lyr.SetAttributeFilter(where)
+        ret = [f.GetFID() for f in lyr]
+        lyr.SetAttributeFilter(None)
+        return ret
+
+    ret, messages = get_index_debug_messages(lambda: get_result_direct("i = 7"))
+    assert ret == expected["i = 7"]
+    assert len(messages) == 1
+    assert "%d candidate" % len(expected["i = 7"]) in messages[0]
+
+    ret, messages = get_index_debug_messages(lambda: get_result_direct("i <> 7"))
+    assert ret == expected["i <> 7"]
+    assert not messages
+
+    for where in queries:
+        assert get_result_direct(where) == expected[where], where
+
+    # Indexes follow feature writes
+    f = lyr.GetFeature(7)
+    f["i"] = 7
+    f["s"] = "VAL3"
+    assert lyr.SetFeature(f) == ogr.OGRERR_NONE
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f["i"] = 15
+    f["r"] = 1.5
+    lyr.CreateFeature(f)
+    new_fid = f.GetFID()
+    lyr.DeleteFeature(expected["i = 7"][0])
+
+    with ds.ExecuteSQL("SELECT * FROM test WHERE i = 7") as sql_lyr:
+        fids = [f.GetFID() for f in sql_lyr]
+    assert 7 in fids
+    assert expected["i = 7"][0] not in fids
+    with ds.ExecuteSQL("SELECT * FROM test WHERE i BETWEEN 10 AND 20") as sql_lyr:
+        assert new_fid in [f.GetFID() for f in sql_lyr]
+    with ds.ExecuteSQL("SELECT * FROM test WHERE s = 'val3'") as sql_lyr:
+        assert 7 in [f.GetFID() for f in sql_lyr]
+
+    ds.ExecuteSQL("DROP INDEX ON test")
+    assert get_result("i = 7") == fids
+    assert get_result_direct("i = 7") == fids
+
+
+###############################################################################
+# In-memory indexes are refused on writable layers whose writes would not
+# keep them up to date
+
+
+def test_ogr_sql_create_index_in_memory_update_mode(tmp_path):
+
+    filename = str(tmp_path / "test.csv")
+    with open(filename, "wt") as f:
+        f.write("i\n")
+        for n in range(10):
+            f.write("%d\n" % n)
+
+    with ogr.Open(filename, update=1) as ds:
+        with pytest.raises(Exception, match="update mode"):
+            ds.ExecuteSQL("CREATE INDEX ON test USING i")
+
+    with ogr.Open(filename) as ds:
+        ds.ExecuteSQL("CREATE INDEX ON test USING i")
+        with ds.ExecuteSQL("SELECT * FROM test WHERE i = '7'") as sql_lyr:
+            assert [f["i"] for f in sql_lyr] == ["7"]
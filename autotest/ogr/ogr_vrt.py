@@ -3449,3 +3449,158 @@ def test_ogr_vrt_getfeature_optimization(tmp_path):
         assert m[f["i"]] == f.GetFID()
     lyr.SetAttributeFilter("1=0")
     assert lyr.TestCapability(ogr.OLCRandomRead) == 0
+
+
+###############################################################################
+# Test OGRVRTSpatialIndexedLayer
+
+
+@pytest.mark.require_driver("CSV")
+@pytest.mark.parametrize("fetch_by_fid", [False, True])
+def test_ogr_vrt_spatial_indexed_layer(tmp_path, fetch_by_fid):
+
+    csv_filename = tmp_path / "test.csv"
+    with open(csv_filename, "wt") as f:
+        f.write("id,WKT\n")
+        for i in range(1000):
+            x = i % 40
+            y = i // 40
+            f.write(f'{i},"LINESTRING ({x} {y},{x + 0.5} {y + 0.5})"\n')
+        f.write('1000,"POINT EMPTY"\n')
+        f.write("1001,\n")
+
+    vrt_filename = tmp_path / "test.vrt"
+    with open(vrt_filename, "wt") as f:
+        f.write(f"""<OGRVRTDataSource>
+    <OGRVRTSpatialIndexedLayer>
+        <OGRVRTLayer name="test">
+            <SrcDataSource relativeToVRT="1">test.csv</SrcDataSource>
+        </OGRVRTLayer>
+        <IndexFile relativeToVRT="1">test.csv.idx</IndexFile>
+        <FetchByFID>{"YES" if fetch_by_fid else "NO"}</FetchByFID>
+    </OGRVRTSpatialIndexedLayer>
+</OGRVRTDataSource>""")
+
+    def get_ids(lyr, filters, where=None):
+        lyr.SetAttributeFilter(where)
+        ret = []
+        for minx, miny, maxx, maxy in filters:
+            lyr.SetSpatialFilterRect(minx, miny, maxx, maxy)
+            ret.append([f["id"] for f in lyr])
+            assert lyr.GetFeatureCount() == len(ret[-1])
+        lyr.SetSpatialFilter(None)
+        lyr.SetAttributeFilter(None)
+        return ret
+
+    filters = [
+        (0, 0, 1, 1),
+        (10.6, 10.6, 10.9, 10.9),
+        (10.2, 3.2, 20.3, 7.7),
+        (-10, -10, -1, -1),
+        (-100, -100, 100, 100),
+    ]
+
+    with ogr.Open(csv_filename) as ds:
+        expected = get_ids(ds.GetLayer(0), filters)
+        expected_with_where = get_ids(ds.GetLayer(0), filters, "id % 3 = 0")
+    assert [len(x) for x in expected] == [4, 0, 55, 0, 1000]
+
+    with ogr.Open(vrt_filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetName() == "test"
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter) == fetch_by_fid
+        assert lyr.GetFeatureCount() == 1002
+        assert get_ids(lyr, filters) == expected
+        assert get_ids(lyr, filters, "id % 3 = 0") == expected_with_where
+        assert lyr.GetExtent() == (0, 39.5, 0, 24.5)
+        assert lyr.TestCapability(ogr.OLCFastGetExtent)
+
+    # The sidecar file is not written in read-only mode
+    assert not os.path.exists(tmp_path / "test.csv.idx")
+
+    with gdal.OpenEx(vrt_filename, gdal.OF_VECTOR | gdal.OF_UPDATE) as ds:
+        assert get_ids(ds.GetLayer(0), filters) == expected
+
+    assert os.path.exists(tmp_path / "test.csv.idx")
+
+    # Reuse the sidecar file
+    messages = []
+
+    def my_handler(errorClass, errno, msg):
+        messages.append(msg)
+
+    with gdaltest.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(
+        my_handler
+    ):
+        with ogr.Open(vrt_filename) as ds:
+            assert get_ids(ds.GetLayer(0), filters) == expected
+    assert any("Loaded spatial index" in msg for msg in messages)
+
+    # Modify the source file: the sidecar file must be ignored
+    with open(csv_filename, "at") as f:
+        f.write('1002,"POINT (0.5 0.5)"\n')
+    os.utime(csv_filename, (0, 0))
+    with ogr.Open(vrt_filename) as ds:
+        lyr = ds.GetLayer(0)
+        lyr.SetSpatialFilterRect(0, 0, 1, 1)
+        assert [f["id"] for f in lyr] == expected[0] + [1002]
+
+
+###############################################################################
+# Test that a OGRVRTSpatialIndexedLayer sidecar file is ignored when the
+# feature count changed, even if the size and modification time did not.
+
+
+@pytest.mark.require_driver("GeoJSON")
+def test_ogr_vrt_spatial_indexed_layer_feature_count_change(tmp_path):
+
+    def write_geojson(n, size=None):
+        features = ",".join(
+            '{"type":"Feature","properties":{"id":%d},'
+            '"geometry":{"type":"Point","coordinates":[%d,0]}}' % (i, i)
+            for i in range(n)
+        )
+        content = '{"type":"FeatureCollection","features":[%s]}' % features
+        if size:
+            content += " " * (size - len(content))
+        with open(tmp_path / "test.geojson", "wt") as f:
+            f.write(content)
+        return len(content)
+
+    size = write_geojson(10)
+    mtime = os.stat(tmp_path / "test.geojson").st_mtime
+
+    vrt_filename = tmp_path / "test.vrt"
+    with open(vrt_filename, "wt") as f:
+        f.write("""<OGRVRTDataSource>
+    <OGRVRTSpatialIndexedLayer>
+        <OGRVRTLayer name="test">
+            <SrcDataSource relativeToVRT="1">test.geojson</SrcDataSource>
+        </OGRVRTLayer>
+        <IndexFile relativeToVRT="1">test.geojson.idx</IndexFile>
+    </OGRVRTSpatialIndexedLayer>
+</OGRVRTDataSource>""")
+
+    with gdaltest.config_option("OGR_VRT_WRITE_SPATIAL_INDEX", "YES"):
+        with ogr.Open(vrt_filename) as ds:
+            lyr = ds.GetLayer(0)
+            lyr.SetSpatialFilterRect(-0.5, -1, 20, 1)
+            assert lyr.GetFeatureCount() == 10
+    assert os.path.exists(tmp_path / "test.geojson.idx")
+
+    write_geojson(9, size)
+    os.utime(tmp_path / "test.geojson", (mtime, mtime))
+
+    messages = []
+
+    def my_handler(errorClass, errno, msg):
+        messages.append(msg)
+
+    with gdaltest.config_option("CPL_DEBUG", "ON"), gdaltest.error_handler(
+        my_handler
+    ):
+        with ogr.Open(vrt_filename) as ds:
+            lyr = ds.GetLayer(0)
+            lyr.SetSpatialFilterRect(-0.5, -1, 20, 1)
+            assert [f["id"] for f in lyr] == list(range(9))
+    assert any("is out of date" in msg for msg in messages)
@@ -951,3 +951,47 @@ UNIT["Foot_US",0.30480060960121924],AUTHORITY["EPSG","102641"]]"""
     x, y, _ = ct.TransformPoint(-122, 39.3333333333333, 0)
     assert x == pytest.approx(6561666.667)
     assert y == pytest.approx(1640416.667)
+
+
+###############################################################################
+# Test that the native implementation of common projection conversions
+# matches PROJ
+
+
+@pytest.mark.parametrize(
+    "src_epsg,dst_epsg,lon_lat",
+    [
+        (4326, 32631, [(3, 40.5), (-2.5, -30), (8.9, 0.1), (3, 84)]),
+        (4326, 32761, [(0, -89), (45, -70), (-120, -80)]),
+        (4171, 2154, [(3, 46.5), (-4.5, 48.3), (8.2, 42.4), (2, 51)]),
+        (4269, 5070, [(-96, 23), (-120, 48), (-75, 35), (-80, 25.5)]),
+        (4326, 3031, [(0, -90), (30, -75), (-150, -60), (179.5, -85)]),
+        (4267, 32040, [(-96, 28.5), (-99, 27.8), (-94, 30)]),
+    ],
+)
+def test_osr_ct_native_conversions(src_epsg, dst_epsg, lon_lat):
+
+    src = osr.SpatialReference()
+    src.ImportFromEPSG(src_epsg)
+    src.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    dst = osr.SpatialReference()
+    dst.ImportFromEPSG(dst_epsg)
+    dst.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+
+    pts = [(lon, lat, 0) for lon, lat in lon_lat]
+
+    with gdal.config_option("OGR_CT_USE_NATIVE_CONVERSIONS", "NO"):
+        ct = osr.CoordinateTransformation(src, dst)
+        expected = ct.TransformPoints(pts)
+        expected_inv = ct.GetInverse().TransformPoints(expected)
+
+    ct = osr.CoordinateTransformation(src, dst)
+    got = ct.TransformPoints(pts)
+    got_inv = ct.GetInverse().TransformPoints(expected)
+
+    for i in range(len(pts)):
+        assert got[i][0] == pytest.approx(expected[i][0], abs=1e-4)
+        assert got[i][1] == pytest.approx(expected[i][1], abs=1e-4)
+        assert got_inv[i][1] == pytest.approx(expected_inv[i][1], abs=1e-9)
+        if abs(expected_inv[i][1]) < 90:
+            assert got_inv[i][0] == pytest.approx(expected_inv[i][0], abs=1e-9)
@@ -3052,6 +3052,65 @@ def test_ogr2ogr_lib_reproject_arrow_optim_ct(tmp_vsimem):
     assert f.GetGeometryRef().ExportToWkt() == "POINT (-1 2)"
 
 
+###############################################################################
+# Test multi-threaded geometry processing in the feature-by-feature code path
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.require_geos
+@pytest.mark.parametrize(
+    "options",
+    [
+        {"dstSRS": "EPSG:4326"},
+        {"dstSRS": "EPSG:4326", "clipDst": "POLYGON((2 0,2 90,4 90,4 0,2 0))"},
+        {"clipSrc": "POLYGON((0 0,0 5e6,5e5 5e6,5e5 0,0 0))", "makeValid": True},
+    ],
+)
+def test_ogr2ogr_lib_multithreaded_geom_processing(options):
+
+    srcDS = gdal.GetDriverByName("MEM").Create("", 0, 0, 0, gdal.GDT_Unknown)
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(32631)
+    srcLayer = srcDS.CreateLayer("test", srs=srs)
+    srcLayer.CreateField(ogr.FieldDefn("id", ogr.OFTInteger))
+    for i in range(100):
+        f = ogr.Feature(srcLayer.GetLayerDefn())
+        f["id"] = i
+        if i % 10 != 3:
+            x = 400000 + i * 2000
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POLYGON(({x} 4500000,{x} 4501000,{x+1000} 4501000,{x} 4500000))"
+                )
+            )
+        srcLayer.CreateFeature(f)
+
+    def translate(num_threads):
+        with gdaltest.config_options(
+            {
+                "OGR2OGR_USE_ARROW_API": "NO",
+                "GDAL_NUM_THREADS": num_threads,
+                "OGR2OGR_MT_BATCH_SIZE": "7",
+            }
+        ):
+            ds = gdal.VectorTranslate("", srcDS, format="MEM", **options)
+        lyr = ds.GetLayer(0)
+        return [
+            (
+                f["id"],
+                f.GetGeometryRef().ExportToIsoWkt() if f.GetGeometryRef() else None,
+            )
+            for f in lyr
+        ]
+
+    expected = translate("1")
+    assert len(expected) > 0
+    got = translate("4")
+    assert got == expected
+    ids = [id for id, _ in got]
+    assert ids == sorted(ids)
+
+
 ###############################################################################
 # Test -explodecollections on empty geometries
 
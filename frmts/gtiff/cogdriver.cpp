@@ -1414,8 +1414,17 @@ static GDALDataset *COGCreateCopy(const char *pszFilename, GDALDataset *poSrcDS,
                                   GDALProgressFunc pfnProgress,
                                   void *pProgressData)
 {
+    CPLStringList aosOptions(papszOptions);
+    if (EQUAL(aosOptions.FetchNameValueDef("COMPRESS", ""), "AUTO") &&
+        !GTiffResolveAutoCompression(GDALDataset::ToHandle(poSrcDS),
+                                     papszOptions, /* bForCOG = */ true,
+                                     aosOptions))
+    {
+        return nullptr;
+    }
     return GDALCOGCreator()
-        .Create(pszFilename, poSrcDS, papszOptions, pfnProgress, pProgressData)
+        .Create(pszFilename, poSrcDS, aosOptions.List(), pfnProgress,
+                pProgressData)
         .release();
 }
 
@@ -1624,7 +1633,23 @@ void GDALCOGDriver::InitializeCreationOptionList()
     osOptions += bHasLZW ? "LZW" : "NONE";
     osOptions += "'>";
     osOptions += osCompressValues;
-    osOptions += "   </Option>";
+    osOptions += "       <Value>AUTO</Value>"
+                 "   </Option>";
+
+    osOptions +=
+        "   <Option name='COMPRESS_AUTO_OBJECTIVE' type='string-select' "
+        "description='Selection criterion for COMPRESS=AUTO' "
+        "default='BALANCED'>"
+        "       <Value>SIZE</Value>"
+        "       <Value>BALANCED</Value>"
+        "       <Value>SPEED</Value>"
+        "   </Option>"
+        "   <Option name='COMPRESS_AUTO_SAMPLE_TILES' type='int' "
+        "description='Number of sample tiles benchmarked by COMPRESS=AUTO' "
+        "default='16'/>"
+        "   <Option name='COMPRESS_AUTO_REPORT' type='string' "
+        "description='File where COMPRESS=AUTO writes its benchmark report "
+        "as CSV'/>";
 
     osOptions +=
         "   <Option name='OVERVIEW_COMPRESS' type='string-select' default='";
@@ -1241,7 +1241,8 @@ void GDALRegister_GTiff()
     osOptions = "<CreationOptionList>"
                 "   <Option name='COMPRESS' type='string-select'>";
     osOptions += osCompressValues;
-    osOptions += "   </Option>";
+    osOptions += "       <Value>AUTO</Value>"
+                 "   </Option>";
     if (bHasLZW || bHasDEFLATE || bHasZSTD)
         osOptions += ""
                      "   <Option name='PREDICTOR' type='int' "
@@ -1341,6 +1342,19 @@ void GDALRegister_GTiff()
         ""
         "   <Option name='NUM_THREADS' type='string' description='Number of "
         "worker threads for compression. Can be set to ALL_CPUS' default='1'/>"
+        "   <Option name='COMPRESS_AUTO_OBJECTIVE' type='string-select' "
+        "description='Selection criterion for COMPRESS=AUTO' "
+        "default='BALANCED'>"
+        "       <Value>SIZE</Value>"
+        "       <Value>BALANCED</Value>"
+        "       <Value>SPEED</Value>"
+        "   </Option>"
+        "   <Option name='COMPRESS_AUTO_SAMPLE_TILES' type='int' "
+        "description='Number of sample tiles benchmarked by COMPRESS=AUTO' "
+        "default='16'/>"
+        "   <Option name='COMPRESS_AUTO_REPORT' type='string' "
+        "description='File where COMPRESS=AUTO writes its benchmark report "
+        "as CSV'/>"
         "   <Option name='NBITS' type='int' description='BITS for sub-byte "
         "files (1-7), sub-uint16_t (9-15), sub-uint32_t (17-31), or float32 "
         "(16)'/>"
@@ -1614,6 +1628,10 @@ void GDALRegister_GTiff()
         "   <Option name='IGNORE_COG_LAYOUT_BREAK' type='boolean' "
         "description='Allow update mode on files with COG structure' "
         "default='FALSE'/>"
+        "   <Option name='COG_INCREMENTAL_UPDATE' type='boolean' "
+        "description='Allow update mode on files with COG structure, and "
+        "refresh the overviews of the modified area when flushing' "
+        "default='FALSE'/>"
         "   <Option name='COLOR_TABLE_MULTIPLIER' type='string-select' "
         "description='Multiplication factor to apply to go from GDAL color "
         "table to TIFF color table' "
@@ -0,0 +1,505 @@
+/******************************************************************************
+ *
+ * Project:  GeoTIFF Driver
+ * Purpose:  Selection of the compression method with COMPRESS=AUTO, by
+ *           benchmarking candidate codecs on a sample of the source tiles.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gtiff.h"
+#include "tif_jxl.h"
+
+namespace
+{
+
+/************************************************************************/
+/*                       GTiffAutoCompressCandidate                     */
+/************************************************************************/
+
+struct GTiffAutoCompressCandidate
+{
+    const char *pszCompress = "NONE";
+    int nPredictor = 1;
+    // Name of the level creation option of the GTiff driver, or nullptr
+    const char *pszLevelKey = nullptr;
+    int nLevel = 0;
+
+    // Results of the benchmark
+    bool bOK = false;
+    vsi_l_offset nSize = 0;
+    double dfEncodeSeconds = 0;
+    double dfDecodeSeconds = 0;
+};
+
+/************************************************************************/
+/*                          BuildCandidates()                           */
+/************************************************************************/
+
+static std::vector<GTiffAutoCompressCandidate>
+BuildCandidates(GDALDataType eDT, CSLConstList papszOptions)
+{
+    const bool bIsComplex = CPL_TO_BOOL(GDALDataTypeIsComplex(eDT));
+    const bool bIsFloat = CPL_TO_BOOL(GDALDataTypeIsFloating(eDT));
+
+    // Only test the predictor imposed by the user, if any
+    std::vector<int> anPredictors;
+    if (const char *pszPredictor = CSLFetchNameValue(papszOptions, "PREDICTOR"))
+    {
+        if (EQUAL(pszPredictor, "NO") || EQUAL(pszPredictor, "FALSE"))
+            anPredictors.push_back(1);
+        else if (EQUAL(pszPredictor, "YES") || EQUAL(pszPredictor, "TRUE"))
+            anPredictors.push_back(bIsFloat ? 3 : 2);
+        else if (EQUAL(pszPredictor, "STANDARD"))
+            anPredictors.push_back(2);
+        else if (EQUAL(pszPredictor, "FLOATING_POINT"))
+            anPredictors.push_back(3);
+        else
+            anPredictors.push_back(atoi(pszPredictor));
+    }
+    else
+    {
+        anPredictors.push_back(1);
+        if (!bIsComplex)
+            anPredictors.push_back(bIsFloat ? 3 : 2);
+    }
+
+    std::vector<GTiffAutoCompressCandidate> aoCandidates;
+    const auto AddCandidate =
+        [&aoCandidates](const char *pszCompress, int nPredictor,
+                        const char *pszLevelKey, int nLevel)
+    {
+        GTiffAutoCompressCandidate oCandidate;
+        oCandidate.pszCompress = pszCompress;
+        oCandidate.nPredictor = nPredictor;
+        oCandidate.pszLevelKey = pszLevelKey;
+        oCandidate.nLevel = nLevel;
+        aoCandidates.push_back(oCandidate);
+    };
+
+    // Uncompressed reference, never selected
+    AddCandidate("NONE", 1, nullptr, 0);
+
+    for (int nPredictor : anPredictors)
+    {
+        if (TIFFIsCODECConfigured(COMPRESSION_LZW))
+            AddCandidate("LZW", nPredictor, nullptr, 0);
+        if (TIFFIsCODECConfigured(COMPRESSION_ADOBE_DEFLATE))
+        {
+            for (int nLevel : {1, 6, 9})
+                AddCandidate("DEFLATE", nPredictor, "ZLEVEL", nLevel);
+        }
+        if (TIFFIsCODECConfigured(COMPRESSION_ZSTD))
+        {
+            for (int nLevel : {1, 9, 15})
+                AddCandidate("ZSTD", nPredictor, "ZSTD_LEVEL", nLevel);
+        }
+        if (TIFFIsCODECConfigured(COMPRESSION_LZMA))
+            AddCandidate("LZMA", nPredictor, "LZMA_PRESET", 6);
+    }
+
+    // Codecs that do not use the TIFF predictor. Only their lossless
+    // settings are considered (default MAX_Z_ERROR=0 and JXL_LOSSLESS=YES).
+    if (!bIsComplex && TIFFIsCODECConfigured(COMPRESSION_LERC))
+    {
+        AddCandidate("LERC", 1, nullptr, 0);
+        if (TIFFIsCODECConfigured(COMPRESSION_ZSTD))
+            AddCandidate("LERC_ZSTD", 1, "ZSTD_LEVEL", 9);
+    }
+#ifdef HAVE_JXL
+    if ((eDT == GDT_UInt8 || eDT == GDT_UInt16 || eDT == GDT_Float32) &&
+        TIFFIsCODECConfigured(COMPRESSION_JXL))
+    {
+        for (int nEffort : {3, 7})
+            AddCandidate("JXL", 1, "JXL_EFFORT", nEffort);
+    }
+#endif
+
+    return aoCandidates;
+}
+
+/************************************************************************/
+/*                          RunCandidate()                              */
+/************************************************************************/
+
+// Compress the sample tiles, stacked vertically in a single strip-organized
+// file with one tile per strip, and decompress them back.
+static void RunCandidate(GTiffAutoCompressCandidate &oCandidate,
+                         const std::vector<GByte> &abySamples, int nTileXSize,
+                         int nTileYSize, int nTiles, int nBands,
+                         GDALDataType eDT, const CPLStringList &aosBaseOptions)
+{
+    GDALDriver *poGTiffDriver =
+        GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDriver)
+        return;
+
+    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+    CPLErrorStateBackuper oErrorStateBackuper;
+
+    CPLStringList aosOptions(aosBaseOptions);
+    aosOptions.SetNameValue("COMPRESS", oCandidate.pszCompress);
+    if (oCandidate.nPredictor != 1)
+        aosOptions.SetNameValue("PREDICTOR",
+                                CPLSPrintf("%d", oCandidate.nPredictor));
+    if (oCandidate.pszLevelKey)
+        aosOptions.SetNameValue(oCandidate.pszLevelKey,
+                                CPLSPrintf("%d", oCandidate.nLevel));
+
+    const std::string osFilename =
+        VSIMemGenerateHiddenFilename("gtiff_compress_auto.tif");
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    const GSpacing nPixelSpace = static_cast<GSpacing>(nDTSize) * nBands;
+    const GSpacing nLineSpace = nPixelSpace * nTileXSize;
+    const int nHeight = nTileYSize * nTiles;
+
+    const auto tStartEncode = std::chrono::steady_clock::now();
+    std::unique_ptr<GDALDataset> poDS(
+        poGTiffDriver->Create(osFilename.c_str(), nTileXSize, nHeight, nBands,
+                              eDT, aosOptions.List()));
+    bool bOK = poDS &&
+               poDS->RasterIO(GF_Write, 0, 0, nTileXSize, nHeight,
+                              const_cast<GByte *>(abySamples.data()),
+                              nTileXSize, nHeight, eDT, nBands, nullptr,
+                              nPixelSpace, nLineSpace, nDTSize,
+                              nullptr) == CE_None;
+    bOK = poDS && poDS->Close() == CE_None && bOK;
+    poDS.reset();
+    const auto tEndEncode = std::chrono::steady_clock::now();
+
+    VSIStatBufL sStat;
+    if (bOK && VSIStatL(osFilename.c_str(), &sStat) == 0)
+    {
+        std::vector<GByte> abyDecoded(abySamples.size());
+        const auto tStartDecode = std::chrono::steady_clock::now();
+        poDS.reset(GDALDataset::Open(osFilename.c_str(), GDAL_OF_RASTER));
+        bOK = poDS &&
+              poDS->RasterIO(GF_Read, 0, 0, nTileXSize, nHeight,
+                             abyDecoded.data(), nTileXSize, nHeight, eDT,
+                             nBands, nullptr, nPixelSpace, nLineSpace, nDTSize,
+                             nullptr) == CE_None;
+        poDS.reset();
+        const auto tEndDecode = std::chrono::steady_clock::now();
+
+        // Only lossless settings are expected to be tested, but check it in
+        // case a codec would silently alter the data (e.g. JXL on data types
+        // it does not handle losslessly)
+        if (bOK && abyDecoded == abySamples)
+        {
+            oCandidate.bOK = true;
+            oCandidate.nSize = sStat.st_size;
+            oCandidate.dfEncodeSeconds =
+                std::chrono::duration<double>(tEndEncode - tStartEncode)
+                    .count();
+            oCandidate.dfDecodeSeconds =
+                std::chrono::duration<double>(tEndDecode - tStartDecode)
+                    .count();
+        }
+    }
+    VSIUnlink(osFilename.c_str());
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                    GTiffResolveAutoCompression()                     */
+/************************************************************************/
+
+/** Resolve COMPRESS=AUTO into an explicit compression method, predictor
+ * and level, by benchmarking lossless candidates on a sample of the tiles of
+ * the source dataset.
+ *
+ * The following creation options are taken into account:
+ * - COMPRESS_AUTO_OBJECTIVE=SIZE/BALANCED/SPEED: SIZE selects the candidate
+ *   producing the smallest output, SPEED the one with the fastest decoding,
+ *   and BALANCED (default) the one with the fastest decoding among the
+ *   candidates whose output is at most 5% larger than the smallest one.
+ * - COMPRESS_AUTO_SAMPLE_TILES=n: number of tiles to sample (default 16).
+ * - COMPRESS_AUTO_REPORT=filename: file (e.g. /vsistdout/) where to write
+ *   the measurements of each candidate.
+ * - NUM_THREADS: number of candidates benchmarked concurrently.
+ *
+ * @param hSrcDS Source dataset.
+ * @param papszOptions Creation options, with COMPRESS=AUTO.
+ * @param bForCOG Whether the options are for the COG driver (in which case
+ * the predictor and level are set with its PREDICTOR and LEVEL options).
+ * @param[out] aosResolvedOptions Copy of papszOptions with COMPRESS, and
+ * possibly PREDICTOR and level options, set to the selected candidate.
+ * @return true in case of success.
+ */
+bool GTiffResolveAutoCompression(GDALDatasetH hSrcDS,
+                                 CSLConstList papszOptions, bool bForCOG,
+                                 CPLStringList &aosResolvedOptions)
+{
+    GDALDataset *poSrcDS = GDALDataset::FromHandle(hSrcDS);
+    const int nBands = poSrcDS->GetRasterCount();
+    const int nXSize = poSrcDS->GetRasterXSize();
+    const int nYSize = poSrcDS->GetRasterYSize();
+    if (nBands == 0 || nXSize == 0 || nYSize == 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "COMPRESS=AUTO requires a non-empty source raster");
+        return false;
+    }
+    const GDALDataType eDT = poSrcDS->GetRasterBand(1)->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+
+    const char *pszObjective =
+        CSLFetchNameValueDef(papszOptions, "COMPRESS_AUTO_OBJECTIVE",
+                             "BALANCED");
+    if (!EQUAL(pszObjective, "SIZE") && !EQUAL(pszObjective, "BALANCED") &&
+        !EQUAL(pszObjective, "SPEED"))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Invalid value for COMPRESS_AUTO_OBJECTIVE: %s", pszObjective);
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Determine the dimension of the tiles (or strips) to sample.     */
+    /* -------------------------------------------------------------------- */
+    int nTileXSize;
+    int nTileYSize;
+    if (bForCOG)
+    {
+        nTileXSize =
+            atoi(CSLFetchNameValueDef(papszOptions, "BLOCKSIZE", "512"));
+        nTileYSize = nTileXSize;
+    }
+    else if (CPLTestBool(CSLFetchNameValueDef(papszOptions, "TILED", "NO")))
+    {
+        nTileXSize =
+            atoi(CSLFetchNameValueDef(papszOptions, "BLOCKXSIZE", "256"));
+        nTileYSize =
+            atoi(CSLFetchNameValueDef(papszOptions, "BLOCKYSIZE", "256"));
+    }
+    else
+    {
+        // Strips of about 8 KB, as done by TIFFDefaultStripSize()
+        nTileXSize = nXSize;
+        const GIntBig nLineSize =
+            static_cast<GIntBig>(nXSize) * nBands * nDTSize;
+        nTileYSize = atoi(CSLFetchNameValueDef(
+            papszOptions, "BLOCKYSIZE",
+            CPLSPrintf("%d", static_cast<int>(std::max<GIntBig>(
+                                 1, 8192 / std::max<GIntBig>(1, nLineSize))))));
+    }
+    nTileXSize = std::max(1, std::min(nTileXSize, nXSize));
+    nTileYSize = std::max(1, std::min(nTileYSize, nYSize));
+
+    const size_t nTileBytes =
+        static_cast<size_t>(nTileXSize) * nTileYSize * nBands * nDTSize;
+    constexpr size_t MAX_SAMPLE_BYTES = 256 * 1024 * 1024;
+    int nTiles = std::max(
+        1, atoi(CSLFetchNameValueDef(papszOptions, "COMPRESS_AUTO_SAMPLE_TILES",
+                                     "16")));
+    nTiles = static_cast<int>(
+        std::max<size_t>(1, std::min(static_cast<size_t>(nTiles),
+                                     MAX_SAMPLE_BYTES / nTileBytes)));
+    const int nTilesPerRow = static_cast<int>(
+        std::ceil(std::sqrt(static_cast<double>(nTiles))));
+    const int nTilesPerCol = DIV_ROUND_UP(nTiles, nTilesPerRow);
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the sample tiles, spread regularly over the source.        */
+    /* -------------------------------------------------------------------- */
+    std::vector<GByte> abySamples;
+    try
+    {
+        abySamples.resize(nTileBytes * nTiles);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for COMPRESS=AUTO samples");
+        return false;
+    }
+    const GSpacing nPixelSpace = static_cast<GSpacing>(nDTSize) * nBands;
+    for (int i = 0; i < nTiles; ++i)
+    {
+        const int iCol = i % nTilesPerRow;
+        const int iRow = i / nTilesPerRow;
+        const int nXOff = static_cast<int>(
+            static_cast<double>(nXSize - nTileXSize) * (iCol + 0.5) /
+            nTilesPerRow);
+        const int nYOff = static_cast<int>(
+            static_cast<double>(nYSize - nTileYSize) * (iRow + 0.5) /
+            nTilesPerCol);
+        if (poSrcDS->RasterIO(GF_Read, nXOff, nYOff, nTileXSize, nTileYSize,
+                              abySamples.data() + i * nTileBytes, nTileXSize,
+                              nTileYSize, eDT, nBands, nullptr, nPixelSpace,
+                              nPixelSpace * nTileXSize, nDTSize,
+                              nullptr) != CE_None)
+        {
+            return false;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Benchmark the candidates, possibly in parallel.                 */
+    /* -------------------------------------------------------------------- */
+    CPLStringList aosBaseOptions;
+    aosBaseOptions.SetNameValue("TILED", "NO");
+    aosBaseOptions.SetNameValue("BLOCKYSIZE", CPLSPrintf("%d", nTileYSize));
+    aosBaseOptions.SetNameValue("INTERLEAVE",
+                                CSLFetchNameValue(papszOptions, "INTERLEAVE"));
+
+    auto aoCandidates = BuildCandidates(eDT, papszOptions);
+
+    const int nThreads =
+        GDALGetNumThreads(papszOptions, "NUM_THREADS",
+                          GDAL_DEFAULT_MAX_THREAD_COUNT,
+                          /* bDefaultToAllCPUs=*/false);
+    auto poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>();
+    for (auto &oCandidate : aoCandidates)
+    {
+        const auto RunJob = [&oCandidate, &abySamples, nTileXSize, nTileYSize,
+                             nTiles, nBands, eDT, &aosBaseOptions]()
+        {
+            RunCandidate(oCandidate, abySamples, nTileXSize, nTileYSize,
+                         nTiles, nBands, eDT, aosBaseOptions);
+        };
+        if (!poJobQueue || !poJobQueue->SubmitJob(RunJob))
+            RunJob();
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+
+    /* -------------------------------------------------------------------- */
+    /*      Select the best candidate according to the objective.           */
+    /* -------------------------------------------------------------------- */
+    vsi_l_offset nMinSize = std::numeric_limits<vsi_l_offset>::max();
+    for (const auto &oCandidate : aoCandidates)
+    {
+        if (oCandidate.bOK && !EQUAL(oCandidate.pszCompress, "NONE"))
+            nMinSize = std::min(nMinSize, oCandidate.nSize);
+    }
+    const double dfSizeTolerance = EQUAL(pszObjective, "SIZE")       ? 1.0
+                                   : EQUAL(pszObjective, "BALANCED") ? 1.05
+                                                                     : 0.0;
+    const GTiffAutoCompressCandidate *poBest = nullptr;
+    for (const auto &oCandidate : aoCandidates)
+    {
+        if (!oCandidate.bOK || EQUAL(oCandidate.pszCompress, "NONE") ||
+            (dfSizeTolerance > 0 &&
+             static_cast<double>(oCandidate.nSize) >
+                 static_cast<double>(nMinSize) * dfSizeTolerance))
+        {
+            continue;
+        }
+        if (poBest == nullptr ||
+            (EQUAL(pszObjective, "SIZE")
+                 ? (oCandidate.nSize < poBest->nSize ||
+                    (oCandidate.nSize == poBest->nSize &&
+                     oCandidate.dfDecodeSeconds < poBest->dfDecodeSeconds))
+                 : oCandidate.dfDecodeSeconds < poBest->dfDecodeSeconds))
+        {
+            poBest = &oCandidate;
+        }
+    }
+    if (poBest == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "COMPRESS=AUTO: no compression method could be evaluated");
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Report the measurements.                                        */
+    /* -------------------------------------------------------------------- */
+    const double dfSampleMB =
+        static_cast<double>(abySamples.size()) / (1024.0 * 1024.0);
+    std::string osReport(
+        "COMPRESS,PREDICTOR,LEVEL,SIZE,RATIO,ENCODE_MB_PER_SEC,"
+        "DECODE_MB_PER_SEC,SELECTED\n");
+    for (const auto &oCandidate : aoCandidates)
+    {
+        if (!oCandidate.bOK)
+            continue;
+        const std::string osLine = CPLSPrintf(
+            "%s,%d,%s,%" PRIu64 ",%.3f,%.1f,%.1f,%s\n", oCandidate.pszCompress,
+            oCandidate.nPredictor,
+            oCandidate.pszLevelKey ? CPLSPrintf("%d", oCandidate.nLevel) : "",
+            static_cast<uint64_t>(oCandidate.nSize),
+            static_cast<double>(abySamples.size()) /
+                static_cast<double>(
+                    std::max<vsi_l_offset>(1, oCandidate.nSize)),
+            dfSampleMB / std::max(1e-9, oCandidate.dfEncodeSeconds),
+            dfSampleMB / std::max(1e-9, oCandidate.dfDecodeSeconds),
+            &oCandidate == poBest ? "YES" : "NO");
+        CPLDebug("GTiff", "COMPRESS=AUTO: %s", osLine.c_str());
+        osReport += osLine;
+    }
+    if (const char *pszReport =
+            CSLFetchNameValue(papszOptions, "COMPRESS_AUTO_REPORT"))
+    {
+        VSILFILE *fp = VSIFOpenL(pszReport, "wb");
+        if (fp == nullptr ||
+            VSIFWriteL(osReport.data(), 1, osReport.size(), fp) !=
+                osReport.size())
+        {
+            CPLError(CE_Warning, CPLE_FileIO, "Cannot write %s", pszReport);
+        }
+        if (fp)
+            VSIFCloseL(fp);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Substitute the selected settings in the creation options.       */
+    /* -------------------------------------------------------------------- */
+    aosResolvedOptions = CPLStringList(papszOptions);
+    aosResolvedOptions.SetNameValue("COMPRESS", poBest->pszCompress);
+    if (bForCOG)
+    {
+        aosResolvedOptions.SetNameValue(
+            "PREDICTOR", poBest->nPredictor == 1
+                             ? "NO"
+                             : CPLSPrintf("%d", poBest->nPredictor));
+        if (poBest->pszLevelKey && !STARTS_WITH(poBest->pszLevelKey, "JXL"))
+            aosResolvedOptions.SetNameValue("LEVEL",
+                                            CPLSPrintf("%d", poBest->nLevel));
+        else if (poBest->pszLevelKey)
+            aosResolvedOptions.SetNameValue(poBest->pszLevelKey,
+                                            CPLSPrintf("%d", poBest->nLevel));
+    }
+    else
+    {
+        aosResolvedOptions.SetNameValue(
+            "PREDICTOR", CPLSPrintf("%d", poBest->nPredictor));
+        if (poBest->pszLevelKey)
+            aosResolvedOptions.SetNameValue(poBest->pszLevelKey,
+                                            CPLSPrintf("%d", poBest->nLevel));
+    }
+    CPLDebug("GTiff", "COMPRESS=AUTO resolved to COMPRESS=%s, PREDICTOR=%d%s%s",
+             poBest->pszCompress, poBest->nPredictor,
+             poBest->pszLevelKey ? ", " : "",
+             poBest->pszLevelKey
+                 ? CPLSPrintf("%s=%d", poBest->pszLevelKey, poBest->nLevel)
+                 : "");
+
+    return true;
+}
@@ -29,6 +29,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "gtiff.h"
 #include "gtiffdataset.h"
 #include "tiff.h"
@@ -1122,11 +1123,17 @@ CPLErr GTIFFBuildOverviewsEx(const char *pszFilename, int nBands,
             bHasAlphaBand = true;
     }
 
+    // When several threads are available, generating all the bands chunk by
+    // chunk enables their resampling to be run concurrently.
+    const int nThreads = GDALGetNumThreads(
+        papszOptions, "NUM_THREADS", GDAL_DEFAULT_MAX_THREAD_COUNT,
+        /* bDefaultToAllCPUs=*/false);
+
     const auto poColorTable = papoBandList[0]->GetColorTable();
     if (((((bSourceIsPixelInterleaved && bSourceIsJPEG2000) ||
            (nCompression != COMPRESSION_NONE)) &&
           nPlanarConfig == PLANARCONFIG_CONTIG) ||
-         bHasAlphaBand) &&
+         bHasAlphaBand || (nThreads > 1 && nBands > 1)) &&
         !GDALDataTypeIsComplex(papoBandList[0]->GetRasterDataType()) &&
         (poColorTable == nullptr || STARTS_WITH_CI(pszResampling, "NEAR") ||
          poColorTable->IsIdentity()) &&
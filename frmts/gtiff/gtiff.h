@@ -75,6 +75,10 @@ CPLString CPL_DLL GTiffGetCompressValues(bool &bHasLZW, bool &bHasDEFLATE,
                                          bool &bHasJPEG, bool &bHasWebP,
                                          bool &bHasLERC, bool bForCOG);
 
+bool GTiffResolveAutoCompression(GDALDatasetH hSrcDS,
+                                 CSLConstList papszOptions, bool bForCOG,
+                                 CPLStringList &aosResolvedOptions);
+
 int &GTIFFGetThreadLocalLibtiffError();
 
 #if !defined(TIFFTAG_GDAL_METADATA)
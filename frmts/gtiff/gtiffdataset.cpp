@@ -101,7 +101,7 @@ GTiffDataset::GTiffDataset()
       m_bMaskInterleavedWithImagery(false), m_bKnownIncompatibleEdition(false),
       m_bWriteKnownIncompatibleEdition(false), m_bHasUsedReadEncodedAPI(false),
       m_bWriteCOGLayout(false), m_bTileInterleave(false),
-      m_bLayoutChecked(false)
+      m_bLayoutChecked(false), m_bCOGIncrementalUpdate(false)
 {
     // CPLDebug("GDAL", "sizeof(GTiffDataset) = %d bytes", static_cast<int>(
     //     sizeof(GTiffDataset)));
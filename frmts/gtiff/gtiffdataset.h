@@ -16,6 +16,7 @@
 
 #include "gdal_pam.h"
 
+#include <limits>
 #include <mutex>
 #include <queue>
 
@@ -102,6 +103,7 @@ class GTiffDataset final : public GDALPamDataset
     friend class GTiffRGBABand;
     friend class GTiffSplitBand;
     friend class GTiffSplitBitmapBand;
+    friend struct GTiffDecompressContext;
 
     friend void GTIFFSetJpegQuality(GDALDatasetH hGTIFFDS, int nJpegQuality);
     friend void GTIFFSetJpegTablesMode(GDALDatasetH hGTIFFDS,
@@ -189,6 +191,15 @@ class GTiffDataset final : public GDALPamDataset
     int m_nRefBaseMapping = 0;
     int m_nDisableMultiThreadedRead = 0;
 
+    // Bounding box, in pixels of the full resolution image, of the striles
+    // written since the last overview refresh, when the file has been opened
+    // with the COG_INCREMENTAL_UPDATE open option. Empty if m_nDirtyXMin >
+    // m_nDirtyXMax.
+    int m_nDirtyXMin = std::numeric_limits<int>::max();
+    int m_nDirtyYMin = std::numeric_limits<int>::max();
+    int m_nDirtyXMax = -1;
+    int m_nDirtyYMax = -1;
+
     struct JPEGOverviewVisibilitySetter
     {
         signed char &nCounter_;
@@ -330,6 +341,7 @@ class GTiffDataset final : public GDALPamDataset
     bool m_bWriteCOGLayout : 1;
     bool m_bTileInterleave : 1;
     bool m_bLayoutChecked : 1;
+    bool m_bCOGIncrementalUpdate : 1;
 
     void ScanDirectories();
     bool ReadStrile(int nBlockId, void *pOutputBuffer,
@@ -373,6 +385,8 @@ class GTiffDataset final : public GDALPamDataset
     CPLErr FillEmptyTiles();
 
     CPLErr FlushDirectory();
+    void MarkStripOrTileDirty(uint32_t nStripOrTile);
+    CPLErr RefreshDirtyOverviews();
     CPLErr CleanOverviews();
 
     void LoadMetadata();
@@ -390,7 +404,8 @@ class GTiffDataset final : public GDALPamDataset
 
     void DiscardLsb(GByte *pabyBuffer, GPtrDiff_t nBytes, int iBand) const;
     void GetDiscardLsbOption(CSLConstList papszOptions);
-    void InitCompressionThreads(bool bUpdateMode, CSLConstList papszOptions);
+    void InitCompressionThreads(bool bUpdateMode, CSLConstList papszOptions,
+                                bool bForOverviews = false);
     void InitCreationOrOpenOptions(bool bUpdateMode, CSLConstList papszOptions);
     static void ThreadCompressionFunc(void *pData);
     void WaitCompletionForJobIdx(int i);
@@ -413,6 +428,9 @@ class GTiffDataset final : public GDALPamDataset
                  GSpacing nPixelSpace, GSpacing nLineSpace, GSpacing nBandSpace,
                  GDALRasterIOExtraArg *psExtraArg);
 
+    bool IsVirtualMemIOCompatible();
+    bool CreateVirtualMemIOMapping(bool bCheckAvailableRAM);
+
     int VirtualMemIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
                      int nYSize, void *pData, int nBufXSize, int nBufYSize,
                      GDALDataType eBufType, int nBandCount,
@@ -332,6 +332,38 @@ CPLErr GTiffDataset::ReadCompressedData(const char *pszFormat, int nXOff,
     return CE_Failure;
 }
 
+/************************************************************************/
+/*                       GTiffDecompressTmpTIFF                         */
+/************************************************************************/
+
+// In-memory TIFF file with the tags of the source file, used by
+// ThreadDecompressionFunc() to decode a single strile with
+// TIFFReadFromUserBuffer(). It is kept alive across jobs, so that codec
+// initialization (e.g. JPEG tables parsing) is only done once per worker
+// thread, rather than once per strile.
+struct GTiffDecompressTmpTIFF
+{
+    CPLString osFilename{};
+    VSILFILE *fp = nullptr;
+    TIFF *hTIFF = nullptr;
+    int nBlockYSize = 0;
+
+    GTiffDecompressTmpTIFF() = default;
+
+    ~GTiffDecompressTmpTIFF()
+    {
+        if (hTIFF)
+            XTIFFClose(hTIFF);
+        if (fp)
+        {
+            CPL_IGNORE_RET_VAL(VSIFCloseL(fp));
+            VSIUnlink(osFilename.c_str());
+        }
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(GTiffDecompressTmpTIFF)
+};
+
 struct GTiffDecompressContext
 {
     // The mutex must be recursive because ThreadDecompressionFuncErrorHandler()
@@ -379,8 +411,128 @@ struct GTiffDecompressContext
 
     uint16_t *pExtraSamples = nullptr;
     uint16_t nExtraSampleCount = 0;
+
+    // Temporary TIFF handles not currently used by a job. Protected by oMutex
+    std::vector<std::unique_ptr<GTiffDecompressTmpTIFF>> apoTmpTIFFPool{};
+
+    std::unique_ptr<GTiffDecompressTmpTIFF> AcquireTmpTIFF(int nBlockYSize);
+    void ReleaseTmpTIFF(std::unique_ptr<GTiffDecompressTmpTIFF> &&poTmpTIFF);
 };
 
+/************************************************************************/
+/*                           AcquireTmpTIFF()                           */
+/************************************************************************/
+
+std::unique_ptr<GTiffDecompressTmpTIFF>
+GTiffDecompressContext::AcquireTmpTIFF(int nBlockYSize)
+{
+    {
+        std::lock_guard<std::recursive_mutex> oLock(oMutex);
+        for (auto oIter = apoTmpTIFFPool.begin();
+             oIter != apoTmpTIFFPool.end(); ++oIter)
+        {
+            if ((*oIter)->nBlockYSize == nBlockYSize)
+            {
+                auto poRet = std::move(*oIter);
+                apoTmpTIFFPool.erase(oIter);
+                return poRet;
+            }
+        }
+    }
+
+    // Generate a dummy in-memory TIFF file that has all the needed tags
+    // from the original file
+    auto poTmpTIFF = std::make_unique<GTiffDecompressTmpTIFF>();
+    poTmpTIFF->nBlockYSize = nBlockYSize;
+    poTmpTIFF->osFilename = VSIMemGenerateHiddenFilename("decompress.tif");
+    poTmpTIFF->fp = VSIFOpenL(poTmpTIFF->osFilename.c_str(), "wb+");
+    TIFF *hTIFFTmp =
+        VSI_TIFFOpen(poTmpTIFF->osFilename.c_str(),
+                     bTIFFIsBigEndian ? "wb+" : "wl+", poTmpTIFF->fp);
+    CPLAssert(hTIFFTmp != nullptr);
+    TIFFSetField(hTIFFTmp, TIFFTAG_IMAGEWIDTH, poDS->m_nBlockXSize);
+    TIFFSetField(hTIFFTmp, TIFFTAG_IMAGELENGTH, nBlockYSize);
+    TIFFSetField(hTIFFTmp, TIFFTAG_BITSPERSAMPLE, poDS->m_nBitsPerSample);
+    TIFFSetField(hTIFFTmp, TIFFTAG_COMPRESSION, poDS->m_nCompression);
+    TIFFSetField(hTIFFTmp, TIFFTAG_PHOTOMETRIC, poDS->m_nPhotometric);
+    TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLEFORMAT, poDS->m_nSampleFormat);
+    TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLESPERPIXEL,
+                 poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
+                     ? poDS->m_nSamplesPerPixel
+                     : 1);
+    TIFFSetField(hTIFFTmp, TIFFTAG_ROWSPERSTRIP, nBlockYSize);
+    TIFFSetField(hTIFFTmp, TIFFTAG_PLANARCONFIG, poDS->m_nPlanarConfig);
+    if (nPredictor != PREDICTOR_NONE)
+        TIFFSetField(hTIFFTmp, TIFFTAG_PREDICTOR, nPredictor);
+    if (poDS->m_nCompression == COMPRESSION_LERC)
+    {
+        TIFFSetField(hTIFFTmp, TIFFTAG_LERC_PARAMETERS, 2,
+                     poDS->m_anLercAddCompressionAndVersion);
+    }
+    else if (poDS->m_nCompression == COMPRESSION_JPEG)
+    {
+        if (pJPEGTable)
+        {
+            TIFFSetField(hTIFFTmp, TIFFTAG_JPEGTABLES, nJPEGTableSize,
+                         pJPEGTable);
+        }
+        if (poDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
+        {
+            TIFFSetField(hTIFFTmp, TIFFTAG_YCBCRSUBSAMPLING,
+                         nYCrbCrSubSampling0, nYCrbCrSubSampling1);
+        }
+    }
+    if (poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
+    {
+        if (pExtraSamples)
+        {
+            TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES, nExtraSampleCount,
+                         pExtraSamples);
+        }
+        else
+        {
+            const int nSamplesAccountedFor =
+                poDS->m_nPhotometric == PHOTOMETRIC_RGB          ? 3
+                : poDS->m_nPhotometric == PHOTOMETRIC_MINISBLACK ? 1
+                                                                 : 0;
+            if (nSamplesAccountedFor > 0 &&
+                poDS->m_nSamplesPerPixel > nSamplesAccountedFor)
+            {
+                // If the input image is not compliant regarndig ExtraSamples,
+                // generate a synthetic one to avoid gazillons of warnings
+                const auto nSyntheticExtraSampleCount = static_cast<uint16_t>(
+                    poDS->m_nSamplesPerPixel - nSamplesAccountedFor);
+                std::vector<uint16_t> anExtraSamples(
+                    nSyntheticExtraSampleCount, EXTRASAMPLE_UNSPECIFIED);
+                TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES,
+                             nSyntheticExtraSampleCount, anExtraSamples.data());
+            }
+        }
+    }
+    TIFFWriteCheck(hTIFFTmp, FALSE, "ThreadDecompressionFunc");
+    TIFFWriteDirectory(hTIFFTmp);
+    XTIFFClose(hTIFFTmp);
+
+    // Re-open file
+    poTmpTIFF->hTIFF =
+        VSI_TIFFOpen(poTmpTIFF->osFilename.c_str(), "r", poTmpTIFF->fp);
+    CPLAssert(poTmpTIFF->hTIFF != nullptr);
+    poDS->RestoreVolatileParameters(poTmpTIFF->hTIFF);
+
+    return poTmpTIFF;
+}
+
+/************************************************************************/
+/*                           ReleaseTmpTIFF()                           */
+/************************************************************************/
+
+void GTiffDecompressContext::ReleaseTmpTIFF(
+    std::unique_ptr<GTiffDecompressTmpTIFF> &&poTmpTIFF)
+{
+    std::lock_guard<std::recursive_mutex> oLock(oMutex);
+    apoTmpTIFFPool.push_back(std::move(poTmpTIFF));
+}
+
 struct GTiffDecompressJob
 {
     GTiffDecompressContext *psContext = nullptr;
@@ -671,15 +823,6 @@ struct GTiffDecompressJob
 
     if (nAlreadyLoadedBlocks != nBandsToCache)
     {
-        // Generate a dummy in-memory TIFF file that has all the needed tags
-        // from the original file
-        const CPLString osTmpFilename(
-            VSIMemGenerateHiddenFilename("decompress.tif"));
-        VSILFILE *fpTmp = VSIFOpenL(osTmpFilename.c_str(), "wb+");
-        TIFF *hTIFFTmp =
-            VSI_TIFFOpen(osTmpFilename.c_str(),
-                         psContext->bTIFFIsBigEndian ? "wb+" : "wl+", fpTmp);
-        CPLAssert(hTIFFTmp != nullptr);
         const int nBlockYSize =
             (psContext->bIsTiled ||
              psJob->nYBlock < poDS->m_nBlocksPerColumn - 1)
@@ -687,75 +830,7 @@ struct GTiffDecompressJob
             : (poDS->nRasterYSize % poDS->m_nBlockYSize) == 0
                 ? poDS->m_nBlockYSize
                 : poDS->nRasterYSize % poDS->m_nBlockYSize;
-        TIFFSetField(hTIFFTmp, TIFFTAG_IMAGEWIDTH, poDS->m_nBlockXSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_IMAGELENGTH, nBlockYSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_BITSPERSAMPLE, poDS->m_nBitsPerSample);
-        TIFFSetField(hTIFFTmp, TIFFTAG_COMPRESSION, poDS->m_nCompression);
-        TIFFSetField(hTIFFTmp, TIFFTAG_PHOTOMETRIC, poDS->m_nPhotometric);
-        TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLEFORMAT, poDS->m_nSampleFormat);
-        TIFFSetField(hTIFFTmp, TIFFTAG_SAMPLESPERPIXEL,
-                     poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
-                         ? poDS->m_nSamplesPerPixel
-                         : 1);
-        TIFFSetField(hTIFFTmp, TIFFTAG_ROWSPERSTRIP, nBlockYSize);
-        TIFFSetField(hTIFFTmp, TIFFTAG_PLANARCONFIG, poDS->m_nPlanarConfig);
-        if (psContext->nPredictor != PREDICTOR_NONE)
-            TIFFSetField(hTIFFTmp, TIFFTAG_PREDICTOR, psContext->nPredictor);
-        if (poDS->m_nCompression == COMPRESSION_LERC)
-        {
-            TIFFSetField(hTIFFTmp, TIFFTAG_LERC_PARAMETERS, 2,
-                         poDS->m_anLercAddCompressionAndVersion);
-        }
-        else if (poDS->m_nCompression == COMPRESSION_JPEG)
-        {
-            if (psContext->pJPEGTable)
-            {
-                TIFFSetField(hTIFFTmp, TIFFTAG_JPEGTABLES,
-                             psContext->nJPEGTableSize, psContext->pJPEGTable);
-            }
-            if (poDS->m_nPhotometric == PHOTOMETRIC_YCBCR)
-            {
-                TIFFSetField(hTIFFTmp, TIFFTAG_YCBCRSUBSAMPLING,
-                             psContext->nYCrbCrSubSampling0,
-                             psContext->nYCrbCrSubSampling1);
-            }
-        }
-        if (poDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
-        {
-            if (psContext->pExtraSamples)
-            {
-                TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES,
-                             psContext->nExtraSampleCount,
-                             psContext->pExtraSamples);
-            }
-            else
-            {
-                const int nSamplesAccountedFor =
-                    poDS->m_nPhotometric == PHOTOMETRIC_RGB          ? 3
-                    : poDS->m_nPhotometric == PHOTOMETRIC_MINISBLACK ? 1
-                                                                     : 0;
-                if (nSamplesAccountedFor > 0 &&
-                    poDS->m_nSamplesPerPixel > nSamplesAccountedFor)
-                {
-                    // If the input image is not compliant regarndig ExtraSamples,
-                    // generate a synthetic one to avoid gazillons of warnings
-                    const auto nExtraSampleCount = static_cast<uint16_t>(
-                        poDS->m_nSamplesPerPixel - nSamplesAccountedFor);
-                    std::vector<uint16_t> anExtraSamples(
-                        nExtraSampleCount, EXTRASAMPLE_UNSPECIFIED);
-                    TIFFSetField(hTIFFTmp, TIFFTAG_EXTRASAMPLES,
-                                 nExtraSampleCount, anExtraSamples.data());
-                }
-            }
-        }
-        TIFFWriteCheck(hTIFFTmp, FALSE, "ThreadDecompressionFunc");
-        TIFFWriteDirectory(hTIFFTmp);
-        XTIFFClose(hTIFFTmp);
-
-        // Re-open file
-        hTIFFTmp = VSI_TIFFOpen(osTmpFilename.c_str(), "r", fpTmp);
-        CPLAssert(hTIFFTmp != nullptr);
-        poDS->RestoreVolatileParameters(hTIFFTmp);
+        auto poTmpTIFF = psContext->AcquireTmpTIFF(nBlockYSize);
 
         bool bRet = true;
         // Request m_nBlockYSize line in the block, except on the bottom-most
@@ -770,17 +845,63 @@ struct GTiffDecompressJob
         const size_t nReqSize = static_cast<size_t>(poDS->m_nBlockXSize) *
                                 nBlockReqYSize * nBandsPerStrile * nDTSize;
 
+        // Check if the decoded strile can be directly written into the
+        // destination buffer, that is the strile is entirely within the
+        // window of interest and the buffer has the same layout.
+        const bool bDecodeIntoDstBuffer = [psContext, poDS, nDTSize,
+                                           nBandsPerStrile, nXOffsetInBlock,
+                                           nYOffsetInBlock, nXSize, nYSize,
+                                           nBlockReqYSize]()
+        {
+            if (!psContext->bSkipBlockCache ||
+                psContext->eBufType != psContext->eDT ||
+                nXOffsetInBlock != 0 || nYOffsetInBlock != 0 ||
+                nXSize != poDS->m_nBlockXSize || nYSize != nBlockReqYSize ||
+                psContext->nLineSpace !=
+                    static_cast<GSpacing>(poDS->m_nBlockXSize) * nDTSize *
+                        nBandsPerStrile)
+            {
+                return false;
+            }
+            if (nBandsPerStrile == 1)
+                return psContext->nPixelSpace == nDTSize;
+            if (psContext->nBandCount != poDS->nBands ||
+                psContext->nPixelSpace !=
+                    static_cast<GSpacing>(nDTSize) * nBandsPerStrile ||
+                psContext->nBandSpace != nDTSize)
+            {
+                return false;
+            }
+            for (int i = 0; i < psContext->nBandCount; ++i)
+            {
+                if (psContext->panBandMap[i] != i + 1)
+                    return false;
+            }
+            return true;
+        }();
+
         GByte *pabyOutput;
         std::vector<GByte> abyOutput;
         if (poDS->m_nCompression == COMPRESSION_NONE &&
             !TIFFIsByteSwapped(poDS->m_hTIFF) && abyInput.size() >= nReqSize &&
-            (psContext->bSkipBlockCache || nBandsPerStrile > 1))
+            (psContext->bSkipBlockCache || nBandsPerStrile > 1) &&
+            !bDecodeIntoDstBuffer)
         {
             pabyOutput = abyInput.data();
         }
         else
         {
-            if (psContext->bSkipBlockCache || nBandsPerStrile > 1)
+            if (bDecodeIntoDstBuffer)
+            {
+                pabyOutput = pDstPtr;
+                if (nBandsPerStrile == 1 &&
+                    poDS->m_nPlanarConfig == PLANARCONFIG_SEPARATE)
+                {
+                    pabyOutput +=
+                        psJob->iDstBandIdxSeparate * psContext->nBandSpace;
+                }
+            }
+            else if (psContext->bSkipBlockCache || nBandsPerStrile > 1)
             {
                 abyOutput.resize(nReqSize);
                 pabyOutput = abyOutput.data();
@@ -789,7 +910,7 @@ struct GTiffDecompressJob
             {
                 pabyOutput = static_cast<GByte *>(apoBlocks[0]->GetDataRef());
             }
-            if (!TIFFReadFromUserBuffer(hTIFFTmp, 0, abyInput.data(),
+            if (!TIFFReadFromUserBuffer(poTmpTIFF->hTIFF, 0, abyInput.data(),
                                         abyInput.size(), pabyOutput,
                                         nReqSize) &&
                 !poDS->m_bIgnoreReadErrors)
@@ -797,16 +918,19 @@ struct GTiffDecompressJob
                 bRet = false;
             }
         }
-        XTIFFClose(hTIFFTmp);
-        CPL_IGNORE_RET_VAL(VSIFCloseL(fpTmp));
-        VSIUnlink(osTmpFilename.c_str());
 
         if (!bRet)
         {
+            // Do not recycle a handle whose codec state might be corrupted
+            poTmpTIFF.reset();
             std::lock_guard<std::recursive_mutex> oLock(psContext->oMutex);
             psContext->bSuccess = false;
             return;
         }
+        psContext->ReleaseTmpTIFF(std::move(poTmpTIFF));
+
+        if (bDecodeIntoDstBuffer)
+            return;
 
         if (!psContext->bSkipBlockCache && nBandsPerStrile > 1)
         {
@@ -1537,6 +1661,57 @@ class FetchBufferVirtualMemIO final
     static const bool bMinimizeIO = false;
 };
 
+/************************************************************************/
+/*                      IsVirtualMemIOCompatible()                      */
+/************************************************************************/
+
+// Whether the raw content of the strips/tiles can be used as is, modulo byte
+// swapping, by VirtualMemIO() and GTiffRasterBand::GetBlockVirtualMem().
+bool GTiffDataset::IsVirtualMemIOCompatible()
+{
+    const GDALDataType eDataType = GetRasterBand(1)->GetRasterDataType();
+    return m_nCompression == COMPRESSION_NONE &&
+           (m_nPhotometric == PHOTOMETRIC_MINISBLACK ||
+            m_nPhotometric == PHOTOMETRIC_RGB ||
+            m_nPhotometric == PHOTOMETRIC_PALETTE) &&
+           m_nBitsPerSample == GDALGetDataTypeSizeBits(eDataType);
+}
+
+/************************************************************************/
+/*                     CreateVirtualMemIOMapping()                      */
+/************************************************************************/
+
+// Create (if not already done) a read-only memory mapping of the whole file.
+bool GTiffDataset::CreateVirtualMemIOMapping(bool bCheckAvailableRAM)
+{
+    if (m_psVirtualMemIOMapping)
+        return true;
+
+    VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
+    if (!CPLIsVirtualMemFileMapAvailable() ||
+        VSIFGetNativeFileDescriptorL(fp) == nullptr)
+    {
+        return false;
+    }
+    if (VSIFSeekL(fp, 0, SEEK_END) != 0)
+        return false;
+    const vsi_l_offset nLength = VSIFTellL(fp);
+    if (nLength == 0 || static_cast<size_t>(nLength) != nLength)
+        return false;
+    if (bCheckAvailableRAM)
+    {
+        GIntBig nRAM = CPLGetUsablePhysicalRAM();
+        if (static_cast<GIntBig>(nLength) > nRAM)
+        {
+            CPLDebug("GTiff", "Not enough RAM to map whole file into memory.");
+            return false;
+        }
+    }
+    m_psVirtualMemIOMapping = CPLVirtualMemFileMapNew(
+        fp, 0, nLength, VIRTUALMEM_READONLY, nullptr, nullptr);
+    return m_psVirtualMemIOMapping != nullptr;
+}
+
 /************************************************************************/
 /*                            VirtualMemIO()                            */
 /************************************************************************/
@@ -1559,13 +1734,7 @@ int GTiffDataset::VirtualMemIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
         return -1;
     }
 
-    const GDALDataType eDataType = GetRasterBand(1)->GetRasterDataType();
-    const int nDTSizeBits = GDALGetDataTypeSizeBits(eDataType);
-    if (!(m_nCompression == COMPRESSION_NONE &&
-          (m_nPhotometric == PHOTOMETRIC_MINISBLACK ||
-           m_nPhotometric == PHOTOMETRIC_RGB ||
-           m_nPhotometric == PHOTOMETRIC_PALETTE) &&
-          m_nBitsPerSample == nDTSizeBits))
+    if (!IsVirtualMemIOCompatible())
     {
         m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
         return -1;
@@ -1584,38 +1753,8 @@ int GTiffDataset::VirtualMemIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
     }
     else if (m_psVirtualMemIOMapping == nullptr)
     {
-        VSILFILE *fp = VSI_TIFFGetVSILFile(TIFFClientdata(m_hTIFF));
-        if (!CPLIsVirtualMemFileMapAvailable() ||
-            VSIFGetNativeFileDescriptorL(fp) == nullptr)
-        {
-            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
-            return -1;
-        }
-        if (VSIFSeekL(fp, 0, SEEK_END) != 0)
-        {
-            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
-            return -1;
-        }
-        const vsi_l_offset nLength = VSIFTellL(fp);
-        if (static_cast<size_t>(nLength) != nLength)
-        {
-            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
-            return -1;
-        }
-        if (m_eVirtualMemIOUsage == VirtualMemIOEnum::IF_ENOUGH_RAM)
-        {
-            GIntBig nRAM = CPLGetUsablePhysicalRAM();
-            if (static_cast<GIntBig>(nLength) > nRAM)
-            {
-                CPLDebug("GTiff",
-                         "Not enough RAM to map whole file into memory.");
-                m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
-                return -1;
-            }
-        }
-        m_psVirtualMemIOMapping = CPLVirtualMemFileMapNew(
-            fp, 0, nLength, VIRTUALMEM_READONLY, nullptr, nullptr);
-        if (m_psVirtualMemIOMapping == nullptr)
+        if (!CreateVirtualMemIOMapping(m_eVirtualMemIOUsage ==
+                                       VirtualMemIOEnum::IF_ENOUGH_RAM))
         {
             m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
             return -1;
@@ -1635,7 +1774,8 @@ int GTiffDataset::VirtualMemIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 
     if (TIFFIsByteSwapped(m_hTIFF) && m_pTempBufferForCommonDirectIO == nullptr)
     {
-        const int nDTSize = nDTSizeBits / 8;
+        const int nDTSize =
+            GDALGetDataTypeSizeBytes(GetRasterBand(1)->GetRasterDataType());
         size_t nTempBufferForCommonDirectIOSize = static_cast<size_t>(
             m_nBlockXSize * nDTSize *
             (m_nPlanarConfig == PLANARCONFIG_CONTIG ? nBands : 1));
@@ -3922,6 +4062,9 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
             if (poOpenInfo->eAccess == GA_Update &&
                 !CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
                                                   "IGNORE_COG_LAYOUT_BREAK",
+                                                  "FALSE")) &&
+                !CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                                  "COG_INCREMENTAL_UPDATE",
                                                   "FALSE")))
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -3930,7 +4073,9 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
                          "the optimizations (but will still produce a valid "
                          "GeoTIFF file). If this is acceptable, open the file "
                          "with the IGNORE_COG_LAYOUT_BREAK open option set "
-                         "to YES.",
+                         "to YES, or with the COG_INCREMENTAL_UPDATE open "
+                         "option set to YES to also refresh the overviews "
+                         "of the modified area.",
                          pszFilename);
                 XTIFFClose(l_hTIFF);
                 return nullptr;
@@ -3948,6 +4093,13 @@ GDALDataset *GTiffDataset::Open(GDALOpenInfo *poOpenInfo)
         poDS->m_bHasGotSiblingFiles = true;
     }
 
+    // Track the area modified in the full resolution image, so that only the
+    // overview blocks depending on it are recomputed when flushing.
+    poDS->m_bCOGIncrementalUpdate =
+        poOpenInfo->eAccess == GA_Update &&
+        CPLTestBool(CSLFetchNameValueDef(poOpenInfo->papszOpenOptions,
+                                         "COG_INCREMENTAL_UPDATE", "FALSE"));
+
     // Should be capped by 257, to avoid 65535 / m_nColorTableMultiplier to overflow 255
     poDS->m_nColorTableMultiplier = std::max(
         0, std::min(257,
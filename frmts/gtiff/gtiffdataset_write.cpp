@@ -901,7 +901,8 @@ bool GTiffDataset::WriteEncodedStrip(uint32_t strip, GByte *pabyData,
 /************************************************************************/
 
 void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
-                                          CSLConstList papszOptions)
+                                          CSLConstList papszOptions,
+                                          bool bForOverviews)
 {
     // Raster == tile, then no need for threads
     if (m_nBlockXSize == nRasterXSize && m_nBlockYSize == nRasterYSize)
@@ -914,7 +915,8 @@ void GTiffDataset::InitCompressionThreads(bool bUpdateMode,
         /* bDefaultToAllCPUs=*/false, &pszNumThreads, &bOK);
     if (nThreads > 1)
     {
-        if ((bUpdateMode && m_nCompression != COMPRESSION_NONE) ||
+        if ((bUpdateMode &&
+             (m_nCompression != COMPRESSION_NONE || bForOverviews)) ||
             (nBands >= 1 && IsMultiThreadedReadCompatible()))
         {
             CPLDebug("GTiff",
@@ -1090,10 +1092,36 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
                              &panByteCounts) &&
                 panByteCounts != nullptr)
             {
+                GTiffDataset *poRootDS = m_poBaseDS ? m_poBaseDS : this;
+                // In COG_INCREMENTAL_UPDATE mode, refuse to write a strile
+                // elsewhere than at its current location, as it would break
+                // the COG layout.
+                if (poRootDS->m_bCOGIncrementalUpdate &&
+                    (static_cast<GUIntBig>(nCompressedBufferSize) >
+                         panByteCounts[nStripOrTile] ||
+                     (m_poMaskDS && m_bMaskInterleavedWithImagery &&
+                      static_cast<GUIntBig>(nCompressedBufferSize) !=
+                          panByteCounts[nStripOrTile])))
+                {
+                    ReportError(
+                        CE_Failure, CPLE_AppDefined,
+                        "Strile %d cannot be rewritten in place, as its new "
+                        "size (" CPL_FRMT_GUIB " bytes) does not fit at its "
+                        "current location (" CPL_FRMT_GUIB " bytes). This "
+                        "would break the COG layout, which the "
+                        "COG_INCREMENTAL_UPDATE open option preserves. Use "
+                        "the IGNORE_COG_LAYOUT_BREAK open option instead, or "
+                        "regenerate the file.",
+                        nStripOrTile,
+                        static_cast<GUIntBig>(nCompressedBufferSize),
+                        static_cast<GUIntBig>(panByteCounts[nStripOrTile]));
+                    m_bWriteError = true;
+                    return;
+                }
+
                 if (static_cast<GUIntBig>(nCompressedBufferSize) >
                     panByteCounts[nStripOrTile])
                 {
-                    GTiffDataset *poRootDS = m_poBaseDS ? m_poBaseDS : this;
                     if (!poRootDS->m_bKnownIncompatibleEdition &&
                         !poRootDS->m_bWriteKnownIncompatibleEdition)
                     {
@@ -1112,7 +1140,6 @@ void GTiffDataset::WriteRawStripOrTile(int nStripOrTile,
                          static_cast<GUIntBig>(nCompressedBufferSize) !=
                              panByteCounts[nStripOrTile])
                 {
-                    GTiffDataset *poRootDS = m_poBaseDS ? m_poBaseDS : this;
                     if (!poRootDS->m_bKnownIncompatibleEdition &&
                         !poRootDS->m_bWriteKnownIncompatibleEdition)
                     {
@@ -1961,6 +1988,8 @@ CPLErr GTiffDataset::WriteEncodedTileOrStrip(uint32_t tile_or_strip, void *data,
 {
     CPLErr eErr = CE_None;
 
+    MarkStripOrTileDirty(tile_or_strip);
+
     if (TIFFIsTiled(m_hTIFF))
     {
         if (!(WriteEncodedTile(tile_or_strip, static_cast<GByte *>(data),
@@ -1981,6 +2010,138 @@ CPLErr GTiffDataset::WriteEncodedTileOrStrip(uint32_t tile_or_strip, void *data,
     return eErr;
 }
 
+/************************************************************************/
+/*                        MarkStripOrTileDirty()                        */
+/************************************************************************/
+
+// Accumulate the extent of striles of the full resolution image (or of its
+// mask) that are written, when in COG_INCREMENTAL_UPDATE mode.
+void GTiffDataset::MarkStripOrTileDirty(uint32_t nStripOrTile)
+{
+    GTiffDataset *poRootDS = m_poBaseDS ? m_poBaseDS : this;
+    if (!poRootDS->m_bCOGIncrementalUpdate ||
+        (m_poBaseDS != nullptr && m_poImageryDS != m_poBaseDS) ||
+        m_nBlocksPerBand == 0 || m_nBlocksPerRow == 0)
+    {
+        return;
+    }
+
+    const int nBlockIdInBand = static_cast<int>(
+        nStripOrTile % static_cast<uint32_t>(m_nBlocksPerBand));
+    const int nXOff = (nBlockIdInBand % m_nBlocksPerRow) * m_nBlockXSize;
+    const int nYOff = (nBlockIdInBand / m_nBlocksPerRow) * m_nBlockYSize;
+    const int nXMax = std::min(nRasterXSize, nXOff + m_nBlockXSize) - 1;
+    const int nYMax = std::min(nRasterYSize, nYOff + m_nBlockYSize) - 1;
+
+    poRootDS->m_nDirtyXMin = std::min(poRootDS->m_nDirtyXMin, nXOff);
+    poRootDS->m_nDirtyYMin = std::min(poRootDS->m_nDirtyYMin, nYOff);
+    poRootDS->m_nDirtyXMax = std::max(poRootDS->m_nDirtyXMax, nXMax);
+    poRootDS->m_nDirtyYMax = std::max(poRootDS->m_nDirtyYMax, nYMax);
+}
+
+/************************************************************************/
+/*                       RefreshDirtyOverviews()                        */
+/************************************************************************/
+
+// Recompute the overview blocks that depend on the area of the full
+// resolution image modified since the last call, when in
+// COG_INCREMENTAL_UPDATE mode. Overview striles that still fit in their
+// current location are rewritten in place, which preserves the COG layout.
+CPLErr GTiffDataset::RefreshDirtyOverviews()
+{
+    CPLAssert(m_poBaseDS == nullptr);
+
+    // Make sure that pending writes of the mask go through
+    // MarkStripOrTileDirty() before the dirty area is fetched.
+    CPLErr eErr = CE_None;
+    if (m_poMaskDS && m_poMaskDS->FlushCache(false) != CE_None)
+        eErr = CE_Failure;
+
+    if (m_nDirtyXMin > m_nDirtyXMax || m_nDirtyYMin > m_nDirtyYMax)
+        return eErr;
+
+    const int nXOff = m_nDirtyXMin;
+    const int nYOff = m_nDirtyYMin;
+    const int nXSize = m_nDirtyXMax - m_nDirtyXMin + 1;
+    const int nYSize = m_nDirtyYMax - m_nDirtyYMin + 1;
+    m_nDirtyXMin = std::numeric_limits<int>::max();
+    m_nDirtyYMin = std::numeric_limits<int>::max();
+    m_nDirtyXMax = -1;
+    m_nDirtyYMax = -1;
+
+    ScanDirectories();
+    if (m_apoOverviewDS.empty())
+        return eErr;
+
+    CPLDebug("GTiff",
+             "Refreshing overviews for window (%d,%d)-(%d,%d) of %s", nXOff,
+             nYOff, nXSize, nYSize, m_osFilename.c_str());
+
+    const char *pszResampling =
+        m_apoOverviewDS[0]->GetRasterBand(1)->GetMetadataItem("RESAMPLING");
+    if (pszResampling == nullptr)
+        pszResampling = m_oGTiffMDMD.GetMetadataItem("OVERVIEW_RESAMPLING",
+                                                     "IMAGE_STRUCTURE");
+    if (pszResampling == nullptr)
+        pszResampling = "NEAREST";
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("XOFF", CPLSPrintf("%d", nXOff));
+    aosOptions.SetNameValue("YOFF", CPLSPrintf("%d", nYOff));
+    aosOptions.SetNameValue("XSIZE", CPLSPrintf("%d", nXSize));
+    aosOptions.SetNameValue("YSIZE", CPLSPrintf("%d", nYSize));
+
+    std::vector<GDALRasterBand *> apoSrcBands;
+    std::vector<std::vector<GDALRasterBand *>> aapoOverviewBands;
+    for (int iBand = 1; iBand <= nBands; ++iBand)
+    {
+        apoSrcBands.push_back(GetRasterBand(iBand));
+        aapoOverviewBands.emplace_back();
+        for (auto &poOvrDS : m_apoOverviewDS)
+            aapoOverviewBands.back().push_back(poOvrDS->GetRasterBand(iBand));
+    }
+    if (GDALRegenerateOverviewsMultiBand(apoSrcBands, aapoOverviewBands,
+                                         pszResampling, nullptr, nullptr,
+                                         aosOptions.List()) != CE_None)
+    {
+        eErr = CE_Failure;
+    }
+
+    if (m_poMaskDS && m_poMaskDS->GetRasterCount() == 1)
+    {
+        std::vector<GDALRasterBand *> apoMaskOvrBands;
+        for (auto &poOvrDS : m_apoOverviewDS)
+        {
+            if (poOvrDS->m_poMaskDS != nullptr)
+            {
+                apoMaskOvrBands.push_back(
+                    poOvrDS->m_poMaskDS->GetRasterBand(1));
+            }
+        }
+        if (apoMaskOvrBands.size() == m_apoOverviewDS.size() &&
+            GDALRegenerateOverviewsMultiBand(
+                {m_poMaskDS->GetRasterBand(1)}, {apoMaskOvrBands},
+                pszResampling, nullptr, nullptr,
+                aosOptions.List()) != CE_None)
+        {
+            eErr = CE_Failure;
+        }
+    }
+
+    for (auto &poOvrDS : m_apoOverviewDS)
+    {
+        if (poOvrDS->FlushCache(false) != CE_None)
+            eErr = CE_Failure;
+        if (poOvrDS->m_poMaskDS &&
+            poOvrDS->m_poMaskDS->FlushCache(false) != CE_None)
+        {
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                           FlushBlockBuf()                            */
 /************************************************************************/
@@ -2198,6 +2359,12 @@ CPLErr GTiffDataset::FlushCacheInternal(bool bAtClosing, bool bFlushDirectory)
         }
     }
 
+    if (m_bCOGIncrementalUpdate && m_poBaseDS == nullptr)
+    {
+        if (RefreshDirtyOverviews() != CE_None)
+            eErr = CE_Failure;
+    }
+
     if (bFlushDirectory && GetAccess() == GA_Update)
     {
         if (FlushDirectory() != CE_None)
@@ -3392,6 +3559,25 @@ CPLErr GTiffDataset::IBuildOverviews(const char *pszResampling, int nOverviews,
         return CE_Failure;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Use worker threads for resampling, and for compression of the   */
+    /*      overview tiles, if requested.                                   */
+    /* -------------------------------------------------------------------- */
+    CPLConfigOptionSetter oNumThreadsSetter(
+        "GDAL_NUM_THREADS", CSLFetchNameValue(papszOptions, "NUM_THREADS"),
+        true);
+    const int nThreads = GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                           /* bDefaultToAllCPUs=*/false);
+    if (nThreads > 1 && !m_poCompressQueue && nCompression != COMPRESSION_NONE)
+    {
+        CPLStringList aosThreadOptions;
+        aosThreadOptions.SetNameValue("NUM_THREADS",
+                                      CPLSPrintf("%d", nThreads));
+        InitCompressionThreads(/* bUpdateMode = */ true,
+                               aosThreadOptions.List(),
+                               /* bForOverviews = */ true);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Do we have a palette?  If so, create a TIFF compatible version. */
     /* -------------------------------------------------------------------- */
@@ -3554,7 +3740,8 @@ CPLErr GTiffDataset::IBuildOverviews(const char *pszResampling, int nOverviews,
     /*      Refresh old overviews that were listed.                         */
     /* -------------------------------------------------------------------- */
     const auto poColorTable = GetRasterBand(panBandList[0])->GetColorTable();
-    if ((m_nPlanarConfig == PLANARCONFIG_CONTIG || bHasAlphaBand) &&
+    if ((m_nPlanarConfig == PLANARCONFIG_CONTIG || bHasAlphaBand ||
+         (nThreads > 1 && nBandsIn > 1)) &&
         GDALDataTypeIsComplex(
             GetRasterBand(panBandList[0])->GetRasterDataType()) == FALSE &&
         (poColorTable == nullptr || STARTS_WITH_CI(pszResampling, "NEAR") ||
@@ -3572,7 +3759,9 @@ CPLErr GTiffDataset::IBuildOverviews(const char *pszResampling, int nOverviews,
         // space in the TIFF file.  We also use that logic for uncompressed
         // overviews, since GDALRegenerateOverviewsMultiBand() will be able to
         // trigger cascading overview regeneration even in the presence
-        // of an alpha band.
+        // of an alpha band. And when several threads are available, the
+        // resampling of the bands of each chunk is dispatched to worker
+        // threads, whatever the planar configuration.
 
         int nNewOverviews = 0;
 
@@ -5515,6 +5704,12 @@ TIFF *GTiffDataset::CreateLL(const char *pszFilename, int nXSize, int nYSize,
     int l_nCompression = COMPRESSION_NONE;
     if (const char *pszValue = CSLFetchNameValue(papszParamList, "COMPRESS"))
     {
+        if (EQUAL(pszValue, "AUTO"))
+        {
+            ReportError(pszFilename, CE_Failure, CPLE_NotSupported,
+                        "COMPRESS=AUTO is only supported by CreateCopy()");
+            return nullptr;
+        }
         l_nCompression = GTIFFGetCompressionMethod(pszValue, "COMPRESS");
         if (l_nCompression < 0)
             return nullptr;
@@ -7336,6 +7531,24 @@ GDALDataset *GTiffDataset::CreateCopy(const char *pszFilename,
         return nullptr;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Replace COMPRESS=AUTO by the best compression settings for a    */
+    /*      sample of the source data.                                      */
+    /* -------------------------------------------------------------------- */
+    if (EQUAL(CSLFetchNameValueDef(papszOptions, "COMPRESS", ""), "AUTO"))
+    {
+        CPLStringList aosResolvedOptions;
+        if (!GTiffResolveAutoCompression(GDALDataset::ToHandle(poSrcDS),
+                                         papszOptions, /* bForCOG = */ false,
+                                         aosResolvedOptions))
+        {
+            return nullptr;
+        }
+        return CreateCopy(pszFilename, poSrcDS, bStrict,
+                          aosResolvedOptions.List(), pfnProgress,
+                          pProgressData);
+    }
+
     GDALRasterBand *const poPBand = poSrcDS->GetRasterBand(1);
     GDALDataType eType = poPBand->GetRasterDataType();
 
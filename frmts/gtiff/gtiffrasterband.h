@@ -150,6 +150,10 @@ class GTiffRasterBand CPL_NON_FINAL : public GDALPamRasterBand
                       GIntBig *pnLineSpace,
                       CSLConstList papszOptions) override final;
 
+    CPLVirtualMem *GetBlockVirtualMem(int nXBlockOff, int nYBlockOff,
+                                      int *pnPixelSpace, GIntBig *pnLineSpace,
+                                      CSLConstList papszOptions) override final;
+
     GDALRasterAttributeTable *GetDefaultRAT() override final;
     virtual CPLErr
     SetDefaultRAT(const GDALRasterAttributeTable *) override final;
@@ -381,6 +381,84 @@ CPLVirtualMem *GTiffRasterBand::GetVirtualMemAuto(GDALRWFlag eRWFlag,
                                              papszOptions);
 }
 
+/************************************************************************/
+/*                         GetBlockVirtualMem()                         */
+/************************************************************************/
+
+CPLVirtualMem *GTiffRasterBand::GetBlockVirtualMem(
+    int nXBlockOff, int nYBlockOff, int *pnPixelSpace, GIntBig *pnLineSpace,
+    CSLConstList /* papszOptions */)
+{
+    if (nXBlockOff < 0 || nXBlockOff >= nBlocksPerRow || nYBlockOff < 0 ||
+        nYBlockOff >= nBlocksPerColumn)
+    {
+        ReportError(CE_Failure, CPLE_IllegalArg,
+                    "Illegal nXBlockOff=%d, nYBlockOff=%d", nXBlockOff,
+                    nYBlockOff);
+        return nullptr;
+    }
+
+    // Views are only safe on files that nobody can modify behind our back,
+    // and whose raw content is usable without any decoding.
+    if (m_poGDS->eAccess == GA_Update || m_poGDS->m_bStreamingIn ||
+        TIFFIsByteSwapped(m_poGDS->m_hTIFF) ||
+        !m_poGDS->IsVirtualMemIOCompatible())
+    {
+        return nullptr;
+    }
+
+    vsi_l_offset nBlockOffset = 0;
+    vsi_l_offset nBlockByteCount = 0;
+    if (!m_poGDS->IsBlockAvailable(ComputeBlockId(nXBlockOff, nYBlockOff),
+                                   &nBlockOffset, &nBlockByteCount, nullptr))
+    {
+        CPLDebug("GTiff", "GetBlockVirtualMem(): sparse block");
+        return nullptr;
+    }
+
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    int nPixelSpace = nDTSize;
+    if (m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG)
+        nPixelSpace *= m_poGDS->nBands;
+    const GIntBig nLineSpace = static_cast<GIntBig>(nPixelSpace) * nBlockXSize;
+
+    // The last strip may be truncated to the raster height.
+    int nLines = nBlockYSize;
+    if (!TIFFIsTiled(m_poGDS->m_hTIFF))
+        nLines = std::min(nLines, nRasterYSize - nYBlockOff * nBlockYSize);
+
+    const vsi_l_offset nBlockDataSize =
+        static_cast<vsi_l_offset>(nLineSpace) * nLines;
+    if (nBlockByteCount < nBlockDataSize)
+    {
+        CPLDebug("GTiff", "GetBlockVirtualMem(): truncated block");
+        return nullptr;
+    }
+
+    if (!m_poGDS->CreateVirtualMemIOMapping(false))
+        return nullptr;
+
+    // Offset of the first sample of this band within a pixel
+    const vsi_l_offset nBandOffset =
+        m_poGDS->m_nPlanarConfig == PLANARCONFIG_CONTIG
+            ? static_cast<vsi_l_offset>(nBand - 1) * nDTSize
+            : 0;
+
+    // Derived mappings hold a reference on the base mapping, so the view
+    // remains valid after the dataset is closed.
+    CPLVirtualMem *pVMem = CPLVirtualMemDerivedNew(
+        m_poGDS->m_psVirtualMemIOMapping, nBlockOffset + nBandOffset,
+        nBlockDataSize - nBandOffset, nullptr, nullptr);
+    if (pVMem == nullptr)
+        return nullptr;
+
+    if (pnPixelSpace)
+        *pnPixelSpace = nPixelSpace;
+    if (pnLineSpace)
+        *pnLineSpace = nLineSpace;
+    return pVMem;
+}
+
 /************************************************************************/
 /*                      DropReferenceVirtualMem()                       */
 /************************************************************************/
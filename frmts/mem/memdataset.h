@@ -21,6 +21,7 @@
 
 #include <map>
 #include <memory>
+#include <vector>
 
 CPL_C_START
 
@@ -269,9 +270,17 @@ class CPL_DLL OGRMemLayer CPL_NON_FINAL : public OGRLayer
 
     GDALDataset *m_poDS{};
 
+    // FIDs of the features selected by the attribute indexes, when the
+    // attribute filter can be evaluated with them.
+    std::vector<GIntBig> m_anIndexCandidates{};
+    size_t m_iNextIndexCandidate = 0;
+    bool m_bIndexCandidatesCollected = false;
+    bool m_bUseIndexCandidates = false;
+
     // Only use it in the lifetime of a function where the list of features
     // doesn't change.
     IOGRMemLayerFeatureIterator *GetIterator();
+    void CollectIndexCandidates();
     void PrepareCreateFeature(OGRFeature *poFeature);
     OGRErr SetFeatureInternal(std::unique_ptr<OGRFeature> poFeature,
                               GIntBig *pnFID = nullptr);
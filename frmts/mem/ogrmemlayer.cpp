@@ -111,6 +111,38 @@ void OGRMemLayer::ResetReading()
 {
     m_iNextReadFID = 0;
     m_oMapFeaturesIter = m_oMapFeatures.begin();
+    // Query the attribute indexes again, as they may have been updated.
+    m_bIndexCandidatesCollected = false;
+}
+
+/************************************************************************/
+/*                       CollectIndexCandidates()                       */
+/************************************************************************/
+
+// Collect the FIDs of the features selected by the attribute indexes (such
+// as the ones created by CREATE INDEX) for the current attribute filter.
+void OGRMemLayer::CollectIndexCandidates()
+
+{
+    m_bIndexCandidatesCollected = true;
+    m_bUseIndexCandidates = false;
+    m_anIndexCandidates.clear();
+    m_iNextIndexCandidate = 0;
+    if (m_poAttrQuery == nullptr || m_poAttrIndex == nullptr)
+        return;
+
+    GIntBig *panFIDs = m_poAttrQuery->EvaluateAgainstIndices(this, nullptr);
+    if (panFIDs == nullptr)
+        return;
+    for (const GIntBig *panIter = panFIDs; *panIter != OGRNullFID; ++panIter)
+        m_anIndexCandidates.push_back(*panIter);
+    CPLFree(panFIDs);
+    m_bUseIndexCandidates = true;
+
+    CPLDebug("MEM",
+             "%s: attribute filter evaluated with attribute indexes, "
+             "%d candidate feature(s)",
+             GetDescription(), static_cast<int>(m_anIndexCandidates.size()));
 }
 
 /************************************************************************/
@@ -123,10 +155,23 @@ OGRFeature *OGRMemLayer::GetNextFeature()
     if (m_iNextReadFID < 0)
         return nullptr;
 
+    if (!m_bIndexCandidatesCollected)
+        CollectIndexCandidates();
+
     while (true)
     {
         OGRFeature *poFeature = nullptr;
-        if (m_papoFeatures)
+        if (m_bUseIndexCandidates)
+        {
+            if (m_iNextIndexCandidate >= m_anIndexCandidates.size())
+                return nullptr;
+            // Features may have been deleted since they were indexed
+            poFeature =
+                GetFeatureRef(m_anIndexCandidates[m_iNextIndexCandidate++]);
+            if (poFeature == nullptr)
+                continue;
+        }
+        else if (m_papoFeatures)
         {
             if (m_iNextReadFID >= m_nMaxFeatureCount)
                 return nullptr;
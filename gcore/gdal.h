@@ -2575,6 +2575,13 @@ GDALGetVirtualMemAuto(GDALRasterBandH hBand, GDALRWFlag eRWFlag,
                       int *pnPixelSpace, GIntBig *pnLineSpace,
                       CSLConstList papszOptions) CPL_WARN_UNUSED_RESULT;
 
+CPLVirtualMem CPL_DLL *
+GDALRasterBandGetBlockVirtualMem(GDALRasterBandH hBand, int nXBlockOff,
+                                 int nYBlockOff, int *pnPixelSpace,
+                                 GIntBig *pnLineSpace,
+                                 CSLConstList papszOptions)
+    CPL_WARN_UNUSED_RESULT;
+
 /**! Enumeration to describe the tile organization */
 typedef enum
 {
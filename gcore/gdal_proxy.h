@@ -211,6 +211,10 @@ class CPL_DLL GDALProxyRasterBand : public GDALRasterBand
                                      GIntBig *pnLineSpace,
                                      CSLConstList papszOptions) override;
 
+    CPLVirtualMem *GetBlockVirtualMem(int nXBlockOff, int nYBlockOff,
+                                      int *pnPixelSpace, GIntBig *pnLineSpace,
+                                      CSLConstList papszOptions) override;
+
     CPLErr InterpolateAtPoint(double dfPixel, double dfLine,
                               GDALRIOResampleAlg eInterpolation,
                               double *pdfRealValue,
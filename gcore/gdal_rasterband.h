@@ -599,6 +599,11 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                       GIntBig *pnLineSpace,
                       CSLConstList papszOptions) CPL_WARN_UNUSED_RESULT;
 
+    virtual CPLVirtualMem *
+    GetBlockVirtualMem(int nXBlockOff, int nYBlockOff, int *pnPixelSpace,
+                       GIntBig *pnLineSpace,
+                       CSLConstList papszOptions) CPL_WARN_UNUSED_RESULT;
+
     int GetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
                               int nMaskFlagStop = 0,
                               double *pdfDataPct = nullptr);
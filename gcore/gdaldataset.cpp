@@ -6713,12 +6713,16 @@ OGRErr GDALDataset::ProcessSQLCreateIndex(const char *pszSQLCommand)
     }
 
     /* -------------------------------------------------------------------- */
-    /*      Does this layer even support attribute indexes?                 */
+    /*      Layers without attribute index support of their own get         */
+    /*      in-memory indexes, provided they are in-memory layers or cannot */
+    /*      be modified.                                                    */
     /* -------------------------------------------------------------------- */
-    if (poLayer->GetIndex() == nullptr)
+    if (poLayer->GetIndex() == nullptr &&
+        poLayer->InitializeIndexSupport(nullptr) != OGRERR_NONE)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
-                 "CREATE INDEX ON not supported by this driver.");
+                 "CREATE INDEX ON not supported by this driver on layers "
+                 "opened in update mode.");
         CSLDestroy(papszTokens);
         return OGRERR_FAILURE;
     }
@@ -6730,7 +6734,7 @@ OGRErr GDALDataset::ProcessSQLCreateIndex(const char *pszSQLCommand)
 
     CSLDestroy(papszTokens);
 
-    if (i >= poLayer->GetLayerDefn()->GetFieldCount())
+    if (i < 0 || i >= poLayer->GetLayerDefn()->GetFieldCount())
     {
         CPLError(CE_Failure, CPLE_AppDefined, "`%s' failed, field not found.",
                  pszSQLCommand);
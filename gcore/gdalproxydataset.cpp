@@ -517,6 +517,12 @@ RB_PROXY_METHOD_WITH_RET(CPLVirtualMem *, nullptr, GetVirtualMemAuto,
                           GIntBig *pnLineSpace, CSLConstList papszOptions),
                          (eRWFlag, pnPixelSpace, pnLineSpace, papszOptions))
 
+RB_PROXY_METHOD_WITH_RET(CPLVirtualMem *, nullptr, GetBlockVirtualMem,
+                         (int nXBlockOff, int nYBlockOff, int *pnPixelSpace,
+                          GIntBig *pnLineSpace, CSLConstList papszOptions),
+                         (nXBlockOff, nYBlockOff, pnPixelSpace, pnLineSpace,
+                          papszOptions))
+
 RB_PROXY_METHOD_WITH_RET(
     CPLErr, CE_Failure, InterpolateAtPoint,
     (double dfPixel, double dfLine, GDALRIOResampleAlg eInterpolation,
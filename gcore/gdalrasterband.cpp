@@ -10400,6 +10400,91 @@ CPLVirtualMem *GDALGetVirtualMemAuto(GDALRasterBandH hBand, GDALRWFlag eRWFlag,
                                      const_cast<char **>(papszOptions));
 }
 
+/************************************************************************/
+/*                         GetBlockVirtualMem()                         */
+/************************************************************************/
+
+/** \brief Return a zero-copy, read-only view on the content of a block.
+ *
+ * Contrary to GetVirtualMemAuto(), this method never falls back to a
+ * generic implementation: it only succeeds when the driver can expose the
+ * block data as stored in the underlying file, without any decoding,
+ * byte-swapping or copy. The returned object is typically a window into a
+ * memory mapping of the file.
+ *
+ * At the time of writing, only the GeoTIFF driver implements it, for
+ * datasets opened in read-only mode, backed by a "real" file, uncompressed,
+ * whose byte ordering matches the native ordering of the CPU and whose
+ * bit depth matches the size of the band data type.
+ *
+ * If p is such a pointer and base_type the type matching
+ * GDALGetRasterDataType(), the element at pixel (x, y) of the block (0 <= x
+ * < block width, 0 <= y < block height) can be accessed with
+ * *(base_type*) ((GByte*)p + x * *pnPixelSpace + y * *pnLineSpace)
+ *
+ * For strip-organized files, only the lines of the last strip that are
+ * within the raster extent may be accessed.
+ *
+ * The view remains valid until CPLVirtualMemFree() is called, including after
+ * the dataset has been closed.
+ *
+ * This method is the same as the C GDALRasterBandGetBlockVirtualMem()
+ * function.
+ *
+ * @param nXBlockOff the horizontal block offset, with zero indicating
+ * the left most block, 1 the next block and so forth.
+ *
+ * @param nYBlockOff the vertical block offset, with zero indicating
+ * the top most block, 1 the next block and so forth.
+ *
+ * @param pnPixelSpace Output parameter giving the byte offset from the start of
+ * one pixel value in the block to the start of the next pixel value within a
+ * line.
+ *
+ * @param pnLineSpace Output parameter giving the byte offset from the start of
+ * one line in the block to the start of the next.
+ *
+ * @param papszOptions NULL terminated list of options. Unused for now.
+ *
+ * @return a virtual memory object that must be unreferenced by
+ * CPLVirtualMemFree(), or NULL if a zero-copy view cannot be provided.
+ *
+ * @since GDAL 3.13
+ */
+
+CPLVirtualMem *GDALRasterBand::GetBlockVirtualMem(
+    CPL_UNUSED int nXBlockOff, CPL_UNUSED int nYBlockOff,
+    CPL_UNUSED int *pnPixelSpace, CPL_UNUSED GIntBig *pnLineSpace,
+    CPL_UNUSED CSLConstList papszOptions)
+{
+    return nullptr;
+}
+
+/************************************************************************/
+/*                  GDALRasterBandGetBlockVirtualMem()                  */
+/************************************************************************/
+
+/**
+ * \brief Return a zero-copy, read-only view on the content of a block.
+ *
+ * @see GDALRasterBand::GetBlockVirtualMem()
+ * @since GDAL 3.13
+ */
+
+CPLVirtualMem *GDALRasterBandGetBlockVirtualMem(GDALRasterBandH hBand,
+                                                int nXBlockOff, int nYBlockOff,
+                                                int *pnPixelSpace,
+                                                GIntBig *pnLineSpace,
+                                                CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hBand, "GDALRasterBandGetBlockVirtualMem", nullptr);
+
+    GDALRasterBand *poBand = GDALRasterBand::FromHandle(hBand);
+
+    return poBand->GetBlockVirtualMem(nXBlockOff, nYBlockOff, pnPixelSpace,
+                                      pnLineSpace, papszOptions);
+}
+
 /************************************************************************/
 /*                     GDALGetDataCoverageStatus()                      */
 /************************************************************************/
@@ -384,6 +384,15 @@ class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
         return nullptr;
     }
 
+    CPLVirtualMem *GetBlockVirtualMem(int, int, int *, GIntBig *,
+                                      CSLConstList) override
+    {
+        CPLError(
+            CE_Failure, CPLE_AppDefined,
+            "GDALThreadSafeRasterBand::GetBlockVirtualMem() not supported");
+        return nullptr;
+    }
+
   protected:
     GDALRasterBand *RefUnderlyingRasterBand(bool bForceOpen) const override;
     void UnrefUnderlyingRasterBand(
@@ -2018,6 +2018,44 @@ CPLErr GDALDataset::RasterIOResampled(
 
 //! @endcond
 
+#ifdef HAVE_SSE2
+
+/************************************************************************/
+/*                        GDALSwapWordsSSE2()                           */
+/************************************************************************/
+
+// Byte swap packed 2, 4 or 8 byte words, 16 bytes at a time. Returns the
+// number of words processed, the remaining ones being left to the caller.
+static int GDALSwapWordsSSE2(GByte *pabyData, int nWordSize, int nWordCount)
+{
+    const int nWordsPerVector = 16 / nWordSize;
+    int i = 0;
+    for (; i + nWordsPerVector <= nWordCount; i += nWordsPerVector)
+    {
+        __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pabyData));
+        // Swap the 2 bytes of each 16-bit word
+        xmm = _mm_or_si128(_mm_slli_epi16(xmm, 8), _mm_srli_epi16(xmm, 8));
+        if (nWordSize == 4)
+        {
+            // Then swap the 16-bit words of each 32-bit word
+            xmm = _mm_shufflelo_epi16(xmm, _MM_SHUFFLE(2, 3, 0, 1));
+            xmm = _mm_shufflehi_epi16(xmm, _MM_SHUFFLE(2, 3, 0, 1));
+        }
+        else if (nWordSize == 8)
+        {
+            // Then reverse the 16-bit words of each 64-bit word
+            xmm = _mm_shufflelo_epi16(xmm, _MM_SHUFFLE(0, 1, 2, 3));
+            xmm = _mm_shufflehi_epi16(xmm, _MM_SHUFFLE(0, 1, 2, 3));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(pabyData), xmm);
+        pabyData += 16;
+    }
+    return i;
+}
+
+#endif
+
 /************************************************************************/
 /*                           GDALSwapWords()                            */
 /************************************************************************/
@@ -2048,6 +2086,17 @@ void CPL_STDCALL GDALSwapWords(void *pData, int nWordSize, int nWordCount,
 
     GByte *pabyData = static_cast<GByte *>(pData);
 
+#ifdef HAVE_SSE2
+    if (nWordSkip == nWordSize &&
+        (nWordSize == 2 || nWordSize == 4 || nWordSize == 8))
+    {
+        const int nProcessed =
+            GDALSwapWordsSSE2(pabyData, nWordSize, nWordCount);
+        pabyData += static_cast<size_t>(nProcessed) * nWordSize;
+        nWordCount -= nProcessed;
+    }
+#endif
+
     switch (nWordSize)
     {
         case 1:
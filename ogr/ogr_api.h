@@ -658,6 +658,8 @@ OGRErr CPL_DLL OGR_L_SetAttributeFilter(OGRLayerH, const char *);
 const char CPL_DLL *OGR_L_GetAttributeFilter(OGRLayerH);
 void CPL_DLL OGR_L_ResetReading(OGRLayerH);
 OGRFeatureH CPL_DLL OGR_L_GetNextFeature(OGRLayerH) CPL_WARN_UNUSED_RESULT;
+OGRFeatureH CPL_DLL OGR_L_GetNextFeatureReusing(OGRLayerH, OGRFeatureH)
+    CPL_WARN_UNUSED_RESULT;
 
 /** Conveniency macro to iterate over features of a layer.
  *
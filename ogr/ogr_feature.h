@@ -1047,8 +1047,39 @@ class CPL_DLL OGRFeature
     char *m_pszNativeData;
     char *m_pszNativeMediaType;
 
+    // Geometry kept in its WKB representation until first accessed
+    struct LazyGeometry
+    {
+        std::vector<GByte> abyWKB{};
+        OGRSpatialReferenceRefCountedPtr poSRS{};
+    };
+
+    // Array of GetGeomFieldCount() elements, only allocated once a geometry
+    // is set with SetGeomFieldFromWKB(). Decoding geometries is an
+    // implementation detail of const accessors, hence mutable.
+    mutable std::unique_ptr<LazyGeometry[]> m_paoLazyGeometries{};
+
     bool SetFieldInternal(int i, const OGRField *puValue);
 
+    bool HasLazyGeometry(int iField) const
+    {
+        return m_paoLazyGeometries &&
+               !m_paoLazyGeometries[iField].abyWKB.empty();
+    }
+
+    void DecodeLazyGeometry(int iField) const;
+
+    void DecodeLazyGeometryIfNeeded(int iField) const
+    {
+        if (HasLazyGeometry(iField))
+            DecodeLazyGeometry(iField);
+    }
+
+    void DiscardLazyGeometry(int iField);
+    LazyGeometry *PrepareLazyGeometry(int iField);
+    void CopyGeomFieldFrom(int iField, const OGRFeature *poSrcFeature,
+                           int iSrcField);
+
   protected:
     //! @cond Doxygen_Suppress
     mutable char *m_pszStyleString;
@@ -1373,6 +1404,10 @@ class CPL_DLL OGRFeature
     OGRErr SetGeomFieldDirectly(int iField, OGRGeometry *);
     OGRErr SetGeomField(int iField, const OGRGeometry *);
     OGRErr SetGeomField(int iField, std::unique_ptr<OGRGeometry>);
+    OGRErr SetGeomFieldFromWKB(int iField, const GByte *pabyWKB,
+                               size_t nWKBSize);
+    OGRErr SetGeomFieldFromWKB(int iField, std::vector<GByte> &&abyWKB);
+    const GByte *GetGeomFieldWKB(int iField, size_t &nWKBSize) const;
 
     void Reset();
 
@@ -72,7 +72,9 @@ typedef enum
     SWQ_SUM,
     SWQ_STDDEV_POP,
     SWQ_STDDEV_SAMP,
-    SWQ_AGGREGATE_END = SWQ_STDDEV_SAMP,
+    SWQ_ST_UNION,
+    SWQ_ST_EXTENT,
+    SWQ_AGGREGATE_END = SWQ_ST_EXTENT,
 
     SWQ_CAST,
     SWQ_CUSTOM_FUNC,  /* only if parsing done in bAcceptCustomFuncs mode */
@@ -320,6 +322,7 @@ const char CPL_UNSTABLE_API *SWQFieldTypeToString(swq_field_type field_type);
 #define SWQM_SUMMARY_RECORD 1
 #define SWQM_RECORDSET 2
 #define SWQM_DISTINCT_LIST 3
+#define SWQM_GROUP_BY 4
 
 typedef enum
 {
@@ -331,6 +334,8 @@ typedef enum
     SWQCF_SUM = SWQ_SUM,
     SWQCF_STDDEV_POP = SWQ_STDDEV_POP,
     SWQCF_STDDEV_SAMP = SWQ_STDDEV_SAMP,
+    SWQCF_ST_UNION = SWQ_ST_UNION,
+    SWQCF_ST_EXTENT = SWQ_ST_EXTENT,
     SWQCF_CUSTOM
 } swq_col_func;
 
@@ -406,6 +411,14 @@ typedef struct
     int ascending_flag;
 } swq_order_def;
 
+typedef struct
+{
+    char *table_name;
+    char *field_name;
+    int table_index;
+    int field_index;
+} swq_group_by_def;
+
 typedef struct
 {
     int secondary_table;
@@ -471,6 +484,14 @@ class CPL_UNSTABLE_API swq_select
 
     swq_expr_node *where_expr = nullptr;
 
+    void PushGroupBy(const char *pszTableName, const char *pszFieldName);
+    int group_by_count = 0;
+    swq_group_by_def *group_by_defs = nullptr;
+
+    // After parse(), the SNT_COLUMN nodes of having_expr reference the index
+    // of a column_defs[] entry, possibly a bHidden one added for that purpose.
+    swq_expr_node *having_expr = nullptr;
+
     void PushOrderBy(const char *pszTableName, const char *pszFieldName,
                      int bAscending);
     int order_specs = 0;
@@ -498,6 +519,12 @@ class CPL_UNSTABLE_API swq_select
 
   private:
     bool IsFieldExcluded(int src_index, const char *table, const char *field);
+    CPLErr ParseGroupBy(swq_field_list *field_list,
+                        swq_custom_func_registrar *poCustomFuncRegistrar);
+    int FindOrAddHavingColumn(swq_col_func col_func, const char *table_name,
+                              const char *field_name, int table_index,
+                              int field_index, swq_field_type field_type);
+    bool RewriteHavingExpr(swq_expr_node *poExpr, swq_field_list *field_list);
 
     // map of EXCLUDE columns keyed according to the index of the
     // asterisk with which it should be associated. key of -1 is
@@ -516,6 +543,14 @@ const char CPL_UNSTABLE_API *swq_select_summarize(swq_select *select_info,
                                                   const char *pszValue,
                                                   const double *pdfValue);
 
+/* Same as swq_select_summarize(), but accumulating into a caller provided
+ * summary, for example one per group of a GROUP BY query.
+ */
+const char CPL_UNSTABLE_API *
+swq_summary_accumulate(const swq_col_def *def, swq_summary &summary,
+                       const char *pszValue, const double *pdfValue,
+                       bool bKeepDistinctValuesOrder);
+
 int CPL_UNSTABLE_API swq_is_reserved_keyword(const char *pszStr);
 
 char CPL_UNSTABLE_API *OGRHStoreGetValue(const char *pszHStore,
@@ -20,6 +20,7 @@
 #include <cstring>
 #include <limits>
 #include <list>
+#include <memory>
 #include <mutex>
 
 #include "cpl_conv.h"
@@ -30,6 +31,7 @@
 #include "ogr_srs_api.h"
 #include "ogr_proj_p.h"
 #include "ogrct_priv.h"
+#include "ogrct_fastpath.h"
 
 #include "proj.h"
 #include "proj_experimental.h"
@@ -106,6 +108,8 @@ struct OGRCoordinateTransformationOptions::Private
 
     bool bCheckWithInvertProj = false;
 
+    bool bUseNativeConversions = true;
+
     Private();
     Private(const Private &) = default;
     Private(Private &&) = default;
@@ -121,6 +125,8 @@ struct OGRCoordinateTransformationOptions::Private
 /************************************************************************/
 
 OGRCoordinateTransformationOptions::Private::Private()
+    : bUseNativeConversions(CPLTestBool(
+          CPLGetConfigOption("OGR_CT_USE_NATIVE_CONVERSIONS", "YES")))
 {
     RefreshCheckWithInvertProj();
 }
@@ -148,6 +154,7 @@ std::string OGRCoordinateTransformationOptions::Private::GetKey() const
     ret += std::to_string(static_cast<int>(bHasTargetCenterLong));
     ret += std::to_string(dfTargetCenterLong);
     ret += std::to_string(static_cast<int>(bCheckWithInvertProj));
+    ret += std::to_string(static_cast<int>(bUseNativeConversions));
     return ret;
 }
 
@@ -770,6 +777,11 @@ class OGRProjCT final : public OGRCoordinateTransformation
     PjPtr m_pj{};
     bool m_bReversePj = false;
 
+    // Native implementation of m_pj, when it is a simple conversion between
+    // a projected CRS and its base geographic CRS.
+    std::shared_ptr<const OGRCTFastPath> m_poFastPath{};
+    std::vector<GByte> m_abyFastPathHandled{};
+
     bool m_bEmitErrors = true;
 
     bool bNoTransform = false;
@@ -817,6 +829,7 @@ class OGRProjCT final : public OGRCoordinateTransformation
 
     void ComputeThreshold();
     void DetectWebMercatorToWGS84();
+    void DetectFastPath();
 
     OGRProjCT &operator=(const OGRProjCT &) = delete;
 
@@ -1349,7 +1362,8 @@ OGRProjCT::OGRProjCT(const OGRProjCT &other)
       bWebMercatorToWGS84LongLat(other.bWebMercatorToWGS84LongLat),
       nErrorCount(other.nErrorCount), dfThreshold(other.dfThreshold),
       m_pj(other.m_pj), m_bReversePj(other.m_bReversePj),
-      m_bEmitErrors(other.m_bEmitErrors), bNoTransform(other.bNoTransform),
+      m_poFastPath(other.m_poFastPath), m_bEmitErrors(other.m_bEmitErrors),
+      bNoTransform(other.bNoTransform),
       m_eStrategy(other.m_eStrategy),
       m_oTransformations(other.m_oTransformations),
       m_iCurTransformation(other.m_iCurTransformation),
@@ -1513,6 +1527,151 @@ void OGRProjCT::DetectWebMercatorToWGS84()
     }
 }
 
+/************************************************************************/
+/*                           DetectFastPath()                           */
+/************************************************************************/
+
+void OGRProjCT::DetectFastPath()
+{
+    m_poFastPath.reset();
+    if (!m_pj || bWebMercatorToWGS84LongLat || bNoTransform ||
+        !m_options.d->bUseNativeConversions ||
+        m_options.d->bCheckWithInvertProj || dfSourceCoordinateEpoch != 0 ||
+        dfTargetCoordinateEpoch != 0)
+    {
+        return;
+    }
+
+    auto ctx = OSRGetProjTLSContext();
+    proj_assign_context(m_pj, ctx);
+    std::unique_ptr<OGRCTFastPath> poFastPath;
+    {
+        // This fails for "meta" operations made of several real ones
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        const char *pszPROJString =
+            proj_as_proj_string(ctx, m_pj, PJ_PROJ_5, nullptr);
+        if (pszPROJString)
+            poFastPath = OGRCTFastPath::Create(pszPROJString, m_bReversePj);
+    }
+    if (!poFastPath)
+        return;
+
+    // Check that the native implementation matches PROJ on points covering
+    // its domain, in both directions of the conversion.
+    std::vector<double> adfGeogX;
+    std::vector<double> adfGeogY;
+    poFastPath->GetSampleGeographicPoints(adfGeogX, adfGeogY);
+    const size_t nCount = adfGeogX.size();
+    const PJ_DIRECTION eGeogToProj =
+        m_bReversePj != poFastPath->IsInverse() ? PJ_INV : PJ_FWD;
+    const PJ_DIRECTION eProjToGeog = eGeogToProj == PJ_FWD ? PJ_INV : PJ_FWD;
+    const auto TransformWithPROJ =
+        [this](PJ_DIRECTION eDir, double &dfX, double &dfY)
+    {
+        PJ_COORD coord;
+        coord.xyzt.x = dfX;
+        coord.xyzt.y = dfY;
+        coord.xyzt.z = 0;
+        coord.xyzt.t = HUGE_VAL;
+        proj_errno_reset(m_pj);
+        coord = proj_trans(m_pj, eDir, coord);
+        dfX = coord.xyzt.x;
+        dfY = coord.xyzt.y;
+        return std::isfinite(dfX) && std::isfinite(dfY);
+    };
+
+    std::vector<double> adfProjX(nCount);
+    std::vector<double> adfProjY(nCount);
+    std::vector<double> adfExpectedX;
+    std::vector<double> adfExpectedY;
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            adfProjX[i] = adfGeogX[i];
+            adfProjY[i] = adfGeogY[i];
+            if (!TransformWithPROJ(eGeogToProj, adfProjX[i], adfProjY[i]))
+            {
+                adfProjX[i] = HUGE_VAL;
+                adfProjY[i] = HUGE_VAL;
+            }
+        }
+        if (poFastPath->IsInverse())
+        {
+            // Round-trip the projected coordinates through PROJ, to get the
+            // reference values.
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                double dfX = adfProjX[i];
+                double dfY = adfProjY[i];
+                if (std::isfinite(dfX) &&
+                    TransformWithPROJ(eProjToGeog, dfX, dfY))
+                {
+                    adfX.push_back(adfProjX[i]);
+                    adfY.push_back(adfProjY[i]);
+                    adfExpectedX.push_back(dfX);
+                    adfExpectedY.push_back(dfY);
+                }
+            }
+        }
+        else
+        {
+            adfX = std::move(adfGeogX);
+            adfY = std::move(adfGeogY);
+            adfExpectedX = std::move(adfProjX);
+            adfExpectedY = std::move(adfProjY);
+        }
+    }
+
+    std::vector<GByte> abyHandled(adfX.size());
+    poFastPath->Transform(adfX.size(), adfX.data(), adfY.data(),
+                          abyHandled.data());
+    for (size_t i = 0; i < adfX.size(); ++i)
+    {
+        if (!abyHandled[i])
+            continue;
+        bool bMatch = std::isfinite(adfExpectedX[i]);
+        if (bMatch && poFastPath->IsInverse())
+        {
+            const bool bLatLong = poFastPath->IsGeographicLatLong();
+            const double dfLong = bLatLong ? adfY[i] : adfX[i];
+            const double dfLat = bLatLong ? adfX[i] : adfY[i];
+            const double dfExpectedLong =
+                bLatLong ? adfExpectedY[i] : adfExpectedX[i];
+            const double dfExpectedLat =
+                bLatLong ? adfExpectedX[i] : adfExpectedY[i];
+            // Tolerance of 1e-9 degree, that is about 0.1 mm. Differences in
+            // longitude are scaled as they are meaningless at the poles.
+            constexpr double TOLERANCE_DEG = 1e-9;
+            bMatch = std::fabs(dfLat - dfExpectedLat) <= TOLERANCE_DEG &&
+                     std::fabs(std::remainder(dfLong - dfExpectedLong, 360)) *
+                             std::cos(dfExpectedLat * M_PI / 180) <=
+                         TOLERANCE_DEG;
+        }
+        else if (bMatch)
+        {
+            // Tolerance of 0.1 mm (or 0.1 mft for CRS in feet)
+            constexpr double TOLERANCE = 1e-4;
+            bMatch = std::fabs(adfX[i] - adfExpectedX[i]) <= TOLERANCE &&
+                     std::fabs(adfY[i] - adfExpectedY[i]) <= TOLERANCE;
+        }
+        if (!bMatch)
+        {
+            CPLDebug("OGRCT",
+                     "Native implementation of the %s conversion does not "
+                     "match PROJ. Not using it",
+                     poFastPath->GetDescription().c_str());
+            return;
+        }
+    }
+
+    CPLDebug("OGRCT", "Using native implementation of the %s conversion",
+             poFastPath->GetDescription().c_str());
+    m_poFastPath = std::move(poFastPath);
+}
+
 /************************************************************************/
 /*                             Initialize()                             */
 /************************************************************************/
@@ -1832,6 +1991,8 @@ int OGRProjCT::Initialize(const OGRSpatialReference *poSourceIn,
             CPL_TO_BOOL(poSRSSource->IsSame(poSRSTarget, apszOptionsIsSame));
     }
 
+    DetectFastPath();
+
     return TRUE;
 }
 
@@ -2750,6 +2911,27 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
         proj_assign_context(pj, ctx);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Use the native implementation of the conversion if possible.    */
+    /*      Points it does not handle are transformed by PROJ below.        */
+    /* -------------------------------------------------------------------- */
+    const GByte *pabyDoneByFastPath = nullptr;
+    if (!bTransformDone && m_poFastPath)
+    {
+        m_abyFastPathHandled.resize(nCount);
+        if (m_poFastPath->Transform(nCount, x, y,
+                                    m_abyFastPathHandled.data()) == 0)
+        {
+            if (panErrorCodes)
+                std::fill(panErrorCodes, panErrorCodes + nCount, 0);
+            bTransformDone = true;
+        }
+        else
+        {
+            pabyDoneByFastPath = m_abyFastPathHandled.data();
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Do the transformation (or not...) using PROJ                    */
     /* -------------------------------------------------------------------- */
@@ -2760,6 +2942,12 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
 
         for (size_t i = 0; i < nCount; i++)
         {
+            if (pabyDoneByFastPath && pabyDoneByFastPath[i])
+            {
+                if (panErrorCodes)
+                    panErrorCodes[i] = 0;
+                continue;
+            }
             PJ_COORD coord;
             const double xIn = x[i];
             const double yIn = y[i];
@@ -3722,6 +3910,7 @@ OGRCoordinateTransformation *OGRProjCT::GetInverse() const
     poNewCT->m_options = newOptions;
 
     poNewCT->DetectWebMercatorToWGS84();
+    poNewCT->DetectFastPath();
 
     return poNewCT;
 }
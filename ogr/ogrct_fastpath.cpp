@@ -0,0 +1,1152 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Native implementation of the most common map projection
+ *           conversions, used by OGRProjCT instead of PROJ when possible.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogrct_fastpath.h"
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include "proj.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <map>
+
+//! @cond Doxygen_Suppress
+
+// The formulas below follow the ones of the corresponding PROJ
+// implementations (tmerc.cpp for the Poder/Engsager variant of the Transverse
+// Mercator, lcc.cpp, aea.cpp and stere.cpp), so that results match those of
+// PROJ to the nanometre. Coordinates are normalized by the semi-major axis.
+
+constexpr double DEG_TO_RAD = M_PI / 180.0;
+constexpr double RAD_TO_DEG = 180.0 / M_PI;
+constexpr double EPS10 = 1e-10;
+
+/************************************************************************/
+/*                               AdjLon()                               */
+/************************************************************************/
+
+/** Wrap a longitude in radians into [-pi,pi], like PROJ adjlon() */
+static inline double AdjLon(double dfLon)
+{
+    // Let longitude slightly overshoot, to avoid spurious sign switching at
+    // the antimeridian
+    if (std::fabs(dfLon) < M_PI + 1e-12)
+        return dfLon;
+    dfLon += M_PI;
+    dfLon -= 2 * M_PI * std::floor(dfLon / (2 * M_PI));
+    return dfLon - M_PI;
+}
+
+/************************************************************************/
+/*                           TanPhiToTanChi()                           */
+/************************************************************************/
+
+/** Returns the tangent of the conformal latitude (that is the hyperbolic sine
+ * of the isometric latitude), from the tangent of the geodetic latitude. */
+static inline double TanPhiToTanChi(double dfTau, double dfE)
+{
+    const double dfTau1 = std::sqrt(1 + dfTau * dfTau);
+    const double dfSig = std::sinh(dfE * std::atanh(dfE * dfTau / dfTau1));
+    return std::sqrt(1 + dfSig * dfSig) * dfTau - dfSig * dfTau1;
+}
+
+/************************************************************************/
+/*                           TanChiToTanPhi()                           */
+/************************************************************************/
+
+/** Inverse of TanPhiToTanChi(), by Newton iterations, like PROJ
+ * pj_sinhpsi2tanphi() */
+static inline bool TanChiToTanPhi(double dfTauP, double dfE, double &dfTau)
+{
+    constexpr int NUM_ITER = 5;
+    const double dfRootEps = std::sqrt(DBL_EPSILON);
+    const double dfTol = dfRootEps / 10;
+    const double dfTMax = 2 / dfRootEps;
+    const double dfE2m = 1 - dfE * dfE;
+    const double dfSTol = dfTol * std::max(1.0, std::fabs(dfTauP));
+    dfTau = std::fabs(dfTauP) > 70 ? dfTauP * std::exp(dfE * std::atanh(dfE))
+                                   : dfTauP / dfE2m;
+    if (!(std::fabs(dfTau) < dfTMax))
+        return true;
+    for (int i = 0; i < NUM_ITER; ++i)
+    {
+        const double dfTauPA = TanPhiToTanChi(dfTau, dfE);
+        const double dfTau1 = std::sqrt(1 + dfTau * dfTau);
+        const double dfDTau =
+            (dfTauP - dfTauPA) * (1 + dfE2m * (dfTau * dfTau)) /
+            (dfE2m * dfTau1 * std::sqrt(1 + dfTauPA * dfTauPA));
+        dfTau += dfDTau;
+        if (!(std::fabs(dfDTau) >= dfSTol))
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                                Tsfn()                                */
+/************************************************************************/
+
+/** Snyder's t function, that is exp(-psi) where psi is the isometric
+ * latitude, like PROJ pj_tsfn() */
+static inline double Tsfn(double dfPhi, double dfSinPhi, double dfE)
+{
+    const double dfCosPhi = std::cos(dfPhi);
+    return std::exp(dfE * std::atanh(dfE * dfSinPhi)) *
+           (dfSinPhi > 0 ? dfCosPhi / (1 + dfSinPhi)
+                         : (1 - dfSinPhi) / dfCosPhi);
+}
+
+/************************************************************************/
+/*                                Phi2()                                 */
+/************************************************************************/
+
+/** Inverse of Tsfn(), like PROJ pj_phi2() */
+static inline bool Phi2(double dfTs, double dfE, double &dfPhi)
+{
+    double dfTau = 0;
+    if (!TanChiToTanPhi((1 / dfTs - dfTs) / 2, dfE, dfTau))
+        return false;
+    dfPhi = std::atan(dfTau);
+    return true;
+}
+
+/************************************************************************/
+/*                                Msfn()                                */
+/************************************************************************/
+
+static inline double Msfn(double dfSinPhi, double dfCosPhi, double dfEs)
+{
+    return dfCosPhi / std::sqrt(1.0 - dfEs * dfSinPhi * dfSinPhi);
+}
+
+/************************************************************************/
+/*                                Qsfn()                                */
+/************************************************************************/
+
+/** Snyder's q function, related to the authalic latitude, like PROJ
+ * pj_qsfn() */
+static inline double Qsfn(double dfSinPhi, double dfE, double dfOneEs)
+{
+    const double dfCon = dfE * dfSinPhi;
+    const double dfDiv1 = 1.0 - dfCon * dfCon;
+    const double dfDiv2 = 1.0 + dfCon;
+    return dfOneEs *
+           (dfSinPhi / dfDiv1 - (.5 / dfE) * std::log((1. - dfCon) / dfDiv2));
+}
+
+/************************************************************************/
+/*                            ClenshawSin()                             */
+/************************************************************************/
+
+/** Evaluates sum(padfCoeffs[j-1] * sin(j * z), j = 1..6) for the complex
+ * number z = dfArgR + i * dfArgI, with the Clenshaw algorithm. */
+static inline void ClenshawSin(const double *padfCoeffs, double dfArgR,
+                               double dfArgI, double &dfR, double &dfI)
+{
+    const double dfSinArgR = std::sin(dfArgR);
+    const double dfCosArgR = std::cos(dfArgR);
+    const double dfSinhArgI = std::sinh(dfArgI);
+    const double dfCoshArgI = std::cosh(dfArgI);
+    // 2 * cos(z)
+    const double dfR2Cos = 2 * dfCosArgR * dfCoshArgI;
+    const double dfI2Cos = -2 * dfSinArgR * dfSinhArgI;
+    double dfHR = 0;
+    double dfHI = 0;
+    double dfHR1 = 0;
+    double dfHI1 = 0;
+    for (int k = 5; k >= 0; --k)
+    {
+        const double dfHR2 = dfHR1;
+        const double dfHI2 = dfHI1;
+        dfHR1 = dfHR;
+        dfHI1 = dfHI;
+        dfHR = -dfHR2 + dfR2Cos * dfHR1 - dfI2Cos * dfHI1 + padfCoeffs[k];
+        dfHI = -dfHI2 + dfI2Cos * dfHR1 + dfR2Cos * dfHI1;
+    }
+    // Multiply by sin(z)
+    const double dfRSin = dfSinArgR * dfCoshArgI;
+    const double dfISin = dfCosArgR * dfSinhArgI;
+    dfR = dfRSin * dfHR - dfISin * dfHI;
+    dfI = dfRSin * dfHI + dfISin * dfHR;
+}
+
+/************************************************************************/
+/*                          OGRCTFastPathTMerc                          */
+/************************************************************************/
+
+struct OGRCTFastPathTMerc
+{
+    const OGRCTFastPath &m_oParams;
+
+    // Domain handled natively. PROJ is used beyond it.
+    static constexpr double MAX_DELTA_LAM = 60 * DEG_TO_RAD;
+    static constexpr double MAX_ETA = 1.25;
+
+    explicit OGRCTFastPathTMerc(const OGRCTFastPath &oParams)
+        : m_oParams(oParams)
+    {
+    }
+
+    inline bool Fwd(double dfLam, double dfPhi, double &dfX,
+                    double &dfY) const
+    {
+        if (std::fabs(dfLam) > MAX_DELTA_LAM)
+            return false;
+        const double dfTauP = TanPhiToTanChi(std::tan(dfPhi), m_oParams.m_dfE);
+        const double dfCosLam = std::cos(dfLam);
+        const double dfXiP = std::atan2(dfTauP, dfCosLam);
+        const double dfEtaP =
+            std::asinh(std::sin(dfLam) / std::hypot(dfTauP, dfCosLam));
+        double dfDXi = 0;
+        double dfDEta = 0;
+        ClenshawSin(m_oParams.m_adfAlpha, 2 * dfXiP, 2 * dfEtaP, dfDXi,
+                    dfDEta);
+        dfX = m_oParams.m_dfQn * (dfEtaP + dfDEta);
+        dfY = m_oParams.m_dfQn * (dfXiP + dfDXi) + m_oParams.m_dfZb;
+        return true;
+    }
+
+    inline bool Inv(double dfX, double dfY, double &dfLam,
+                    double &dfPhi) const
+    {
+        const double dfXi = (dfY - m_oParams.m_dfZb) / m_oParams.m_dfQn;
+        const double dfEta = dfX / m_oParams.m_dfQn;
+        if (!(std::fabs(dfEta) <= MAX_ETA))
+            return false;
+        double dfDXi = 0;
+        double dfDEta = 0;
+        ClenshawSin(m_oParams.m_adfBeta, 2 * dfXi, 2 * dfEta, dfDXi, dfDEta);
+        const double dfXiP = dfXi - dfDXi;
+        const double dfEtaP = dfEta - dfDEta;
+        const double dfSinhEtaP = std::sinh(dfEtaP);
+        const double dfCosXiP = std::cos(dfXiP);
+        const double dfTauP =
+            std::sin(dfXiP) / std::hypot(dfSinhEtaP, dfCosXiP);
+        double dfTau = 0;
+        if (!TanChiToTanPhi(dfTauP, m_oParams.m_dfE, dfTau))
+            return false;
+        dfPhi = std::atan(dfTau);
+        dfLam = std::atan2(dfSinhEtaP, dfCosXiP);
+        return true;
+    }
+};
+
+/************************************************************************/
+/*                           OGRCTFastPathLCC                           */
+/************************************************************************/
+
+struct OGRCTFastPathLCC
+{
+    const OGRCTFastPath &m_oParams;
+
+    explicit OGRCTFastPathLCC(const OGRCTFastPath &oParams)
+        : m_oParams(oParams)
+    {
+    }
+
+    inline bool Fwd(double dfLam, double dfPhi, double &dfX,
+                    double &dfY) const
+    {
+        // Leave the poles to PROJ
+        if (std::fabs(std::fabs(dfPhi) - M_PI_2) < EPS10)
+            return false;
+        const double dfN = m_oParams.m_dfN;
+        const double dfRho =
+            m_oParams.m_dfC *
+            std::pow(Tsfn(dfPhi, std::sin(dfPhi), m_oParams.m_dfE), dfN);
+        const double dfLamN = dfLam * dfN;
+        dfX = m_oParams.m_dfK0 * (dfRho * std::sin(dfLamN));
+        dfY = m_oParams.m_dfK0 *
+              (m_oParams.m_dfRho0 - dfRho * std::cos(dfLamN));
+        return std::isfinite(dfX) && std::isfinite(dfY);
+    }
+
+    inline bool Inv(double dfX, double dfY, double &dfLam,
+                    double &dfPhi) const
+    {
+        const double dfN = m_oParams.m_dfN;
+        dfX /= m_oParams.m_dfK0;
+        dfY = m_oParams.m_dfRho0 - dfY / m_oParams.m_dfK0;
+        double dfRho = std::hypot(dfX, dfY);
+        if (dfRho == 0.0)
+            return false;
+        if (dfN < 0.)
+        {
+            dfRho = -dfRho;
+            dfX = -dfX;
+            dfY = -dfY;
+        }
+        if (!Phi2(std::pow(dfRho / m_oParams.m_dfC, 1. / dfN),
+                  m_oParams.m_dfE, dfPhi))
+            return false;
+        dfLam = std::atan2(dfX, dfY) / dfN;
+        return std::isfinite(dfPhi);
+    }
+};
+
+/************************************************************************/
+/*                           OGRCTFastPathAEA                           */
+/************************************************************************/
+
+struct OGRCTFastPathAEA
+{
+    const OGRCTFastPath &m_oParams;
+    const double m_dfOneEs;
+    const double m_dfDD;
+
+    explicit OGRCTFastPathAEA(const OGRCTFastPath &oParams)
+        : m_oParams(oParams), m_dfOneEs(1 - oParams.m_dfEs),
+          m_dfDD(1 / oParams.m_dfN)
+    {
+    }
+
+    inline bool Fwd(double dfLam, double dfPhi, double &dfX,
+                    double &dfY) const
+    {
+        double dfRho =
+            m_oParams.m_dfC -
+            m_oParams.m_dfN *
+                Qsfn(std::sin(dfPhi), m_oParams.m_dfE, m_dfOneEs);
+        if (!(dfRho >= 0.))
+            return false;
+        dfRho = m_dfDD * std::sqrt(dfRho);
+        const double dfLamN = dfLam * m_oParams.m_dfN;
+        dfX = dfRho * std::sin(dfLamN);
+        dfY = m_oParams.m_dfRho0 - dfRho * std::cos(dfLamN);
+        return true;
+    }
+
+    // Inverse of Qsfn(), like phi1_() of PROJ aea.cpp
+    inline bool Phi1(double dfQs, double &dfPhi) const
+    {
+        constexpr int N_ITER = 15;
+        constexpr double TOL = 1e-10;
+        const double dfE = m_oParams.m_dfE;
+        dfPhi = std::asin(.5 * dfQs);
+        for (int i = 0; i < N_ITER; ++i)
+        {
+            const double dfSinPhi = std::sin(dfPhi);
+            const double dfCosPhi = std::cos(dfPhi);
+            const double dfCon = dfE * dfSinPhi;
+            const double dfCom = 1. - dfCon * dfCon;
+            const double dfDPhi =
+                .5 * dfCom * dfCom / dfCosPhi *
+                (dfQs / m_dfOneEs - dfSinPhi / dfCom +
+                 .5 / dfE * std::log((1. - dfCon) / (1. + dfCon)));
+            dfPhi += dfDPhi;
+            if (!(std::fabs(dfDPhi) > TOL))
+                return true;
+        }
+        return false;
+    }
+
+    inline bool Inv(double dfX, double dfY, double &dfLam,
+                    double &dfPhi) const
+    {
+        constexpr double TOL7 = 1e-7;
+        dfY = m_oParams.m_dfRho0 - dfY;
+        double dfRho = std::hypot(dfX, dfY);
+        if (dfRho == 0.0)
+            return false;
+        if (m_oParams.m_dfN < 0.)
+        {
+            dfRho = -dfRho;
+            dfX = -dfX;
+            dfY = -dfY;
+        }
+        const double dfQs = dfRho / m_dfDD;
+        const double dfQ = (m_oParams.m_dfC - dfQs * dfQs) / m_oParams.m_dfN;
+        // Leave the neighbourhood of the poles to PROJ
+        if (!(std::fabs(m_oParams.m_dfEc - std::fabs(dfQ)) > TOL7) ||
+            !Phi1(dfQ, dfPhi))
+            return false;
+        dfLam = std::atan2(dfX, dfY) / m_oParams.m_dfN;
+        return std::isfinite(dfPhi);
+    }
+};
+
+/************************************************************************/
+/*                       OGRCTFastPathPolarStere                        */
+/************************************************************************/
+
+struct OGRCTFastPathPolarStere
+{
+    const OGRCTFastPath &m_oParams;
+
+    explicit OGRCTFastPathPolarStere(const OGRCTFastPath &oParams)
+        : m_oParams(oParams)
+    {
+    }
+
+    inline bool Fwd(double dfLam, double dfPhi, double &dfX,
+                    double &dfY) const
+    {
+        double dfCosLam = std::cos(dfLam);
+        double dfSinPhi = std::sin(dfPhi);
+        if (m_oParams.m_bSouthPole)
+        {
+            dfPhi = -dfPhi;
+            dfCosLam = -dfCosLam;
+            dfSinPhi = -dfSinPhi;
+        }
+        // Leave the opposite pole to PROJ
+        if (dfPhi < -M_PI_2 + EPS10)
+            return false;
+        const double dfR = std::fabs(dfPhi - M_PI_2) < 1e-15
+                               ? 0.0
+                               : m_oParams.m_dfAkm1 *
+                                     Tsfn(dfPhi, dfSinPhi, m_oParams.m_dfE);
+        dfX = dfR * std::sin(dfLam);
+        dfY = -dfR * dfCosLam;
+        return true;
+    }
+
+    inline bool Inv(double dfX, double dfY, double &dfLam,
+                    double &dfPhi) const
+    {
+        const double dfRho = std::hypot(dfX, dfY);
+        if (!m_oParams.m_bSouthPole)
+            dfY = -dfY;
+        if (!Phi2(dfRho / m_oParams.m_dfAkm1, m_oParams.m_dfE, dfPhi))
+            return false;
+        if (m_oParams.m_bSouthPole)
+            dfPhi = -dfPhi;
+        dfLam = (dfX == 0. && dfY == 0.) ? 0. : std::atan2(dfX, dfY);
+        return true;
+    }
+};
+
+/************************************************************************/
+/*                     OGRCTFastPath::ForwardLoop()                     */
+/************************************************************************/
+
+template <class Projection>
+size_t OGRCTFastPath::ForwardLoop(size_t nCount, double *padfX, double *padfY,
+                                  GByte *pabyHandled) const
+{
+    const Projection oProj(*this);
+    const double *padfLong = m_bSwapGeog ? padfY : padfX;
+    const double *padfLat = m_bSwapGeog ? padfX : padfY;
+    double *padfEasting = m_bSwapProj ? padfY : padfX;
+    double *padfNorthing = m_bSwapProj ? padfX : padfY;
+    const double dfAToUnit = m_dfA / m_dfToMeter;
+    const double dfX0ToUnit = m_dfX0 / m_dfToMeter;
+    const double dfY0ToUnit = m_dfY0 / m_dfToMeter;
+
+    size_t nNotHandled = 0;
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        const double dfLam = padfLong[i] * DEG_TO_RAD;
+        const double dfPhi = padfLat[i] * DEG_TO_RAD;
+        double dfX = 0;
+        double dfY = 0;
+        // Invalid coordinates and points out of the domain handled natively
+        // are left to PROJ.
+        if (!std::isfinite(dfLam) || !(std::fabs(dfPhi) <= M_PI_2) ||
+            !oProj.Fwd(AdjLon(dfLam - m_dfLam0), dfPhi, dfX, dfY))
+        {
+            pabyHandled[i] = FALSE;
+            ++nNotHandled;
+            continue;
+        }
+        padfEasting[i] = dfAToUnit * dfX + dfX0ToUnit;
+        padfNorthing[i] = dfAToUnit * dfY + dfY0ToUnit;
+        pabyHandled[i] = TRUE;
+    }
+    return nNotHandled;
+}
+
+/************************************************************************/
+/*                     OGRCTFastPath::InverseLoop()                     */
+/************************************************************************/
+
+template <class Projection>
+size_t OGRCTFastPath::InverseLoop(size_t nCount, double *padfX, double *padfY,
+                                  GByte *pabyHandled) const
+{
+    const Projection oProj(*this);
+    double *padfLong = m_bSwapGeog ? padfY : padfX;
+    double *padfLat = m_bSwapGeog ? padfX : padfY;
+    const double *padfEasting = m_bSwapProj ? padfY : padfX;
+    const double *padfNorthing = m_bSwapProj ? padfX : padfY;
+    const double dfUnitToA = m_dfToMeter / m_dfA;
+    const double dfInvA = 1.0 / m_dfA;
+
+    size_t nNotHandled = 0;
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        const double dfX = padfEasting[i] * dfUnitToA - m_dfX0 * dfInvA;
+        const double dfY = padfNorthing[i] * dfUnitToA - m_dfY0 * dfInvA;
+        double dfLam = 0;
+        double dfPhi = 0;
+        if (!std::isfinite(dfX) || !std::isfinite(dfY) ||
+            !oProj.Inv(dfX, dfY, dfLam, dfPhi))
+        {
+            pabyHandled[i] = FALSE;
+            ++nNotHandled;
+            continue;
+        }
+        padfLong[i] = AdjLon(dfLam + m_dfLam0) * RAD_TO_DEG;
+        padfLat[i] = dfPhi * RAD_TO_DEG;
+        pabyHandled[i] = TRUE;
+    }
+    return nNotHandled;
+}
+
+/************************************************************************/
+/*                      OGRCTFastPath::Transform()                      */
+/************************************************************************/
+
+/** Transform points in place.
+ *
+ * Coordinates are in the axis order and units of the CRS, that is the
+ * ones of the input and output of the PROJ coordinate operation.
+ *
+ * Points that cannot be transformed natively, because they are invalid or
+ * out of the domain where the native implementation is known to match PROJ,
+ * are left unmodified, and the corresponding pabyHandled[] value is set
+ * to FALSE.
+ *
+ * @return the number of points that have not been transformed.
+ */
+size_t OGRCTFastPath::Transform(size_t nCount, double *padfX, double *padfY,
+                                GByte *pabyHandled) const
+{
+    switch (m_eMethod)
+    {
+        case Method::TMERC:
+            return m_bInverse ? InverseLoop<OGRCTFastPathTMerc>(
+                                    nCount, padfX, padfY, pabyHandled)
+                              : ForwardLoop<OGRCTFastPathTMerc>(
+                                    nCount, padfX, padfY, pabyHandled);
+        case Method::LCC:
+            return m_bInverse ? InverseLoop<OGRCTFastPathLCC>(
+                                    nCount, padfX, padfY, pabyHandled)
+                              : ForwardLoop<OGRCTFastPathLCC>(
+                                    nCount, padfX, padfY, pabyHandled);
+        case Method::AEA:
+            return m_bInverse ? InverseLoop<OGRCTFastPathAEA>(
+                                    nCount, padfX, padfY, pabyHandled)
+                              : ForwardLoop<OGRCTFastPathAEA>(
+                                    nCount, padfX, padfY, pabyHandled);
+        case Method::POLAR_STERE:
+            return m_bInverse ? InverseLoop<OGRCTFastPathPolarStere>(
+                                    nCount, padfX, padfY, pabyHandled)
+                              : ForwardLoop<OGRCTFastPathPolarStere>(
+                                    nCount, padfX, padfY, pabyHandled);
+    }
+    return nCount;
+}
+
+/************************************************************************/
+/*              OGRCTFastPath::GetSampleGeographicPoints()              */
+/************************************************************************/
+
+/** Returns geographic coordinates, in degrees and in the axis order of the
+ * geographic CRS, of points covering the domain where the conversion is
+ * handled natively, to check its results against PROJ.
+ */
+void OGRCTFastPath::GetSampleGeographicPoints(std::vector<double> &adfX,
+                                              std::vector<double> &adfY) const
+{
+    std::vector<double> adfDeltaLong;
+    std::vector<double> adfLat;
+    switch (m_eMethod)
+    {
+        case Method::TMERC:
+            adfDeltaLong = {-55, -20, -6, -2.5, 0, 1, 3, 9, 30, 55};
+            adfLat = {-89.9, -60, -30, -5, 0, 5, 30, 60, 85, 89.9};
+            break;
+        case Method::LCC:
+        case Method::AEA:
+            adfDeltaLong = {-149.5, -90, -30, -5, 0, 5, 30, 90, 149.5};
+            adfLat = {-80, -50, -20, 0, 20, 50, 80};
+            break;
+        case Method::POLAR_STERE:
+            adfDeltaLong = {-169.5, -100, -45, 0, 10, 80, 135, 169.5};
+            for (double dfLat : {0.0, 30.0, 60.0, 75.0, 85.0, 89.5, 90.0})
+                adfLat.push_back(m_bSouthPole ? -dfLat : dfLat);
+            break;
+    }
+    adfLat.push_back(m_dfPhi0 * RAD_TO_DEG);
+
+    adfX.clear();
+    adfY.clear();
+    for (double dfLat : adfLat)
+    {
+        for (double dfDeltaLong : adfDeltaLong)
+        {
+            double dfLong = m_dfLam0 * RAD_TO_DEG + dfDeltaLong;
+            if (dfLong > 180)
+                dfLong -= 360;
+            else if (dfLong < -180)
+                dfLong += 360;
+            adfX.push_back(m_bSwapGeog ? dfLat : dfLong);
+            adfY.push_back(m_bSwapGeog ? dfLong : dfLat);
+        }
+    }
+}
+
+/************************************************************************/
+/*                        OGRCTFastPath::Setup()                        */
+/************************************************************************/
+
+/** Compute the constants of the projection, like the setup functions of the
+ * PROJ implementations. */
+bool OGRCTFastPath::Setup()
+{
+    const double dfE = m_dfE;
+    const double dfEs = m_dfEs;
+    switch (m_eMethod)
+    {
+        case Method::TMERC:
+        {
+            const double dfF = dfEs / (1 + std::sqrt(1 - dfEs));
+            // Third flattening
+            const double n = dfF / (2 - dfF);
+            double np = n;
+            m_adfAlpha[0] =
+                n * (1 / 2. +
+                     n * (-2 / 3. +
+                          n * (5 / 16. +
+                               n * (41 / 180. +
+                                    n * (-127 / 288. + n * (7891 / 37800.))))));
+            m_adfBeta[0] =
+                n *
+                (1 / 2. +
+                 n * (-2 / 3. +
+                      n * (37 / 96. +
+                           n * (-1 / 360. +
+                                n * (-81 / 512. + n * (96199 / 604800.))))));
+            np *= n;
+            m_adfAlpha[1] =
+                np * (13 / 48. +
+                      n * (-3 / 5. +
+                           n * (557 / 1440. +
+                                n * (281 / 630. + n * (-1983433 / 1935360.)))));
+            m_adfBeta[1] =
+                np * (1 / 48. +
+                      n * (1 / 15. +
+                           n * (-437 / 1440. +
+                                n * (46 / 105. + n * (-1118711 / 3870720.)))));
+            np *= n;
+            m_adfAlpha[2] =
+                np * (61 / 240. +
+                      n * (-103 / 140. +
+                           n * (15061 / 26880. + n * (167603 / 181440.))));
+            m_adfBeta[2] =
+                np * (17 / 480. +
+                      n * (-37 / 840. +
+                           n * (-209 / 4480. + n * (5569 / 90720.))));
+            np *= n;
+            m_adfAlpha[3] = np * (49561 / 161280. +
+                                  n * (-179 / 168. + n * (6601661 / 7257600.)));
+            m_adfBeta[3] = np * (4397 / 161280. +
+                                 n * (-11 / 504. + n * (-830251 / 7257600.)));
+            np *= n;
+            m_adfAlpha[4] = np * (34729 / 80640. + n * (-3418889 / 1995840.));
+            m_adfBeta[4] = np * (4583 / 161280. + n * (-108847 / 3991680.));
+            np *= n;
+            m_adfAlpha[5] = np * (212378941 / 319334400.);
+            m_adfBeta[5] = np * (20648693 / 638668800.);
+
+            // Normalized rectifying radius
+            const double n2 = n * n;
+            m_dfQn =
+                m_dfK0 / (1 + n) * (1. + n2 * (1 / 4.0 + n2 * (1 / 64.0 +
+                                                               n2 / 256.0)));
+
+            // Northing of the latitude of origin
+            const double dfXiP0 =
+                std::atan(TanPhiToTanChi(std::tan(m_dfPhi0), dfE));
+            double dfDXi = 0;
+            double dfDEta = 0;
+            ClenshawSin(m_adfAlpha, 2 * dfXiP0, 0, dfDXi, dfDEta);
+            m_dfZb = -m_dfQn * (dfXiP0 + dfDXi);
+            return true;
+        }
+
+        case Method::LCC:
+        {
+            if (std::fabs(m_dfPhi1) > M_PI_2 || std::fabs(m_dfPhi2) > M_PI_2 ||
+                std::fabs(m_dfPhi1 + m_dfPhi2) < EPS10)
+                return false;
+            double dfSinPhi = std::sin(m_dfPhi1);
+            double dfCosPhi = std::cos(m_dfPhi1);
+            m_dfN = dfSinPhi;
+            const double dfM1 = Msfn(dfSinPhi, dfCosPhi, dfEs);
+            const double dfMl1 = Tsfn(m_dfPhi1, dfSinPhi, dfE);
+            if (std::fabs(m_dfPhi1 - m_dfPhi2) >= EPS10)
+            {
+                dfSinPhi = std::sin(m_dfPhi2);
+                dfCosPhi = std::cos(m_dfPhi2);
+                m_dfN = std::log(dfM1 / Msfn(dfSinPhi, dfCosPhi, dfEs));
+                if (m_dfN == 0)
+                    return false;
+                const double dfMl2 = Tsfn(m_dfPhi2, dfSinPhi, dfE);
+                const double dfDenom = std::log(dfMl1 / dfMl2);
+                if (dfDenom == 0)
+                    return false;
+                m_dfN /= dfDenom;
+            }
+            if (m_dfN == 0)
+                return false;
+            m_dfC = dfM1 * std::pow(dfMl1, -m_dfN) / m_dfN;
+            m_dfRho0 = std::fabs(std::fabs(m_dfPhi0) - M_PI_2) < EPS10
+                           ? 0.
+                           : m_dfC * std::pow(Tsfn(m_dfPhi0, std::sin(m_dfPhi0),
+                                                   dfE),
+                                              m_dfN);
+            return std::isfinite(m_dfC) && std::isfinite(m_dfRho0);
+        }
+
+        case Method::AEA:
+        {
+            if (std::fabs(m_dfPhi1) > M_PI_2 || std::fabs(m_dfPhi2) > M_PI_2 ||
+                std::fabs(m_dfPhi1 + m_dfPhi2) < EPS10)
+                return false;
+            const double dfOneEs = 1 - dfEs;
+            double dfSinPhi = std::sin(m_dfPhi1);
+            double dfCosPhi = std::cos(m_dfPhi1);
+            m_dfN = dfSinPhi;
+            const double dfM1 = Msfn(dfSinPhi, dfCosPhi, dfEs);
+            const double dfMl1 = Qsfn(dfSinPhi, dfE, dfOneEs);
+            if (std::fabs(m_dfPhi1 - m_dfPhi2) >= EPS10)
+            {
+                dfSinPhi = std::sin(m_dfPhi2);
+                dfCosPhi = std::cos(m_dfPhi2);
+                const double dfM2 = Msfn(dfSinPhi, dfCosPhi, dfEs);
+                const double dfMl2 = Qsfn(dfSinPhi, dfE, dfOneEs);
+                if (dfMl2 == dfMl1)
+                    return false;
+                m_dfN = (dfM1 * dfM1 - dfM2 * dfM2) / (dfMl2 - dfMl1);
+            }
+            if (m_dfN == 0)
+                return false;
+            m_dfEc =
+                1. - .5 * dfOneEs * std::log((1. - dfE) / (1. + dfE)) / dfE;
+            m_dfC = dfM1 * dfM1 + m_dfN * dfMl1;
+            const double dfRho0Squared =
+                m_dfC - m_dfN * Qsfn(std::sin(m_dfPhi0), dfE, dfOneEs);
+            if (dfRho0Squared < 0)
+                return false;
+            m_dfRho0 = std::sqrt(dfRho0Squared) / m_dfN;
+            return true;
+        }
+
+        case Method::POLAR_STERE:
+        {
+            if (std::fabs(std::fabs(m_dfPhi0) - M_PI_2) >= EPS10)
+                return false;
+            m_bSouthPole = m_dfPhi0 < 0;
+            const double dfPhiTS = std::fabs(m_dfPhiTS);
+            if (std::fabs(dfPhiTS - M_PI_2) < EPS10)
+            {
+                m_dfAkm1 = 2. * m_dfK0 /
+                           std::sqrt(std::pow(1 + dfE, 1 + dfE) *
+                                     std::pow(1 - dfE, 1 - dfE));
+            }
+            else
+            {
+                const double dfSinPhiTS = std::sin(dfPhiTS);
+                m_dfAkm1 = std::cos(dfPhiTS) / Tsfn(dfPhiTS, dfSinPhiTS, dfE);
+                const double dfT = dfSinPhiTS * dfE;
+                m_dfAkm1 /= std::sqrt(1. - dfT * dfT);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       OGRCTFastPath::Create()                        */
+/************************************************************************/
+
+namespace
+{
+struct PROJStep
+{
+    bool bInv = false;
+    std::string osProj{};
+    // Parameters, without their leading '+'. Flags have an empty value.
+    std::map<std::string, std::string> oMapParams{};
+};
+}  // namespace
+
+/** Parses a number, that must be the whole string */
+static bool ParseDouble(const std::string &osVal, double &dfVal)
+{
+    if (osVal.empty())
+        return false;
+    char *pszEnd = nullptr;
+    dfVal = CPLStrtod(osVal.c_str(), &pszEnd);
+    return pszEnd && *pszEnd == '\0' && std::isfinite(dfVal);
+}
+
+/** Returns the size in metre of a linear unit of PROJ unitconvert */
+static bool GetLinearUnitToMeter(const std::string &osUnit, double &dfToMeter)
+{
+    if (osUnit == "m")
+        dfToMeter = 1.0;
+    else if (osUnit == "km")
+        dfToMeter = 1000.0;
+    else if (osUnit == "ft")
+        dfToMeter = 0.3048;
+    else if (osUnit == "us-ft")
+        dfToMeter = 1200.0 / 3937.0;
+    else if (!ParseDouble(osUnit, dfToMeter) || !(dfToMeter > 0))
+        return false;
+    return true;
+}
+
+/** Sets the ellipsoid from the +ellps, +a, +b, +rf and +f parameters */
+static bool GetEllipsoid(const std::map<std::string, std::string> &oMapParams,
+                         double &dfA, double &dfEs)
+{
+    std::string osA;
+    std::string osShapeKey;
+    std::string osShapeValue;
+    const auto oIterEllps = oMapParams.find("ellps");
+    if (oIterEllps != oMapParams.end())
+    {
+        for (const auto *psEllps = proj_list_ellps(); psEllps && psEllps->id;
+             ++psEllps)
+        {
+            if (oIterEllps->second == psEllps->id)
+            {
+                if (!STARTS_WITH(psEllps->major, "a="))
+                    return false;
+                osA = psEllps->major + 2;
+                const char *pszEqual = strchr(psEllps->ell, '=');
+                if (!pszEqual)
+                    return false;
+                osShapeKey.assign(psEllps->ell, pszEqual - psEllps->ell);
+                osShapeValue = pszEqual + 1;
+                break;
+            }
+        }
+        if (osA.empty())
+            return false;
+    }
+    for (const char *pszKey : {"a", "b", "rf", "f"})
+    {
+        const auto oIter = oMapParams.find(pszKey);
+        if (oIter == oMapParams.end())
+            continue;
+        // Do not try to mix +ellps with explicit parameters
+        if (oIterEllps != oMapParams.end())
+            return false;
+        if (EQUAL(pszKey, "a"))
+        {
+            osA = oIter->second;
+        }
+        else
+        {
+            if (!osShapeKey.empty())
+                return false;
+            osShapeKey = pszKey;
+            osShapeValue = oIter->second;
+        }
+    }
+
+    double dfShape = 0;
+    if (!ParseDouble(osA, dfA) || !(dfA > 0) ||
+        !ParseDouble(osShapeValue, dfShape))
+        return false;
+    if (osShapeKey == "rf")
+    {
+        const double dfF = 1.0 / dfShape;
+        dfEs = 2 * dfF - dfF * dfF;
+    }
+    else if (osShapeKey == "f")
+    {
+        dfEs = 2 * dfShape - dfShape * dfShape;
+    }
+    else if (osShapeKey == "b")
+    {
+        dfEs = 1 - (dfShape * dfShape) / (dfA * dfA);
+    }
+    else if (osShapeKey == "es")
+    {
+        dfEs = dfShape;
+    }
+    else
+    {
+        return false;
+    }
+    // Spheres are not handled
+    return dfEs > 0 && dfEs < 1;
+}
+
+/** Instantiates a native implementation of a PROJ pipeline.
+ *
+ * The pipeline must consist of the conversion between a geographic CRS with
+ * angles in degree, and a projected CRS using one of the supported methods,
+ * optionally with axis swapping and conversion of the linear unit.
+ *
+ * @param pszPROJString PROJ string of the coordinate operation
+ * @param bReverse whether the coordinate operation is used in the reverse
+ *                 direction.
+ * @return a new object, or nullptr if the pipeline is not handled.
+ */
+std::unique_ptr<OGRCTFastPath> OGRCTFastPath::Create(const char *pszPROJString,
+                                                     bool bReverse)
+{
+    const CPLStringList aosTokens(
+        CSLTokenizeString2(pszPROJString, " ", CSLT_HONOURSTRINGS));
+    if (aosTokens.empty() || !EQUAL(aosTokens[0], "+proj=pipeline"))
+        return nullptr;
+
+    std::vector<PROJStep> asSteps;
+    for (int i = 1; i < aosTokens.size(); ++i)
+    {
+        const char *pszToken = aosTokens[i];
+        if (EQUAL(pszToken, "+step"))
+        {
+            asSteps.emplace_back();
+            continue;
+        }
+        // Global parameters of the pipeline are not handled
+        if (asSteps.empty() || pszToken[0] != '+')
+            return nullptr;
+        auto &sStep = asSteps.back();
+        const char *pszEqual = strchr(pszToken, '=');
+        const std::string osKey =
+            pszEqual ? std::string(pszToken + 1, pszEqual - pszToken - 1)
+                     : std::string(pszToken + 1);
+        const std::string osValue = pszEqual ? pszEqual + 1 : "";
+        if (osKey == "inv" && !pszEqual)
+            sStep.bInv = true;
+        else if (osKey == "proj")
+            sStep.osProj = osValue;
+        else if (!sStep.oMapParams.insert({osKey, osValue}).second)
+            return nullptr;
+    }
+
+    // Locate the projection step
+    const auto IsProjection = [](const PROJStep &sStep)
+    {
+        return sStep.osProj == "tmerc" || sStep.osProj == "etmerc" ||
+               sStep.osProj == "utm" || sStep.osProj == "lcc" ||
+               sStep.osProj == "aea" || sStep.osProj == "stere" ||
+               sStep.osProj == "ups";
+    };
+    const auto oIterProj =
+        std::find_if(asSteps.begin(), asSteps.end(), IsProjection);
+    if (oIterProj == asSteps.end() ||
+        std::find_if(oIterProj + 1, asSteps.end(), IsProjection) !=
+            asSteps.end())
+    {
+        return nullptr;
+    }
+
+    // Normalize the pipeline so that it goes from geographic to projected
+    // coordinates.
+    auto poFastPath = std::unique_ptr<OGRCTFastPath>(new OGRCTFastPath());
+    const bool bInverse = oIterProj->bInv;
+    if (bInverse)
+    {
+        std::reverse(asSteps.begin(), asSteps.end());
+        for (auto &sStep : asSteps)
+            sStep.bInv = !sStep.bInv;
+    }
+    poFastPath->m_bInverse = bInverse != bReverse;
+
+    const auto IsAxisSwap = [](const PROJStep &sStep)
+    {
+        return sStep.osProj == "axisswap" && sStep.oMapParams.size() == 1 &&
+               sStep.oMapParams.begin()->first == "order" &&
+               sStep.oMapParams.begin()->second == "2,1";
+    };
+    // Returns the input and output units of a unitconvert step
+    const auto GetUnitConvert =
+        [](const PROJStep &sStep, std::string &osIn, std::string &osOut)
+    {
+        if (sStep.osProj != "unitconvert" || sStep.oMapParams.size() != 2)
+            return false;
+        const auto oIterIn = sStep.oMapParams.find("xy_in");
+        const auto oIterOut = sStep.oMapParams.find("xy_out");
+        if (oIterIn == sStep.oMapParams.end() ||
+            oIterOut == sStep.oMapParams.end())
+            return false;
+        osIn = sStep.bInv ? oIterOut->second : oIterIn->second;
+        osOut = sStep.bInv ? oIterIn->second : oIterOut->second;
+        return true;
+    };
+
+    // Expected sequence of steps: [axisswap] unitconvert(deg->rad)
+    // projection [unitconvert(m->unit)] [axisswap]
+    size_t iStep = 0;
+    std::string osIn;
+    std::string osOut;
+    if (iStep < asSteps.size() && IsAxisSwap(asSteps[iStep]))
+    {
+        poFastPath->m_bSwapGeog = true;
+        ++iStep;
+    }
+    if (!(iStep < asSteps.size() &&
+          GetUnitConvert(asSteps[iStep], osIn, osOut) && osIn == "deg" &&
+          osOut == "rad"))
+    {
+        return nullptr;
+    }
+    ++iStep;
+    if (iStep >= asSteps.size() || !IsProjection(asSteps[iStep]))
+        return nullptr;
+    const PROJStep &sProj = asSteps[iStep];
+    ++iStep;
+    if (iStep < asSteps.size() && GetUnitConvert(asSteps[iStep], osIn, osOut))
+    {
+        if (osIn != "m" ||
+            !GetLinearUnitToMeter(osOut, poFastPath->m_dfToMeter))
+            return nullptr;
+        ++iStep;
+    }
+    if (iStep < asSteps.size() && IsAxisSwap(asSteps[iStep]))
+    {
+        poFastPath->m_bSwapProj = true;
+        ++iStep;
+    }
+    if (iStep != asSteps.size())
+        return nullptr;
+
+    // Parameters of the projection step
+    auto oMapParams = sProj.oMapParams;
+    const auto oIterUnits = oMapParams.find("units");
+    if (oIterUnits != oMapParams.end())
+    {
+        if (oIterUnits->second != "m")
+            return nullptr;
+        oMapParams.erase(oIterUnits);
+    }
+    oMapParams.erase("no_defs");
+    if (!GetEllipsoid(oMapParams, poFastPath->m_dfA, poFastPath->m_dfEs))
+        return nullptr;
+    poFastPath->m_dfE = std::sqrt(poFastPath->m_dfEs);
+    for (const char *pszKey : {"ellps", "a", "b", "rf", "f"})
+        oMapParams.erase(pszKey);
+
+    // Consume the parameters with numeric values, which must be the only
+    // remaining ones.
+    const auto GetParam =
+        [&oMapParams](const char *pszKey, double dfDefault, double &dfVal)
+    {
+        const auto oIter = oMapParams.find(pszKey);
+        if (oIter == oMapParams.end())
+        {
+            dfVal = dfDefault;
+            return true;
+        }
+        const bool bOK = ParseDouble(oIter->second, dfVal);
+        oMapParams.erase(oIter);
+        return bOK;
+    };
+    double dfLon0 = 0;
+    double dfLat0 = 0;
+    double dfLat1 = 0;
+    double dfLat2 = 0;
+    double dfLatTS = 90;
+    bool bOK = true;
+    const std::string &osProj = sProj.osProj;
+    auto &oFP = *poFastPath;
+    if (osProj == "utm" || osProj == "ups")
+    {
+        const bool bSouth = oMapParams.erase("south") > 0;
+        oFP.m_eMethod =
+            osProj == "utm" ? Method::TMERC : Method::POLAR_STERE;
+        if (osProj == "utm")
+        {
+            double dfZone = 0;
+            if (!GetParam("zone", 0, dfZone) || dfZone < 1 || dfZone > 60 ||
+                dfZone != std::floor(dfZone))
+                return nullptr;
+            dfLon0 = (dfZone - 1 + .5) * 6 - 180;
+            oFP.m_dfK0 = 0.9996;
+            oFP.m_dfX0 = 500000;
+            oFP.m_dfY0 = bSouth ? 10000000 : 0;
+            oFP.m_osDescription = CPLSPrintf("UTM zone %d%s",
+                                             static_cast<int>(dfZone),
+                                             bSouth ? "S" : "N");
+        }
+        else
+        {
+            dfLat0 = bSouth ? -90 : 90;
+            oFP.m_dfK0 = 0.994;
+            oFP.m_dfX0 = 2000000;
+            oFP.m_dfY0 = 2000000;
+            oFP.m_osDescription = "Universal Polar Stereographic";
+        }
+    }
+    else
+    {
+        bOK = GetParam("lon_0", 0, dfLon0) && GetParam("lat_0", 0, dfLat0) &&
+              GetParam("x_0", 0, oFP.m_dfX0) && GetParam("y_0", 0, oFP.m_dfY0);
+        if (osProj != "aea")
+        {
+            if (oMapParams.find("k_0") != oMapParams.end())
+                bOK = bOK && GetParam("k_0", 1, oFP.m_dfK0);
+            else
+                bOK = bOK && GetParam("k", 1, oFP.m_dfK0);
+        }
+        if (osProj == "tmerc" || osProj == "etmerc")
+        {
+            oFP.m_eMethod = Method::TMERC;
+            oFP.m_osDescription = "Transverse Mercator";
+        }
+        else if (osProj == "lcc" || osProj == "aea")
+        {
+            oFP.m_eMethod = osProj == "lcc" ? Method::LCC : Method::AEA;
+            oFP.m_osDescription = osProj == "lcc"
+                                      ? "Lambert Conformal Conic"
+                                      : "Albers Equal Area";
+            bOK = bOK && GetParam("lat_1", 0, dfLat1);
+            if (osProj == "lcc" &&
+                sProj.oMapParams.find("lat_2") == sProj.oMapParams.end())
+            {
+                // Lambert Conformal Conic 1SP
+                dfLat2 = dfLat1;
+                if (sProj.oMapParams.find("lat_0") == sProj.oMapParams.end())
+                    dfLat0 = dfLat1;
+            }
+            else
+            {
+                bOK = bOK && GetParam("lat_2", 0, dfLat2);
+            }
+        }
+        else
+        {
+            oFP.m_eMethod = Method::POLAR_STERE;
+            oFP.m_osDescription = "Polar Stereographic";
+            bOK = bOK && GetParam("lat_ts", 90, dfLatTS);
+        }
+    }
+    if (!bOK || !oMapParams.empty())
+        return nullptr;
+
+    oFP.m_dfLam0 = dfLon0 * DEG_TO_RAD;
+    oFP.m_dfPhi0 = dfLat0 * DEG_TO_RAD;
+    oFP.m_dfPhi1 = dfLat1 * DEG_TO_RAD;
+    oFP.m_dfPhi2 = dfLat2 * DEG_TO_RAD;
+    oFP.m_dfPhiTS = dfLatTS * DEG_TO_RAD;
+    if (!(oFP.m_dfK0 > 0) || !oFP.Setup())
+        return nullptr;
+    if (oFP.m_bInverse)
+        oFP.m_osDescription += " (inverse)";
+
+    return poFastPath;
+}
+
+//! @endcond
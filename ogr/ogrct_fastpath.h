@@ -0,0 +1,139 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Native implementation of the most common map projection
+ *           conversions, used by OGRProjCT instead of PROJ when possible.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGRCT_FASTPATH_H_INCLUDED
+#define OGRCT_FASTPATH_H_INCLUDED
+
+#include "cpl_port.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                            OGRCTFastPath                             */
+/************************************************************************/
+
+/** Batch-oriented implementation of the conversion between a projected CRS
+ * and its base geographic CRS, for the Transverse Mercator (including UTM),
+ * Lambert Conformal Conic, Albers Equal Area and polar Stereographic
+ * methods.
+ *
+ * It is instantiated from the PROJ string of the coordinate operation that
+ * PROJ has selected, and is only meant to be used once its results have been
+ * checked to match the ones of PROJ.
+ *
+ * Instances are immutable, and can thus be shared between threads.
+ */
+class OGRCTFastPath
+{
+  public:
+    enum class Method
+    {
+        TMERC,
+        LCC,
+        AEA,
+        POLAR_STERE,
+    };
+
+    static std::unique_ptr<OGRCTFastPath> Create(const char *pszPROJString,
+                                                 bool bReverse);
+
+    /** Short description of the conversion, for debug messages */
+    const std::string &GetDescription() const
+    {
+        return m_osDescription;
+    }
+
+    /** Whether this converts projected coordinates to geographic ones */
+    bool IsInverse() const
+    {
+        return m_bInverse;
+    }
+
+    /** Whether geographic coordinates are in latitude, longitude order */
+    bool IsGeographicLatLong() const
+    {
+        return m_bSwapGeog;
+    }
+
+    void GetSampleGeographicPoints(std::vector<double> &adfX,
+                                   std::vector<double> &adfY) const;
+
+    size_t Transform(size_t nCount, double *padfX, double *padfY,
+                     GByte *pabyHandled) const;
+
+  private:
+    Method m_eMethod = Method::TMERC;
+    std::string m_osDescription{};
+
+    // Whether the conversion goes from the projected CRS to the geographic
+    // one.
+    bool m_bInverse = false;
+    // Whether the geographic coordinates are in latitude, longitude order
+    bool m_bSwapGeog = false;
+    // Whether the projected coordinates are in northing, easting order
+    bool m_bSwapProj = false;
+    // Size of the linear unit of the projected CRS, in metre
+    double m_dfToMeter = 1.0;
+
+    // Ellipsoid
+    double m_dfA = 0.0;
+    double m_dfE = 0.0;
+    double m_dfEs = 0.0;
+
+    // Projection parameters, with angles in radians
+    double m_dfLam0 = 0.0;
+    double m_dfPhi0 = 0.0;
+    double m_dfPhi1 = 0.0;
+    double m_dfPhi2 = 0.0;
+    double m_dfPhiTS = 0.0;
+    double m_dfK0 = 1.0;
+    double m_dfX0 = 0.0;
+    double m_dfY0 = 0.0;
+
+    // Derived constants, for coordinates normalized by the semi-major axis
+    double m_adfAlpha[6] = {0, 0, 0, 0, 0, 0};  // TMERC: Krüger series
+    double m_adfBeta[6] = {0, 0, 0, 0, 0, 0};   // TMERC: Krüger series
+    double m_dfQn = 0.0;                        // TMERC: rectifying radius
+    double m_dfZb = 0.0;                        // TMERC: northing of phi0
+    double m_dfN = 0.0;                         // LCC, AEA: cone constant
+    double m_dfC = 0.0;                         // LCC, AEA
+    double m_dfRho0 = 0.0;                      // LCC, AEA
+    double m_dfEc = 0.0;                        // AEA
+    double m_dfAkm1 = 0.0;                      // POLAR_STERE
+    bool m_bSouthPole = false;                  // POLAR_STERE
+
+    OGRCTFastPath() = default;
+
+    bool Setup();
+
+    template <class Projection>
+    size_t ForwardLoop(size_t nCount, double *padfX, double *padfY,
+                       GByte *pabyHandled) const;
+    template <class Projection>
+    size_t InverseLoop(size_t nCount, double *padfX, double *padfY,
+                       GByte *pabyHandled) const;
+
+    friend struct OGRCTFastPathTMerc;
+    friend struct OGRCTFastPathLCC;
+    friend struct OGRCTFastPathAEA;
+    friend struct OGRCTFastPathPolarStere;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRCTFastPath)
+};
+
+//! @endcond
+
+#endif  // OGRCT_FASTPATH_H_INCLUDED
@@ -341,6 +341,7 @@ void OGRFeature::Reset()
         {
             delete papoGeometries[i];
             papoGeometries[i] = nullptr;
+            DiscardLazyGeometry(i);
         }
     }
 
@@ -623,6 +624,7 @@ OGRGeometry *OGRFeature::StealGeometry()
 {
     if (GetGeomFieldCount() > 0)
     {
+        DecodeLazyGeometryIfNeeded(0);
         OGRGeometry *poReturn = papoGeometries[0];
         papoGeometries[0] = nullptr;
         return poReturn;
@@ -651,6 +653,7 @@ OGRGeometry *OGRFeature::StealGeometry(int iGeomField)
 {
     if (iGeomField >= 0 && iGeomField < GetGeomFieldCount())
     {
+        DecodeLazyGeometryIfNeeded(iGeomField);
         OGRGeometry *poReturn = papoGeometries[iGeomField];
         papoGeometries[iGeomField] = nullptr;
         return poReturn;
@@ -823,8 +826,8 @@ OGRGeometry *OGRFeature::GetGeomFieldRef(int iField)
 {
     if (iField < 0 || iField >= GetGeomFieldCount())
         return nullptr;
-    else
-        return papoGeometries[iField];
+    DecodeLazyGeometryIfNeeded(iField);
+    return papoGeometries[iField];
 }
 
 /**
@@ -842,8 +845,8 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef(int iField) const
 {
     if (iField < 0 || iField >= GetGeomFieldCount())
         return nullptr;
-    else
-        return papoGeometries[iField];
+    DecodeLazyGeometryIfNeeded(iField);
+    return papoGeometries[iField];
 }
 
 /************************************************************************/
@@ -866,6 +869,7 @@ OGRGeometry *OGRFeature::GetGeomFieldRef(const char *pszFName)
     if (iField < 0)
         return nullptr;
 
+    DecodeLazyGeometryIfNeeded(iField);
     return papoGeometries[iField];
 }
 
@@ -884,6 +888,7 @@ const OGRGeometry *OGRFeature::GetGeomFieldRef(const char *pszFName) const
     if (iField < 0)
         return nullptr;
 
+    DecodeLazyGeometryIfNeeded(iField);
     return papoGeometries[iField];
 }
 
@@ -952,7 +957,8 @@ OGRGeometryH OGR_F_GetGeomFieldRef(OGRFeatureH hFeat, int iField)
 
 OGRErr OGRFeature::SetGeomFieldDirectly(int iField, OGRGeometry *poGeomIn)
 {
-    if (poGeomIn && poGeomIn == GetGeomFieldRef(iField))
+    if (poGeomIn && iField >= 0 && iField < GetGeomFieldCount() &&
+        poGeomIn == papoGeometries[iField])
     {
         return OGRERR_NONE;
     }
@@ -1024,6 +1030,7 @@ OGRErr OGRFeature::SetGeomField(int iField, const OGRGeometry *poGeomIn)
     if (iField < 0 || iField >= GetGeomFieldCount())
         return OGRERR_FAILURE;
 
+    DiscardLazyGeometry(iField);
     if (papoGeometries[iField] != poGeomIn)
     {
         delete papoGeometries[iField];
@@ -1100,6 +1107,7 @@ OGRErr OGRFeature::SetGeomField(int iField,
         return OGRERR_FAILURE;
     }
 
+    DiscardLazyGeometry(iField);
     if (papoGeometries[iField] != poGeomIn.get())
     {
         delete papoGeometries[iField];
@@ -1109,6 +1117,243 @@ OGRErr OGRFeature::SetGeomField(int iField,
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                        SetGeomFieldFromWKB()                         */
+/************************************************************************/
+
+/**
+ * \brief Set feature geometry of a specified geometry field from its WKB
+ * representation.
+ *
+ * The WKB blob is copied, but not decoded: it is kept as is until the
+ * geometry is accessed with GetGeomFieldRef(), StealGeometry() or any other
+ * method requiring an OGRGeometry instance. This saves the decoding cost for
+ * consumers that only need the WKB, such as drivers writing WKB-based
+ * formats, which can retrieve it with GetGeomFieldWKB().
+ *
+ * The spatial reference system of the geometry field definition, at the
+ * time of the call, is assigned to the geometry when it is decoded.
+ * No validation of the WKB content is done by this method. If it turns out
+ * to be corrupted when decoded, an error is emitted and the geometry is
+ * considered to be null.
+ *
+ * @param iField geometry field to set.
+ * @param pabyWKB pointer to the WKB blob, or NULL to unset the geometry.
+ * @param nWKBSize size in bytes of the WKB blob.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE if the index is invalid.
+ *
+ * @since GDAL 3.13
+ */
+
+OGRErr OGRFeature::SetGeomFieldFromWKB(int iField, const GByte *pabyWKB,
+                                       size_t nWKBSize)
+
+{
+    if (pabyWKB == nullptr || nWKBSize == 0)
+        return SetGeomFieldFromWKB(iField, std::vector<GByte>());
+
+    if (iField < 0 || iField >= GetGeomFieldCount())
+        return OGRERR_FAILURE;
+
+    auto poLazy = PrepareLazyGeometry(iField);
+    if (!poLazy)
+        return OGRERR_NOT_ENOUGH_MEMORY;
+    // Copy into the existing buffer, whose capacity is kept across Reset()
+    // calls, to avoid an allocation per feature when a feature is reused.
+    try
+    {
+        poLazy->abyWKB.assign(pabyWKB, pabyWKB + nWKBSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "SetGeomFieldFromWKB(): out of memory");
+        poLazy->abyWKB.clear();
+        poLazy->poSRS.reset();
+        return OGRERR_NOT_ENOUGH_MEMORY;
+    }
+    return OGRERR_NONE;
+}
+
+/**
+ * \brief Set feature geometry of a specified geometry field from its WKB
+ * representation.
+ *
+ * Same as the above method, except that the WKB blob is moved into the
+ * feature.
+ *
+ * @param iField geometry field to set.
+ * @param abyWKB WKB blob. An empty vector unsets the geometry.
+ *
+ * @return OGRERR_NONE if successful, or OGRERR_FAILURE if the index is invalid.
+ *
+ * @since GDAL 3.13
+ */
+
+OGRErr OGRFeature::SetGeomFieldFromWKB(int iField, std::vector<GByte> &&abyWKB)
+
+{
+    if (iField < 0 || iField >= GetGeomFieldCount())
+    {
+        return OGRERR_FAILURE;
+    }
+
+    if (abyWKB.empty())
+    {
+        delete papoGeometries[iField];
+        papoGeometries[iField] = nullptr;
+        DiscardLazyGeometry(iField);
+        return OGRERR_NONE;
+    }
+
+    auto poLazy = PrepareLazyGeometry(iField);
+    if (!poLazy)
+        return OGRERR_NOT_ENOUGH_MEMORY;
+    poLazy->abyWKB = std::move(abyWKB);
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                        PrepareLazyGeometry()                         */
+/************************************************************************/
+
+/* Clear the geometry of a field and return its lazy geometry slot, with */
+/* the SRS of the field set, or nullptr in case of error. */
+OGRFeature::LazyGeometry *OGRFeature::PrepareLazyGeometry(int iField)
+{
+    if (iField < 0 || iField >= GetGeomFieldCount())
+        return nullptr;
+
+    delete papoGeometries[iField];
+    papoGeometries[iField] = nullptr;
+
+    if (!m_paoLazyGeometries)
+    {
+        m_paoLazyGeometries.reset(
+            new (std::nothrow) LazyGeometry[GetGeomFieldCount()]);
+        if (!m_paoLazyGeometries)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "SetGeomFieldFromWKB(): out of memory");
+            return nullptr;
+        }
+    }
+
+    auto &oLazy = m_paoLazyGeometries[iField];
+    oLazy.poSRS.reset(const_cast<OGRSpatialReference *>(
+                          poDefn->GetGeomFieldDefn(iField)->GetSpatialRef()),
+                      /* add_ref = */ true);
+    return &oLazy;
+}
+
+/************************************************************************/
+/*                          GetGeomFieldWKB()                           */
+/************************************************************************/
+
+/**
+ * \brief Return the undecoded WKB representation of a geometry field.
+ *
+ * This only returns a non-NULL value if the geometry has been set with
+ * SetGeomFieldFromWKB(), and has not been accessed as an OGRGeometry since
+ * then. Callers that need the WKB of the geometry should use this method
+ * first, and fallback to GetGeomFieldRef() and OGRGeometry::exportToWkb()
+ * otherwise.
+ *
+ * The returned WKB may be in any of the variants accepted by
+ * OGRGeometryFactory::createFromWkb(), and in any byte order.
+ *
+ * @param iField geometry field to get.
+ * @param nWKBSize [out] size in bytes of the returned WKB blob.
+ *
+ * @return a pointer to the WKB blob, owned by the feature and valid until the
+ * geometry field is modified or accessed, or NULL.
+ *
+ * @since GDAL 3.13
+ */
+
+const GByte *OGRFeature::GetGeomFieldWKB(int iField, size_t &nWKBSize) const
+
+{
+    nWKBSize = 0;
+    if (iField < 0 || iField >= GetGeomFieldCount() ||
+        !HasLazyGeometry(iField))
+    {
+        return nullptr;
+    }
+    const auto &abyWKB = m_paoLazyGeometries[iField].abyWKB;
+    nWKBSize = abyWKB.size();
+    return abyWKB.data();
+}
+
+/************************************************************************/
+/*                         DecodeLazyGeometry()                         */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+void OGRFeature::DecodeLazyGeometry(int iField) const
+{
+    auto &oLazy = m_paoLazyGeometries[iField];
+    OGRGeometry *poGeom = nullptr;
+    if (OGRGeometryFactory::createFromWkb(oLazy.abyWKB.data(),
+                                          oLazy.poSRS.get(), &poGeom,
+                                          oLazy.abyWKB.size()) != OGRERR_NONE)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Feature " CPL_FRMT_GIB
+                 ": cannot decode WKB geometry of field %d",
+                 nFID, iField);
+        delete poGeom;
+        poGeom = nullptr;
+    }
+    papoGeometries[iField] = poGeom;
+    oLazy.abyWKB.clear();
+    oLazy.abyWKB.shrink_to_fit();
+    oLazy.poSRS.reset();
+}
+
+/************************************************************************/
+/*                        DiscardLazyGeometry()                         */
+/************************************************************************/
+
+void OGRFeature::DiscardLazyGeometry(int iField)
+{
+    if (HasLazyGeometry(iField))
+    {
+        // Keep the buffer allocated, in case the feature is reused
+        auto &oLazy = m_paoLazyGeometries[iField];
+        oLazy.abyWKB.clear();
+        oLazy.poSRS.reset();
+    }
+}
+
+/************************************************************************/
+/*                         CopyGeomFieldFrom()                          */
+/************************************************************************/
+
+/* Copy a geometry field from another feature, keeping it undecoded if it */
+/* is undecoded in the source feature. */
+void OGRFeature::CopyGeomFieldFrom(int iField, const OGRFeature *poSrcFeature,
+                                   int iSrcField)
+{
+    size_t nWKBSize = 0;
+    const GByte *pabyWKB = poSrcFeature->GetGeomFieldWKB(iSrcField, nWKBSize);
+    if (pabyWKB &&
+        SetGeomFieldFromWKB(iField, pabyWKB, nWKBSize) == OGRERR_NONE)
+    {
+        // Preserve the SRS of the source, as SetGeom() would do
+        m_paoLazyGeometries[iField].poSRS =
+            poSrcFeature->m_paoLazyGeometries[iSrcField].poSRS;
+    }
+    else
+    {
+        SetGeomField(iField, poSrcFeature->GetGeomFieldRef(iSrcField));
+    }
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                               Clone()                                */
 /************************************************************************/
@@ -1201,6 +1446,10 @@ bool OGRFeature::CopySelfTo(OGRFeature *poNew) const
                     return false;
                 }
             }
+            else if (HasLazyGeometry(i))
+            {
+                poNew->CopyGeomFieldFrom(i, this, i);
+            }
         }
     }
 
@@ -1525,13 +1774,14 @@ int OGRFeature::IsFieldSet(int iField) const
 
             case SPF_OGR_GEOM_WKT:
             case SPF_OGR_GEOMETRY:
-                return GetGeomFieldCount() > 0 && papoGeometries[0] != nullptr;
+                return GetGeomFieldCount() > 0 &&
+                       (papoGeometries[0] != nullptr || HasLazyGeometry(0));
 
             case SPF_OGR_STYLE:
                 return GetStyleString() != nullptr;
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldRef(0) == nullptr)
                     return FALSE;
 
                 return OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])) !=
@@ -2020,7 +2270,7 @@ int OGRFeature::GetFieldAsInteger(int iField) const
             }
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldRef(0) == nullptr)
                     return 0;
                 return static_cast<int>(
                     OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])));
@@ -2149,7 +2399,7 @@ GIntBig OGRFeature::GetFieldAsInteger64(int iField) const
                 return nFID;
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldRef(0) == nullptr)
                     return 0;
                 return static_cast<int>(
                     OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0])));
@@ -2266,7 +2516,7 @@ double OGRFeature::GetFieldAsDouble(int iField) const
                 return static_cast<double>(GetFID());
 
             case SPF_OGR_GEOM_AREA:
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldRef(0) == nullptr)
                     return 0.0;
                 return OGR_G_Area(OGRGeometry::ToHandle(papoGeometries[0]));
 
@@ -2460,7 +2710,7 @@ const char *OGRFeature::GetFieldAsString(int iField) const
             }
 
             case SPF_OGR_GEOMETRY:
-                if (GetGeomFieldCount() > 0 && papoGeometries[0] != nullptr)
+                if (GetGeomFieldRef(0) != nullptr)
                     return papoGeometries[0]->getGeometryName();
                 else
                     return "";
@@ -2473,7 +2723,7 @@ const char *OGRFeature::GetFieldAsString(int iField) const
 
             case SPF_OGR_GEOM_WKT:
             {
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldRef(0) == nullptr)
                     return "";
 
                 if (papoGeometries[0]->exportToWkt(&m_pszTmpFieldValue) ==
@@ -2485,7 +2735,7 @@ const char *OGRFeature::GetFieldAsString(int iField) const
 
             case SPF_OGR_GEOM_AREA:
             {
-                if (GetGeomFieldCount() == 0 || papoGeometries[0] == nullptr)
+                if (GetGeomFieldRef(0) == nullptr)
                     return "";
 
                 constexpr size_t MAX_SIZE = 20 + 1;
@@ -5775,6 +6025,7 @@ std::string OGRFeature::DumpReadableAsString(CSLConstList papszOptions) const
                 const OGRGeomFieldDefn *poFDefn =
                     poDefn->GetGeomFieldDefn(iField);
 
+                DecodeLazyGeometryIfNeeded(iField);
                 if (papoGeometries[iField] != nullptr)
                 {
                     CPLStringList aosGeomOptions(papszOptions);
@@ -6358,11 +6609,11 @@ OGRErr OGRFeature::SetFrom(const OGRFeature *poSrcFeature, const int *panMap,
 
         int iSrc = poSrcFeature->GetGeomFieldIndex(poGFieldDefn->GetNameRef());
         if (iSrc >= 0)
-            SetGeomField(0, poSrcFeature->GetGeomFieldRef(iSrc));
+            CopyGeomFieldFrom(0, poSrcFeature, iSrc);
         else
             // Whatever the geometry field names are.  For backward
             // compatibility.
-            SetGeomField(0, poSrcFeature->GetGeomFieldRef(0));
+            CopyGeomFieldFrom(0, poSrcFeature, 0);
     }
     else
     {
@@ -6373,7 +6624,7 @@ OGRErr OGRFeature::SetFrom(const OGRFeature *poSrcFeature, const int *panMap,
             const int iSrc =
                 poSrcFeature->GetGeomFieldIndex(poGFieldDefn->GetNameRef());
             if (iSrc >= 0)
-                SetGeomField(i, poSrcFeature->GetGeomFieldRef(iSrc));
+                CopyGeomFieldFrom(i, poSrcFeature, iSrc);
             else
                 SetGeomField(i, nullptr);
         }
@@ -6935,6 +7186,10 @@ OGRErr OGRFeature::RemapGeomFields(const OGRFeatureDefn *poNewDefn,
     if (poNewDefn == nullptr)
         poNewDefn = poDefn;
 
+    for (int i = 0; i < poDefn->GetGeomFieldCount(); i++)
+        DecodeLazyGeometryIfNeeded(i);
+    m_paoLazyGeometries.reset();
+
     OGRGeometry **papoNewGeomFields = static_cast<OGRGeometry **>(
         CPLCalloc(poNewDefn->GetGeomFieldCount(), sizeof(OGRGeometry *)));
 
@@ -7843,6 +8098,7 @@ bool OGRFeature::SerializeToBinary(std::vector<GByte> &abyBuffer) const
         }
         for (int i = 0; i < nGeomFieldCount; ++i)
         {
+            DecodeLazyGeometryIfNeeded(i);
             if (!papoGeometries[i])
             {
                 const int iBit = 2 * nFieldCount + i;
@@ -18,6 +18,8 @@
 
 #include <cstddef>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -388,9 +390,9 @@ int OGRFeatureQuery::CanUseIndex(const swq_expr_node *psExpr, OGRLayer *poLayer)
 /*      available indices, or an "OGRNullFID" terminated list of        */
 /*      FIDs if it can.                                                 */
 /*                                                                      */
-/*      For now we only support equality tests on a single indexed      */
-/*      attribute field.  Eventually we should make this support        */
-/*      multi-part queries with ranges.                                 */
+/*      Equality, IN, range comparisons and BETWEEN tests of an         */
+/*      indexed attribute field against constants are supported, as     */
+/*      well as AND and OR combinations of them.                        */
 /************************************************************************/
 
 GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(OGRLayer *poLayer,
@@ -533,6 +535,174 @@ static GIntBig *OGRANDGIntBigArray(GIntBig panFIDList1[], GIntBig nFIDCount1,
     return panFIDList;
 }
 
+/************************************************************************/
+/*                       OGRIsIndexableConstant()                       */
+/************************************************************************/
+
+static bool OGRIsIndexableConstant(const OGRFieldDefn *poFieldDefn,
+                                   const swq_expr_node *poValue)
+{
+    if (poValue->eNodeType != SNT_CONSTANT || poValue->is_null)
+        return false;
+    if (poFieldDefn->GetType() == OFTString)
+    {
+        return poValue->field_type == SWQ_STRING &&
+               poValue->string_value != nullptr;
+    }
+    return SWQ_IS_INTEGER(poValue->field_type) ||
+           poValue->field_type == SWQ_FLOAT;
+}
+
+/************************************************************************/
+/*                          OGRGetIndexBound()                          */
+/*                                                                      */
+/*      Convert the constant of a range comparison into a bound in      */
+/*      the representation of the indexed field.  Returns false if      */
+/*      the index cannot be used with that constant.                    */
+/************************************************************************/
+
+static bool OGRGetIndexBound(const OGRFieldDefn *poFieldDefn,
+                             const swq_expr_node *poValue, bool bIsMin,
+                             OGRField &sBound, bool &bIncluded)
+{
+    if (!OGRIsIndexableConstant(poFieldDefn, poValue))
+        return false;
+
+    switch (poFieldDefn->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+        {
+            GIntBig nValue = poValue->int_value;
+            if (poValue->field_type == SWQ_FLOAT)
+            {
+                // For example "x > 2.5" is the same as "x >= 3"
+                const double dfValue = poValue->float_value;
+                const double dfRounded =
+                    bIsMin ? std::ceil(dfValue) : std::floor(dfValue);
+                if (!(dfRounded >= static_cast<double>(
+                                       std::numeric_limits<GIntBig>::min()) &&
+                      dfRounded < static_cast<double>(
+                                      std::numeric_limits<GIntBig>::max())))
+                {
+                    return false;
+                }
+                if (dfRounded != dfValue)
+                    bIncluded = true;
+                nValue = static_cast<GIntBig>(dfRounded);
+            }
+
+            if (poFieldDefn->GetType() == OFTInteger)
+            {
+                if (!CPL_INT64_FITS_ON_INT32(nValue))
+                    return false;
+                sBound.Integer = static_cast<int>(nValue);
+            }
+            else
+            {
+                sBound.Integer64 = nValue;
+            }
+            return true;
+        }
+
+        case OFTReal:
+            sBound.Real = poValue->field_type == SWQ_FLOAT
+                              ? poValue->float_value
+                              : static_cast<double>(poValue->int_value);
+            return !std::isnan(sBound.Real);
+
+        case OFTString:
+            sBound.String = poValue->string_value;
+            return true;
+
+        default:
+            break;
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                   OGREvaluateRangeAgainstIndices()                   */
+/*                                                                      */
+/*      Handle <, <=, > and >= comparisons of a column with a           */
+/*      constant, in any order, and BETWEEN.                            */
+/************************************************************************/
+
+static GIntBig *OGREvaluateRangeAgainstIndices(const swq_expr_node *psExpr,
+                                               OGRLayer *poLayer,
+                                               GIntBig &nFIDCount)
+{
+    const swq_expr_node *poColumn = nullptr;
+    const swq_expr_node *poMin = nullptr;
+    const swq_expr_node *poMax = nullptr;
+    bool bMinIncluded = true;
+    bool bMaxIncluded = true;
+
+    if (psExpr->nOperation == SWQ_BETWEEN)
+    {
+        if (psExpr->nSubExprCount != 3)
+            return nullptr;
+        poColumn = psExpr->papoSubExpr[0];
+        poMin = psExpr->papoSubExpr[1];
+        poMax = psExpr->papoSubExpr[2];
+    }
+    else
+    {
+        if (psExpr->nSubExprCount != 2)
+            return nullptr;
+        int nOperation = psExpr->nOperation;
+        poColumn = psExpr->papoSubExpr[0];
+        const swq_expr_node *poValue = psExpr->papoSubExpr[1];
+        if (poColumn->eNodeType == SNT_CONSTANT &&
+            poValue->eNodeType == SNT_COLUMN)
+        {
+            // "constant < column" is "column > constant"
+            std::swap(poColumn, poValue);
+            nOperation = nOperation == SWQ_LT   ? SWQ_GT
+                         : nOperation == SWQ_LE ? SWQ_GE
+                         : nOperation == SWQ_GT ? SWQ_LT
+                                                : SWQ_LE;
+        }
+        if (nOperation == SWQ_GT || nOperation == SWQ_GE)
+        {
+            poMin = poValue;
+            bMinIncluded = nOperation == SWQ_GE;
+        }
+        else
+        {
+            poMax = poValue;
+            bMaxIncluded = nOperation == SWQ_LE;
+        }
+    }
+
+    if (poColumn->eNodeType != SNT_COLUMN)
+        return nullptr;
+
+    const int nIdx = OGRFeatureFetcherFixFieldIndex(poLayer->GetLayerDefn(),
+                                                    poColumn->field_index);
+
+    OGRAttrIndex *poIndex = poLayer->GetIndex()->GetFieldIndex(nIdx);
+    if (poIndex == nullptr)
+        return nullptr;
+
+    const OGRFieldDefn *poFieldDefn =
+        poLayer->GetLayerDefn()->GetFieldDefn(nIdx);
+    OGRField sMin;
+    OGRField sMax;
+    if ((poMin != nullptr && !OGRGetIndexBound(poFieldDefn, poMin, true, sMin,
+                                               bMinIncluded)) ||
+        (poMax != nullptr &&
+         !OGRGetIndexBound(poFieldDefn, poMax, false, sMax, bMaxIncluded)))
+    {
+        return nullptr;
+    }
+
+    return poIndex->GetAllMatchesInRange(
+        poMin ? &sMin : nullptr, bMinIncluded, poMax ? &sMax : nullptr,
+        bMaxIncluded, &nFIDCount);
+}
+
 GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
                                                  OGRLayer *poLayer,
                                                  GIntBig &nFIDCount)
@@ -570,6 +740,13 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
         return panFIDList;
     }
 
+    if (psExpr->nOperation == SWQ_LT || psExpr->nOperation == SWQ_LE ||
+        psExpr->nOperation == SWQ_GT || psExpr->nOperation == SWQ_GE ||
+        psExpr->nOperation == SWQ_BETWEEN)
+    {
+        return OGREvaluateRangeAgainstIndices(psExpr, poLayer, nFIDCount);
+    }
+
     if (!(psExpr->nOperation == SWQ_EQ || psExpr->nOperation == SWQ_IN) ||
         psExpr->nSubExprCount < 2)
         return nullptr;
@@ -592,6 +769,14 @@ GIntBig *OGRFeatureQuery::EvaluateAgainstIndices(const swq_expr_node *psExpr,
     const OGRFieldDefn *poFieldDefn =
         poLayer->GetLayerDefn()->GetFieldDefn(nIdx);
 
+    // Values that must be converted to the type of the field, or the
+    // reverse, cannot be looked up.
+    for (int iIN = 1; iIN < psExpr->nSubExprCount; iIN++)
+    {
+        if (!OGRIsIndexableConstant(poFieldDefn, psExpr->papoSubExpr[iIN]))
+            return nullptr;
+    }
+
     // Handle the case of an IN operation.
     if (psExpr->nOperation == SWQ_IN)
     {
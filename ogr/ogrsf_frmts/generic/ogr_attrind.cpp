@@ -62,4 +62,23 @@ OGRAttrIndex::~OGRAttrIndex()
 {
 }
 
+/************************************************************************/
+/*                        GetAllMatchesInRange()                        */
+/*                                                                      */
+/*      Return the sorted, OGRNullFID terminated, list of the FIDs      */
+/*      whose key is within the given range.  A null bound means the    */
+/*      range is not bounded on that side.  The default                 */
+/*      implementation returns NULL to indicate that range requests     */
+/*      are not supported by the index.                                 */
+/************************************************************************/
+
+GIntBig *OGRAttrIndex::GetAllMatchesInRange(const OGRField * /* psMin */,
+                                            bool /* bMinIncluded */,
+                                            const OGRField * /* psMax */,
+                                            bool /* bMaxIncluded */,
+                                            GIntBig * /* pnFIDCount */)
+{
+    return nullptr;
+}
+
 //! @endcond
@@ -14,15 +14,19 @@
 #include "ogr_swq.h"
 #include "ogr_p.h"
 #include "ogr_gensql.h"
+#include "ograttrindexedlayer.h"
 #include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
 #include "ogr_api.h"
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -122,6 +126,18 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
     }
 
     m_poSrcLayer = m_apoTableLayers[0];
+
+    // Serve the WHERE clause from the attribute indexes of the source layer,
+    // such as the in-memory ones created by CREATE INDEX, when the driver
+    // does not make use of them by itself.
+    if (m_poSrcLayer->GetIndex() != nullptr &&
+        m_poSrcLayer->TestCapability(OLCRandomRead))
+    {
+        m_poAttrIndexedSrcLayer =
+            std::make_unique<OGRAttrIndexedLayer>(m_poSrcLayer, FALSE);
+        m_poSrcLayer = m_poAttrIndexedSrcLayer.get();
+    }
+
     SetMetadata(m_poSrcLayer->GetMetadata("NATIVE_DATA"), "NATIVE_DATA");
 
     /* -------------------------------------------------------------------- */
@@ -216,8 +232,12 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
             const swq_operation *op = swq_op_registrar::GetOperator(
                 static_cast<swq_op>(psColDef->col_func));
 
-            oFDefn.SetName(
-                CPLSPrintf("%s_%s", op->pszName, psColDef->field_name));
+            if (bIsGeometry)
+                oGFDefn.SetName(
+                    CPLSPrintf("%s_%s", op->pszName, psColDef->field_name));
+            else
+                oFDefn.SetName(
+                    CPLSPrintf("%s_%s", op->pszName, psColDef->field_name));
         }
         else
         {
@@ -276,7 +296,12 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
         }
         else if (poSrcGFDefn != nullptr)
         {
-            oGFDefn.SetType(poSrcGFDefn->GetType());
+            if (psColDef->col_func == SWQCF_ST_EXTENT)
+                oGFDefn.SetType(wkbPolygon);
+            else if (psColDef->col_func == SWQCF_ST_UNION)
+                oGFDefn.SetType(wkbUnknown);
+            else
+                oGFDefn.SetType(poSrcGFDefn->GetType());
             oGFDefn.SetSpatialRef(poSrcGFDefn->GetSpatialRef());
         }
         else if (psColDef->field_index >= m_iFIDFieldIndex)
@@ -383,7 +408,13 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
 
         if (bIsGeometry)
         {
-            m_anGeomFieldToSrcGeomField.push_back(iSrcGeomField);
+            // Spatial filters on the aggregated geometries of a GROUP BY
+            // must be evaluated on the groups, not on the source features.
+            if (psSelectInfo->query_mode == SWQM_GROUP_BY &&
+                psColDef->col_func != SWQCF_NONE)
+                m_anGeomFieldToSrcGeomField.push_back(-1);
+            else
+                m_anGeomFieldToSrcGeomField.push_back(iSrcGeomField);
             /* Hack while drivers haven't been updated so that */
             /* poSrcDefn->GetGeomFieldDefn(0)->GetSpatialRef() ==
              * m_poSrcLayer->GetSpatialRef() */
@@ -464,7 +495,11 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
     /* -------------------------------------------------------------------- */
     if (poSpatFilter)
     {
-        if (m_poDefn->GetGeomFieldCount() > 0)
+        // When the first geometry field is an aggregated geometry of a
+        // GROUP BY, the spatial filter passed to ExecuteSQL() restricts the
+        // source features that are grouped, as a WHERE clause would do.
+        if (m_poDefn->GetGeomFieldCount() > 0 &&
+            m_anGeomFieldToSrcGeomField[0] >= 0)
         {
             OGRGenSQLResultsLayer::SetSpatialFilter(
                 0, const_cast<OGRGeometry *>(poSpatFilter));
@@ -481,7 +516,10 @@ OGRGenSQLResultsLayer::OGRGenSQLResultsLayer(
 
     FindAndSetIgnoredFields();
 
-    if (!m_bForwardWhereToSourceLayer)
+    // In GROUP BY mode, the WHERE clause is evaluated by PrepareGroupBy()
+    // on source features, not on the result features.
+    if (!m_bForwardWhereToSourceLayer &&
+        psSelectInfo->query_mode != SWQM_GROUP_BY)
         OGRLayer::SetAttributeFilter(m_osInitialWHERE.c_str());
 }
 
@@ -559,7 +597,7 @@ void OGRGenSQLResultsLayer::ClearFilters()
 /*                 MustEvaluateSpatialFilterOnGenSQL()                  */
 /************************************************************************/
 
-int OGRGenSQLResultsLayer::MustEvaluateSpatialFilterOnGenSQL()
+int OGRGenSQLResultsLayer::MustEvaluateSpatialFilterOnGenSQL() const
 {
     int bEvaluateSpatialFilter = FALSE;
     if (m_poFilterGeom != nullptr && m_iGeomFieldFilter >= 0 &&
@@ -653,7 +691,10 @@ OGRErr OGRGenSQLResultsLayer::SetNextByIndex(GIntBig nIndex)
         return OGRERR_NON_EXISTING_FEATURE;
     }
     if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
-        psSelectInfo->query_mode == SWQM_DISTINCT_LIST || !m_anFIDIndex.empty())
+        psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+        (psSelectInfo->query_mode == SWQM_GROUP_BY &&
+         m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL()) ||
+        !m_anFIDIndex.empty() || m_poExternalSort)
     {
         m_nNextIndexFID = nIndex + psSelectInfo->offset;
         return OGRERR_NONE;
@@ -712,6 +753,16 @@ GIntBig OGRGenSQLResultsLayer::GetFeatureCount(int bForce)
 
         nRet = psSelectInfo->column_summary[0].count;
     }
+    else if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (!PrepareGroupBy())
+            return 0;
+
+        if (m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL())
+            nRet = static_cast<GIntBig>(m_apoGroupByFeatures.size());
+        else
+            nRet = OGRLayer::GetFeatureCount(bForce);
+    }
     else if (psSelectInfo->query_mode != SWQM_RECORDSET)
         return 1;
     else if (m_poAttrQuery == nullptr && !MustEvaluateSpatialFilterOnGenSQL())
@@ -742,8 +793,13 @@ int OGRGenSQLResultsLayer::TestCapability(const char *pszCap) const
 
     if (EQUAL(pszCap, OLCFastSetNextByIndex))
     {
+        if (m_poExternalSort)
+            return FALSE;
         if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD ||
             psSelectInfo->query_mode == SWQM_DISTINCT_LIST ||
+            (psSelectInfo->query_mode == SWQM_GROUP_BY &&
+             m_poAttrQuery == nullptr &&
+             !MustEvaluateSpatialFilterOnGenSQL()) ||
             !m_anFIDIndex.empty())
             return TRUE;
         else
@@ -857,6 +913,134 @@ int OGRGenSQLResultsLayer::ContainGeomSpecialField(
     return FALSE;
 }
 
+/************************************************************************/
+/*                        SetSummaryFieldValue()                        */
+/*                                                                      */
+/*      Set the value of a column function from its summary.            */
+/************************************************************************/
+
+static void SetSummaryFieldValue(OGRFeature *poFeature, int iField,
+                                 const swq_col_def *psColDef,
+                                 const swq_summary &oSummary)
+{
+    switch (psColDef->col_func)
+    {
+        case SWQCF_NONE:
+        case SWQCF_CUSTOM:
+        case SWQCF_ST_UNION:
+        case SWQCF_ST_EXTENT:
+            break;
+
+        case SWQCF_AVG:
+        {
+            if (oSummary.count > 0)
+            {
+                const double dfAvg = oSummary.sum() / oSummary.count;
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP)
+                {
+                    struct tm brokendowntime;
+                    CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
+                                        &brokendowntime);
+                    poFeature->SetField(
+                        iField, brokendowntime.tm_year + 1900,
+                        brokendowntime.tm_mon + 1, brokendowntime.tm_mday,
+                        brokendowntime.tm_hour, brokendowntime.tm_min,
+                        static_cast<float>(brokendowntime.tm_sec +
+                                           fmod(dfAvg, 1)),
+                        0);
+                }
+                else
+                {
+                    poFeature->SetField(iField, dfAvg);
+                }
+            }
+            break;
+        }
+
+        case SWQCF_MIN:
+        {
+            if (oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poFeature->SetField(iField, oSummary.osMin.c_str());
+                else
+                    poFeature->SetField(iField, oSummary.min);
+            }
+            break;
+        }
+
+        case SWQCF_MAX:
+        {
+            if (oSummary.count > 0)
+            {
+                if (psColDef->field_type == SWQ_DATE ||
+                    psColDef->field_type == SWQ_TIME ||
+                    psColDef->field_type == SWQ_TIMESTAMP ||
+                    psColDef->field_type == SWQ_STRING)
+                    poFeature->SetField(iField, oSummary.osMax.c_str());
+                else
+                    poFeature->SetField(iField, oSummary.max);
+            }
+            break;
+        }
+
+        case SWQCF_COUNT:
+        {
+            poFeature->SetField(iField, oSummary.count);
+            break;
+        }
+
+        case SWQCF_SUM:
+        {
+            if (oSummary.count > 0)
+                poFeature->SetField(iField, oSummary.sum());
+            break;
+        }
+
+        case SWQCF_STDDEV_POP:
+        {
+            if (oSummary.count > 0)
+            {
+                const double dfVariance =
+                    oSummary.sq_dist_from_mean_acc / oSummary.count;
+                poFeature->SetField(iField, sqrt(dfVariance));
+            }
+            break;
+        }
+
+        case SWQCF_STDDEV_SAMP:
+        {
+            if (oSummary.count > 1)
+            {
+                const double dfSampleVariance =
+                    oSummary.sq_dist_from_mean_acc / (oSummary.count - 1);
+                poFeature->SetField(iField, sqrt(dfSampleVariance));
+            }
+            break;
+        }
+    }
+}
+
+/************************************************************************/
+/*                        HasGeometryAggregate()                        */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::HasGeometryAggregate() const
+{
+    for (const auto &oColDef : m_pSelectInfo->column_defs)
+    {
+        if (oColDef.col_func == SWQCF_ST_UNION ||
+            oColDef.col_func == SWQCF_ST_EXTENT)
+            return true;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                           PrepareSummary()                           */
 /************************************************************************/
@@ -869,6 +1053,24 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
     if (m_poSummaryFeature)
         return true;
 
+    /* -------------------------------------------------------------------- */
+    /*      Geometry aggregates are computed by the GROUP BY machinery,     */
+    /*      with a single group.                                            */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_SUMMARY_RECORD &&
+        HasGeometryAggregate())
+    {
+        const bool bOK = PrepareGroupBy() && !m_apoGroupByFeatures.empty();
+        if (bOK)
+        {
+            m_poSummaryFeature = std::move(m_apoGroupByFeatures[0]);
+            m_poSummaryFeature->SetFID(0);
+        }
+        m_apoGroupByFeatures.clear();
+        m_bGroupByValid = false;
+        return bOK;
+    }
+
     m_poSummaryFeature = std::make_unique<OGRFeature>(m_poDefn);
     m_poSummaryFeature->SetFID(0);
 
@@ -1104,116 +1306,8 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
                 const swq_summary &oSummary =
                     psSelectInfo->column_summary[iField];
 
-                switch (psColDef->col_func)
-                {
-                    case SWQCF_NONE:
-                    case SWQCF_CUSTOM:
-                        break;
-
-                    case SWQCF_AVG:
-                    {
-                        if (oSummary.count > 0)
-                        {
-                            const double dfAvg =
-                                oSummary.sum() / oSummary.count;
-                            if (psColDef->field_type == SWQ_DATE ||
-                                psColDef->field_type == SWQ_TIME ||
-                                psColDef->field_type == SWQ_TIMESTAMP)
-                            {
-                                struct tm brokendowntime;
-                                CPLUnixTimeToYMDHMS(static_cast<GIntBig>(dfAvg),
-                                                    &brokendowntime);
-                                m_poSummaryFeature->SetField(
-                                    iField, brokendowntime.tm_year + 1900,
-                                    brokendowntime.tm_mon + 1,
-                                    brokendowntime.tm_mday,
-                                    brokendowntime.tm_hour,
-                                    brokendowntime.tm_min,
-                                    static_cast<float>(brokendowntime.tm_sec +
-                                                       fmod(dfAvg, 1)),
-                                    0);
-                            }
-                            else
-                            {
-                                m_poSummaryFeature->SetField(iField, dfAvg);
-                            }
-                        }
-                        break;
-                    }
-
-                    case SWQCF_MIN:
-                    {
-                        if (oSummary.count > 0)
-                        {
-                            if (psColDef->field_type == SWQ_DATE ||
-                                psColDef->field_type == SWQ_TIME ||
-                                psColDef->field_type == SWQ_TIMESTAMP ||
-                                psColDef->field_type == SWQ_STRING)
-                                m_poSummaryFeature->SetField(
-                                    iField, oSummary.osMin.c_str());
-                            else
-                                m_poSummaryFeature->SetField(iField,
-                                                             oSummary.min);
-                        }
-                        break;
-                    }
-
-                    case SWQCF_MAX:
-                    {
-                        if (oSummary.count > 0)
-                        {
-                            if (psColDef->field_type == SWQ_DATE ||
-                                psColDef->field_type == SWQ_TIME ||
-                                psColDef->field_type == SWQ_TIMESTAMP ||
-                                psColDef->field_type == SWQ_STRING)
-                                m_poSummaryFeature->SetField(
-                                    iField, oSummary.osMax.c_str());
-                            else
-                                m_poSummaryFeature->SetField(iField,
-                                                             oSummary.max);
-                        }
-                        break;
-                    }
-
-                    case SWQCF_COUNT:
-                    {
-                        m_poSummaryFeature->SetField(iField, oSummary.count);
-                        break;
-                    }
-
-                    case SWQCF_SUM:
-                    {
-                        if (oSummary.count > 0)
-                            m_poSummaryFeature->SetField(iField,
-                                                         oSummary.sum());
-                        break;
-                    }
-
-                    case SWQCF_STDDEV_POP:
-                    {
-                        if (oSummary.count > 0)
-                        {
-                            const double dfVariance =
-                                oSummary.sq_dist_from_mean_acc / oSummary.count;
-                            m_poSummaryFeature->SetField(iField,
-                                                         sqrt(dfVariance));
-                        }
-                        break;
-                    }
-
-                    case SWQCF_STDDEV_SAMP:
-                    {
-                        if (oSummary.count > 1)
-                        {
-                            const double dfSampleVariance =
-                                oSummary.sq_dist_from_mean_acc /
-                                (oSummary.count - 1);
-                            m_poSummaryFeature->SetField(
-                                iField, sqrt(dfSampleVariance));
-                        }
-                        break;
-                    }
-                }
+                SetSummaryFieldValue(m_poSummaryFeature.get(), iField,
+                                     psColDef, oSummary);
             }
             else if (psColDef->col_func == SWQCF_COUNT)
                 m_poSummaryFeature->SetField(iField, 0);
@@ -1227,14 +1321,13 @@ bool OGRGenSQLResultsLayer::PrepareSummary() const
 /*                       OGRMultiFeatureFetcher()                       */
 /************************************************************************/
 
-typedef std::vector<std::unique_ptr<OGRFeature>> VectorOfUniquePtrFeature;
+typedef std::vector<OGRFeature *> VectorOfFeature;
 
 static swq_expr_node *OGRMultiFeatureFetcher(swq_expr_node *op,
                                              void *pFeatureList)
 
 {
-    auto &apoFeatures =
-        *(static_cast<VectorOfUniquePtrFeature *>(pFeatureList));
+    auto &apoFeatures = *(static_cast<VectorOfFeature *>(pFeatureList));
     swq_expr_node *poRetNode = nullptr;
 
     CPLAssert(op->eNodeType == SNT_COLUMN);
@@ -1251,7 +1344,7 @@ static swq_expr_node *OGRMultiFeatureFetcher(swq_expr_node *op,
         return nullptr;
     }
 
-    OGRFeature *poFeature = apoFeatures[op->table_index].get();
+    OGRFeature *poFeature = apoFeatures[op->table_index];
 
     /* -------------------------------------------------------------------- */
     /*      Fetch the value.                                                */
@@ -1492,80 +1585,561 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
 }
 
 /************************************************************************/
-/*                          TranslateFeature()                          */
+/*                           JoinHashTable                              */
 /************************************************************************/
 
-std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
-    std::unique_ptr<OGRFeature> poSrcFeatUniquePtr)
-
+// Features of the secondary layer of a JOIN, indexed by the values of the
+// fields compared for equality with fields of the primary layer in the ON
+// clause. Only the first feature with a given key is kept, as the nested
+// loop join only retains the first matching feature.
+struct OGRGenSQLResultsLayer::JoinHashTable
 {
-    swq_select *psSelectInfo = m_pSelectInfo.get();
-    VectorOfUniquePtrFeature apoFeatures;
+    struct KeyPart
+    {
+        int iPrimaryField = -1;    // index in the primary layer
+        int iSecondaryField = -1;  // index in the secondary layer
+        // Type under which values are compared: OFTInteger64, OFTReal or
+        // OFTString
+        OGRFieldType eType = OFTString;
+    };
 
-    if (poSrcFeatUniquePtr == nullptr)
-        return nullptr;
+    bool bUsable = false;
+    std::vector<KeyPart> aoKeyParts{};
+    // Whether string values are compared case insensitively, as done by the
+    // secondary layer in the attribute filter of the nested loop join.
+    bool bCaseInsensitive = true;
 
-    m_nFeaturesRead++;
+    // Used until the memory limit is reached
+    std::unordered_map<std::string, OGRFeatureUniquePtr> oMapFeatures{};
 
-    apoFeatures.push_back(std::move(poSrcFeatUniquePtr));
-    auto poSrcFeat = apoFeatures.front().get();
+    // Used afterwards, if the secondary layer supports fast random reads
+    bool bFIDMode = false;
+    std::unordered_map<std::string, GIntBig> oMapFIDs{};
+};
 
-    /* -------------------------------------------------------------------- */
-    /*      Fetch the corresponding features from any jointed tables.       */
-    /* -------------------------------------------------------------------- */
-    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+/************************************************************************/
+/*                         GetJoinKeyFieldType()                        */
+/************************************************************************/
+
+// Return the type of a field of a JOIN key, as OFTInteger64, OFTReal,
+// OFTString, or OFTMaxType if it is not supported.
+static OGRFieldType GetJoinKeyFieldType(const OGRFeatureDefn *poDefn,
+                                        int iField)
+{
+    if (iField >= poDefn->GetFieldCount())
     {
-        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        return iField == poDefn->GetFieldCount() + SPF_FID ? OFTInteger64
+                                                           : OFTMaxType;
+    }
+    switch (poDefn->GetFieldDefn(iField)->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+            return OFTInteger64;
+        case OFTReal:
+            return OFTReal;
+        case OFTString:
+            return OFTString;
+        default:
+            break;
+    }
+    return OFTMaxType;
+}
 
-        /* OGRMultiFeatureFetcher assumes that the features are pushed in */
-        /* apoFeatures with increasing secondary_table, so make sure */
-        /* we have taken care of this */
-        CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
+/************************************************************************/
+/*                       JoinExprUsesPrimaryTable()                     */
+/************************************************************************/
 
-        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+static bool JoinExprUsesPrimaryTable(const swq_expr_node *poExpr)
+{
+    if (poExpr->eNodeType == SNT_COLUMN)
+        return poExpr->table_index == 0;
+    if (poExpr->eNodeType == SNT_OPERATION)
+    {
+        for (int i = 0; i < poExpr->nSubExprCount; i++)
+        {
+            if (JoinExprUsesPrimaryTable(poExpr->papoSubExpr[i]))
+                return true;
+        }
+    }
+    return false;
+}
 
-        const std::string osFilter =
-            GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
-                             psJoinInfo->secondary_table);
-        // CPLDebug("OGR", "Filter = %s\n", osFilter.c_str());
+/************************************************************************/
+/*                         CollectJoinKeyParts()                        */
+/************************************************************************/
 
-        // if source key is null, we can't do join.
-        if (osFilter.empty())
+// Decompose the ON expression of a JOIN into equalities between a field of
+// the primary layer and a field of the secondary layer, which make the key
+// of the hash table, and into residual terms that only involve the secondary
+// layer. Returns false if the expression cannot be decomposed this way.
+static bool
+CollectJoinKeyParts(swq_expr_node *poExpr, int secondary_table,
+                    const OGRFeatureDefn *poPrimaryDefn,
+                    const OGRFeatureDefn *poSecondaryDefn,
+                    std::vector<OGRGenSQLResultsLayer::JoinHashTable::KeyPart>
+                        &aoKeyParts,
+                    std::vector<swq_expr_node *> &apoResidualExprs)
+{
+    if (poExpr->eNodeType == SNT_OPERATION && poExpr->nOperation == SWQ_AND)
+    {
+        for (int i = 0; i < poExpr->nSubExprCount; i++)
         {
-            apoFeatures.push_back(nullptr);
-            continue;
+            if (!CollectJoinKeyParts(poExpr->papoSubExpr[i], secondary_table,
+                                     poPrimaryDefn, poSecondaryDefn,
+                                     aoKeyParts, apoResidualExprs))
+            {
+                return false;
+            }
         }
+        return true;
+    }
 
-        std::unique_ptr<OGRFeature> poJoinFeature;
+    if (poExpr->eNodeType == SNT_OPERATION && poExpr->nOperation == SWQ_EQ &&
+        poExpr->nSubExprCount == 2 &&
+        poExpr->papoSubExpr[0]->eNodeType == SNT_COLUMN &&
+        poExpr->papoSubExpr[1]->eNodeType == SNT_COLUMN)
+    {
+        const swq_expr_node *poPrimary = poExpr->papoSubExpr[0];
+        const swq_expr_node *poSecondary = poExpr->papoSubExpr[1];
+        if (poPrimary->table_index != 0)
+            std::swap(poPrimary, poSecondary);
+        if (poPrimary->table_index == 0 &&
+            poSecondary->table_index == secondary_table)
+        {
+            const OGRFieldType eTypePrimary =
+                GetJoinKeyFieldType(poPrimaryDefn, poPrimary->field_index);
+            const OGRFieldType eTypeSecondary =
+                GetJoinKeyFieldType(poSecondaryDefn, poSecondary->field_index);
+            OGRGenSQLResultsLayer::JoinHashTable::KeyPart oPart;
+            oPart.iPrimaryField = poPrimary->field_index;
+            oPart.iSecondaryField = poSecondary->field_index;
+            if (eTypePrimary == OFTMaxType || eTypeSecondary == OFTMaxType ||
+                (eTypePrimary == OFTString) != (eTypeSecondary == OFTString))
+            {
+                return false;
+            }
+            oPart.eType = eTypePrimary == eTypeSecondary ? eTypePrimary
+                                                         : OFTReal;
+            aoKeyParts.push_back(oPart);
+            return true;
+        }
+    }
 
-        poJoinLayer->ResetReading();
-        if (poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
-            poJoinFeature.reset(poJoinLayer->GetNextFeature());
+    if (JoinExprUsesPrimaryTable(poExpr))
+        return false;
+    apoResidualExprs.push_back(poExpr);
+    return true;
+}
+
+/************************************************************************/
+/*                            BuildJoinKey()                            */
+/************************************************************************/
 
-        apoFeatures.push_back(std::move(poJoinFeature));
+// Serialize the key of a feature of the primary (bPrimary == true) or
+// secondary layer. Returns false if one of its values is null, in which case
+// the feature cannot take part in the join.
+static bool BuildJoinKey(const OGRFeature *poFeature, bool bPrimary,
+                         const OGRGenSQLResultsLayer::JoinHashTable &oHashTable,
+                         std::string &osKey)
+{
+    osKey.clear();
+    const int nFieldCount = poFeature->GetFieldCount();
+    for (const auto &oPart : oHashTable.aoKeyParts)
+    {
+        const int iField =
+            bPrimary ? oPart.iPrimaryField : oPart.iSecondaryField;
+        const bool bFID = iField >= nFieldCount;
+        if (!bFID && !poFeature->IsFieldSetAndNotNull(iField))
+            return false;
+        switch (oPart.eType)
+        {
+            case OFTInteger64:
+            {
+                const GIntBig nVal =
+                    bFID ? poFeature->GetFID()
+                         : poFeature->GetFieldAsInteger64(iField);
+                osKey.append(reinterpret_cast<const char *>(&nVal),
+                             sizeof(nVal));
+                break;
+            }
+            case OFTReal:
+            {
+                double dfVal =
+                    bFID ? static_cast<double>(poFeature->GetFID())
+                         : poFeature->GetFieldAsDouble(iField);
+                if (std::isnan(dfVal))
+                    return false;
+                if (dfVal == 0)
+                    dfVal = 0;  // -0 == 0
+                osKey.append(reinterpret_cast<const char *>(&dfVal),
+                             sizeof(dfVal));
+                break;
+            }
+            default:
+            {
+                CPLString osVal(poFeature->GetFieldAsString(iField));
+                if (oHashTable.bCaseInsensitive)
+                    osVal.tolower();
+                const uint32_t nSize = static_cast<uint32_t>(osVal.size());
+                osKey.append(reinterpret_cast<const char *>(&nSize),
+                             sizeof(nSize));
+                osKey += osVal;
+                break;
+            }
+        }
     }
+    return true;
+}
 
-    /* -------------------------------------------------------------------- */
-    /*      Create destination feature.                                     */
-    /* -------------------------------------------------------------------- */
-    auto poDstFeat = std::make_unique<OGRFeature>(m_poDefn);
+/************************************************************************/
+/*                         GetMaxMemoryOption()                         */
+/************************************************************************/
 
-    poDstFeat->SetFID(poSrcFeat->GetFID());
+// Return the value of one of the OGR_SQL_xxxx_MAX_MEMORY configuration
+// options, in bytes. Invalid values are reported and replaced by the default.
+static GIntBig GetMaxMemoryOption(const char *pszOptionName)
+{
+    constexpr const char *pszDefault = "10%";
+    const char *pszValue = CPLGetConfigOption(pszOptionName, pszDefault);
+    GIntBig nMaxMemory = 0;
+    bool bUnitSpecified = false;
+    CPLErr eErr;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        eErr = CPLParseMemorySize(pszValue, &nMaxMemory, &bUnitSpecified);
+    }
+    if (eErr != CE_None && !EQUAL(pszValue, pszDefault))
+    {
+        CPLError(CE_Warning, CPLE_IllegalArg,
+                 "Invalid value for %s: '%s'. Using %s instead",
+                 pszOptionName, pszValue, pszDefault);
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        eErr = CPLParseMemorySize(pszDefault, &nMaxMemory, &bUnitSpecified);
+    }
+    if (eErr != CE_None)
+        nMaxMemory = 0;
+    return nMaxMemory;
+}
 
-    poDstFeat->SetStyleString(poSrcFeat->GetStyleString());
-    poDstFeat->SetNativeData(poSrcFeat->GetNativeData());
-    poDstFeat->SetNativeMediaType(poSrcFeat->GetNativeMediaType());
+/************************************************************************/
+/*                       EstimateFeatureMemory()                        */
+/************************************************************************/
 
-    /* -------------------------------------------------------------------- */
-    /*      Evaluate fields that are complex expressions.                   */
-    /* -------------------------------------------------------------------- */
-    int iRegularField = 0;
-    int iGeomField = 0;
-    swq_evaluation_context sContext;
-    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+static size_t EstimateFeatureMemory(const OGRFeature *poFeature)
+{
+    size_t nSize = sizeof(OGRFeature) +
+                   static_cast<size_t>(poFeature->GetFieldCount()) *
+                       (sizeof(OGRField) + 16);
+    for (int i = 0; i < poFeature->GetFieldCount(); i++)
     {
-        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
-
+        if (poFeature->IsFieldSetAndNotNull(i) &&
+            poFeature->GetFieldDefnRef(i)->GetType() == OFTString)
+        {
+            nSize += strlen(poFeature->GetFieldAsString(i));
+        }
+    }
+    for (int i = 0; i < poFeature->GetGeomFieldCount(); i++)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+        if (poGeom)
+            nSize += 2 * poGeom->WkbSize();
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                          GetJoinHashTable()                          */
+/************************************************************************/
+
+// Return the hash table of the secondary layer of a JOIN, building it on
+// first use, or nullptr if the JOIN must be resolved with a nested loop.
+OGRGenSQLResultsLayer::JoinHashTable *
+OGRGenSQLResultsLayer::GetJoinHashTable(int iJoin)
+{
+    const swq_select *psSelectInfo = m_pSelectInfo.get();
+    if (m_apoJoinHashTables.empty())
+        m_apoJoinHashTables.resize(psSelectInfo->join_count);
+    if (!m_apoJoinHashTables[iJoin])
+    {
+        m_apoJoinHashTables[iJoin] = std::make_unique<JoinHashTable>();
+        BuildJoinHashTable(iJoin, *(m_apoJoinHashTables[iJoin]));
+    }
+    return m_apoJoinHashTables[iJoin]->bUsable
+               ? m_apoJoinHashTables[iJoin].get()
+               : nullptr;
+}
+
+/************************************************************************/
+/*                         BuildJoinHashTable()                         */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::BuildJoinHashTable(int iJoin,
+                                               JoinHashTable &oHashTable)
+{
+    const swq_join_def *psJoinInfo = m_pSelectInfo->join_defs + iJoin;
+    OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+
+    if (!CPLTestBool(CPLGetConfigOption("OGR_SQL_HASH_JOIN", "YES")) ||
+        poJoinLayer == m_apoTableLayers[0])
+    {
+        return;
+    }
+
+    std::vector<swq_expr_node *> apoResidualExprs;
+    if (!CollectJoinKeyParts(psJoinInfo->poExpr, psJoinInfo->secondary_table,
+                             m_poSrcLayer->GetLayerDefn(),
+                             poJoinLayer->GetLayerDefn(),
+                             oHashTable.aoKeyParts, apoResidualExprs) ||
+        oHashTable.aoKeyParts.empty())
+    {
+        CPLDebug("GenSQL",
+                 "JOIN with %s cannot use a hash table: ON clause is not a "
+                 "conjunction of equalities between fields",
+                 poJoinLayer->GetName());
+        oHashTable.aoKeyParts.clear();
+        return;
+    }
+
+    // Terms of the ON clause that do not involve the primary layer restrict
+    // the features inserted in the hash table.
+    std::string osResidualFilter;
+    for (swq_expr_node *poExpr : apoResidualExprs)
+    {
+        if (!osResidualFilter.empty())
+            osResidualFilter += " AND ";
+        osResidualFilter += '(';
+        osResidualFilter += GetFilterForJoin(poExpr, nullptr, poJoinLayer,
+                                             psJoinInfo->secondary_table);
+        osResidualFilter += ')';
+    }
+
+    // The OGR SQL evaluator compares strings case insensitively, but drivers
+    // that translate attribute filters to their own SQL dialect generally do
+    // not. Find out what the nested loop join would have done by checking
+    // whether a case-insensitive equality selects any feature. If none is
+    // selected, the hash table is empty anyway.
+    if (std::any_of(oHashTable.aoKeyParts.begin(), oHashTable.aoKeyParts.end(),
+                    [](const JoinHashTable::KeyPart &oPart)
+                    { return oPart.eType == OFTString; }))
+    {
+        std::string osProbeFilter("'a' = 'A'");
+        if (!osResidualFilter.empty())
+        {
+            osProbeFilter += " AND (";
+            osProbeFilter += osResidualFilter;
+            osProbeFilter += ')';
+        }
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        poJoinLayer->ResetReading();
+        oHashTable.bCaseInsensitive =
+            poJoinLayer->SetAttributeFilter(osProbeFilter.c_str()) ==
+                OGRERR_NONE &&
+            OGRFeatureUniquePtr(poJoinLayer->GetNextFeature()) != nullptr;
+    }
+
+    if (poJoinLayer->SetAttributeFilter(osResidualFilter.empty()
+                                            ? nullptr
+                                            : osResidualFilter.c_str()) !=
+        OGRERR_NONE)
+    {
+        poJoinLayer->SetAttributeFilter("");
+        oHashTable.aoKeyParts.clear();
+        return;
+    }
+
+    const GIntBig nMaxMemory =
+        GetMaxMemoryOption("OGR_SQL_HASH_JOIN_MAX_MEMORY");
+    const bool bCanUseFIDs =
+        poJoinLayer->TestCapability(OLCRandomRead) != FALSE;
+
+    bool bOK = true;
+    GIntBig nMemory = 0;
+    std::string osKey;
+    poJoinLayer->ResetReading();
+    for (auto &&poFeature : *poJoinLayer)
+    {
+        if (!BuildJoinKey(poFeature.get(), false, oHashTable, osKey))
+        {
+            continue;
+        }
+
+        if (oHashTable.bFIDMode)
+        {
+            oHashTable.oMapFIDs.emplace(osKey, poFeature->GetFID());
+            continue;
+        }
+
+        if (oHashTable.oMapFeatures.find(osKey) !=
+            oHashTable.oMapFeatures.end())
+        {
+            continue;
+        }
+        nMemory += static_cast<GIntBig>(
+            osKey.size() + EstimateFeatureMemory(poFeature.get()));
+        oHashTable.oMapFeatures.emplace(osKey, std::move(poFeature));
+
+        if (nMemory > nMaxMemory)
+        {
+            if (!bCanUseFIDs)
+            {
+                bOK = false;
+                break;
+            }
+            // Keep only the FIDs of features, which are fetched afterwards
+            // with GetFeature()
+            CPLDebug("GenSQL",
+                     "Hash table of JOIN with %s exceeds "
+                     "OGR_SQL_HASH_JOIN_MAX_MEMORY. Only storing FIDs",
+                     poJoinLayer->GetName());
+            for (const auto &oIter : oHashTable.oMapFeatures)
+            {
+                if (oIter.second->GetFID() == OGRNullFID)
+                {
+                    bOK = false;
+                    break;
+                }
+                oHashTable.oMapFIDs.emplace(oIter.first,
+                                            oIter.second->GetFID());
+            }
+            oHashTable.oMapFeatures.clear();
+            oHashTable.bFIDMode = true;
+            if (!bOK)
+                break;
+        }
+    }
+
+    poJoinLayer->SetAttributeFilter("");
+    poJoinLayer->ResetReading();
+
+    if (!bOK)
+    {
+        CPLDebug("GenSQL",
+                 "Hash table of JOIN with %s exceeds "
+                 "OGR_SQL_HASH_JOIN_MAX_MEMORY. Using nested loop join",
+                 poJoinLayer->GetName());
+        oHashTable.aoKeyParts.clear();
+        oHashTable.oMapFeatures.clear();
+        oHashTable.oMapFIDs.clear();
+        oHashTable.bFIDMode = false;
+        return;
+    }
+
+    CPLDebug("GenSQL", "Hash table of JOIN with %s built with %d keys",
+             poJoinLayer->GetName(),
+             static_cast<int>(oHashTable.bFIDMode
+                                  ? oHashTable.oMapFIDs.size()
+                                  : oHashTable.oMapFeatures.size()));
+    oHashTable.bUsable = true;
+}
+
+/************************************************************************/
+/*                          TranslateFeature()                          */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
+    std::unique_ptr<OGRFeature> poSrcFeatUniquePtr)
+
+{
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    // Features of the primary and secondary layers, and the subset of them
+    // that must be destroyed (features of hash tables are not)
+    VectorOfFeature apoFeatures;
+    std::vector<std::unique_ptr<OGRFeature>> apoOwnedFeatures;
+
+    if (poSrcFeatUniquePtr == nullptr)
+        return nullptr;
+
+    m_nFeaturesRead++;
+
+    auto poSrcFeat = poSrcFeatUniquePtr.get();
+    apoFeatures.push_back(poSrcFeat);
+    apoOwnedFeatures.push_back(std::move(poSrcFeatUniquePtr));
+
+    /* -------------------------------------------------------------------- */
+    /*      Fetch the corresponding features from any jointed tables.       */
+    /* -------------------------------------------------------------------- */
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+
+        /* OGRMultiFeatureFetcher assumes that the features are pushed in */
+        /* apoFeatures with increasing secondary_table, so make sure */
+        /* we have taken care of this */
+        CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
+
+        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+
+        if (JoinHashTable *poHashTable = GetJoinHashTable(iJoin))
+        {
+            OGRFeature *poJoinFeature = nullptr;
+            if (BuildJoinKey(poSrcFeat, true, *poHashTable, m_osJoinKey))
+            {
+                if (poHashTable->bFIDMode)
+                {
+                    const auto oIter = poHashTable->oMapFIDs.find(m_osJoinKey);
+                    if (oIter != poHashTable->oMapFIDs.end())
+                    {
+                        apoOwnedFeatures.emplace_back(
+                            poJoinLayer->GetFeature(oIter->second));
+                        poJoinFeature = apoOwnedFeatures.back().get();
+                    }
+                }
+                else
+                {
+                    const auto oIter =
+                        poHashTable->oMapFeatures.find(m_osJoinKey);
+                    if (oIter != poHashTable->oMapFeatures.end())
+                        poJoinFeature = oIter->second.get();
+                }
+            }
+            apoFeatures.push_back(poJoinFeature);
+            continue;
+        }
+
+        const std::string osFilter =
+            GetFilterForJoin(psJoinInfo->poExpr, poSrcFeat, poJoinLayer,
+                             psJoinInfo->secondary_table);
+        // CPLDebug("OGR", "Filter = %s\n", osFilter.c_str());
+
+        // if source key is null, we can't do join.
+        if (osFilter.empty())
+        {
+            apoFeatures.push_back(nullptr);
+            continue;
+        }
+
+        std::unique_ptr<OGRFeature> poJoinFeature;
+
+        poJoinLayer->ResetReading();
+        if (poJoinLayer->SetAttributeFilter(osFilter.c_str()) == OGRERR_NONE)
+            poJoinFeature.reset(poJoinLayer->GetNextFeature());
+
+        apoFeatures.push_back(poJoinFeature.get());
+        apoOwnedFeatures.push_back(std::move(poJoinFeature));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Create destination feature.                                     */
+    /* -------------------------------------------------------------------- */
+    auto poDstFeat = std::make_unique<OGRFeature>(m_poDefn);
+
+    poDstFeat->SetFID(poSrcFeat->GetFID());
+
+    poDstFeat->SetStyleString(poSrcFeat->GetStyleString());
+    poDstFeat->SetNativeData(poSrcFeat->GetNativeData());
+    poDstFeat->SetNativeMediaType(poSrcFeat->GetNativeMediaType());
+
+    /* -------------------------------------------------------------------- */
+    /*      Evaluate fields that are complex expressions.                   */
+    /* -------------------------------------------------------------------- */
+    int iRegularField = 0;
+    int iGeomField = 0;
+    swq_evaluation_context sContext;
+    for (int iField = 0; iField < psSelectInfo->result_columns(); iField++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[iField];
+
         if (psColDef->bHidden)
         {
             const char *pszDstFieldName = psColDef->field_alias
@@ -1830,7 +2404,7 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
     for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
     {
         const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
-        const OGRFeature *poJoinFeature = apoFeatures[iJoin + 1].get();
+        const OGRFeature *poJoinFeature = apoFeatures[iJoin + 1];
 
         if (poJoinFeature == nullptr)
             continue;
@@ -1862,6 +2436,57 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
     return poDstFeat;
 }
 
+/************************************************************************/
+/*                              ExternalSort                            */
+/************************************************************************/
+
+// Sorted runs of an ORDER BY whose keys do not fit in
+// OGR_SQL_ORDER_BY_MAX_MEMORY. Each run is a temporary file of records made
+// of the sort keys of a source feature, its FID, and optionally the serialized
+// feature itself. The runs are merged on the fly by GetNextFeature().
+struct OGRGenSQLResultsLayer::ExternalSort
+{
+    struct Run
+    {
+        std::string osFilename{};
+        // Only open while the run is written or merged
+        VSIVirtualHandleUniquePtr fp{};
+
+        // Current record (empty when the run is exhausted), and its decoded
+        // sort keys, whose strings point into osRecord.
+        std::string osRecord{};
+        std::vector<OGRField> asIndexFields{};
+        GIntBig nFID = 0;
+        size_t nRowOffset = 0;
+
+        Run() = default;
+
+        ~Run()
+        {
+            fp.reset();
+            if (!osFilename.empty())
+                VSIUnlink(osFilename.c_str());
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(Run)
+    };
+
+    // Runs in the order of the source features they contain, which is used
+    // to break ties and keep the sort stable.
+    std::vector<std::unique_ptr<Run>> apoRuns{};
+
+    // Indices in apoRuns of the runs that are not exhausted, as a heap whose
+    // front has the smallest current record.
+    std::vector<size_t> anHeap{};
+
+    // Whether the records carry the serialized source features, or only
+    // their FID.
+    bool bCarryRows = false;
+
+    // Index, in the sorted output, of the record at the front of the heap
+    GIntBig nNextRecord = 0;
+};
+
 /************************************************************************/
 /*                           GetNextFeature()                           */
 /************************************************************************/
@@ -1879,7 +2504,7 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return nullptr;
 
     CreateOrderByIndex();
-    if (m_anFIDIndex.empty() && m_nIteratedFeatures < 0 &&
+    if (m_anFIDIndex.empty() && !m_poExternalSort && m_nIteratedFeatures < 0 &&
         psSelectInfo->offset > 0 && psSelectInfo->query_mode == SWQM_RECORDSET)
     {
         m_poSrcLayer->SetNextByIndex(psSelectInfo->offset);
@@ -1897,6 +2522,33 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
         return GetFeature(m_nNextIndexFID++);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle grouped sets.                                            */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        // Spatial filters on geometries that are grouping keys are applied
+        // to the source layer, and the ones on aggregated geometries here.
+        const bool bEvaluateSpatialFilter =
+            CPL_TO_BOOL(MustEvaluateSpatialFilterOnGenSQL());
+        while (true)
+        {
+            auto poFeature =
+                std::unique_ptr<OGRFeature>(GetFeature(m_nNextIndexFID++));
+            if (poFeature == nullptr)
+                return nullptr;
+            if ((m_poAttrQuery == nullptr ||
+                 m_poAttrQuery->Evaluate(poFeature.get())) &&
+                (!bEvaluateSpatialFilter ||
+                 FilterGeometry(
+                     poFeature->GetGeomFieldRef(m_iGeomFieldFilter))))
+            {
+                m_nIteratedFeatures++;
+                return poFeature.release();
+            }
+        }
+    }
+
     int bEvaluateSpatialFilter = MustEvaluateSpatialFilterOnGenSQL();
 
     /* -------------------------------------------------------------------- */
@@ -1922,6 +2574,23 @@ OGRFeature *OGRGenSQLResultsLayer::GetNextFeature()
                 m_anFIDIndex[static_cast<size_t>(m_nNextIndexFID)]));
             m_nNextIndexFID++;
         }
+        else if (m_poExternalSort)
+        {
+            // Position on the requested record of the merge of the runs
+            if (m_nNextIndexFID < m_poExternalSort->nNextRecord &&
+                !RewindExternalSort())
+                return nullptr;
+            while (m_poExternalSort->nNextRecord < m_nNextIndexFID)
+            {
+                if (!AdvanceExternalSort())
+                    return nullptr;
+            }
+
+            poSrcFeat = FetchExternallySortedFeature();
+            if (poSrcFeat == nullptr || !AdvanceExternalSort())
+                return nullptr;
+            m_nNextIndexFID++;
+        }
         else
         {
             poSrcFeat.reset(m_poSrcLayer->GetNextFeature());
@@ -1967,6 +2636,17 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
             return m_poSummaryFeature->Clone();
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Handle request for a group.                                     */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        if (!PrepareGroupBy() || nFID < 0 ||
+            nFID >= static_cast<GIntBig>(m_apoGroupByFeatures.size()))
+            return nullptr;
+        return m_apoGroupByFeatures[static_cast<size_t>(nFID)]->Clone();
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Handle request for distinct list record.                        */
     /* -------------------------------------------------------------------- */
@@ -2211,8 +2891,8 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*      this in memory copy of the order-by fields to create the        */
 /*      required index.                                                 */
 /*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      If the key values exceed OGR_SQL_ORDER_BY_MAX_MEMORY, we fall    */
+/*      back to an external merge sort in CreateExternalOrderByIndex(). */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2229,6 +2909,7 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     m_bOrderByValid = true;
     m_anFIDIndex.clear();
+    m_poExternalSort.reset();
 
     ResetReading();
 
@@ -2308,6 +2989,10 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nIndexSize);
 
+    const GIntBig nMaxMemory =
+        GetMaxMemoryOption("OGR_SQL_ORDER_BY_MAX_MEMORY");
+    GIntBig nMemory = 0;
+
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
@@ -2359,6 +3044,21 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         anFIDList.push_back(poSrcFeat->GetFID());
 
         nIndexSize++;
+
+        // Key values, FID, and index entry
+        nMemory += GetIndexFieldsMemoryUsage(asIndexFields.data() +
+                                             (nIndexSize - 1) * nOrderItems) +
+                   2 * sizeof(GIntBig);
+        if (nMemory > nMaxMemory)
+        {
+            FreeIndexFields(asIndexFields.data(), nIndexSize);
+            nIndexSize = 0;
+            asIndexFields = std::vector<OGRField>();
+            anFIDList = std::vector<GIntBig>();
+
+            CreateExternalOrderByIndex(nMaxMemory);
+            return;
+        }
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
@@ -2587,25 +3287,1832 @@ int OGRGenSQLResultsLayer::Compare(const OGRField *pasFirstTuple,
 }
 
 /************************************************************************/
-/*                         AddFieldDefnToSet()                          */
+/*                     OGRGenSQLGroupByAggregator                       */
 /************************************************************************/
 
-void OGRGenSQLResultsLayer::AddFieldDefnToSet(int iTable, int iColumn,
-                                              CPLHashSet *hSet)
+// Hash aggregation of the source features of a GROUP BY query, or of a
+// summary query with geometry aggregates (with a single group then).
+// Groups are held in memory until the estimated memory usage exceeds
+// OGR_SQL_GROUP_BY_MAX_MEMORY. Afterwards, features of groups that are not in
+// memory yet are written to temporary files, partitioned on the hash of the
+// group key, and each partition is aggregated in turn at the end, recursively.
+class OGRGenSQLGroupByAggregator
 {
-    if (iTable != -1)
+  public:
+    OGRGenSQLGroupByAggregator(swq_select *psSelectInfo,
+                               const OGRFeatureDefn *poSrcDefn,
+                               OGRFeatureDefn *poDstDefn, GIntBig nMaxMemory,
+                               int nLevel = 0);
+    ~OGRGenSQLGroupByAggregator();
+
+    bool AddFeature(const OGRFeature *poSrcFeature);
+    bool Finalize(std::vector<std::unique_ptr<OGRFeature>> &apoResults);
+
+    int GetDstFieldIndex(int iColumn) const
     {
-        OGRLayer *poLayer = m_apoTableLayers[iTable];
-        const auto poLayerDefn = poLayer->GetLayerDefn();
-        const int nFieldCount = poLayerDefn->GetFieldCount();
-        if (iColumn == -1)
+        return m_anDstField[iColumn];
+    }
+
+  private:
+    // Value of the argument of an aggregate function for a source feature
+    struct Value
+    {
+        // 'N'ull (ignored), 'I' (counted), 'R'eal, 'S'tring, 'G'eometry or
+        // 'E'nvelope
+        char chType = 'N';
+        double dfVal = 0;
+        std::string osVal{};
+        std::unique_ptr<OGRGeometry> poGeom{};
+        OGREnvelope sEnvelope{};
+    };
+
+    struct Group
+    {
+        std::string osKey{};
+        std::vector<swq_summary> aoSummaries{};
+        // Geometries pending union, per column
+        std::vector<std::vector<std::unique_ptr<OGRGeometry>>> aapoGeoms{};
+        std::vector<OGREnvelope> asExtents{};
+    };
+
+    struct Partition
+    {
+        std::string osFilename{};
+        VSIVirtualHandleUniquePtr fp{};
+    };
+
+    static constexpr int PARTITION_COUNT = 16;
+    static constexpr int MAX_LEVEL = 4;
+    // Number of geometries of a ST_UNION() after which they are merged
+    static constexpr size_t UNION_BATCH_SIZE = 256;
+
+    swq_select *m_psSelectInfo = nullptr;
+    const OGRFeatureDefn *m_poSrcDefn = nullptr;
+    OGRFeatureDefn *m_poDstDefn = nullptr;
+    const GIntBig m_nMaxMemory;
+    const int m_nLevel;
+
+    // Per grouping field: source field index, and type of its key part
+    // ('I'nteger, 'R'eal or 'S'tring)
+    std::vector<int> m_anKeyField{};
+    std::vector<char> m_achKeyType{};
+
+    // Per column: index of the grouping field, and index of the field or
+    // geometry field in the result (-1 if not applicable)
+    std::vector<int> m_anColumnKey{};
+    std::vector<int> m_anDstField{};
+    std::vector<int> m_anDstGeomField{};
+
+    // One field per column, to evaluate the HAVING clause
+    OGRFeatureDefn *m_poHavingDefn = nullptr;
+
+    std::vector<swq_summary> m_aoInitialSummaries{};
+    std::vector<std::unique_ptr<Group>> m_apoGroups{};
+    std::unordered_map<std::string, size_t> m_oMapGroups{};
+    GIntBig m_nMemoryUsage = 0;
+
+    std::vector<Partition> m_aoPartitions{};
+
+    // Working buffers
+    std::string m_osKey{};
+    std::string m_osRecord{};
+    std::vector<Value> m_aoValues{};
+
+    void BuildKey(const OGRFeature *poSrcFeature);
+    void ReadValues(const OGRFeature *poSrcFeature);
+    bool AddRow();
+    bool Accumulate(Group &oGroup);
+    bool Spill();
+    bool ReadPartition(Partition &oPartition,
+                       OGRGenSQLGroupByAggregator &oAggregator);
+    bool EmitGroup(Group &oGroup,
+                   std::vector<std::unique_ptr<OGRFeature>> &apoResults);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLGroupByAggregator)
+};
+
+/************************************************************************/
+/*                     CollectHavingColumnTypes()                       */
+/************************************************************************/
+
+static void CollectHavingColumnTypes(const swq_expr_node *poExpr,
+                                     std::vector<swq_field_type> &aeTypes)
+{
+    if (poExpr->eNodeType == SNT_COLUMN)
+    {
+        if (poExpr->field_index >= 0 &&
+            poExpr->field_index < static_cast<int>(aeTypes.size()))
+            aeTypes[poExpr->field_index] = poExpr->field_type;
+    }
+    else if (poExpr->eNodeType == SNT_OPERATION)
+    {
+        for (int i = 0; i < poExpr->nSubExprCount; i++)
+            CollectHavingColumnTypes(poExpr->papoSubExpr[i], aeTypes);
+    }
+}
+
+/************************************************************************/
+/*                     OGRGenSQLGroupByAggregator()                     */
+/************************************************************************/
+
+OGRGenSQLGroupByAggregator::OGRGenSQLGroupByAggregator(
+    swq_select *psSelectInfo, const OGRFeatureDefn *poSrcDefn,
+    OGRFeatureDefn *poDstDefn, GIntBig nMaxMemory, int nLevel)
+    : m_psSelectInfo(psSelectInfo), m_poSrcDefn(poSrcDefn),
+      m_poDstDefn(poDstDefn), m_nMaxMemory(nMaxMemory), m_nLevel(nLevel)
+{
+    const int nSrcFieldCount = poSrcDefn->GetFieldCount();
+    for (int i = 0; i < psSelectInfo->group_by_count; i++)
+    {
+        const int iField = psSelectInfo->group_by_defs[i].field_index;
+        swq_field_type eType = SWQ_STRING;
+        if (iField < nSrcFieldCount)
         {
-            for (int i = 0; i < nFieldCount; ++i)
+            switch (poSrcDefn->GetFieldDefn(iField)->GetType())
             {
-                OGRFieldDefn *poFDefn = poLayerDefn->GetFieldDefn(i);
-                CPLHashSetInsert(hSet, poFDefn);
-            }
-
+                case OFTInteger:
+                case OFTInteger64:
+                    eType = SWQ_INTEGER64;
+                    break;
+                case OFTReal:
+                    eType = SWQ_FLOAT;
+                    break;
+                default:
+                    break;
+            }
+        }
+        else
+        {
+            eType = SpecialFieldTypes[iField - nSrcFieldCount];
+        }
+        m_anKeyField.push_back(iField);
+        m_achKeyType.push_back(
+            eType == SWQ_INTEGER || eType == SWQ_INTEGER64 ? 'I'
+            : eType == SWQ_FLOAT                           ? 'R'
+                                                           : 'S');
+    }
+
+    const int nColumns = psSelectInfo->result_columns();
+    std::vector<swq_field_type> aeHavingTypes(nColumns, SWQ_OTHER);
+    if (psSelectInfo->having_expr)
+        CollectHavingColumnTypes(psSelectInfo->having_expr, aeHavingTypes);
+
+    m_poHavingDefn = new OGRFeatureDefn();
+    m_poHavingDefn->SetGeomType(wkbNone);
+    m_poHavingDefn->Reference();
+
+    int iDstField = 0;
+    int iDstGeomField = 0;
+    m_aoInitialSummaries.resize(nColumns);
+    m_aoValues.resize(nColumns);
+    for (int i = 0; i < nColumns; i++)
+    {
+        const swq_col_def *psColDef = &psSelectInfo->column_defs[i];
+
+        int iKey = -1;
+        for (int j = 0; psColDef->col_func == SWQCF_NONE &&
+                        j < psSelectInfo->group_by_count;
+             j++)
+        {
+            if (psSelectInfo->group_by_defs[j].field_index ==
+                psColDef->field_index)
+            {
+                iKey = j;
+                break;
+            }
+        }
+        m_anColumnKey.push_back(iKey);
+
+        const bool bIsGeometry = psColDef->col_func == SWQCF_ST_UNION ||
+                                 psColDef->col_func == SWQCF_ST_EXTENT;
+        if (psColDef->bHidden)
+        {
+            m_anDstField.push_back(-1);
+            m_anDstGeomField.push_back(-1);
+
+            OGRFieldDefn oFieldDefn(CPLSPrintf("column%d", i), OFTString);
+            switch (aeHavingTypes[i])
+            {
+                case SWQ_BOOLEAN:
+                    oFieldDefn.SetType(OFTInteger);
+                    oFieldDefn.SetSubType(OFSTBoolean);
+                    break;
+                case SWQ_INTEGER:
+                    oFieldDefn.SetType(OFTInteger);
+                    break;
+                case SWQ_INTEGER64:
+                    oFieldDefn.SetType(OFTInteger64);
+                    break;
+                case SWQ_FLOAT:
+                    oFieldDefn.SetType(OFTReal);
+                    break;
+                case SWQ_DATE:
+                    oFieldDefn.SetType(OFTDate);
+                    break;
+                case SWQ_TIME:
+                    oFieldDefn.SetType(OFTTime);
+                    break;
+                case SWQ_TIMESTAMP:
+                    oFieldDefn.SetType(OFTDateTime);
+                    break;
+                default:
+                    break;
+            }
+            m_poHavingDefn->AddFieldDefn(&oFieldDefn);
+        }
+        else if (bIsGeometry)
+        {
+            m_anDstField.push_back(-1);
+            m_anDstGeomField.push_back(iDstGeomField++);
+
+            // Placeholder, as geometries cannot be used in HAVING
+            OGRFieldDefn oFieldDefn(CPLSPrintf("column%d", i), OFTString);
+            m_poHavingDefn->AddFieldDefn(&oFieldDefn);
+        }
+        else
+        {
+            m_anDstField.push_back(iDstField);
+            m_anDstGeomField.push_back(-1);
+            m_poHavingDefn->AddFieldDefn(poDstDefn->GetFieldDefn(iDstField));
+            iDstField++;
+        }
+
+        swq_summary &oSummary = m_aoInitialSummaries[i];
+        if (psColDef->distinct_flag)
+        {
+            swq_summary::Comparator oComparator;
+            if (psColDef->field_type == SWQ_INTEGER ||
+                psColDef->field_type == SWQ_INTEGER64)
+            {
+                oComparator.eType = SWQ_INTEGER64;
+            }
+            else if (psColDef->field_type == SWQ_FLOAT)
+            {
+                oComparator.eType = SWQ_FLOAT;
+            }
+            oSummary.oSetDistinctValues =
+                std::set<CPLString, swq_summary::Comparator>(oComparator);
+        }
+        oSummary.min = std::numeric_limits<double>::infinity();
+        oSummary.max = -std::numeric_limits<double>::infinity();
+    }
+
+    // Without GROUP BY, there is always a result row.
+    if (m_anKeyField.empty() && nLevel == 0)
+    {
+        m_oMapGroups[std::string()] = 0;
+        m_apoGroups.push_back(std::make_unique<Group>());
+        m_apoGroups[0]->aoSummaries = m_aoInitialSummaries;
+        m_apoGroups[0]->aapoGeoms.resize(nColumns);
+        m_apoGroups[0]->asExtents.resize(nColumns);
+    }
+}
+
+/************************************************************************/
+/*                    ~OGRGenSQLGroupByAggregator()                     */
+/************************************************************************/
+
+OGRGenSQLGroupByAggregator::~OGRGenSQLGroupByAggregator()
+{
+    for (auto &oPartition : m_aoPartitions)
+    {
+        if (oPartition.fp)
+        {
+            oPartition.fp.reset();
+            VSIUnlink(oPartition.osFilename.c_str());
+        }
+    }
+    m_poHavingDefn->Release();
+}
+
+/************************************************************************/
+/*                         Serialization helpers                        */
+/************************************************************************/
+
+template <class T> static void AppendToBuffer(std::string &osBuffer, T value)
+{
+    osBuffer.append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <class T>
+static bool ReadFromBuffer(const std::string &osBuffer, size_t &nPos, T &value)
+{
+    if (osBuffer.size() - nPos < sizeof(T))
+        return false;
+    memcpy(&value, osBuffer.data() + nPos, sizeof(T));
+    nPos += sizeof(T);
+    return true;
+}
+
+static void AppendStringToBuffer(std::string &osBuffer, const char *pszValue,
+                                size_t nLen)
+{
+    AppendToBuffer(osBuffer, static_cast<uint32_t>(nLen));
+    osBuffer.append(pszValue, nLen);
+}
+
+static bool ReadStringFromBuffer(const std::string &osBuffer, size_t &nPos,
+                              std::string &osValue)
+{
+    uint32_t nLen = 0;
+    if (!ReadFromBuffer(osBuffer, nPos, nLen) || osBuffer.size() - nPos < nLen)
+        return false;
+    osValue.assign(osBuffer.data() + nPos, nLen);
+    nPos += nLen;
+    return true;
+}
+
+/************************************************************************/
+/*                             BuildKey()                               */
+/*                                                                      */
+/*      Serialize the values of the grouping fields into m_osKey.       */
+/************************************************************************/
+
+void OGRGenSQLGroupByAggregator::BuildKey(const OGRFeature *poSrcFeature)
+{
+    m_osKey.clear();
+    for (size_t i = 0; i < m_anKeyField.size(); ++i)
+    {
+        const int iField = m_anKeyField[i];
+        if (!poSrcFeature->IsFieldSetAndNotNull(iField))
+        {
+            m_osKey += 'N';
+            continue;
+        }
+        m_osKey += m_achKeyType[i];
+        if (m_achKeyType[i] == 'I')
+        {
+            AppendToBuffer(m_osKey, poSrcFeature->GetFieldAsInteger64(iField));
+        }
+        else if (m_achKeyType[i] == 'R')
+        {
+            double dfValue = poSrcFeature->GetFieldAsDouble(iField);
+            if (dfValue == 0)
+                dfValue = 0;  // -0 and 0 belong to the same group
+            AppendToBuffer(m_osKey, dfValue);
+        }
+        else
+        {
+            const char *pszValue = poSrcFeature->GetFieldAsString(iField);
+            AppendStringToBuffer(m_osKey, pszValue, strlen(pszValue));
+        }
+    }
+}
+
+/************************************************************************/
+/*                            ReadValues()                              */
+/*                                                                      */
+/*      Fetch the arguments of the aggregate functions into m_aoValues. */
+/************************************************************************/
+
+void OGRGenSQLGroupByAggregator::ReadValues(const OGRFeature *poSrcFeature)
+{
+    for (size_t i = 0; i < m_aoValues.size(); ++i)
+    {
+        const swq_col_def *psColDef = &m_psSelectInfo->column_defs[i];
+        Value &oValue = m_aoValues[i];
+        oValue.chType = 'N';
+        oValue.poGeom.reset();
+
+        const int iField = psColDef->field_index;
+        if (psColDef->col_func == SWQCF_NONE)
+        {
+            continue;
+        }
+        else if (iField < 0)
+        {
+            // COUNT(*)
+            oValue.chType = 'I';
+        }
+        else if (IS_GEOM_FIELD_INDEX(m_poSrcDefn, iField))
+        {
+            const OGRGeometry *poGeom = poSrcFeature->GetGeomFieldRef(
+                ALL_FIELD_INDEX_TO_GEOM_FIELD_INDEX(m_poSrcDefn, iField));
+            if (poGeom == nullptr)
+                continue;
+            if (psColDef->col_func == SWQCF_COUNT)
+            {
+                oValue.chType = 'I';
+            }
+            else if (psColDef->col_func == SWQCF_ST_EXTENT)
+            {
+                if (!poGeom->IsEmpty())
+                {
+                    oValue.chType = 'E';
+                    poGeom->getEnvelope(&oValue.sEnvelope);
+                }
+            }
+            else
+            {
+                oValue.chType = 'G';
+                oValue.poGeom.reset(poGeom->clone());
+            }
+        }
+        else if (poSrcFeature->IsFieldSetAndNotNull(iField))
+        {
+            const bool bNumeric = psColDef->field_type == SWQ_BOOLEAN ||
+                                  psColDef->field_type == SWQ_INTEGER ||
+                                  psColDef->field_type == SWQ_INTEGER64 ||
+                                  psColDef->field_type == SWQ_FLOAT;
+            if (psColDef->distinct_flag ||
+                (psColDef->col_func != SWQCF_COUNT && !bNumeric))
+            {
+                oValue.chType = 'S';
+                oValue.osVal = poSrcFeature->GetFieldAsString(iField);
+            }
+            else if (psColDef->col_func == SWQCF_COUNT)
+            {
+                oValue.chType = 'I';
+            }
+            else
+            {
+                oValue.chType = 'R';
+                oValue.dfVal = poSrcFeature->GetFieldAsDouble(iField);
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/*                            AddFeature()                              */
+/************************************************************************/
+
+bool OGRGenSQLGroupByAggregator::AddFeature(const OGRFeature *poSrcFeature)
+{
+    BuildKey(poSrcFeature);
+    ReadValues(poSrcFeature);
+    return AddRow();
+}
+
+/************************************************************************/
+/*                              AddRow()                                */
+/*                                                                      */
+/*      Aggregate m_aoValues into the group of key m_osKey, or spill    */
+/*      them to disk.                                                   */
+/************************************************************************/
+
+bool OGRGenSQLGroupByAggregator::AddRow()
+{
+    const auto oIter = m_oMapGroups.find(m_osKey);
+    if (oIter != m_oMapGroups.end())
+        return Accumulate(*(m_apoGroups[oIter->second]));
+
+    if (m_nMemoryUsage > m_nMaxMemory && m_nLevel < MAX_LEVEL)
+        return Spill();
+
+    const size_t nColumns = m_aoValues.size();
+    auto poGroup = std::make_unique<Group>();
+    poGroup->osKey = m_osKey;
+    poGroup->aoSummaries = m_aoInitialSummaries;
+    poGroup->aapoGeoms.resize(nColumns);
+    poGroup->asExtents.resize(nColumns);
+    m_nMemoryUsage += static_cast<GIntBig>(
+        sizeof(Group) + 2 * m_osKey.size() + 64 +
+        nColumns * (sizeof(swq_summary) + sizeof(OGREnvelope) +
+                    sizeof(std::vector<std::unique_ptr<OGRGeometry>>)));
+
+    m_oMapGroups[m_osKey] = m_apoGroups.size();
+    m_apoGroups.push_back(std::move(poGroup));
+    return Accumulate(*(m_apoGroups.back()));
+}
+
+/************************************************************************/
+/*                           MergeGeometries()                          */
+/************************************************************************/
+
+static std::unique_ptr<OGRGeometry>
+MergeGeometries(std::vector<std::unique_ptr<OGRGeometry>> &apoGeoms)
+{
+    OGRGeometryCollection oCollection;
+    for (auto &poGeom : apoGeoms)
+        oCollection.addGeometryDirectly(poGeom.release());
+    apoGeoms.clear();
+    return std::unique_ptr<OGRGeometry>(oCollection.UnaryUnion());
+}
+
+/************************************************************************/
+/*                            Accumulate()                              */
+/************************************************************************/
+
+bool OGRGenSQLGroupByAggregator::Accumulate(Group &oGroup)
+{
+    for (size_t i = 0; i < m_aoValues.size(); ++i)
+    {
+        Value &oValue = m_aoValues[i];
+        if (oValue.chType == 'N')
+            continue;
+
+        const swq_col_def *psColDef = &m_psSelectInfo->column_defs[i];
+        swq_summary &oSummary = oGroup.aoSummaries[i];
+        const char *pszError = nullptr;
+        switch (psColDef->col_func)
+        {
+            case SWQCF_ST_UNION:
+            {
+                auto &apoGeoms = oGroup.aapoGeoms[i];
+                m_nMemoryUsage += oValue.poGeom->WkbSize();
+                apoGeoms.push_back(std::move(oValue.poGeom));
+                if (apoGeoms.size() == UNION_BATCH_SIZE)
+                {
+                    for (const auto &poGeom : apoGeoms)
+                        m_nMemoryUsage -= poGeom->WkbSize();
+                    auto poUnion = MergeGeometries(apoGeoms);
+                    if (!poUnion)
+                        return false;
+                    m_nMemoryUsage += poUnion->WkbSize();
+                    apoGeoms.push_back(std::move(poUnion));
+                }
+                break;
+            }
+
+            case SWQCF_ST_EXTENT:
+                oGroup.asExtents[i].Merge(oValue.sEnvelope);
+                break;
+
+            case SWQCF_COUNT:
+            {
+                if (oValue.chType == 'S')
+                {
+                    const GIntBig nCountBefore = oSummary.count;
+                    pszError = swq_summary_accumulate(
+                        psColDef, oSummary, oValue.osVal.c_str(), nullptr,
+                        /* bKeepDistinctValuesOrder = */ false);
+                    if (oSummary.count != nCountBefore)
+                        m_nMemoryUsage += oValue.osVal.size() + 64;
+                }
+                else
+                {
+                    pszError = swq_summary_accumulate(psColDef, oSummary, "",
+                                                      nullptr, false);
+                }
+                break;
+            }
+
+            default:
+                pszError = swq_summary_accumulate(
+                    psColDef, oSummary,
+                    oValue.chType == 'S' ? oValue.osVal.c_str() : nullptr,
+                    oValue.chType == 'R' ? &oValue.dfVal : nullptr, false);
+                break;
+        }
+
+        if (pszError)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Spill()                                */
+/*                                                                      */
+/*      Append m_osKey and m_aoValues to a temporary file.              */
+/************************************************************************/
+
+bool OGRGenSQLGroupByAggregator::Spill()
+{
+    if (m_aoPartitions.empty())
+    {
+        CPLDebug("GenSQL",
+                 "GROUP BY exceeds OGR_SQL_GROUP_BY_MAX_MEMORY after %d "
+                 "groups. Spilling to temporary files",
+                 static_cast<int>(m_apoGroups.size()));
+        m_aoPartitions.resize(PARTITION_COUNT);
+    }
+
+    // Salt the hash with the level, so that a partition is split in turn
+    // if it has to be spilled again.
+    m_osKey += static_cast<char>(m_nLevel);
+    const size_t nHash = std::hash<std::string>{}(m_osKey);
+    m_osKey.pop_back();
+    Partition &oPartition = m_aoPartitions[nHash % PARTITION_COUNT];
+    if (!oPartition.fp)
+    {
+        oPartition.osFilename = CPLGenerateTempFilenameSafe("ogr_group_by");
+        oPartition.fp.reset(VSIFOpenL(oPartition.osFilename.c_str(), "wb+"));
+        if (!oPartition.fp)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     oPartition.osFilename.c_str());
+            return false;
+        }
+    }
+
+    m_osRecord.clear();
+    AppendStringToBuffer(m_osRecord, m_osKey.data(), m_osKey.size());
+    for (const auto &oValue : m_aoValues)
+    {
+        m_osRecord += oValue.chType;
+        switch (oValue.chType)
+        {
+            case 'R':
+                AppendToBuffer(m_osRecord, oValue.dfVal);
+                break;
+            case 'S':
+                AppendStringToBuffer(m_osRecord, oValue.osVal.data(),
+                                    oValue.osVal.size());
+                break;
+            case 'G':
+            {
+                const size_t nWkbSize = oValue.poGeom->WkbSize();
+                AppendToBuffer(m_osRecord, static_cast<uint32_t>(nWkbSize));
+                const size_t nOffset = m_osRecord.size();
+                m_osRecord.resize(nOffset + nWkbSize);
+                oValue.poGeom->exportToWkb(
+                    wkbNDR,
+                    reinterpret_cast<unsigned char *>(&m_osRecord[nOffset]),
+                    wkbVariantIso);
+                break;
+            }
+            case 'E':
+                AppendToBuffer(m_osRecord, oValue.sEnvelope.MinX);
+                AppendToBuffer(m_osRecord, oValue.sEnvelope.MinY);
+                AppendToBuffer(m_osRecord, oValue.sEnvelope.MaxX);
+                AppendToBuffer(m_osRecord, oValue.sEnvelope.MaxY);
+                break;
+            default:
+                break;
+        }
+    }
+
+    const uint32_t nRecordSize = static_cast<uint32_t>(m_osRecord.size());
+    if (oPartition.fp->Write(&nRecordSize, sizeof(nRecordSize), 1) != 1 ||
+        oPartition.fp->Write(m_osRecord.data(), 1, m_osRecord.size()) !=
+            m_osRecord.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                 oPartition.osFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           ReadPartition()                            */
+/*                                                                      */
+/*      Feed the records of a spilled partition to another aggregator.  */
+/************************************************************************/
+
+bool OGRGenSQLGroupByAggregator::ReadPartition(
+    Partition &oPartition, OGRGenSQLGroupByAggregator &oAggregator)
+{
+    oPartition.fp->Seek(0, SEEK_SET);
+    while (true)
+    {
+        uint32_t nRecordSize = 0;
+        if (oPartition.fp->Read(&nRecordSize, sizeof(nRecordSize), 1) != 1)
+            return true;
+
+        std::string &osRecord = oAggregator.m_osRecord;
+        osRecord.resize(nRecordSize);
+        if (oPartition.fp->Read(&osRecord[0], 1, nRecordSize) != nRecordSize)
+            break;
+
+        size_t nPos = 0;
+        if (!ReadStringFromBuffer(osRecord, nPos, oAggregator.m_osKey))
+            break;
+        bool bOK = true;
+        for (auto &oValue : oAggregator.m_aoValues)
+        {
+            bOK = ReadFromBuffer(osRecord, nPos, oValue.chType);
+            switch (oValue.chType)
+            {
+                case 'R':
+                    bOK = bOK && ReadFromBuffer(osRecord, nPos, oValue.dfVal);
+                    break;
+                case 'S':
+                    bOK = bOK &&
+                          ReadStringFromBuffer(osRecord, nPos, oValue.osVal);
+                    break;
+                case 'G':
+                {
+                    uint32_t nWkbSize = 0;
+                    bOK = bOK && ReadFromBuffer(osRecord, nPos, nWkbSize) &&
+                          osRecord.size() - nPos >= nWkbSize;
+                    OGRGeometry *poGeom = nullptr;
+                    bOK = bOK &&
+                          OGRGeometryFactory::createFromWkb(
+                              osRecord.data() + nPos, nullptr, &poGeom,
+                              nWkbSize) == OGRERR_NONE;
+                    oValue.poGeom.reset(poGeom);
+                    nPos += nWkbSize;
+                    break;
+                }
+                case 'E':
+                {
+                    OGREnvelope &sEnvelope = oValue.sEnvelope;
+                    bOK = bOK &&
+                          ReadFromBuffer(osRecord, nPos, sEnvelope.MinX) &&
+                          ReadFromBuffer(osRecord, nPos, sEnvelope.MinY) &&
+                          ReadFromBuffer(osRecord, nPos, sEnvelope.MaxX) &&
+                          ReadFromBuffer(osRecord, nPos, sEnvelope.MaxY);
+                    break;
+                }
+                default:
+                    break;
+            }
+            if (!bOK)
+                break;
+        }
+        if (!bOK)
+            break;
+
+        if (!oAggregator.AddRow())
+            return false;
+    }
+
+    CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+             oPartition.osFilename.c_str());
+    return false;
+}
+
+/************************************************************************/
+/*                            EmitGroup()                               */
+/************************************************************************/
+
+bool OGRGenSQLGroupByAggregator::EmitGroup(
+    Group &oGroup, std::vector<std::unique_ptr<OGRFeature>> &apoResults)
+{
+    /* -------------------------------------------------------------------- */
+    /*      Decode the values of the grouping fields.                       */
+    /* -------------------------------------------------------------------- */
+    std::vector<std::pair<char, std::string>> aoKeyValues;
+    size_t nPos = 0;
+    for (size_t i = 0; i < m_anKeyField.size(); ++i)
+    {
+        char chType = 'N';
+        std::string osValue;
+        if (!ReadFromBuffer(oGroup.osKey, nPos, chType))
+            return false;
+        if (chType == 'I' || chType == 'R')
+        {
+            if (oGroup.osKey.size() - nPos < sizeof(double))
+                return false;
+            osValue.assign(oGroup.osKey.data() + nPos, sizeof(double));
+            nPos += sizeof(double);
+        }
+        else if (chType == 'S' &&
+                 !ReadStringFromBuffer(oGroup.osKey, nPos, osValue))
+        {
+            return false;
+        }
+        aoKeyValues.emplace_back(chType, std::move(osValue));
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the value of each column.                               */
+    /* -------------------------------------------------------------------- */
+    OGRFeature oHavingFeature(m_poHavingDefn);
+    const int nColumns = static_cast<int>(m_aoValues.size());
+    std::vector<std::unique_ptr<OGRGeometry>> apoGeoms(nColumns);
+    for (int i = 0; i < nColumns; i++)
+    {
+        const swq_col_def *psColDef = &m_psSelectInfo->column_defs[i];
+        switch (psColDef->col_func)
+        {
+            case SWQCF_NONE:
+            {
+                if (m_anColumnKey[i] < 0)
+                    break;
+                const auto &oKeyValue = aoKeyValues[m_anColumnKey[i]];
+                if (oKeyValue.first == 'I')
+                {
+                    GIntBig nValue = 0;
+                    memcpy(&nValue, oKeyValue.second.data(), sizeof(nValue));
+                    oHavingFeature.SetField(i, nValue);
+                }
+                else if (oKeyValue.first == 'R')
+                {
+                    double dfValue = 0;
+                    memcpy(&dfValue, oKeyValue.second.data(), sizeof(dfValue));
+                    oHavingFeature.SetField(i, dfValue);
+                }
+                else if (oKeyValue.first == 'S')
+                {
+                    oHavingFeature.SetField(i, oKeyValue.second.c_str());
+                }
+                else
+                {
+                    oHavingFeature.SetFieldNull(i);
+                }
+                break;
+            }
+
+            case SWQCF_ST_UNION:
+            {
+                auto &apoPendingGeoms = oGroup.aapoGeoms[i];
+                if (apoPendingGeoms.size() == 1)
+                {
+                    apoGeoms[i] = std::move(apoPendingGeoms[0]);
+                }
+                else if (!apoPendingGeoms.empty())
+                {
+                    apoGeoms[i] = MergeGeometries(apoPendingGeoms);
+                    if (!apoGeoms[i])
+                        return false;
+                }
+                break;
+            }
+
+            case SWQCF_ST_EXTENT:
+            {
+                if (oGroup.asExtents[i].IsInit())
+                    apoGeoms[i] =
+                        std::make_unique<OGRPolygon>(oGroup.asExtents[i]);
+                break;
+            }
+
+            default:
+                SetSummaryFieldValue(&oHavingFeature, i, psColDef,
+                                     oGroup.aoSummaries[i]);
+                break;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Apply the HAVING clause.                                        */
+    /* -------------------------------------------------------------------- */
+    if (m_psSelectInfo->having_expr)
+    {
+        VectorOfFeature apoFeatures{&oHavingFeature};
+        swq_evaluation_context sContext;
+        auto poResult = std::unique_ptr<swq_expr_node>(
+            m_psSelectInfo->having_expr->Evaluate(OGRMultiFeatureFetcher,
+                                                  &apoFeatures, sContext));
+        if (!poResult)
+            return false;
+        if (poResult->is_null || poResult->int_value == 0 ||
+            (poResult->field_type != SWQ_BOOLEAN &&
+             poResult->field_type != SWQ_INTEGER &&
+             poResult->field_type != SWQ_INTEGER64))
+        {
+            return true;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Build the result feature.                                       */
+    /* -------------------------------------------------------------------- */
+    auto poDstFeature = std::make_unique<OGRFeature>(m_poDstDefn);
+    for (int i = 0; i < nColumns; i++)
+    {
+        if (m_anDstField[i] >= 0)
+        {
+            poDstFeature->SetField(m_anDstField[i],
+                                   oHavingFeature.GetRawFieldRef(i));
+        }
+        else if (m_anDstGeomField[i] >= 0)
+        {
+            poDstFeature->SetGeomFieldDirectly(m_anDstGeomField[i],
+                                               apoGeoms[i].release());
+        }
+    }
+    apoResults.push_back(std::move(poDstFeature));
+    return true;
+}
+
+/************************************************************************/
+/*                             Finalize()                               */
+/*                                                                      */
+/*      Append the result features, in the order in which the groups    */
+/*      were first seen, followed by those of each spilled partition.   */
+/************************************************************************/
+
+bool OGRGenSQLGroupByAggregator::Finalize(
+    std::vector<std::unique_ptr<OGRFeature>> &apoResults)
+{
+    m_oMapGroups.clear();
+    for (auto &poGroup : m_apoGroups)
+    {
+        if (!EmitGroup(*poGroup, apoResults))
+            return false;
+        poGroup.reset();
+    }
+    m_apoGroups.clear();
+    m_nMemoryUsage = 0;
+
+    for (auto &oPartition : m_aoPartitions)
+    {
+        if (!oPartition.fp)
+            continue;
+
+        OGRGenSQLGroupByAggregator oAggregator(m_psSelectInfo, m_poSrcDefn,
+                                               m_poDstDefn, m_nMaxMemory,
+                                               m_nLevel + 1);
+        if (!ReadPartition(oPartition, oAggregator))
+            return false;
+        oPartition.fp.reset();
+        VSIUnlink(oPartition.osFilename.c_str());
+
+        if (!oAggregator.Finalize(apoResults))
+            return false;
+    }
+    m_aoPartitions.clear();
+
+    return true;
+}
+
+/************************************************************************/
+/*                      CompareGroupByFeatures()                        */
+/************************************************************************/
+
+static int CompareGroupByFeatures(const OGRFeature *poFirst,
+                                  const OGRFeature *poSecond, int iField)
+{
+    const bool bFirstNull = !poFirst->IsFieldSetAndNotNull(iField);
+    const bool bSecondNull = !poSecond->IsFieldSetAndNotNull(iField);
+    if (bFirstNull || bSecondNull)
+        return bFirstNull == bSecondNull ? 0 : bFirstNull ? -1 : 1;
+
+    switch (poFirst->GetFieldDefnRef(iField)->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+            return ComparePrimitive(poFirst->GetFieldAsInteger64(iField),
+                                    poSecond->GetFieldAsInteger64(iField));
+        case OFTReal:
+            return ComparePrimitive(poFirst->GetFieldAsDouble(iField),
+                                    poSecond->GetFieldAsDouble(iField));
+        case OFTDate:
+        case OFTTime:
+        case OFTDateTime:
+            return OGRCompareDate(poFirst->GetRawFieldRef(iField),
+                                  poSecond->GetRawFieldRef(iField));
+        default:
+            return strcmp(poFirst->GetFieldAsString(iField),
+                          poSecond->GetFieldAsString(iField));
+    }
+}
+
+/************************************************************************/
+/*                           PrepareGroupBy()                           */
+/*                                                                      */
+/*      Compute the result of a GROUP BY query, or of a summary query   */
+/*      with geometry aggregates, into m_apoGroupByFeatures.            */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::PrepareGroupBy() const
+{
+    if (m_bGroupByValid)
+        return true;
+
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    m_apoGroupByFeatures.clear();
+
+    const GIntBig nMaxMemory =
+        GetMaxMemoryOption("OGR_SQL_GROUP_BY_MAX_MEMORY");
+
+    OGRGenSQLGroupByAggregator oAggregator(
+        psSelectInfo, m_poSrcLayer->GetLayerDefn(), m_poDefn, nMaxMemory);
+
+    const_cast<OGRGenSQLResultsLayer *>(this)->ApplyFiltersToSource();
+
+    bool bOK = true;
+    for (auto &&poSrcFeature : *m_poSrcLayer)
+    {
+        // The WHERE clause was not forwarded to the source layer
+        if (!m_bForwardWhereToSourceLayer && psSelectInfo->where_expr)
+        {
+            VectorOfFeature apoFeatures{poSrcFeature.get()};
+            swq_evaluation_context sContext;
+            auto poResult = std::unique_ptr<swq_expr_node>(
+                psSelectInfo->where_expr->Evaluate(OGRMultiFeatureFetcher,
+                                                   &apoFeatures, sContext));
+            if (!poResult)
+            {
+                bOK = false;
+                break;
+            }
+            if (poResult->is_null || !poResult->int_value)
+                continue;
+        }
+
+        if (!oAggregator.AddFeature(poSrcFeature.get()))
+        {
+            bOK = false;
+            break;
+        }
+    }
+
+    const_cast<OGRGenSQLResultsLayer *>(this)->ClearFilters();
+
+    if (!bOK || !oAggregator.Finalize(m_apoGroupByFeatures))
+    {
+        m_apoGroupByFeatures.clear();
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Apply ORDER BY, which references columns of the result.         */
+    /* -------------------------------------------------------------------- */
+    if (psSelectInfo->order_specs > 0)
+    {
+        std::stable_sort(
+            m_apoGroupByFeatures.begin(), m_apoGroupByFeatures.end(),
+            [psSelectInfo, &oAggregator](const std::unique_ptr<OGRFeature> &a,
+                                         const std::unique_ptr<OGRFeature> &b)
+            {
+                for (int i = 0; i < psSelectInfo->order_specs; i++)
+                {
+                    const swq_order_def *psKeyDef =
+                        psSelectInfo->order_defs + i;
+                    int nResult = CompareGroupByFeatures(
+                        a.get(), b.get(),
+                        oAggregator.GetDstFieldIndex(psKeyDef->field_index));
+                    if (!psKeyDef->ascending_flag)
+                        nResult = -nResult;
+                    if (nResult != 0)
+                        return nResult < 0;
+                }
+                return false;
+            });
+    }
+
+    for (size_t i = 0; i < m_apoGroupByFeatures.size(); ++i)
+        m_apoGroupByFeatures[i]->SetFID(static_cast<GIntBig>(i));
+
+    m_bGroupByValid = true;
+    return true;
+}
+
+/************************************************************************/
+/*                           SerializeFeature()                         */
+/*                                                                      */
+/*      Append the FID, fields, geometries and style string of a        */
+/*      feature to a buffer, for DeserializeFeature().                  */
+/************************************************************************/
+
+static void SerializeFeature(const OGRFeature *poFeature, std::string &osBuffer)
+{
+    AppendToBuffer(osBuffer, static_cast<GIntBig>(poFeature->GetFID()));
+
+    const int nFieldCount = poFeature->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        if (!poFeature->IsFieldSet(i))
+        {
+            osBuffer += 'U';
+            continue;
+        }
+        if (poFeature->IsFieldNull(i))
+        {
+            osBuffer += 'N';
+            continue;
+        }
+        osBuffer += 'V';
+
+        const OGRField *psField = poFeature->GetRawFieldRef(i);
+        switch (poFeature->GetFieldDefnRef(i)->GetType())
+        {
+            case OFTInteger:
+                AppendToBuffer(osBuffer, psField->Integer);
+                break;
+            case OFTInteger64:
+                AppendToBuffer(osBuffer, psField->Integer64);
+                break;
+            case OFTReal:
+                AppendToBuffer(osBuffer, psField->Real);
+                break;
+            case OFTDate:
+            case OFTTime:
+            case OFTDateTime:
+                AppendToBuffer(osBuffer, psField->Date);
+                break;
+            case OFTBinary:
+                AppendStringToBuffer(
+                    osBuffer,
+                    reinterpret_cast<const char *>(psField->Binary.paData),
+                    psField->Binary.nCount);
+                break;
+            case OFTIntegerList:
+                AppendStringToBuffer(
+                    osBuffer,
+                    reinterpret_cast<const char *>(psField->IntegerList.paList),
+                    sizeof(int) * psField->IntegerList.nCount);
+                break;
+            case OFTInteger64List:
+                AppendStringToBuffer(
+                    osBuffer,
+                    reinterpret_cast<const char *>(
+                        psField->Integer64List.paList),
+                    sizeof(GIntBig) * psField->Integer64List.nCount);
+                break;
+            case OFTRealList:
+                AppendStringToBuffer(
+                    osBuffer,
+                    reinterpret_cast<const char *>(psField->RealList.paList),
+                    sizeof(double) * psField->RealList.nCount);
+                break;
+            case OFTStringList:
+            {
+                const int nCount = psField->StringList.nCount;
+                AppendToBuffer(osBuffer, static_cast<uint32_t>(nCount));
+                for (int j = 0; j < nCount; ++j)
+                {
+                    const char *pszValue = psField->StringList.paList[j];
+                    AppendStringToBuffer(osBuffer, pszValue, strlen(pszValue));
+                }
+                break;
+            }
+            default:
+                AppendStringToBuffer(osBuffer, psField->String,
+                                     strlen(psField->String));
+                break;
+        }
+    }
+
+    const int nGeomFieldCount = poFeature->GetGeomFieldCount();
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
+        if (poGeom == nullptr)
+        {
+            osBuffer += 'N';
+            continue;
+        }
+        osBuffer += 'G';
+        const size_t nWkbSize = poGeom->WkbSize();
+        AppendToBuffer(osBuffer, static_cast<uint32_t>(nWkbSize));
+        const size_t nOffset = osBuffer.size();
+        osBuffer.resize(nOffset + nWkbSize);
+        poGeom->exportToWkb(
+            wkbNDR, reinterpret_cast<unsigned char *>(&osBuffer[nOffset]),
+            wkbVariantIso);
+    }
+
+    const char *pszStyle = poFeature->GetStyleString();
+    if (pszStyle)
+    {
+        osBuffer += 'S';
+        AppendStringToBuffer(osBuffer, pszStyle, strlen(pszStyle));
+    }
+    else
+    {
+        osBuffer += 'N';
+    }
+}
+
+/************************************************************************/
+/*                          DeserializeFeature()                        */
+/************************************************************************/
+
+static bool DeserializeFeature(const std::string &osBuffer, size_t nPos,
+                               OGRFeature *poFeature)
+{
+    GIntBig nFID = 0;
+    if (!ReadFromBuffer(osBuffer, nPos, nFID))
+        return false;
+    poFeature->SetFID(nFID);
+
+    std::string osValue;
+    const int nFieldCount = poFeature->GetFieldCount();
+    for (int i = 0; i < nFieldCount; ++i)
+    {
+        char chState = 0;
+        if (!ReadFromBuffer(osBuffer, nPos, chState))
+            return false;
+        if (chState == 'U')
+            continue;
+        if (chState == 'N')
+        {
+            poFeature->SetFieldNull(i);
+            continue;
+        }
+
+        OGRField sField;
+        bool bOK = true;
+        switch (poFeature->GetFieldDefnRef(i)->GetType())
+        {
+            case OFTInteger:
+                bOK = ReadFromBuffer(osBuffer, nPos, sField.Integer);
+                break;
+            case OFTInteger64:
+                bOK = ReadFromBuffer(osBuffer, nPos, sField.Integer64);
+                break;
+            case OFTReal:
+                bOK = ReadFromBuffer(osBuffer, nPos, sField.Real);
+                break;
+            case OFTDate:
+            case OFTTime:
+            case OFTDateTime:
+                bOK = ReadFromBuffer(osBuffer, nPos, sField.Date);
+                break;
+            case OFTBinary:
+                bOK = ReadStringFromBuffer(osBuffer, nPos, osValue);
+                sField.Binary.nCount = static_cast<int>(osValue.size());
+                sField.Binary.paData =
+                    reinterpret_cast<GByte *>(osValue.empty() ? nullptr
+                                                              : &osValue[0]);
+                break;
+            case OFTIntegerList:
+                bOK = ReadStringFromBuffer(osBuffer, nPos, osValue);
+                sField.IntegerList.nCount =
+                    static_cast<int>(osValue.size() / sizeof(int));
+                sField.IntegerList.paList =
+                    reinterpret_cast<int *>(osValue.empty() ? nullptr
+                                                            : &osValue[0]);
+                break;
+            case OFTInteger64List:
+                bOK = ReadStringFromBuffer(osBuffer, nPos, osValue);
+                sField.Integer64List.nCount =
+                    static_cast<int>(osValue.size() / sizeof(GIntBig));
+                sField.Integer64List.paList =
+                    reinterpret_cast<GIntBig *>(osValue.empty() ? nullptr
+                                                                : &osValue[0]);
+                break;
+            case OFTRealList:
+                bOK = ReadStringFromBuffer(osBuffer, nPos, osValue);
+                sField.RealList.nCount =
+                    static_cast<int>(osValue.size() / sizeof(double));
+                sField.RealList.paList =
+                    reinterpret_cast<double *>(osValue.empty() ? nullptr
+                                                               : &osValue[0]);
+                break;
+            case OFTStringList:
+            {
+                uint32_t nCount = 0;
+                bOK = ReadFromBuffer(osBuffer, nPos, nCount);
+                CPLStringList aosList;
+                for (uint32_t j = 0; bOK && j < nCount; ++j)
+                {
+                    bOK = ReadStringFromBuffer(osBuffer, nPos, osValue);
+                    aosList.AddString(osValue.c_str());
+                }
+                if (bOK)
+                    poFeature->SetField(i, aosList.List());
+                break;
+            }
+            default:
+                bOK = ReadStringFromBuffer(osBuffer, nPos, osValue);
+                sField.String = &osValue[0];
+                break;
+        }
+        if (!bOK)
+            return false;
+        if (poFeature->GetFieldDefnRef(i)->GetType() != OFTStringList)
+            poFeature->SetField(i, &sField);
+    }
+
+    const int nGeomFieldCount = poFeature->GetGeomFieldCount();
+    for (int i = 0; i < nGeomFieldCount; ++i)
+    {
+        char chState = 0;
+        if (!ReadFromBuffer(osBuffer, nPos, chState))
+            return false;
+        if (chState != 'G')
+            continue;
+        uint32_t nWkbSize = 0;
+        if (!ReadFromBuffer(osBuffer, nPos, nWkbSize) ||
+            osBuffer.size() - nPos < nWkbSize)
+            return false;
+        OGRGeometry *poGeom = nullptr;
+        if (OGRGeometryFactory::createFromWkb(osBuffer.data() + nPos, nullptr,
+                                              &poGeom,
+                                              nWkbSize) != OGRERR_NONE)
+            return false;
+        nPos += nWkbSize;
+        poGeom->assignSpatialReference(
+            poFeature->GetGeomFieldDefnRef(i)->GetSpatialRef());
+        poFeature->SetGeomFieldDirectly(i, poGeom);
+    }
+
+    char chState = 0;
+    if (!ReadFromBuffer(osBuffer, nPos, chState))
+        return false;
+    if (chState == 'S')
+    {
+        if (!ReadStringFromBuffer(osBuffer, nPos, osValue))
+            return false;
+        poFeature->SetStyleString(osValue.c_str());
+    }
+    return true;
+}
+
+// Maximum number of runs merged at once, and thus of temporary files opened
+// at once
+constexpr size_t ORDER_BY_MAX_MERGE_FAN_IN = 64;
+
+// In OGR_SQL_ORDER_BY_CARRY_ROWS=AUTO mode, source features larger than this
+// on average are fetched again by FID rather than stored in the runs, if the
+// source layer supports random reading.
+constexpr size_t ORDER_BY_MAX_CARRIED_ROW_SIZE = 4096;
+
+/************************************************************************/
+/*                            WriteRunRecord()                          */
+/************************************************************************/
+
+static bool WriteRunRecord(OGRGenSQLResultsLayer::ExternalSort::Run &oRun,
+                           const std::string &osRecord)
+{
+    const uint32_t nRecordSize = static_cast<uint32_t>(osRecord.size());
+    if (oRun.fp->Write(&nRecordSize, sizeof(nRecordSize), 1) != 1 ||
+        oRun.fp->Write(osRecord.data(), 1, osRecord.size()) != osRecord.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                 oRun.osFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               CloseRun()                             */
+/************************************************************************/
+
+static bool CloseRun(OGRGenSQLResultsLayer::ExternalSort::Run &oRun)
+{
+    const bool bOK = oRun.fp->Close() == 0;
+    oRun.fp.reset();
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                 oRun.osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                           IsStringOrderKey()                         */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::IsStringOrderKey(int iKey) const
+{
+    const swq_order_def *psKeyDef = m_pSelectInfo->order_defs + iKey;
+    if (psKeyDef->field_index >= m_iFIDFieldIndex)
+    {
+        return SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex] ==
+               SWQ_STRING;
+    }
+    return m_poSrcLayer->GetLayerDefn()
+               ->GetFieldDefn(psKeyDef->field_index)
+               ->GetType() == OFTString;
+}
+
+/************************************************************************/
+/*                      GetIndexFieldsMemoryUsage()                     */
+/*                                                                      */
+/*      Estimate the memory used by the sort keys of a feature read by  */
+/*      ReadIndexFields().                                              */
+/************************************************************************/
+
+size_t OGRGenSQLResultsLayer::GetIndexFieldsMemoryUsage(
+    const OGRField *pasIndexFields) const
+{
+    const int nOrderItems = m_pSelectInfo->order_specs;
+    size_t nSize = sizeof(OGRField) * nOrderItems;
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    {
+        const OGRField *psField = pasIndexFields + iKey;
+        if (IsStringOrderKey(iKey) && !OGR_RawField_IsUnset(psField) &&
+            !OGR_RawField_IsNull(psField))
+        {
+            // Approximate overhead of the heap allocation
+            nSize += strlen(psField->String) + 1 + 2 * sizeof(void *);
+        }
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                           WriteOrderByRun()                          */
+/*                                                                      */
+/*      Sort features read in memory and write them to a new run.       */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::WriteOrderByRun(
+    const std::vector<OGRField> &asIndexFields,
+    const std::vector<GIntBig> &anFIDList, const std::string &osRows,
+    const std::vector<size_t> &anRowOffsets)
+{
+    ExternalSort &oSort = *m_poExternalSort;
+    const int nOrderItems = m_pSelectInfo->order_specs;
+    const size_t nEntries = anFIDList.size();
+
+    std::vector<size_t> anOrder(nEntries);
+    for (size_t i = 0; i < nEntries; ++i)
+        anOrder[i] = i;
+    std::stable_sort(anOrder.begin(), anOrder.end(),
+                     [this, &asIndexFields, nOrderItems](size_t a, size_t b)
+                     {
+                         return Compare(asIndexFields.data() + a * nOrderItems,
+                                        asIndexFields.data() +
+                                            b * nOrderItems) < 0;
+                     });
+
+    auto poRun = std::make_unique<ExternalSort::Run>();
+    poRun->osFilename = CPLGenerateTempFilenameSafe("ogr_order_by");
+    poRun->fp.reset(VSIFOpenL(poRun->osFilename.c_str(), "wb"));
+    if (!poRun->fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 poRun->osFilename.c_str());
+        return false;
+    }
+    oSort.apoRuns.push_back(std::move(poRun));
+    ExternalSort::Run &oRun = *(oSort.apoRuns.back());
+
+    std::string osRecord;
+    for (const size_t i : anOrder)
+    {
+        osRecord.clear();
+        for (int iKey = 0; iKey < nOrderItems; iKey++)
+        {
+            const OGRField *psField = &asIndexFields[i * nOrderItems + iKey];
+            if (IsStringOrderKey(iKey) && !OGR_RawField_IsUnset(psField) &&
+                !OGR_RawField_IsNull(psField))
+            {
+                osRecord += 'S';
+                osRecord.append(psField->String, strlen(psField->String) + 1);
+            }
+            else
+            {
+                osRecord += 'R';
+                AppendToBuffer(osRecord, *psField);
+            }
+        }
+        AppendToBuffer(osRecord, anFIDList[i]);
+        if (oSort.bCarryRows)
+        {
+            const size_t nEnd = i + 1 < anRowOffsets.size()
+                                     ? anRowOffsets[i + 1]
+                                     : osRows.size();
+            osRecord.append(osRows, anRowOffsets[i], nEnd - anRowOffsets[i]);
+        }
+
+        if (!WriteRunRecord(oRun, osRecord))
+            return false;
+    }
+
+    return CloseRun(oRun);
+}
+
+/************************************************************************/
+/*                         ReadOrderByRunRecord()                       */
+/*                                                                      */
+/*      Read and decode the next record of a run.                       */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::ReadOrderByRunRecord(size_t iRun)
+{
+    ExternalSort::Run &oRun = *(m_poExternalSort->apoRuns[iRun]);
+    const int nOrderItems = m_pSelectInfo->order_specs;
+
+    oRun.osRecord.clear();
+    uint32_t nRecordSize = 0;
+    if (oRun.fp->Read(&nRecordSize, sizeof(nRecordSize), 1) != 1)
+        return true;  // End of run
+
+    std::string &osRecord = oRun.osRecord;
+    osRecord.resize(nRecordSize);
+    bool bOK = nRecordSize > 0 &&
+               oRun.fp->Read(&osRecord[0], 1, nRecordSize) == nRecordSize;
+
+    oRun.asIndexFields.resize(nOrderItems);
+    size_t nPos = 0;
+    for (int iKey = 0; bOK && iKey < nOrderItems; iKey++)
+    {
+        OGRField *psField = &oRun.asIndexFields[iKey];
+        char chType = 0;
+        bOK = ReadFromBuffer(osRecord, nPos, chType);
+        if (bOK && chType == 'S')
+        {
+            const char *pszEnd = static_cast<const char *>(
+                memchr(osRecord.data() + nPos, 0, osRecord.size() - nPos));
+            bOK = pszEnd != nullptr;
+            if (bOK)
+            {
+                psField->String = &osRecord[nPos];
+                nPos = pszEnd - osRecord.data() + 1;
+            }
+        }
+        else if (bOK)
+        {
+            bOK = chType == 'R' && ReadFromBuffer(osRecord, nPos, *psField);
+        }
+    }
+    bOK = bOK && ReadFromBuffer(osRecord, nPos, oRun.nFID);
+    oRun.nRowOffset = nPos;
+
+    if (!bOK)
+    {
+        osRecord.clear();
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                 oRun.osFilename.c_str());
+    }
+    return bOK;
+}
+
+/************************************************************************/
+/*                          AdvanceExternalSort()                       */
+/*                                                                      */
+/*      Skip the smallest record among the runs of the heap.            */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::AdvanceExternalSort()
+{
+    ExternalSort &oSort = *m_poExternalSort;
+    const auto IsAfter = [this, &oSort](size_t a, size_t b)
+    {
+        const int nResult =
+            Compare(oSort.apoRuns[a]->asIndexFields.data(),
+                    oSort.apoRuns[b]->asIndexFields.data());
+        return nResult > 0 || (nResult == 0 && a > b);
+    };
+
+    if (oSort.anHeap.empty())
+        return false;
+
+    std::pop_heap(oSort.anHeap.begin(), oSort.anHeap.end(), IsAfter);
+    const size_t iRun = oSort.anHeap.back();
+    oSort.anHeap.pop_back();
+    if (!ReadOrderByRunRecord(iRun))
+        return false;
+    if (!oSort.apoRuns[iRun]->osRecord.empty())
+    {
+        oSort.anHeap.push_back(iRun);
+        std::push_heap(oSort.anHeap.begin(), oSort.anHeap.end(), IsAfter);
+    }
+    oSort.nNextRecord++;
+    return true;
+}
+
+/************************************************************************/
+/*                          RewindExternalSort()                        */
+/*                                                                      */
+/*      Position on the first record of each run, and build the heap.   */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::RewindExternalSort()
+{
+    ExternalSort &oSort = *m_poExternalSort;
+    const auto IsAfter = [this, &oSort](size_t a, size_t b)
+    {
+        const int nResult =
+            Compare(oSort.apoRuns[a]->asIndexFields.data(),
+                    oSort.apoRuns[b]->asIndexFields.data());
+        return nResult > 0 || (nResult == 0 && a > b);
+    };
+
+    oSort.anHeap.clear();
+    oSort.nNextRecord = 0;
+    for (size_t iRun = 0; iRun < oSort.apoRuns.size(); ++iRun)
+    {
+        ExternalSort::Run &oRun = *(oSort.apoRuns[iRun]);
+        if (oRun.fp)
+        {
+            oRun.fp->Seek(0, SEEK_SET);
+        }
+        else
+        {
+            oRun.fp.reset(VSIFOpenL(oRun.osFilename.c_str(), "rb"));
+            if (!oRun.fp)
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s",
+                         oRun.osFilename.c_str());
+                return false;
+            }
+        }
+        if (!ReadOrderByRunRecord(iRun))
+            return false;
+        if (!oSort.apoRuns[iRun]->osRecord.empty())
+            oSort.anHeap.push_back(iRun);
+    }
+    std::make_heap(oSort.anHeap.begin(), oSort.anHeap.end(), IsAfter);
+    return true;
+}
+
+/************************************************************************/
+/*                           MergeOrderByRuns()                         */
+/*                                                                      */
+/*      Replace nRuns consecutive runs, starting at iFirstRun, by their */
+/*      merge.                                                          */
+/************************************************************************/
+
+bool OGRGenSQLResultsLayer::MergeOrderByRuns(size_t iFirstRun, size_t nRuns)
+{
+    ExternalSort &oSort = *m_poExternalSort;
+
+    auto poMergedRun = std::make_unique<ExternalSort::Run>();
+    poMergedRun->osFilename = CPLGenerateTempFilenameSafe("ogr_order_by");
+    poMergedRun->fp.reset(VSIFOpenL(poMergedRun->osFilename.c_str(), "wb"));
+    if (!poMergedRun->fp)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                 poMergedRun->osFilename.c_str());
+        return false;
+    }
+
+    // Temporarily restrict the runs to the ones to merge
+    std::vector<std::unique_ptr<ExternalSort::Run>> apoAllRuns;
+    std::swap(apoAllRuns, oSort.apoRuns);
+    for (size_t i = 0; i < nRuns; ++i)
+        oSort.apoRuns.push_back(std::move(apoAllRuns[iFirstRun + i]));
+
+    bool bOK = RewindExternalSort();
+    while (bOK && !oSort.anHeap.empty())
+    {
+        bOK = WriteRunRecord(*poMergedRun,
+                             oSort.apoRuns[oSort.anHeap.front()]->osRecord) &&
+              AdvanceExternalSort();
+    }
+    bOK = CloseRun(*poMergedRun) && bOK;
+
+    // Closes and removes the merged runs
+    oSort.apoRuns.clear();
+    oSort.anHeap.clear();
+    apoAllRuns[iFirstRun] = std::move(poMergedRun);
+    apoAllRuns.erase(apoAllRuns.begin() + iFirstRun + 1,
+                     apoAllRuns.begin() + iFirstRun + nRuns);
+    std::swap(apoAllRuns, oSort.apoRuns);
+    return bOK;
+}
+
+/************************************************************************/
+/*                       CreateExternalOrderByIndex()                   */
+/*                                                                      */
+/*      Sort the source features when their keys do not fit in memory:  */
+/*      sorted runs of at most nMaxMemory bytes are written to          */
+/*      temporary files, and merged by GetNextFeature().                */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::CreateExternalOrderByIndex(GIntBig nMaxMemory)
+{
+    const int nOrderItems = m_pSelectInfo->order_specs;
+
+    m_poExternalSort = std::make_unique<ExternalSort>();
+    ExternalSort &oSort = *m_poExternalSort;
+
+    const char *pszCarryRows =
+        CPLGetConfigOption("OGR_SQL_ORDER_BY_CARRY_ROWS", "AUTO");
+    const bool bAutoCarryRows = EQUAL(pszCarryRows, "AUTO");
+    oSort.bCarryRows = bAutoCarryRows || CPLTestBool(pszCarryRows);
+    if (!oSort.bCarryRows && !m_poSrcLayer->TestCapability(OLCRandomRead))
+    {
+        CPLDebug("GenSQL", "Source layer does not support random reading. "
+                           "Ignoring OGR_SQL_ORDER_BY_CARRY_ROWS=NO");
+        oSort.bCarryRows = true;
+    }
+    // In AUTO mode, rows are carried until the first run is written, and
+    // the decision is taken on their average size.
+    bool bCarryRowsDecided = !bAutoCarryRows;
+
+    std::vector<OGRField> asIndexFields;
+    std::vector<GIntBig> anFIDList;
+    std::string osRows;
+    std::vector<size_t> anRowOffsets;
+    GIntBig nMemory = 0;
+
+    const auto FlushRun = [&]()
+    {
+        if (!bCarryRowsDecided)
+        {
+            bCarryRowsDecided = true;
+            const size_t nAvgRowSize = osRows.size() / anFIDList.size();
+            oSort.bCarryRows =
+                nAvgRowSize <= ORDER_BY_MAX_CARRIED_ROW_SIZE ||
+                !m_poSrcLayer->TestCapability(OLCRandomRead);
+            CPLDebug("GenSQL",
+                     "ORDER BY exceeds OGR_SQL_ORDER_BY_MAX_MEMORY. Sorting "
+                     "in temporary files, %s",
+                     oSort.bCarryRows ? "with features"
+                                      : "with FIDs of features");
+        }
+
+        const bool bOK =
+            WriteOrderByRun(asIndexFields, anFIDList, osRows, anRowOffsets);
+
+        FreeIndexFields(asIndexFields.data(), anFIDList.size());
+        asIndexFields.clear();
+        anFIDList.clear();
+        osRows.clear();
+        anRowOffsets.clear();
+        nMemory = 0;
+        return bOK;
+    };
+
+    bool bOK = true;
+    ResetReading();
+    for (auto &&poSrcFeat : *m_poSrcLayer)
+    {
+        const size_t nIndexSize = anFIDList.size();
+        try
+        {
+            asIndexFields.resize((nIndexSize + 1) * nOrderItems);
+            anFIDList.push_back(poSrcFeat->GetFID());
+            if (oSort.bCarryRows)
+            {
+                anRowOffsets.push_back(osRows.size());
+                SerializeFeature(poSrcFeat.get(), osRows);
+            }
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "CreateOrderByIndex(): out of memory");
+            asIndexFields.resize(nIndexSize * nOrderItems);
+            anFIDList.resize(nIndexSize);
+            bOK = false;
+            break;
+        }
+        OGRField *pasIndexFields =
+            asIndexFields.data() + nIndexSize * nOrderItems;
+        ReadIndexFields(poSrcFeat.get(), nOrderItems, pasIndexFields);
+
+        nMemory += GetIndexFieldsMemoryUsage(pasIndexFields) + sizeof(GIntBig);
+        if (oSort.bCarryRows)
+            nMemory += osRows.size() - anRowOffsets.back() + sizeof(size_t);
+        if (nMemory > nMaxMemory && !FlushRun())
+        {
+            bOK = false;
+            break;
+        }
+    }
+
+    if (bOK && !anFIDList.empty())
+        bOK = FlushRun();
+    FreeIndexFields(asIndexFields.data(), anFIDList.size());
+
+    if (bOK)
+    {
+        CPLDebug("GenSQL", "ORDER BY: merging %d sorted runs",
+                 static_cast<int>(oSort.apoRuns.size()));
+    }
+
+    // Merge passes, until the remaining runs can be merged by
+    // GetNextFeature().
+    while (bOK && oSort.apoRuns.size() > ORDER_BY_MAX_MERGE_FAN_IN)
+    {
+        for (size_t iRun = 0; bOK && iRun < oSort.apoRuns.size(); ++iRun)
+        {
+            bOK = MergeOrderByRuns(
+                iRun, std::min(ORDER_BY_MAX_MERGE_FAN_IN,
+                               oSort.apoRuns.size() - iRun));
+        }
+    }
+
+    if (bOK)
+        bOK = RewindExternalSort();
+    if (!bOK)
+        m_poExternalSort.reset();
+
+    ResetReading();
+}
+
+/************************************************************************/
+/*                      FetchExternallySortedFeature()                  */
+/*                                                                      */
+/*      Return the source feature of the smallest record of the heap.   */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLResultsLayer::FetchExternallySortedFeature()
+{
+    ExternalSort &oSort = *m_poExternalSort;
+    if (oSort.anHeap.empty())
+        return nullptr;
+
+    const ExternalSort::Run &oRun = *(oSort.apoRuns[oSort.anHeap.front()]);
+    std::unique_ptr<OGRFeature> poFeature;
+    if (oSort.bCarryRows)
+    {
+        poFeature = std::make_unique<OGRFeature>(m_poSrcLayer->GetLayerDefn());
+        if (!DeserializeFeature(oRun.osRecord, oRun.nRowOffset,
+                                poFeature.get()))
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read %s",
+                     oRun.osFilename.c_str());
+            poFeature.reset();
+        }
+    }
+    else
+    {
+        poFeature.reset(m_poSrcLayer->GetFeature(oRun.nFID));
+    }
+    return poFeature;
+}
+
+/************************************************************************/
+/*                         AddFieldDefnToSet()                          */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::AddFieldDefnToSet(int iTable, int iColumn,
+                                              CPLHashSet *hSet)
+{
+    if (iTable != -1)
+    {
+        OGRLayer *poLayer = m_apoTableLayers[iTable];
+        const auto poLayerDefn = poLayer->GetLayerDefn();
+        const int nFieldCount = poLayerDefn->GetFieldCount();
+        if (iColumn == -1)
+        {
+            for (int i = 0; i < nFieldCount; ++i)
+            {
+                OGRFieldDefn *poFDefn = poLayerDefn->GetFieldDefn(i);
+                CPLHashSetInsert(hSet, poFDefn);
+            }
+
             const int nGeomFieldCount = poLayerDefn->GetGeomFieldCount();
             for (int i = 0; i < nGeomFieldCount; ++i)
             {
@@ -2694,6 +5201,15 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
                           hSet);
     }
 
+    // The HAVING clause only references result columns.
+    for (int iGroupBy = 0; iGroupBy < psSelectInfo->group_by_count; iGroupBy++)
+    {
+        const swq_group_by_def *psGroupByDef =
+            psSelectInfo->group_by_defs + iGroupBy;
+        AddFieldDefnToSet(psGroupByDef->table_index, psGroupByDef->field_index,
+                          hSet);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      2nd phase : now, we can exclude the unused fields               */
     /* -------------------------------------------------------------------- */
@@ -2747,6 +5263,7 @@ void OGRGenSQLResultsLayer::FindAndSetIgnoredFields()
 void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
 {
     m_anFIDIndex.clear();
+    m_poExternalSort.reset();
     m_bOrderByValid = false;
 }
 
@@ -2756,6 +5273,12 @@ void OGRGenSQLResultsLayer::InvalidateOrderByIndex()
 
 OGRErr OGRGenSQLResultsLayer::SetAttributeFilter(const char *pszAttributeFilter)
 {
+    if (m_pSelectInfo->query_mode == SWQM_GROUP_BY)
+    {
+        // Applies to the result features only.
+        return OGRLayer::SetAttributeFilter(pszAttributeFilter);
+    }
+
     const std::string osAdditionalWHERE =
         pszAttributeFilter ? pszAttributeFilter : "";
     std::string osWHERE;
@@ -2786,6 +5309,8 @@ OGRErr OGRGenSQLResultsLayer::ISetSpatialFilter(int iGeomField,
                                                 const OGRGeometry *poGeom)
 {
     InvalidateOrderByIndex();
+    m_apoGroupByFeatures.clear();
+    m_bGroupByValid = false;
     return OGRLayer::ISetSpatialFilter(iGeomField, poGeom);
 }
 
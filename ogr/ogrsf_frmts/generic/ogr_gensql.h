@@ -19,6 +19,8 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
+#include <string>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -59,6 +61,11 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     std::vector<std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>>
         m_apoExtraDS{};
 
+    // m_poSrcLayer when the WHERE clause is served from the attribute indexes
+    // of m_apoTableLayers[0]. Declared after m_apoExtraDS, which may own the
+    // decorated layer.
+    std::unique_ptr<OGRLayer> m_poAttrIndexedSrcLayer{};
+
     OGRFeatureDefn *m_poDefn = nullptr;
 
     std::vector<int> m_anGeomFieldToSrcGeomField{};
@@ -69,12 +76,33 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nNextIndexFID = 0;
     mutable std::unique_ptr<OGRFeature> m_poSummaryFeature{};
 
+    // Result of a GROUP BY query, computed on first use
+    mutable std::vector<std::unique_ptr<OGRFeature>> m_apoGroupByFeatures{};
+    mutable bool m_bGroupByValid = false;
+
     int m_iFIDFieldIndex = 0;
 
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+  public:
+    struct JoinHashTable;
+    struct ExternalSort;
+
+  private:
+    // Hash tables of the secondary layers of JOINs, built on first use
+    std::vector<std::unique_ptr<JoinHashTable>> m_apoJoinHashTables{};
+    std::string m_osJoinKey{};
+
+    JoinHashTable *GetJoinHashTable(int iJoin);
+    void BuildJoinHashTable(int iJoin, JoinHashTable &oHashTable);
+
+    // Sorted runs of an ORDER BY that did not fit in memory
+    std::unique_ptr<ExternalSort> m_poExternalSort{};
+
     bool PrepareSummary() const;
+    bool PrepareGroupBy() const;
+    bool HasGeometryAggregate() const;
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
@@ -84,6 +112,18 @@ class OGRGenSQLResultsLayer final : public OGRLayer
                           size_t nStart, size_t nEntries);
     void FreeIndexFields(OGRField *pasIndexFields, size_t l_nIndexSize);
     int Compare(const OGRField *pasFirst, const OGRField *pasSecond);
+    bool IsStringOrderKey(int iKey) const;
+    size_t GetIndexFieldsMemoryUsage(const OGRField *pasIndexFields) const;
+    void CreateExternalOrderByIndex(GIntBig nMaxMemory);
+    bool WriteOrderByRun(const std::vector<OGRField> &asIndexFields,
+                         const std::vector<GIntBig> &anFIDList,
+                         const std::string &osRows,
+                         const std::vector<size_t> &anRowOffsets);
+    bool MergeOrderByRuns(size_t iFirstRun, size_t nRuns);
+    bool ReadOrderByRunRecord(size_t iRun);
+    bool RewindExternalSort();
+    bool AdvanceExternalSort();
+    std::unique_ptr<OGRFeature> FetchExternallySortedFeature();
 
     void ClearFilters();
     void ApplyFiltersToSource();
@@ -96,7 +136,7 @@ class OGRGenSQLResultsLayer final : public OGRLayer
 
     void InvalidateOrderByIndex();
 
-    int MustEvaluateSpatialFilterOnGenSQL();
+    int MustEvaluateSpatialFilterOnGenSQL() const;
 
     CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLResultsLayer)
 
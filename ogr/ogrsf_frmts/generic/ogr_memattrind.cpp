@@ -0,0 +1,605 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  In-memory implementation of attribute indexes, usable with any
+ *           layer.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "ogr_attrind.h"
+#include "cpl_conv.h"
+#include "cpl_error.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                         GetMemAttrIndexKey()                         */
+/*                                                                      */
+/*      Convert a field value to a key of the index.  Return false      */
+/*      for values that cannot match any comparison.                    */
+/************************************************************************/
+
+static bool GetMemAttrIndexKey(OGRFieldType eType, const OGRField *psField,
+                               GIntBig &nKey)
+{
+    nKey = eType == OFTInteger ? psField->Integer : psField->Integer64;
+    return true;
+}
+
+static bool GetMemAttrIndexKey(OGRFieldType, const OGRField *psField,
+                               double &dfKey)
+{
+    if (std::isnan(psField->Real))
+        return false;
+    // -0 and 0 compare equal, but must also hash equal.
+    dfKey = psField->Real == 0 ? 0.0 : psField->Real;
+    return true;
+}
+
+static bool GetMemAttrIndexKey(OGRFieldType, const OGRField *psField,
+                               std::string &osKey)
+{
+    if (psField->String == nullptr)
+        return false;
+    // OGR SQL compares strings in a case insensitive way, so index them
+    // folded to lower case, which also gives the ordering of strcasecmp().
+    osKey = psField->String;
+    for (char &ch : osKey)
+    {
+        if (ch >= 'A' && ch <= 'Z')
+            ch = static_cast<char>(ch - 'A' + 'a');
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           OGRMemAttrIndex                            */
+/*                                                                      */
+/*      Index of one field, as an ordered map for range requests and    */
+/*      a hash map for equality requests.                               */
+/************************************************************************/
+
+template <class Key> class OGRMemAttrIndex final : public OGRAttrIndex
+{
+    const OGRFieldType m_eType;
+
+    // Ordered index, used by range requests. The FIDs of each key are kept
+    // sorted.
+    std::map<Key, std::vector<GIntBig>> m_oMapKeyToFIDs{};
+
+    // Hash index on top of the ordered one, used by equality requests. Values
+    // point to the ones of m_oMapKeyToFIDs, whose nodes are stable.
+    std::unordered_map<Key, std::vector<GIntBig> *> m_oHashKeyToFIDs{};
+
+    // Key each FID is indexed with, so that features whose previous value
+    // is unknown can be removed.
+    std::unordered_map<GIntBig, Key> m_oMapFIDToKey{};
+
+    const std::vector<GIntBig> *Find(const OGRField *psKey) const;
+    void Remove(const Key &key, GIntBig nFID);
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRMemAttrIndex)
+
+  public:
+    explicit OGRMemAttrIndex(OGRFieldType eType) : m_eType(eType)
+    {
+    }
+
+    GIntBig GetFirstMatch(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey) override;
+    GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList,
+                           int *nFIDCount, int *nLength) override;
+    GIntBig *GetAllMatchesInRange(const OGRField *psMin, bool bMinIncluded,
+                                  const OGRField *psMax, bool bMaxIncluded,
+                                  GIntBig *pnFIDCount) override;
+
+    OGRErr AddEntry(OGRField *psKey, GIntBig nFID) override;
+    OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) override;
+
+    OGRErr Clear() override;
+};
+
+/************************************************************************/
+/*                                Find()                                */
+/************************************************************************/
+
+template <class Key>
+const std::vector<GIntBig> *
+OGRMemAttrIndex<Key>::Find(const OGRField *psKey) const
+{
+    Key key{};
+    if (psKey == nullptr || !GetMemAttrIndexKey(m_eType, psKey, key))
+        return nullptr;
+    const auto oIter = m_oHashKeyToFIDs.find(key);
+    return oIter == m_oHashKeyToFIDs.end() ? nullptr : oIter->second;
+}
+
+/************************************************************************/
+/*                           GetFirstMatch()                            */
+/************************************************************************/
+
+template <class Key>
+GIntBig OGRMemAttrIndex<Key>::GetFirstMatch(OGRField *psKey)
+{
+    const auto panFIDs = Find(psKey);
+    return panFIDs ? panFIDs->front() : OGRNullFID;
+}
+
+/************************************************************************/
+/*                           GetAllMatches()                            */
+/************************************************************************/
+
+template <class Key>
+GIntBig *OGRMemAttrIndex<Key>::GetAllMatches(OGRField *psKey,
+                                             GIntBig *panFIDList,
+                                             int *nFIDCount, int *nLength)
+{
+    if (panFIDList == nullptr)
+    {
+        panFIDList = static_cast<GIntBig *>(CPLMalloc(sizeof(GIntBig) * 2));
+        *nFIDCount = 0;
+        *nLength = 2;
+    }
+
+    const auto panFIDs = Find(psKey);
+    if (panFIDs)
+    {
+        const int nNeeded = *nFIDCount + static_cast<int>(panFIDs->size()) + 1;
+        if (nNeeded > *nLength)
+        {
+            *nLength = nNeeded;
+            panFIDList = static_cast<GIntBig *>(
+                CPLRealloc(panFIDList, sizeof(GIntBig) * (*nLength)));
+        }
+        std::copy(panFIDs->begin(), panFIDs->end(), panFIDList + *nFIDCount);
+        *nFIDCount += static_cast<int>(panFIDs->size());
+    }
+
+    panFIDList[*nFIDCount] = OGRNullFID;
+
+    return panFIDList;
+}
+
+template <class Key>
+GIntBig *OGRMemAttrIndex<Key>::GetAllMatches(OGRField *psKey)
+{
+    int nFIDCount = 0;
+    int nLength = 0;
+    return GetAllMatches(psKey, nullptr, &nFIDCount, &nLength);
+}
+
+/************************************************************************/
+/*                        GetAllMatchesInRange()                        */
+/************************************************************************/
+
+template <class Key>
+GIntBig *OGRMemAttrIndex<Key>::GetAllMatchesInRange(const OGRField *psMin,
+                                                    bool bMinIncluded,
+                                                    const OGRField *psMax,
+                                                    bool bMaxIncluded,
+                                                    GIntBig *pnFIDCount)
+{
+    Key minKey{};
+    Key maxKey{};
+    std::vector<GIntBig> anFIDs;
+    // Bounds that cannot be compared select nothing.
+    if ((psMin == nullptr || GetMemAttrIndexKey(m_eType, psMin, minKey)) &&
+        (psMax == nullptr || GetMemAttrIndexKey(m_eType, psMax, maxKey)))
+    {
+        auto oIter = psMin == nullptr ? m_oMapKeyToFIDs.begin()
+                     : bMinIncluded   ? m_oMapKeyToFIDs.lower_bound(minKey)
+                                      : m_oMapKeyToFIDs.upper_bound(minKey);
+        for (; oIter != m_oMapKeyToFIDs.end(); ++oIter)
+        {
+            if (psMax != nullptr && (bMaxIncluded ? maxKey < oIter->first
+                                                  : !(oIter->first < maxKey)))
+            {
+                break;
+            }
+            anFIDs.insert(anFIDs.end(), oIter->second.begin(),
+                          oIter->second.end());
+        }
+        std::sort(anFIDs.begin(), anFIDs.end());
+    }
+
+    GIntBig *panFIDList = static_cast<GIntBig *>(
+        VSI_MALLOC2_VERBOSE(anFIDs.size() + 1, sizeof(GIntBig)));
+    if (panFIDList == nullptr)
+        return nullptr;
+    std::copy(anFIDs.begin(), anFIDs.end(), panFIDList);
+    panFIDList[anFIDs.size()] = OGRNullFID;
+    *pnFIDCount = static_cast<GIntBig>(anFIDs.size());
+
+    return panFIDList;
+}
+
+/************************************************************************/
+/*                              AddEntry()                              */
+/*                                                                      */
+/*      A feature is indexed with a single key: adding it again with    */
+/*      another value replaces the previous one.                        */
+/************************************************************************/
+
+template <class Key>
+OGRErr OGRMemAttrIndex<Key>::AddEntry(OGRField *psKey, GIntBig nFID)
+{
+    Key key{};
+    if (psKey == nullptr || !GetMemAttrIndexKey(m_eType, psKey, key))
+        return RemoveEntry(nullptr, nFID);
+
+    const auto oIterFID = m_oMapFIDToKey.find(nFID);
+    if (oIterFID != m_oMapFIDToKey.end())
+    {
+        if (oIterFID->second == key)
+            return OGRERR_NONE;
+        Remove(oIterFID->second, nFID);
+        oIterFID->second = key;
+    }
+    else
+    {
+        m_oMapFIDToKey.emplace(nFID, key);
+    }
+
+    auto [oIter, bInserted] = m_oMapKeyToFIDs.try_emplace(key);
+    if (bInserted)
+        m_oHashKeyToFIDs[key] = &(oIter->second);
+
+    // Features are most often indexed by increasing FID.
+    auto &anFIDs = oIter->second;
+    if (anFIDs.empty() || anFIDs.back() < nFID)
+        anFIDs.push_back(nFID);
+    else
+        anFIDs.insert(std::lower_bound(anFIDs.begin(), anFIDs.end(), nFID),
+                      nFID);
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                               Remove()                               */
+/************************************************************************/
+
+template <class Key>
+void OGRMemAttrIndex<Key>::Remove(const Key &key, GIntBig nFID)
+{
+    const auto oIter = m_oMapKeyToFIDs.find(key);
+    if (oIter == m_oMapKeyToFIDs.end())
+        return;
+
+    auto &anFIDs = oIter->second;
+    const auto oIterFID = std::lower_bound(anFIDs.begin(), anFIDs.end(), nFID);
+    if (oIterFID != anFIDs.end() && *oIterFID == nFID)
+        anFIDs.erase(oIterFID);
+
+    if (anFIDs.empty())
+    {
+        m_oHashKeyToFIDs.erase(key);
+        m_oMapKeyToFIDs.erase(oIter);
+    }
+}
+
+/************************************************************************/
+/*                            RemoveEntry()                             */
+/*                                                                      */
+/*      The key each feature is indexed with is remembered, so psKey    */
+/*      may be NULL.                                                    */
+/************************************************************************/
+
+template <class Key>
+OGRErr OGRMemAttrIndex<Key>::RemoveEntry(OGRField *psKey, GIntBig nFID)
+{
+    const auto oIterFID = m_oMapFIDToKey.find(nFID);
+    if (oIterFID == m_oMapFIDToKey.end())
+        return OGRERR_NONE;
+
+    if (psKey != nullptr)
+    {
+        Key key{};
+        if (!GetMemAttrIndexKey(m_eType, psKey, key) ||
+            !(key == oIterFID->second))
+        {
+            return OGRERR_NONE;
+        }
+    }
+
+    Remove(oIterFID->second, nFID);
+    m_oMapFIDToKey.erase(oIterFID);
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                               Clear()                                */
+/************************************************************************/
+
+template <class Key> OGRErr OGRMemAttrIndex<Key>::Clear()
+{
+    m_oMapKeyToFIDs.clear();
+    m_oHashKeyToFIDs.clear();
+    m_oMapFIDToKey.clear();
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                         OGRMemLayerAttrIndex                         */
+/************************************************************************/
+
+class OGRMemLayerAttrIndex final : public OGRLayerAttrIndex
+{
+    struct FieldIndex
+    {
+        std::unique_ptr<OGRAttrIndex> poIndex{};
+        // Name and type of the field when the index was created, to detect
+        // schema changes after which the index can no longer be used.
+        std::string osFieldName{};
+        OGRFieldType eType = OFTString;
+    };
+
+    std::map<int, FieldIndex> m_oMapFieldIndexes{};
+
+    bool IsValid(int iField, const FieldIndex &oFieldIndex) const;
+
+  public:
+    OGRMemLayerAttrIndex() = default;
+
+    OGRErr Initialize(const char *pszIndexPath, OGRLayer *) override;
+
+    OGRErr CreateIndex(int iField) override;
+    OGRErr DropIndex(int iField) override;
+    OGRErr IndexAllFeatures(int iField = -1) override;
+
+    OGRErr AddToIndex(OGRFeature *poFeature, int iField = -1) override;
+    OGRErr RemoveFromIndex(OGRFeature *poFeature) override;
+
+    OGRAttrIndex *GetFieldIndex(int iField) override;
+};
+
+/************************************************************************/
+/*                             Initialize()                             */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::Initialize(const char * /* pszIndexPath */,
+                                        OGRLayer *poLayerIn)
+
+{
+    poLayer = poLayerIn;
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                              IsValid()                               */
+/************************************************************************/
+
+bool OGRMemLayerAttrIndex::IsValid(int iField,
+                                   const FieldIndex &oFieldIndex) const
+{
+    const OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    if (iField >= poDefn->GetFieldCount())
+        return false;
+    const OGRFieldDefn *poFldDefn = poDefn->GetFieldDefn(iField);
+    return poFldDefn->GetType() == oFieldIndex.eType &&
+           oFieldIndex.osFieldName == poFldDefn->GetNameRef();
+}
+
+/************************************************************************/
+/*                            CreateIndex()                             */
+/*                                                                      */
+/*      Create an index corresponding to the indicated field, but do    */
+/*      not populate it.  Use IndexAllFeatures() for that.              */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::CreateIndex(int iField)
+
+{
+    const OGRFeatureDefn *poDefn = poLayer->GetLayerDefn();
+    if (iField < 0 || iField >= poDefn->GetFieldCount())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid field index: %d.",
+                 iField);
+        return OGRERR_FAILURE;
+    }
+
+    const OGRFieldDefn *poFldDefn = poDefn->GetFieldDefn(iField);
+    const auto oIter = m_oMapFieldIndexes.find(iField);
+    if (oIter != m_oMapFieldIndexes.end() && IsValid(iField, oIter->second))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "It seems we already have an index for field %d/%s\n"
+                 "of layer %s.",
+                 iField, poFldDefn->GetNameRef(), poDefn->GetName());
+        return OGRERR_FAILURE;
+    }
+
+    std::unique_ptr<OGRAttrIndex> poIndex;
+    switch (poFldDefn->GetType())
+    {
+        case OFTInteger:
+        case OFTInteger64:
+            poIndex = std::make_unique<OGRMemAttrIndex<GIntBig>>(
+                poFldDefn->GetType());
+            break;
+
+        case OFTReal:
+            poIndex =
+                std::make_unique<OGRMemAttrIndex<double>>(poFldDefn->GetType());
+            break;
+
+        case OFTString:
+            poIndex = std::make_unique<OGRMemAttrIndex<std::string>>(
+                poFldDefn->GetType());
+            break;
+
+        default:
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Indexing not supported for the field type of field %s.",
+                     poFldDefn->GetNameRef());
+            return OGRERR_FAILURE;
+    }
+
+    FieldIndex &oFieldIndex = m_oMapFieldIndexes[iField];
+    oFieldIndex.poIndex = std::move(poIndex);
+    oFieldIndex.osFieldName = poFldDefn->GetNameRef();
+    oFieldIndex.eType = poFldDefn->GetType();
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             DropIndex()                              */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::DropIndex(int iField)
+
+{
+    const auto oIter = m_oMapFieldIndexes.find(iField);
+    if (oIter == m_oMapFieldIndexes.end())
+    {
+        const OGRFieldDefn *poFldDefn =
+            poLayer->GetLayerDefn()->GetFieldDefn(iField);
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "DROP INDEX on field (%s) that doesn't have an index.",
+                 poFldDefn ? poFldDefn->GetNameRef() : "(invalid)");
+        return OGRERR_FAILURE;
+    }
+
+    m_oMapFieldIndexes.erase(oIter);
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          IndexAllFeatures()                          */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::IndexAllFeatures(int iField)
+
+{
+    // Index all features, regardless of the filters currently installed.
+    const char *pszAttrQuery = poLayer->GetAttrQueryString();
+    const bool bHasAttrQuery = pszAttrQuery != nullptr;
+    const std::string osAttrQuery(bHasAttrQuery ? pszAttrQuery : "");
+    const OGRGeometry *poFilterGeom = poLayer->GetSpatialFilter();
+    const std::unique_ptr<OGRGeometry> poSpatialFilter(
+        poFilterGeom ? poFilterGeom->clone() : nullptr);
+    const int iGeomFieldFilter = poLayer->GetGeomFieldFilter();
+
+    if (bHasAttrQuery)
+        poLayer->SetAttributeFilter(nullptr);
+    if (poSpatialFilter)
+        poLayer->SetSpatialFilter(iGeomFieldFilter, nullptr);
+    poLayer->ResetReading();
+
+    OGRErr eErr = OGRERR_NONE;
+    for (auto &&poFeature : *poLayer)
+    {
+        eErr = AddToIndex(poFeature.get(), iField);
+        if (eErr != OGRERR_NONE)
+            break;
+    }
+
+    if (bHasAttrQuery)
+        poLayer->SetAttributeFilter(osAttrQuery.c_str());
+    if (poSpatialFilter)
+        poLayer->SetSpatialFilter(iGeomFieldFilter, poSpatialFilter.get());
+    poLayer->ResetReading();
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                             AddToIndex()                             */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::AddToIndex(OGRFeature *poFeature,
+                                        int iTargetField)
+
+{
+    const GIntBig nFID = poFeature->GetFID();
+    if (nFID == OGRNullFID)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Attempt to index feature with no FID.");
+        return OGRERR_FAILURE;
+    }
+
+    for (const auto &[iField, oFieldIndex] : m_oMapFieldIndexes)
+    {
+        if ((iTargetField != -1 && iTargetField != iField) ||
+            !IsValid(iField, oFieldIndex) ||
+            iField >= poFeature->GetFieldCount())
+        {
+            continue;
+        }
+
+        // Some drivers leave unset fields unchanged when rewriting a
+        // feature, so keep their entry, which is at worst a false positive.
+        if (!poFeature->IsFieldSet(iField))
+            continue;
+
+        // Null values never match a comparison.
+        const OGRErr eErr =
+            poFeature->IsFieldNull(iField)
+                ? oFieldIndex.poIndex->RemoveEntry(nullptr, nFID)
+                : oFieldIndex.poIndex->AddEntry(
+                      poFeature->GetRawFieldRef(iField), nFID);
+        if (eErr != OGRERR_NONE)
+            return eErr;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                          RemoveFromIndex()                           */
+/************************************************************************/
+
+OGRErr OGRMemLayerAttrIndex::RemoveFromIndex(OGRFeature *poFeature)
+
+{
+    for (const auto &oIter : m_oMapFieldIndexes)
+    {
+        const OGRErr eErr =
+            oIter.second.poIndex->RemoveEntry(nullptr, poFeature->GetFID());
+        if (eErr != OGRERR_NONE)
+            return eErr;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                           GetFieldIndex()                            */
+/************************************************************************/
+
+OGRAttrIndex *OGRMemLayerAttrIndex::GetFieldIndex(int iField)
+
+{
+    const auto oIter = m_oMapFieldIndexes.find(iField);
+    if (oIter == m_oMapFieldIndexes.end() || !IsValid(iField, oIter->second))
+        return nullptr;
+    return oIter->second.poIndex.get();
+}
+
+/************************************************************************/
+/*                     OGRCreateMemoryLayerIndex()                      */
+/************************************************************************/
+
+OGRLayerAttrIndex *OGRCreateMemoryLayerIndex()
+
+{
+    return new OGRMemLayerAttrIndex();
+}
+
+//! @endcond
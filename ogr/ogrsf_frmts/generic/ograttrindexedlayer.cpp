@@ -0,0 +1,204 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRAttrIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef DOXYGEN_SKIP
+
+#include "ograttrindexedlayer.h"
+
+#include "cpl_conv.h"
+
+/************************************************************************/
+/*                        OGRAttrIndexedLayer()                         */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param poDecoratedLayer Layer to decorate.
+ * @param bTakeOwnership Whether poDecoratedLayer must be destroyed with this
+ *                       layer.
+ */
+OGRAttrIndexedLayer::OGRAttrIndexedLayer(OGRLayer *poDecoratedLayer,
+                                         int bTakeOwnership)
+    : OGRLayerDecorator(poDecoratedLayer, bTakeOwnership)
+{
+}
+
+/************************************************************************/
+/*                          GetSpatialFilter()                          */
+/************************************************************************/
+
+OGRGeometry *OGRAttrIndexedLayer::GetSpatialFilter()
+{
+    return m_poFilterGeom;
+}
+
+/************************************************************************/
+/*                         ISetSpatialFilter()                          */
+/************************************************************************/
+
+OGRErr OGRAttrIndexedLayer::ISetSpatialFilter(int iGeomField,
+                                              const OGRGeometry *poGeom)
+{
+    // Installed locally too, for features fetched by FID.
+    m_iGeomFieldFilter = iGeomField;
+    InstallFilter(poGeom);
+    return m_poDecoratedLayer->SetSpatialFilter(iGeomField, poGeom);
+}
+
+/************************************************************************/
+/*                         SetAttributeFilter()                         */
+/************************************************************************/
+
+OGRErr OGRAttrIndexedLayer::SetAttributeFilter(const char *pszQuery)
+{
+    // Compile the filter for our own use when fetching features by FID
+    const OGRErr eErr = OGRLayer::SetAttributeFilter(pszQuery);
+    if (eErr != OGRERR_NONE)
+        return eErr;
+
+    m_bUseIndex = m_poAttrQuery != nullptr &&
+                  m_poDecoratedLayer->GetIndex() != nullptr &&
+                  m_poDecoratedLayer->TestCapability(OLCRandomRead) &&
+                  CollectCandidates();
+
+    // When the indexes are used, the decorated layer must return all
+    // features, and the filter is evaluated by GetNextFeature().
+    return m_poDecoratedLayer->SetAttributeFilter(m_bUseIndex ? nullptr
+                                                              : pszQuery);
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRAttrIndexedLayer::ResetReading()
+{
+    m_poDecoratedLayer->ResetReading();
+    // Query the indexes again, as they may have been updated since.
+    m_bCandidatesValid = false;
+    m_iNextCandidate = 0;
+}
+
+/************************************************************************/
+/*                         CollectCandidates()                          */
+/************************************************************************/
+
+/** Collect the FIDs of the features selected by the indexes, in increasing
+ * order. Returns false if the filter cannot be evaluated with them. */
+bool OGRAttrIndexedLayer::CollectCandidates()
+{
+    GIntBig *panFIDs =
+        m_poAttrQuery->EvaluateAgainstIndices(m_poDecoratedLayer, nullptr);
+    if (panFIDs == nullptr)
+        return false;
+
+    m_anCandidates.clear();
+    for (const GIntBig *panIter = panFIDs; *panIter != OGRNullFID; ++panIter)
+        m_anCandidates.push_back(*panIter);
+    CPLFree(panFIDs);
+
+    m_iNextCandidate = 0;
+    m_bCandidatesValid = true;
+
+    CPLDebug("OGR",
+             "%s: attribute filter evaluated with attribute indexes, "
+             "%d candidate feature(s)",
+             m_poDecoratedLayer->GetDescription(),
+             static_cast<int>(m_anCandidates.size()));
+    return true;
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRAttrIndexedLayer::GetNextFeature()
+{
+    if (!m_bUseIndex)
+        return OGRLayerDecorator::GetNextFeature();
+
+    if (!m_bCandidatesValid && !CollectCandidates())
+    {
+        // The indexes can no longer be used, for example after DROP INDEX
+        m_bUseIndex = false;
+        m_anCandidates.clear();
+        m_poDecoratedLayer->SetAttributeFilter(m_pszAttrQueryString);
+        m_poDecoratedLayer->ResetReading();
+        return OGRLayerDecorator::GetNextFeature();
+    }
+
+    while (m_iNextCandidate < m_anCandidates.size())
+    {
+        OGRFeatureUniquePtr poFeature(m_poDecoratedLayer->GetFeature(
+            m_anCandidates[m_iNextCandidate++]));
+        // GetFeature() ignores filters, and features may have been modified
+        // since they were indexed.
+        if (poFeature &&
+            FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter)) &&
+            m_poAttrQuery->Evaluate(poFeature.get()))
+        {
+            return poFeature.release();
+        }
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                           SetNextByIndex()                           */
+/************************************************************************/
+
+OGRErr OGRAttrIndexedLayer::SetNextByIndex(GIntBig nIndex)
+{
+    if (m_bUseIndex)
+        return OGRLayer::SetNextByIndex(nIndex);
+    return OGRLayerDecorator::SetNextByIndex(nIndex);
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRAttrIndexedLayer::GetFeatureCount(int bForce)
+{
+    if (m_bUseIndex)
+        return OGRLayer::GetFeatureCount(bForce);
+    return OGRLayerDecorator::GetFeatureCount(bForce);
+}
+
+/************************************************************************/
+/*                           TestCapability()                           */
+/************************************************************************/
+
+int OGRAttrIndexedLayer::TestCapability(const char *pszCapability) const
+{
+    if (m_bUseIndex && (EQUAL(pszCapability, OLCFastFeatureCount) ||
+                        EQUAL(pszCapability, OLCFastSetNextByIndex) ||
+                        EQUAL(pszCapability, OLCFastGetArrowStream)))
+    {
+        return FALSE;
+    }
+    return OGRLayerDecorator::TestCapability(pszCapability);
+}
+
+/************************************************************************/
+/*                           GetArrowStream()                           */
+/************************************************************************/
+
+bool OGRAttrIndexedLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                         CSLConstList papszOptions)
+{
+    // The decorated layer does not know about the attribute filter
+    if (m_bUseIndex)
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    return OGRLayerDecorator::GetArrowStream(out_stream, papszOptions);
+}
+
+#endif /* #ifndef DOXYGEN_SKIP */
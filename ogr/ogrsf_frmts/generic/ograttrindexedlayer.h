@@ -0,0 +1,70 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Defines OGRAttrIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGRATTRINDEXEDLAYER_H_INCLUDED
+#define OGRATTRINDEXEDLAYER_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrlayerdecorator.h"
+
+#include <vector>
+
+/************************************************************************/
+/*                         OGRAttrIndexedLayer                          */
+/************************************************************************/
+
+/** Layer decorator that serves attribute filters from the attribute indexes
+ * of the decorated layer (see OGRLayer::GetIndex()), for drivers that do not
+ * make use of them by themselves.
+ *
+ * This is the case of the in-memory indexes created with CREATE INDEX on
+ * layers without index support of their own. When the filter can be
+ * evaluated with the indexes, the selected features are fetched with
+ * GetFeature(), so this requires the OLCRandomRead capability. Filters are
+ * evaluated again on the fetched features, so that indexes that are not up
+ * to date cannot return features that do not match.
+ */
+class CPL_DLL OGRAttrIndexedLayer final : public OGRLayerDecorator
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRAttrIndexedLayer)
+
+    // Whether the current attribute filter is evaluated with the indexes
+    bool m_bUseIndex = false;
+    bool m_bCandidatesValid = false;
+    std::vector<GIntBig> m_anCandidates{};
+    size_t m_iNextCandidate = 0;
+
+    bool CollectCandidates();
+
+  public:
+    OGRAttrIndexedLayer(OGRLayer *poDecoratedLayer, int bTakeOwnership);
+
+    OGRGeometry *GetSpatialFilter() override;
+    virtual OGRErr ISetSpatialFilter(int iGeomField,
+                                     const OGRGeometry *) override;
+    OGRErr SetAttributeFilter(const char *) override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRErr SetNextByIndex(GIntBig nIndex) override;
+
+    GIntBig GetFeatureCount(int bForce = TRUE) override;
+
+    int TestCapability(const char *) const override;
+
+    virtual bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                                CSLConstList papszOptions = nullptr) override;
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif  //  OGRATTRINDEXEDLAYER_H_INCLUDED
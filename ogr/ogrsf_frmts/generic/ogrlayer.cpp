@@ -19,6 +19,7 @@
 #include "ograpispy.h"
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
+#include "memdataset.h"
 
 #include "cpl_time.h"
 #include <cassert>
@@ -1209,6 +1210,108 @@ OGRFeatureH OGR_L_GetNextFeature(OGRLayerH hLayer)
     return OGRFeature::ToHandle(OGRLayer::FromHandle(hLayer)->GetNextFeature());
 }
 
+/************************************************************************/
+/*                  OGRLayer::GetNextFeatureReusing()                   */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly reusing
+ an existing feature.
+
+ This method is similar to GetNextFeature(), except that the caller can
+ provide a feature it no longer needs, typically the one returned by the
+ previous call, which the layer may refill instead of allocating a new one.
+ This saves the allocation of the feature object, of its array of field
+ values and of its geometry buffers, in loops that only process one feature
+ at a time. The values of string, binary and list fields are still
+ allocated for each feature.
+
+ The provided feature must have been created with the feature definition
+ of the layer, and the layer definition must not have been modified since
+ then. Its content is lost in any case: it is either reused and returned,
+ or destroyed.
+
+ The default implementation destroys the provided feature and returns the
+ result of GetNextFeature(). Drivers may override it to reuse the feature.
+
+ Typical usage is:
+ \code{.cpp}
+ std::unique_ptr<OGRFeature> poFeature;
+ while ((poFeature = poLayer->GetNextFeatureReusing(std::move(poFeature))))
+ {
+     // do something with poFeature
+ }
+ \endcode
+
+ This method is the same as the C function OGR_L_GetNextFeatureReusing().
+
+ @param poFeature feature to reuse, or nullptr.
+ @return a feature, or nullptr if no more features are available.
+
+ @since GDAL 3.13
+*/
+
+std::unique_ptr<OGRFeature>
+OGRLayer::GetNextFeatureReusing(std::unique_ptr<OGRFeature> poFeature)
+{
+    poFeature.reset();
+    return std::unique_ptr<OGRFeature>(GetNextFeature());
+}
+
+/************************************************************************/
+/*                    OGR_L_GetNextFeatureReusing()                     */
+/************************************************************************/
+
+/**
+ \brief Fetch the next available feature from this layer, possibly reusing
+ an existing feature.
+
+ This function is similar to OGR_L_GetNextFeature(), except that the caller
+ can provide a feature it no longer needs, typically the one returned by the
+ previous call, which the layer may refill instead of allocating a new one.
+
+ The ownership of hFeat is transferred to the function: it must not be used
+ nor destroyed by the caller afterwards, except through the returned handle.
+ The returned feature becomes the responsibility of the caller to delete
+ with OGR_F_Destroy(), or to pass again to this function.
+
+ Typical usage is:
+ \code{.c}
+ OGRFeatureH hFeat = NULL;
+ while ((hFeat = OGR_L_GetNextFeatureReusing(hLayer, hFeat)) != NULL)
+ {
+     // do something with hFeat
+ }
+ \endcode
+
+ This function is the same as the C++ method
+ OGRLayer::GetNextFeatureReusing().
+
+ @param hLayer handle to the layer from which feature are read.
+ @param hFeat handle to a feature to reuse, created from the layer definition,
+ or NULL.
+ @return a handle to a feature, or NULL if no more features are available.
+
+ @since GDAL 3.13
+*/
+
+OGRFeatureH OGR_L_GetNextFeatureReusing(OGRLayerH hLayer, OGRFeatureH hFeat)
+
+{
+    VALIDATE_POINTER1(hLayer, "OGR_L_GetNextFeatureReusing", nullptr);
+
+#ifdef OGRAPISPY_ENABLED
+    if (bOGRAPISpyEnabled)
+        OGRAPISpy_L_GetNextFeature(hLayer);
+#endif
+
+    return OGRFeature::ToHandle(
+        OGRLayer::FromHandle(hLayer)
+            ->GetNextFeatureReusing(
+                std::unique_ptr<OGRFeature>(OGRFeature::FromHandle(hFeat)))
+            .release());
+}
+
 /************************************************************************/
 /*                      ConvertGeomsIfNecessary()                       */
 /************************************************************************/
@@ -1250,6 +1353,21 @@ void OGRLayer::ConvertGeomsIfNecessary(OGRFeature *poFeature)
         const int nGeomFieldCount = poFeatureDefn->GetGeomFieldCount();
         for (int i = 0; i < nGeomFieldCount; i++)
         {
+            // Avoid decoding a geometry still in its WKB form when its type
+            // shows that no conversion is needed.
+            size_t nWKBSize = 0;
+            const GByte *pabyWKB = poFeature->GetGeomFieldWKB(i, nWKBSize);
+            OGRwkbGeometryType eWKBType = wkbUnknown;
+            if (pabyWKB && !m_poPrivate->m_bApplyGeomSetPrecision &&
+                OGRReadWKBGeometryType(pabyWKB, wkbVariantIso, &eWKBType) ==
+                    OGRERR_NONE &&
+                (m_poPrivate->m_bSupportsM || !OGR_GT_HasM(eWKBType)) &&
+                (m_poPrivate->m_bSupportsCurve ||
+                 !OGR_GT_IsNonLinear(eWKBType)))
+            {
+                continue;
+            }
+
             OGRGeometry *poGeom = poFeature->GetGeomFieldRef(i);
             if (poGeom)
             {
@@ -1342,7 +1460,10 @@ OGRErr OGRLayer::SetFeature(OGRFeature *poFeature)
 
 {
     ConvertGeomsIfNecessary(poFeature);
-    return ISetFeature(poFeature);
+    const OGRErr eErr = ISetFeature(poFeature);
+    if (eErr == OGRERR_NONE)
+        UpdateMemoryAttrIndex(poFeature);
+    return eErr;
 }
 
 /************************************************************************/
@@ -1475,6 +1596,14 @@ OGRErr OGRLayer::SetFeature(std::unique_ptr<OGRFeature> poFeature)
 
 {
     ConvertGeomsIfNecessary(poFeature.get());
+    if (m_poPrivate->m_bAttrIndexInMemory)
+    {
+        // The feature is needed after the write to update the index.
+        const OGRErr eErr = ISetFeature(poFeature.get());
+        if (eErr == OGRERR_NONE)
+            UpdateMemoryAttrIndex(poFeature.get());
+        return eErr;
+    }
     return ISetFeatureUniqPtr(std::move(poFeature));
 }
 
@@ -1540,7 +1669,10 @@ OGRErr OGRLayer::CreateFeature(OGRFeature *poFeature)
 
 {
     ConvertGeomsIfNecessary(poFeature);
-    return ICreateFeature(poFeature);
+    const OGRErr eErr = ICreateFeature(poFeature);
+    if (eErr == OGRERR_NONE)
+        UpdateMemoryAttrIndex(poFeature);
+    return eErr;
 }
 
 /************************************************************************/
@@ -1646,6 +1778,16 @@ OGRErr OGRLayer::CreateFeature(std::unique_ptr<OGRFeature> poFeature,
 
 {
     ConvertGeomsIfNecessary(poFeature.get());
+    if (m_poPrivate->m_bAttrIndexInMemory)
+    {
+        // The feature is needed after the write to update the index.
+        const OGRErr eErr = ICreateFeature(poFeature.get());
+        if (pnFID)
+            *pnFID = poFeature->GetFID();
+        if (eErr == OGRERR_NONE)
+            UpdateMemoryAttrIndex(poFeature.get());
+        return eErr;
+    }
     return ICreateFeatureUniqPtr(std::move(poFeature), pnFID);
 }
 
@@ -1715,7 +1857,10 @@ OGRErr OGRLayer::UpsertFeature(OGRFeature *poFeature)
 
 {
     ConvertGeomsIfNecessary(poFeature);
-    return IUpsertFeature(poFeature);
+    const OGRErr eErr = IUpsertFeature(poFeature);
+    if (eErr == OGRERR_NONE)
+        UpdateMemoryAttrIndex(poFeature);
+    return eErr;
 }
 
 /************************************************************************/
@@ -1884,9 +2029,16 @@ OGRErr OGRLayer::UpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
             return OGRERR_FAILURE;
         }
     }
-    return IUpdateFeature(poFeature, nUpdatedFieldsCount, panUpdatedFieldsIdx,
-                          nUpdatedGeomFieldsCount, panUpdatedGeomFieldsIdx,
-                          bUpdateStyleString);
+    const OGRErr eErr =
+        IUpdateFeature(poFeature, nUpdatedFieldsCount, panUpdatedFieldsIdx,
+                       nUpdatedGeomFieldsCount, panUpdatedGeomFieldsIdx,
+                       bUpdateStyleString);
+    if (eErr == OGRERR_NONE)
+    {
+        for (int i = 0; i < nUpdatedFieldsCount; ++i)
+            UpdateMemoryAttrIndex(poFeature, panUpdatedFieldsIdx[i]);
+    }
+    return eErr;
 }
 
 /************************************************************************/
@@ -4396,20 +4548,54 @@ void OGR_L_ResetReading(OGRLayerH hLayer)
 /*      This is only intended to be called by driver layer              */
 /*      implementations but we don't make it protected so that the      */
 /*      datasources can do it too if that is more appropriate.          */
+/*                                                                      */
+/*      A NULL filename installs in-memory indexes, which can be used   */
+/*      with layers whose content cannot be modified other than through */
+/*      the OGRLayer methods that keep them in sync.                    */
 /************************************************************************/
 
 //! @cond Doxygen_Suppress
-OGRErr
-OGRLayer::InitializeIndexSupport([[maybe_unused]] const char *pszFilename)
+
+// In-memory layers are only modified through the OGRLayer API. Other
+// layers may be modified by driver specific paths (WriteArrowBatch()
+// overrides, SQL statements, ...) that bypass the in-memory indexes, which
+// would then miss entries, so they must not be writable.
+static bool CanUseMemoryAttrIndex(const OGRLayer *poLayer)
+{
+    if (dynamic_cast<const OGRMemLayer *>(poLayer) != nullptr)
+        return true;
+    for (const char *pszCap :
+         {OLCSequentialWrite, OLCRandomWrite, OLCDeleteFeature,
+          OLCUpsertFeature, OLCUpdateFeature, OLCFastWriteArrowBatch})
+    {
+        if (poLayer->TestCapability(pszCap))
+            return false;
+    }
+    return true;
+}
+
+OGRErr OGRLayer::InitializeIndexSupport(const char *pszFilename)
 
 {
-#ifdef HAVE_MITAB
     OGRErr eErr;
 
     if (m_poAttrIndex != nullptr)
         return OGRERR_NONE;
 
-    m_poAttrIndex = OGRCreateDefaultLayerIndex();
+    if (pszFilename == nullptr)
+    {
+        if (!CanUseMemoryAttrIndex(this))
+            return OGRERR_FAILURE;
+        m_poAttrIndex = OGRCreateMemoryLayerIndex();
+    }
+    else
+    {
+#ifdef HAVE_MITAB
+        m_poAttrIndex = OGRCreateDefaultLayerIndex();
+#else
+        return OGRERR_FAILURE;
+#endif
+    }
 
     eErr = m_poAttrIndex->Initialize(pszFilename, this);
     if (eErr != OGRERR_NONE)
@@ -4417,11 +4603,42 @@ OGRLayer::InitializeIndexSupport([[maybe_unused]] const char *pszFilename)
         delete m_poAttrIndex;
         m_poAttrIndex = nullptr;
     }
+    else
+    {
+        m_poPrivate->m_bAttrIndexInMemory = pszFilename == nullptr;
+    }
 
     return eErr;
-#else
-    return OGRERR_FAILURE;
-#endif
+}
+
+/************************************************************************/
+/*                       UpdateMemoryAttrIndex()                        */
+/*                                                                      */
+/*      Keep in-memory attribute indexes in sync with the features      */
+/*      written through the layer.  Other indexes are maintained, or    */
+/*      not, by the drivers themselves.                                 */
+/************************************************************************/
+
+void OGRLayer::UpdateMemoryAttrIndex(OGRFeature *poFeature, int iField)
+
+{
+    if (m_poAttrIndex != nullptr && m_poPrivate->m_bAttrIndexInMemory &&
+        poFeature->GetFID() != OGRNullFID)
+    {
+        // Index the values as stored by the layer, which may differ from
+        // the ones of the written feature (field type conversions, ...)
+        const std::unique_ptr<OGRFeature> poStoredFeature(
+            GetFeature(poFeature->GetFID()));
+        if (poStoredFeature)
+        {
+            CPL_IGNORE_RET_VAL(
+                m_poAttrIndex->AddToIndex(poStoredFeature.get(), iField));
+        }
+        else
+        {
+            CPL_IGNORE_RET_VAL(m_poAttrIndex->RemoveFromIndex(poFeature));
+        }
+    }
 }
 
 //! @endcond
@@ -8140,7 +8357,13 @@ OGRFeatureUniquePtr &OGRLayer::FeatureIterator::operator*()
 
 OGRLayer::FeatureIterator &OGRLayer::FeatureIterator::operator++()
 {
-    m_poPrivate->m_poFeature.reset(m_poPrivate->m_poLayer->GetNextFeature());
+    // Give the current feature back to the layer, unless the caller has taken
+    // ownership of it.
+    m_poPrivate->m_poFeature.reset(
+        m_poPrivate->m_poLayer
+            ->GetNextFeatureReusing(std::unique_ptr<OGRFeature>(
+                m_poPrivate->m_poFeature.release()))
+            .release());
     m_poPrivate->m_bEOF = m_poPrivate->m_poFeature == nullptr;
     return *this;
 }
@@ -40,6 +40,10 @@ struct OGRLayer::Private
 
     //! Whether OGRGeometry::SetPrecision() should be applied. Only valid after ConvertGeomsIfNecessary() has been called.
     bool m_bApplyGeomSetPrecision = false;
+
+    //! Whether m_poAttrIndex is an in-memory index, which must be kept in
+    //! sync with feature writes.
+    bool m_bAttrIndexInMemory = false;
 };
 
 //! @endcond
@@ -5178,6 +5178,773 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                          OGRArrowFilterPlan                          */
+/************************************************************************/
+
+namespace
+{
+
+/** Columnar evaluation of an attribute filter over an Arrow record batch.
+ *
+ * The swq_expr_node tree is compiled into a tree of operations that each
+ * process a whole column, and produce one byte per row for the value and
+ * the null state of the sub-expression. This avoids materializing a
+ * OGRFeature and evaluating the expression for each row. NULL handling
+ * mimics SWQGeneralEvaluator(), including for AND, OR and NOT.
+ *
+ * Only comparisons, IN, BETWEEN and IS NULL between a top-level numeric or
+ * string column and constants, and their combinations with AND, OR and NOT,
+ * are supported. Compile() returns false for anything else, in which case
+ * the filter must be evaluated feature by feature.
+ */
+class OGRArrowFilterPlan
+{
+    struct Column
+    {
+        const struct ArrowArray *psArray = nullptr;
+        // Arrow format letter, or 'v' for string view
+        char chFormat = 0;
+        swq_field_type eType = SWQ_INTEGER64;
+        bool bFID = false;
+    };
+
+    enum class Kind
+    {
+        AND,
+        OR,
+        NOT,
+        COMPARE,
+        IN,
+        BETWEEN,
+        IS_NULL,
+        BOOLEAN_COLUMN,
+    };
+
+    struct Node
+    {
+        Kind eKind = Kind::COMPARE;
+        swq_op eOp = SWQ_EQ;
+        int iColumn = -1;
+        bool bAsDouble = false;
+        std::vector<GIntBig> anValues{};
+        std::vector<double> adfValues{};
+        std::vector<std::string> aosValues{};
+        std::vector<Node> aoChildren{};
+    };
+
+    const OGRFeatureDefn *m_poFeatureDefn;
+    const struct ArrowArray *m_array;
+    const std::map<std::string, std::vector<int>> &m_oMapFieldNameToArrowPath;
+    const GIntBig m_nBaseSeqFID;
+    const std::vector<int> &m_anArrowPathToFIDColumn;
+    const struct ArrowSchema *m_schema;
+    const size_t m_nLength;
+
+    std::vector<Column> m_aoColumns{};
+    std::map<int, int> m_oMapFieldIndexToColumn{};
+    Node m_oRoot{};
+
+    int GetColumn(const swq_expr_node *poNode);
+    bool CompileConstants(const swq_expr_node *const *papoConstants,
+                          int nConstants, swq_op eOp, Node &oNode) const;
+    bool CompileNode(const swq_expr_node *poNode, Node &oNode);
+
+    void FillNull(const Column &oColumn, uint8_t *pabyNull) const;
+    template <class Func>
+    void VisitNumericColumn(const Column &oColumn, Func &&func) const;
+    void EvaluateStringColumn(const Node &oNode, const Column &oColumn,
+                              uint8_t *pabyValue) const;
+    void EvaluateNode(const Node &oNode, std::vector<uint8_t> &abyValue,
+                      std::vector<uint8_t> &abyNull) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRArrowFilterPlan)
+
+  public:
+    OGRArrowFilterPlan(
+        const OGRFeatureDefn *poFeatureDefn, const struct ArrowSchema *schema,
+        const struct ArrowArray *array,
+        const std::map<std::string, std::vector<int>> &oMapFieldNameToArrowPath,
+        GIntBig nBaseSeqFID, const std::vector<int> &anArrowPathToFIDColumn)
+        : m_poFeatureDefn(poFeatureDefn), m_array(array),
+          m_oMapFieldNameToArrowPath(oMapFieldNameToArrowPath),
+          m_nBaseSeqFID(nBaseSeqFID),
+          m_anArrowPathToFIDColumn(anArrowPathToFIDColumn), m_schema(schema),
+          m_nLength(static_cast<size_t>(array->length))
+    {
+    }
+
+    bool Compile(const swq_expr_node *poExpr)
+    {
+        return CompileNode(poExpr, m_oRoot);
+    }
+
+    size_t Evaluate(std::vector<bool> &abyValidityFromFilters) const;
+};
+
+/************************************************************************/
+/*                             GetColumn()                              */
+/************************************************************************/
+
+/** Return the index in m_aoColumns of the column referenced by a SNT_COLUMN
+ * node, or -1 if it cannot be processed in a columnar way. */
+int OGRArrowFilterPlan::GetColumn(const swq_expr_node *poNode)
+{
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    int iField = poNode->field_index;
+    // Same as OGRFeatureFetcherFixFieldIndex()
+    if (iField == nFieldCount + SPECIAL_FIELD_COUNT +
+                      m_poFeatureDefn->GetGeomFieldCount())
+    {
+        iField = nFieldCount + SPF_FID;
+    }
+
+    const auto oIter = m_oMapFieldIndexToColumn.find(iField);
+    if (oIter != m_oMapFieldIndexToColumn.end())
+        return oIter->second;
+
+    Column oColumn;
+    const struct ArrowSchema *psSchemaField = nullptr;
+    if (iField == nFieldCount + SPF_FID)
+    {
+        oColumn.bFID = true;
+        oColumn.eType = SWQ_INTEGER64;
+        if (m_nBaseSeqFID < 0)
+        {
+            if (m_anArrowPathToFIDColumn.size() != 1)
+                return -1;
+            psSchemaField = m_schema->children[m_anArrowPathToFIDColumn[0]];
+            oColumn.psArray = m_array->children[m_anArrowPathToFIDColumn[0]];
+            if (psSchemaField->dictionary ||
+                (!IsInt32(psSchemaField->format) &&
+                 !IsInt64(psSchemaField->format)))
+            {
+                return -1;
+            }
+        }
+    }
+    else if (iField >= 0 && iField < nFieldCount)
+    {
+        const auto poFieldDefn = m_poFeatureDefn->GetFieldDefn(iField);
+        const auto oIterPath =
+            m_oMapFieldNameToArrowPath.find(poFieldDefn->GetNameRef());
+        if (oIterPath == m_oMapFieldNameToArrowPath.end() ||
+            oIterPath->second.size() != 1)
+        {
+            return -1;
+        }
+        psSchemaField = m_schema->children[oIterPath->second[0]];
+        oColumn.psArray = m_array->children[oIterPath->second[0]];
+        if (psSchemaField->dictionary)
+            return -1;
+        const char *format = psSchemaField->format;
+
+        // Only accept the combinations of OGR and Arrow types for which
+        // the value fetched by OGRFeatureFetcher() is the Arrow value.
+        const bool bSmallInt = IsBoolean(format) || IsInt8(format) ||
+                               IsUInt8(format) || IsInt16(format) ||
+                               IsUInt16(format) || IsInt32(format);
+        const auto eOGRType = poFieldDefn->GetType();
+        if ((poNode->field_type == SWQ_INTEGER ||
+             poNode->field_type == SWQ_BOOLEAN) &&
+            eOGRType == OFTInteger && bSmallInt)
+        {
+            oColumn.eType = SWQ_INTEGER64;
+        }
+        else if (poNode->field_type == SWQ_INTEGER64 &&
+                 eOGRType == OFTInteger64 &&
+                 (bSmallInt || IsUInt32(format) || IsInt64(format)))
+        {
+            oColumn.eType = SWQ_INTEGER64;
+        }
+        else if (poNode->field_type == SWQ_FLOAT && eOGRType == OFTReal &&
+                 (IsFloat32(format) || IsFloat64(format)))
+        {
+            oColumn.eType = SWQ_FLOAT;
+        }
+        else if (poNode->field_type == SWQ_STRING && eOGRType == OFTString &&
+                 (IsString(format) || IsLargeString(format) ||
+                  IsStringView(format)))
+        {
+            oColumn.eType = SWQ_STRING;
+        }
+        else
+        {
+            return -1;
+        }
+    }
+    else
+    {
+        return -1;
+    }
+
+    if (psSchemaField)
+    {
+        const char *format = psSchemaField->format;
+        oColumn.chFormat = IsStringView(format) ? 'v' : format[0];
+    }
+
+    const int iColumn = static_cast<int>(m_aoColumns.size());
+    m_aoColumns.push_back(oColumn);
+    m_oMapFieldIndexToColumn[iField] = iColumn;
+    return iColumn;
+}
+
+/************************************************************************/
+/*                          CompileConstants()                          */
+/************************************************************************/
+
+/** Collect the operands compared to the column of oNode (by the eOp
+ * operation) into its values. */
+bool OGRArrowFilterPlan::CompileConstants(
+    const swq_expr_node *const *papoConstants, int nConstants, swq_op eOp,
+    Node &oNode) const
+{
+    const auto eColumnType = m_aoColumns[oNode.iColumn].eType;
+    bool bHasInteger = false;
+    bool bHasFloat = false;
+    for (int i = 0; i < nConstants; ++i)
+    {
+        const auto poSubExpr = papoConstants[i];
+        if (poSubExpr->eNodeType != SNT_CONSTANT || poSubExpr->is_null)
+            return false;
+        if (eColumnType == SWQ_STRING)
+        {
+            if (poSubExpr->field_type != SWQ_STRING ||
+                poSubExpr->string_value == nullptr)
+            {
+                return false;
+            }
+            const std::string osValue(poSubExpr->string_value);
+            // SWQGeneralEvaluator() has special rules for timestamp-like
+            // strings in equality comparisons.
+            if (eOp == SWQ_EQ && osValue.size() > 3 &&
+                (osValue[osValue.size() - 3] == ':' ||
+                 osValue.compare(osValue.size() - 3, 3, "+00") == 0))
+            {
+                return false;
+            }
+            oNode.aosValues.push_back(osValue);
+        }
+        else if (SWQ_IS_INTEGER(poSubExpr->field_type) ||
+                 poSubExpr->field_type == SWQ_BOOLEAN)
+        {
+            bHasInteger = true;
+            oNode.anValues.push_back(poSubExpr->int_value);
+            oNode.adfValues.push_back(
+                static_cast<double>(poSubExpr->int_value));
+        }
+        else if (poSubExpr->field_type == SWQ_FLOAT)
+        {
+            bHasFloat = true;
+            oNode.adfValues.push_back(poSubExpr->float_value);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    oNode.bAsDouble = eColumnType == SWQ_FLOAT || bHasFloat;
+    // SWQGeneralEvaluator() only looks at the type of the first two
+    // operands to decide between integer and floating-point comparisons,
+    // and only converts those to floating-point, so do not try to reproduce
+    // its behavior in other cases.
+    if ((bHasInteger && bHasFloat) ||
+        (oNode.bAsDouble && bHasInteger && nConstants > 1))
+    {
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                            CompileNode()                             */
+/************************************************************************/
+
+bool OGRArrowFilterPlan::CompileNode(const swq_expr_node *poNode, Node &oNode)
+{
+    if (poNode->eNodeType == SNT_COLUMN)
+    {
+        // A boolean field used as a predicate
+        if (poNode->field_type != SWQ_BOOLEAN)
+            return false;
+        oNode.eKind = Kind::BOOLEAN_COLUMN;
+        oNode.iColumn = GetColumn(poNode);
+        return oNode.iColumn >= 0;
+    }
+    if (poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    const auto eOp = poNode->nOperation;
+    if (eOp == SWQ_AND || eOp == SWQ_OR || eOp == SWQ_NOT)
+    {
+        if (poNode->nSubExprCount != (eOp == SWQ_NOT ? 1 : 2))
+            return false;
+        oNode.eKind = eOp == SWQ_AND  ? Kind::AND
+                      : eOp == SWQ_OR ? Kind::OR
+                                      : Kind::NOT;
+        oNode.aoChildren.resize(poNode->nSubExprCount);
+        for (int i = 0; i < poNode->nSubExprCount; ++i)
+        {
+            if (!CompileNode(poNode->papoSubExpr[i], oNode.aoChildren[i]))
+                return false;
+        }
+        return true;
+    }
+
+    if (eOp == SWQ_ISNULL)
+    {
+        if (poNode->nSubExprCount != 1 ||
+            poNode->papoSubExpr[0]->eNodeType != SNT_COLUMN)
+        {
+            return false;
+        }
+        oNode.eKind = Kind::IS_NULL;
+        oNode.iColumn = GetColumn(poNode->papoSubExpr[0]);
+        return oNode.iColumn >= 0;
+    }
+
+    if (eOp == SWQ_IN || eOp == SWQ_BETWEEN)
+    {
+        if (poNode->nSubExprCount < 2 ||
+            (eOp == SWQ_BETWEEN && poNode->nSubExprCount != 3) ||
+            poNode->papoSubExpr[0]->eNodeType != SNT_COLUMN)
+        {
+            return false;
+        }
+        oNode.eKind = eOp == SWQ_IN ? Kind::IN : Kind::BETWEEN;
+        oNode.iColumn = GetColumn(poNode->papoSubExpr[0]);
+        return oNode.iColumn >= 0 &&
+               CompileConstants(poNode->papoSubExpr + 1,
+                                poNode->nSubExprCount - 1, eOp, oNode);
+    }
+
+    if (eOp == SWQ_EQ || eOp == SWQ_NE || eOp == SWQ_LT || eOp == SWQ_LE ||
+        eOp == SWQ_GT || eOp == SWQ_GE)
+    {
+        if (poNode->nSubExprCount != 2)
+            return false;
+        oNode.eKind = Kind::COMPARE;
+        oNode.eOp = eOp;
+        int iColumnExpr = 0;
+        if (poNode->papoSubExpr[0]->eNodeType != SNT_COLUMN)
+        {
+            // "constant op column": evaluate as "column swapped_op constant"
+            iColumnExpr = 1;
+            oNode.eOp = eOp == SWQ_LT   ? SWQ_GT
+                        : eOp == SWQ_LE ? SWQ_GE
+                        : eOp == SWQ_GT ? SWQ_LT
+                        : eOp == SWQ_GE ? SWQ_LE
+                                        : eOp;
+        }
+        const auto poColumnExpr = poNode->papoSubExpr[iColumnExpr];
+        const auto poConstantExpr = poNode->papoSubExpr[1 - iColumnExpr];
+        if (poColumnExpr->eNodeType != SNT_COLUMN ||
+            poConstantExpr->eNodeType != SNT_CONSTANT)
+        {
+            return false;
+        }
+        oNode.iColumn = GetColumn(poColumnExpr);
+        return oNode.iColumn >= 0 &&
+               CompileConstants(&poConstantExpr, 1, eOp, oNode);
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                              FillNull()                              */
+/************************************************************************/
+
+void OGRArrowFilterPlan::FillNull(const Column &oColumn,
+                                  uint8_t *pabyNull) const
+{
+    if (oColumn.psArray == nullptr)
+    {
+        // Sequential FID
+        memset(pabyNull, 0, m_nLength);
+        return;
+    }
+    const struct ArrowArray *psArray = oColumn.psArray;
+    const uint8_t *pabyValidity =
+        psArray->null_count == 0
+            ? nullptr
+            : static_cast<const uint8_t *>(psArray->buffers[0]);
+    if (!pabyValidity)
+    {
+        memset(pabyNull, 0, m_nLength);
+    }
+    else
+    {
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+            pabyNull[iRow] = !TestBit(pabyValidity, nOffset + iRow);
+    }
+    if (oColumn.bFID)
+    {
+        // OGRFeature::IsFieldSetAndNotNull() on the FID special field
+        // checks against OGRNullFID.
+        VisitNumericColumn(oColumn,
+                           [this, pabyNull](const auto *panValues)
+                           {
+                               for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+                               {
+                                   pabyNull[iRow] |=
+                                       static_cast<int64_t>(panValues[iRow]) ==
+                                       OGRNullFID;
+                               }
+                           });
+    }
+}
+
+/************************************************************************/
+/*                         VisitNumericColumn()                         */
+/************************************************************************/
+
+/** Call func with a pointer to the first value of the column for the
+ * batch. */
+template <class Func>
+void OGRArrowFilterPlan::VisitNumericColumn(const Column &oColumn,
+                                            Func &&func) const
+{
+    if (oColumn.psArray == nullptr)
+    {
+        // Sequential FID
+        std::vector<int64_t> anFIDs(m_nLength);
+        for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+            anFIDs[iRow] = m_nBaseSeqFID + static_cast<int64_t>(iRow);
+        func(anFIDs.data());
+        return;
+    }
+
+    const struct ArrowArray *psArray = oColumn.psArray;
+    const size_t nOffset = static_cast<size_t>(psArray->offset);
+    const void *pData = psArray->buffers[1];
+    switch (oColumn.chFormat)
+    {
+        case ARROW_LETTER_BOOLEAN:
+        {
+            std::vector<uint8_t> abyValues(m_nLength);
+            const auto pabyData = static_cast<const uint8_t *>(pData);
+            for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+                abyValues[iRow] = TestBit(pabyData, nOffset + iRow);
+            func(abyValues.data());
+            break;
+        }
+        case ARROW_LETTER_INT8:
+            func(static_cast<const int8_t *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_UINT8:
+            func(static_cast<const uint8_t *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_INT16:
+            func(static_cast<const int16_t *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_UINT16:
+            func(static_cast<const uint16_t *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_INT32:
+            func(static_cast<const int32_t *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_UINT32:
+            func(static_cast<const uint32_t *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_INT64:
+            func(static_cast<const int64_t *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_FLOAT32:
+            func(static_cast<const float *>(pData) + nOffset);
+            break;
+        case ARROW_LETTER_FLOAT64:
+            func(static_cast<const double *>(pData) + nOffset);
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                       EvaluateNumericValues()                        */
+/************************************************************************/
+
+/** Evaluate a COMPARE, IN or BETWEEN node over nLength values, without
+ * taking into account nulls. */
+template <class T, class V>
+static void EvaluateNumericValues(const T *CPL_RESTRICT panValues,
+                                  size_t nLength, bool bIn, bool bBetween,
+                                  swq_op eOp, const std::vector<V> &aValues,
+                                  uint8_t *CPL_RESTRICT pabyValue)
+{
+    if (bIn)
+    {
+        memset(pabyValue, 0, nLength);
+        for (const V value : aValues)
+        {
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] |= static_cast<V>(panValues[i]) == value;
+        }
+        return;
+    }
+
+    if (bBetween)
+    {
+        const V lower = aValues[0];
+        const V upper = aValues[1];
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            const V v = static_cast<V>(panValues[i]);
+            pabyValue[i] = (v >= lower) & (v <= upper);
+        }
+        return;
+    }
+
+    const V value = aValues[0];
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<V>(panValues[i]) == value;
+            break;
+        case SWQ_NE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<V>(panValues[i]) != value;
+            break;
+        case SWQ_LT:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<V>(panValues[i]) < value;
+            break;
+        case SWQ_LE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<V>(panValues[i]) <= value;
+            break;
+        case SWQ_GT:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<V>(panValues[i]) > value;
+            break;
+        case SWQ_GE:
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = static_cast<V>(panValues[i]) >= value;
+            break;
+        default:
+            CPLAssert(false);
+            break;
+    }
+}
+
+/************************************************************************/
+/*                       CompareCaseInsensitive()                       */
+/************************************************************************/
+
+/** Same as strcasecmp(), on a string view that is not NUL-terminated. */
+static int CompareCaseInsensitive(std::string_view sv, const std::string &s)
+{
+    const size_t nLen = std::min(sv.size(), s.size());
+    for (size_t i = 0; i < nLen; ++i)
+    {
+        const int ch1 = tolower(static_cast<unsigned char>(sv[i]));
+        const int ch2 = tolower(static_cast<unsigned char>(s[i]));
+        if (ch1 != ch2)
+            return ch1 - ch2;
+    }
+    return sv.size() < s.size()   ? -1
+           : sv.size() > s.size() ? 1
+                                  : 0;
+}
+
+/************************************************************************/
+/*                        EvaluateStringColumn()                        */
+/************************************************************************/
+
+void OGRArrowFilterPlan::EvaluateStringColumn(const Node &oNode,
+                                              const Column &oColumn,
+                                              uint8_t *pabyValue) const
+{
+    const struct ArrowArray *psArray = oColumn.psArray;
+    for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+    {
+        std::string_view sv =
+            oColumn.chFormat == ARROW_LETTER_STRING
+                ? GetStringAsStringView<uint32_t>(psArray, iRow)
+            : oColumn.chFormat == ARROW_LETTER_LARGE_STRING
+                ? GetStringAsStringView<uint64_t>(psArray, iRow)
+                : GetStringView(psArray, iRow);
+        // The per-feature path stores values as C strings
+        const size_t nNulPos = sv.find('\0');
+        if (nNulPos != std::string_view::npos)
+            sv = sv.substr(0, nNulPos);
+
+        bool bValue = false;
+        if (oNode.eKind == Kind::IN)
+        {
+            for (const auto &osValue : oNode.aosValues)
+            {
+                if (sv.size() == osValue.size() &&
+                    CompareCaseInsensitive(sv, osValue) == 0)
+                {
+                    bValue = true;
+                    break;
+                }
+            }
+        }
+        else if (oNode.eKind == Kind::BETWEEN)
+        {
+            bValue = CompareCaseInsensitive(sv, oNode.aosValues[0]) >= 0 &&
+                     CompareCaseInsensitive(sv, oNode.aosValues[1]) <= 0;
+        }
+        else if (oNode.eOp == SWQ_EQ || oNode.eOp == SWQ_NE)
+        {
+            const std::string &osValue = oNode.aosValues[0];
+            const bool bEqual = sv.size() == osValue.size() &&
+                                CompareCaseInsensitive(sv, osValue) == 0;
+            bValue = (oNode.eOp == SWQ_EQ) == bEqual;
+        }
+        else
+        {
+            const int nCmp = CompareCaseInsensitive(sv, oNode.aosValues[0]);
+            bValue = oNode.eOp == SWQ_LT   ? nCmp < 0
+                     : oNode.eOp == SWQ_LE ? nCmp <= 0
+                     : oNode.eOp == SWQ_GT ? nCmp > 0
+                                           : nCmp >= 0;
+        }
+        pabyValue[iRow] = bValue;
+    }
+}
+
+/************************************************************************/
+/*                            EvaluateNode()                            */
+/************************************************************************/
+
+void OGRArrowFilterPlan::EvaluateNode(const Node &oNode,
+                                      std::vector<uint8_t> &abyValue,
+                                      std::vector<uint8_t> &abyNull) const
+{
+    abyValue.resize(m_nLength);
+    abyNull.resize(m_nLength);
+    uint8_t *CPL_RESTRICT pabyValue = abyValue.data();
+    uint8_t *CPL_RESTRICT pabyNull = abyNull.data();
+
+    switch (oNode.eKind)
+    {
+        case Kind::AND:
+        case Kind::OR:
+        {
+            EvaluateNode(oNode.aoChildren[0], abyValue, abyNull);
+            std::vector<uint8_t> abyValue2, abyNull2;
+            EvaluateNode(oNode.aoChildren[1], abyValue2, abyNull2);
+            const uint8_t *CPL_RESTRICT pabyValue2 = abyValue2.data();
+            const uint8_t *CPL_RESTRICT pabyNull2 = abyNull2.data();
+            if (oNode.eKind == Kind::AND)
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                {
+                    pabyValue[i] &= pabyValue2[i];
+                    pabyNull[i] &= pabyNull2[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < m_nLength; ++i)
+                {
+                    pabyValue[i] |= pabyValue2[i];
+                    pabyNull[i] |= pabyNull2[i];
+                }
+            }
+            return;
+        }
+
+        case Kind::NOT:
+        {
+            EvaluateNode(oNode.aoChildren[0], abyValue, abyNull);
+            for (size_t i = 0; i < m_nLength; ++i)
+                pabyValue[i] = (pabyValue[i] | pabyNull[i]) ^ 1;
+            return;
+        }
+
+        default:
+            break;
+    }
+
+    const Column &oColumn = m_aoColumns[oNode.iColumn];
+    FillNull(oColumn, pabyNull);
+
+    if (oNode.eKind == Kind::IS_NULL)
+    {
+        memcpy(pabyValue, pabyNull, m_nLength);
+        memset(pabyNull, 0, m_nLength);
+        return;
+    }
+
+    if (oNode.eKind == Kind::BOOLEAN_COLUMN)
+    {
+        VisitNumericColumn(oColumn,
+                           [this, pabyValue](const auto *panValues)
+                           {
+                               for (size_t i = 0; i < m_nLength; ++i)
+                                   pabyValue[i] = panValues[i] != 0;
+                           });
+    }
+    else if (oColumn.eType == SWQ_STRING)
+    {
+        EvaluateStringColumn(oNode, oColumn, pabyValue);
+    }
+    else
+    {
+        const bool bIn = oNode.eKind == Kind::IN;
+        const bool bBetween = oNode.eKind == Kind::BETWEEN;
+        VisitNumericColumn(
+            oColumn,
+            [this, &oNode, bIn, bBetween, pabyValue](const auto *panValues)
+            {
+                if (oNode.bAsDouble)
+                {
+                    EvaluateNumericValues(panValues, m_nLength, bIn, bBetween,
+                                          oNode.eOp, oNode.adfValues,
+                                          pabyValue);
+                }
+                else
+                {
+                    EvaluateNumericValues(panValues, m_nLength, bIn, bBetween,
+                                          oNode.eOp, oNode.anValues,
+                                          pabyValue);
+                }
+            });
+    }
+
+    // A NULL operand makes the result NULL, with a false value.
+    for (size_t i = 0; i < m_nLength; ++i)
+        pabyValue[i] &= pabyNull[i] ^ 1;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+/** Unset the entries of abyValidityFromFilters for which the filter does
+ * not evaluate to true, and return the number of remaining entries. */
+size_t
+OGRArrowFilterPlan::Evaluate(std::vector<bool> &abyValidityFromFilters) const
+{
+    CPLAssert(abyValidityFromFilters.size() == m_nLength);
+    std::vector<uint8_t> abyValue, abyNull;
+    EvaluateNode(m_oRoot, abyValue, abyNull);
+
+    size_t nCountIntersecting = 0;
+    for (size_t iRow = 0; iRow < m_nLength; ++iRow)
+    {
+        if (abyValidityFromFilters[iRow])
+        {
+            if (abyValue[iRow])
+                ++nCountIntersecting;
+            else
+                abyValidityFromFilters[iRow] = false;
+        }
+    }
+    return nCountIntersecting;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                   FillValidityArrayFromAttrQuery()                   */
 /************************************************************************/
@@ -5290,6 +6057,18 @@ static size_t FillValidityArrayFromAttrQuery(
         }
     }
 
+    if (CPLTestBool(CPLGetConfigOption("OGR_ARROW_VECTORIZED_FILTER", "YES")))
+    {
+        OGRArrowFilterPlan oPlan(poFeatureDefn, schema, array,
+                                 oMapFieldNameToArrowPath, nBaseSeqFID,
+                                 anArrowPathToFIDColumn);
+        if (oPlan.Compile(
+                static_cast<swq_expr_node *>(poAttrQuery->GetSWQExpr())))
+        {
+            return oPlan.Evaluate(abyValidityFromFilters);
+        }
+    }
+
     for (size_t iRow = 0; iRow < nLength; ++iRow)
     {
         if (!abyValidityFromFilters[iRow])
@@ -0,0 +1,748 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Implements OGRSpatialIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrspatialindexedlayer.h"
+
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+#include "gdal_alg.h"
+#include "ogr_p.h"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+
+// Number of children of each node of the R-tree
+constexpr size_t RTREE_NODE_SIZE = 16;
+
+constexpr const char SIDECAR_MAGIC[] = "OGRSIDX";
+constexpr uint32_t SIDECAR_VERSION = 2;
+// magic, version, geometry field index, source size, source mtime,
+// source feature count, count
+constexpr size_t SIDECAR_HEADER_SIZE = 8 + 4 + 4 + 8 + 8 + 8 + 8;
+constexpr size_t SIDECAR_ITEM_SIZE = 4 * sizeof(double) + sizeof(int64_t);
+
+/************************************************************************/
+/*                       OGRSpatialIndexedLayer()                       */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param poDecoratedLayer Layer to decorate.
+ * @param bTakeOwnership Whether poDecoratedLayer must be destroyed with this
+ *                       layer.
+ * @param pszIndexFilename Sidecar file from which the R-tree is loaded, or
+ *                         nullptr.
+ * @param pszSourceFilename File whose size and modification time must match
+ *                          the ones recorded in the sidecar file for it to be
+ *                          reused. Required when pszIndexFilename is set.
+ * @param bFetchByFID Whether the features selected by the R-tree must be
+ *                    fetched with GetFeature(), even if poDecoratedLayer does
+ *                    not advertise OLCRandomRead. Otherwise features are read
+ *                    sequentially, and the R-tree only avoids evaluating the
+ *                    spatial filter on features whose envelope does not
+ *                    intersect it.
+ * @param bWriteIndex Whether the R-tree must be written into pszIndexFilename
+ *                    once built, when it could not be loaded from it.
+ */
+OGRSpatialIndexedLayer::OGRSpatialIndexedLayer(OGRLayer *poDecoratedLayer,
+                                               int bTakeOwnership,
+                                               const char *pszIndexFilename,
+                                               const char *pszSourceFilename,
+                                               bool bFetchByFID,
+                                               bool bWriteIndex)
+    : OGRLayerDecorator(poDecoratedLayer, bTakeOwnership),
+      m_osIndexFilename(pszIndexFilename ? pszIndexFilename : ""),
+      m_osSourceFilename(pszSourceFilename ? pszSourceFilename : ""),
+      m_bFetchByFID(bFetchByFID ||
+                    poDecoratedLayer->TestCapability(OLCRandomRead)),
+      m_bWriteIndex(bWriteIndex)
+{
+}
+
+/************************************************************************/
+/*                            CanUseIndex()                             */
+/************************************************************************/
+
+bool OGRSpatialIndexedLayer::CanUseIndex(int iGeomField) const
+{
+    return !m_bIndexBuildFailed && iGeomField >= 0 &&
+           iGeomField < GetLayerDefn()->GetGeomFieldCount() &&
+           !m_poDecoratedLayer->TestCapability(OLCFastSpatialFilter);
+}
+
+/************************************************************************/
+/*                          GetSpatialFilter()                          */
+/************************************************************************/
+
+OGRGeometry *OGRSpatialIndexedLayer::GetSpatialFilter()
+{
+    return m_poFilterGeom;
+}
+
+/************************************************************************/
+/*                         ISetSpatialFilter()                          */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::ISetSpatialFilter(int iGeomField,
+                                                 const OGRGeometry *poGeom)
+{
+    m_iGeomFieldFilter = iGeomField;
+    InstallFilter(poGeom);
+    m_bCandidatesValid = false;
+    m_iNextCandidate = 0;
+
+    m_bUseIndex = poGeom != nullptr && CanUseIndex(iGeomField);
+    // When the R-tree is used, the decorated layer must return all features
+    // and the exact spatial test is done by GetNextFeature().
+    return m_poDecoratedLayer->SetSpatialFilter(iGeomField,
+                                                m_bUseIndex ? nullptr : poGeom);
+}
+
+/************************************************************************/
+/*                         SetAttributeFilter()                         */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::SetAttributeFilter(const char *pszQuery)
+{
+    // Compile the filter for our own use when fetching features by FID
+    const OGRErr eErr = OGRLayer::SetAttributeFilter(pszQuery);
+    if (eErr != OGRERR_NONE)
+        return eErr;
+    return m_poDecoratedLayer->SetAttributeFilter(pszQuery);
+}
+
+/************************************************************************/
+/*                            ResetReading()                            */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::ResetReading()
+{
+    m_poDecoratedLayer->ResetReading();
+    m_iNextCandidate = 0;
+}
+
+/************************************************************************/
+/*                          GetSourceFileKey()                          */
+/************************************************************************/
+
+bool OGRSpatialIndexedLayer::GetSourceFileKey(GUIntBig &nSize,
+                                              GIntBig &nMTime) const
+{
+    VSIStatBufL sStat;
+    if (m_osSourceFilename.empty() ||
+        VSIStatL(m_osSourceFilename.c_str(), &sStat) != 0)
+    {
+        return false;
+    }
+    nSize = static_cast<GUIntBig>(sStat.st_size);
+    nMTime = static_cast<GIntBig>(sStat.st_mtime);
+    return true;
+}
+
+/************************************************************************/
+/*                       GetSourceFeatureCount()                        */
+/************************************************************************/
+
+/** Return the number of features of the decorated layer, without filters,
+ * or -1 if it cannot be computed without reading all features. */
+GIntBig OGRSpatialIndexedLayer::GetSourceFeatureCount()
+{
+    m_poDecoratedLayer->SetAttributeFilter(nullptr);
+    m_poDecoratedLayer->SetSpatialFilter(nullptr);
+    const GIntBig nCount =
+        m_poDecoratedLayer->TestCapability(OLCFastFeatureCount)
+            ? m_poDecoratedLayer->GetFeatureCount(TRUE)
+            : -1;
+    m_poDecoratedLayer->SetAttributeFilter(m_pszAttrQueryString);
+    m_poDecoratedLayer->SetSpatialFilter(m_iGeomFieldFilter,
+                                         m_bUseIndex ? nullptr
+                                                     : m_poFilterGeom);
+    return nCount;
+}
+
+/************************************************************************/
+/*                            BuildLevels()                             */
+/************************************************************************/
+
+/** Build the upper levels of the R-tree from its leaves, already sorted in
+ * Hilbert order. */
+void OGRSpatialIndexedLayer::BuildLevels(std::vector<Box> &&asLeaves,
+                                         std::vector<GIntBig> &&anFIDs)
+{
+    m_asBoxes = std::move(asLeaves);
+    m_anIndices = std::move(anFIDs);
+    m_anLevelEnds.clear();
+    m_anLevelEnds.push_back(m_asBoxes.size());
+
+    size_t iLevelStart = 0;
+    size_t iLevelEnd = m_asBoxes.size();
+    while (iLevelEnd - iLevelStart > 1)
+    {
+        for (size_t i = iLevelStart; i < iLevelEnd; i += RTREE_NODE_SIZE)
+        {
+            Box sNode = m_asBoxes[i];
+            const size_t iEnd = std::min(i + RTREE_NODE_SIZE, iLevelEnd);
+            for (size_t j = i + 1; j < iEnd; ++j)
+            {
+                const Box &sChild = m_asBoxes[j];
+                sNode.dfMinX = std::min(sNode.dfMinX, sChild.dfMinX);
+                sNode.dfMinY = std::min(sNode.dfMinY, sChild.dfMinY);
+                sNode.dfMaxX = std::max(sNode.dfMaxX, sChild.dfMaxX);
+                sNode.dfMaxY = std::max(sNode.dfMaxY, sChild.dfMaxY);
+            }
+            m_asBoxes.push_back(sNode);
+            m_anIndices.push_back(static_cast<GIntBig>(i));
+        }
+        iLevelStart = iLevelEnd;
+        iLevelEnd = m_asBoxes.size();
+        m_anLevelEnds.push_back(iLevelEnd);
+    }
+}
+
+/************************************************************************/
+/*                             LoadIndex()                              */
+/************************************************************************/
+
+bool OGRSpatialIndexedLayer::LoadIndex(int iGeomField)
+{
+    GUIntBig nSourceSize = 0;
+    GIntBig nSourceMTime = 0;
+    if (m_osIndexFilename.empty() || m_bSidecarStale ||
+        !GetSourceFileKey(nSourceSize, nSourceMTime))
+    {
+        return false;
+    }
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osIndexFilename.c_str(), "rb"));
+    if (!fp)
+        return false;
+
+    GByte abyHeader[SIDECAR_HEADER_SIZE];
+    if (fp->Read(abyHeader, sizeof(abyHeader), 1) != 1 ||
+        memcmp(abyHeader, SIDECAR_MAGIC, 8) != 0)
+    {
+        return false;
+    }
+    uint32_t nVersion = 0;
+    int32_t nGeomField = 0;
+    uint64_t nSize = 0;
+    int64_t nMTime = 0;
+    int64_t nFeatureCount = 0;
+    uint64_t nCount = 0;
+    memcpy(&nVersion, abyHeader + 8, sizeof(nVersion));
+    CPL_LSBPTR32(&nVersion);
+    memcpy(&nGeomField, abyHeader + 12, sizeof(nGeomField));
+    CPL_LSBPTR32(&nGeomField);
+    memcpy(&nSize, abyHeader + 16, sizeof(nSize));
+    CPL_LSBPTR64(&nSize);
+    memcpy(&nMTime, abyHeader + 24, sizeof(nMTime));
+    CPL_LSBPTR64(&nMTime);
+    memcpy(&nFeatureCount, abyHeader + 32, sizeof(nFeatureCount));
+    CPL_LSBPTR64(&nFeatureCount);
+    memcpy(&nCount, abyHeader + 40, sizeof(nCount));
+    CPL_LSBPTR64(&nCount);
+    // The modification time has a resolution of one second, so also check
+    // the feature count when it is cheap to get.
+    GIntBig nSourceFeatureCount = -1;
+    if (nVersion == SIDECAR_VERSION && nGeomField == iGeomField &&
+        nSize == nSourceSize && nMTime == nSourceMTime)
+    {
+        nSourceFeatureCount = GetSourceFeatureCount();
+    }
+    if (nVersion != SIDECAR_VERSION || nGeomField != iGeomField ||
+        nSize != nSourceSize || nMTime != nSourceMTime ||
+        (nSourceFeatureCount >= 0 && nSourceFeatureCount != nFeatureCount))
+    {
+        CPLDebug("OGR", "Spatial index %s is out of date",
+                 m_osIndexFilename.c_str());
+        return false;
+    }
+
+    // Check the count against the file size before allocating
+    fp->Seek(0, SEEK_END);
+    if (nCount != (fp->Tell() - SIDECAR_HEADER_SIZE) / SIDECAR_ITEM_SIZE)
+        return false;
+    fp->Seek(SIDECAR_HEADER_SIZE, SEEK_SET);
+
+    std::vector<Box> asLeaves;
+    std::vector<GIntBig> anFIDs;
+    std::vector<GByte> abyItems;
+    try
+    {
+        asLeaves.resize(static_cast<size_t>(nCount));
+        anFIDs.resize(static_cast<size_t>(nCount));
+        abyItems.resize(static_cast<size_t>(nCount) * SIDECAR_ITEM_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate spatial index of " CPL_FRMT_GUIB " features",
+                 static_cast<GUIntBig>(nCount));
+        return false;
+    }
+    if (fp->Read(abyItems.data(), 1, abyItems.size()) != abyItems.size())
+        return false;
+
+    const GByte *pabyIter = abyItems.data();
+    for (size_t i = 0; i < asLeaves.size(); ++i)
+    {
+        double adfBox[4];
+        memcpy(adfBox, pabyIter, sizeof(adfBox));
+        for (double &dfVal : adfBox)
+            CPL_LSBPTR64(&dfVal);
+        asLeaves[i] = Box{adfBox[0], adfBox[1], adfBox[2], adfBox[3]};
+        pabyIter += sizeof(adfBox);
+        int64_t nFID = 0;
+        memcpy(&nFID, pabyIter, sizeof(nFID));
+        CPL_LSBPTR64(&nFID);
+        anFIDs[i] = nFID;
+        pabyIter += sizeof(nFID);
+    }
+
+    BuildLevels(std::move(asLeaves), std::move(anFIDs));
+    m_iIndexedGeomField = iGeomField;
+    m_nIndexedFeatureCount = nFeatureCount;
+    CPLDebug("OGR", "Loaded spatial index of %d features from %s",
+             static_cast<int>(nCount), m_osIndexFilename.c_str());
+    return true;
+}
+
+/************************************************************************/
+/*                             SaveIndex()                              */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::SaveIndex() const
+{
+    GUIntBig nSourceSize = 0;
+    GIntBig nSourceMTime = 0;
+    if (!m_bWriteIndex || m_osIndexFilename.empty() || m_bSidecarStale ||
+        !GetSourceFileKey(nSourceSize, nSourceMTime))
+    {
+        return;
+    }
+
+    const size_t nCount = m_anLevelEnds.empty() ? 0 : m_anLevelEnds[0];
+    std::vector<GByte> abyData(SIDECAR_HEADER_SIZE +
+                               nCount * SIDECAR_ITEM_SIZE);
+    GByte *pabyIter = abyData.data();
+    const auto Append = [&pabyIter](auto nValue)
+    {
+        if constexpr (sizeof(nValue) == 4)
+            CPL_LSBPTR32(&nValue);
+        else
+            CPL_LSBPTR64(&nValue);
+        memcpy(pabyIter, &nValue, sizeof(nValue));
+        pabyIter += sizeof(nValue);
+    };
+    memcpy(pabyIter, SIDECAR_MAGIC, 8);
+    pabyIter += 8;
+    Append(SIDECAR_VERSION);
+    Append(static_cast<int32_t>(m_iIndexedGeomField));
+    Append(static_cast<uint64_t>(nSourceSize));
+    Append(static_cast<int64_t>(nSourceMTime));
+    Append(static_cast<int64_t>(m_nIndexedFeatureCount));
+    Append(static_cast<uint64_t>(nCount));
+    for (size_t i = 0; i < nCount; ++i)
+    {
+        const Box &sBox = m_asBoxes[i];
+        Append(sBox.dfMinX);
+        Append(sBox.dfMinY);
+        Append(sBox.dfMaxX);
+        Append(sBox.dfMaxY);
+        Append(static_cast<int64_t>(m_anIndices[i]));
+    }
+
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osIndexFilename.c_str(), "wb"));
+    if (!fp ||
+        fp->Write(abyData.data(), 1, abyData.size()) != abyData.size() ||
+        fp->Close() != 0)
+    {
+        CPLError(CE_Warning, CPLE_FileIO, "Cannot write spatial index %s",
+                 m_osIndexFilename.c_str());
+        fp.reset();
+        VSIUnlink(m_osIndexFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                             BuildIndex()                             */
+/************************************************************************/
+
+/** Build (or load from the sidecar file) the R-tree of the envelopes of the
+ * geometries of field iGeomField. */
+bool OGRSpatialIndexedLayer::BuildIndex(int iGeomField)
+{
+    InvalidateIndex();
+    if (LoadIndex(iGeomField))
+        return true;
+
+    OGRFeatureDefn *poDefn = m_poDecoratedLayer->GetLayerDefn();
+
+    // Only read the geometry field we need, without any filter.
+    CPLStringList aosOldIgnoredFields;
+    CPLStringList aosIgnoredFields;
+    for (int i = 0; i < poDefn->GetFieldCount(); ++i)
+    {
+        const auto poFieldDefn = poDefn->GetFieldDefn(i);
+        if (poFieldDefn->IsIgnored())
+            aosOldIgnoredFields.AddString(poFieldDefn->GetNameRef());
+        aosIgnoredFields.AddString(poFieldDefn->GetNameRef());
+    }
+    for (int i = 0; i < poDefn->GetGeomFieldCount(); ++i)
+    {
+        const auto poGeomFieldDefn = poDefn->GetGeomFieldDefn(i);
+        if (poGeomFieldDefn->IsIgnored())
+            aosOldIgnoredFields.AddString(poGeomFieldDefn->GetNameRef());
+        if (i != iGeomField)
+            aosIgnoredFields.AddString(poGeomFieldDefn->GetNameRef());
+    }
+    if (poDefn->IsStyleIgnored())
+        aosOldIgnoredFields.AddString("OGR_STYLE");
+    aosIgnoredFields.AddString("OGR_STYLE");
+
+    m_poDecoratedLayer->SetIgnoredFields(aosIgnoredFields.List());
+    m_poDecoratedLayer->SetAttributeFilter(nullptr);
+    m_poDecoratedLayer->SetSpatialFilter(nullptr);
+    m_poDecoratedLayer->ResetReading();
+
+    std::vector<Box> asBoxes;
+    std::vector<GIntBig> anFIDs;
+    OGREnvelope sExtent;
+    bool bOK = true;
+    GIntBig nFeatureCount = 0;
+    for (auto &&poFeature : *m_poDecoratedLayer)
+    {
+        ++nFeatureCount;
+        const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(iGeomField);
+        if (!poGeom || poGeom->IsEmpty())
+            continue;
+        if (poFeature->GetFID() == OGRNullFID)
+        {
+            CPLDebug("OGR",
+                     "Cannot build spatial index for layer %s: "
+                     "features without FID",
+                     GetDescription());
+            bOK = false;
+            break;
+        }
+        OGREnvelope sEnvelope;
+        poGeom->getEnvelope(&sEnvelope);
+        sExtent.Merge(sEnvelope);
+        asBoxes.push_back(Box{sEnvelope.MinX, sEnvelope.MinY, sEnvelope.MaxX,
+                              sEnvelope.MaxY});
+        anFIDs.push_back(poFeature->GetFID());
+    }
+
+    m_poDecoratedLayer->SetIgnoredFields(aosOldIgnoredFields.List());
+    m_poDecoratedLayer->SetAttributeFilter(m_pszAttrQueryString);
+    m_poDecoratedLayer->ResetReading();
+
+    if (!bOK)
+        return false;
+
+    // Sort the leaves in Hilbert order of the center of their envelope.
+    std::vector<uint32_t> anCodes(asBoxes.size());
+    for (size_t i = 0; i < asBoxes.size(); ++i)
+    {
+        const Box &sBox = asBoxes[i];
+        anCodes[i] = GDALHilbertCode(&sExtent, (sBox.dfMinX + sBox.dfMaxX) / 2,
+                                     (sBox.dfMinY + sBox.dfMaxY) / 2);
+    }
+    std::vector<size_t> anOrder(asBoxes.size());
+    std::iota(anOrder.begin(), anOrder.end(), 0);
+    std::stable_sort(anOrder.begin(), anOrder.end(),
+                     [&anCodes](size_t a, size_t b)
+                     { return anCodes[a] < anCodes[b]; });
+
+    std::vector<Box> asLeaves(asBoxes.size());
+    std::vector<GIntBig> anSortedFIDs(asBoxes.size());
+    for (size_t i = 0; i < anOrder.size(); ++i)
+    {
+        asLeaves[i] = asBoxes[anOrder[i]];
+        anSortedFIDs[i] = anFIDs[anOrder[i]];
+    }
+
+    BuildLevels(std::move(asLeaves), std::move(anSortedFIDs));
+    m_iIndexedGeomField = iGeomField;
+    m_nIndexedFeatureCount = nFeatureCount;
+    CPLDebug("OGR", "Built spatial index of %d features for layer %s",
+             static_cast<int>(m_anLevelEnds[0]), GetDescription());
+
+    SaveIndex();
+    return true;
+}
+
+/************************************************************************/
+/*                          InvalidateIndex()                           */
+/************************************************************************/
+
+void OGRSpatialIndexedLayer::InvalidateIndex()
+{
+    m_iIndexedGeomField = -1;
+    m_asBoxes.clear();
+    m_anIndices.clear();
+    m_anLevelEnds.clear();
+    m_bCandidatesValid = false;
+    m_anCandidates.clear();
+    m_iNextCandidate = 0;
+}
+
+/************************************************************************/
+/*                         CollectCandidates()                          */
+/************************************************************************/
+
+/** Collect the FIDs of the features whose envelope intersects the envelope
+ * of the spatial filter, in increasing order. */
+void OGRSpatialIndexedLayer::CollectCandidates()
+{
+    m_anCandidates.clear();
+    m_iNextCandidate = 0;
+    m_bCandidatesValid = true;
+    if (m_asBoxes.empty())
+        return;
+
+    const size_t nLeaves = m_anLevelEnds[0];
+    const OGREnvelope &sFilter = m_sFilterEnvelope;
+    std::vector<size_t> anStack{m_asBoxes.size() - 1};
+    while (!anStack.empty())
+    {
+        const size_t iNode = anStack.back();
+        anStack.pop_back();
+        const Box &sBox = m_asBoxes[iNode];
+        if (sBox.dfMaxX < sFilter.MinX || sBox.dfMinX > sFilter.MaxX ||
+            sBox.dfMaxY < sFilter.MinY || sBox.dfMinY > sFilter.MaxY)
+        {
+            continue;
+        }
+        if (iNode < nLeaves)
+        {
+            m_anCandidates.push_back(m_anIndices[iNode]);
+        }
+        else
+        {
+            const size_t iFirstChild = static_cast<size_t>(m_anIndices[iNode]);
+            const size_t iLevelEnd = *std::upper_bound(
+                m_anLevelEnds.begin(), m_anLevelEnds.end(), iFirstChild);
+            const size_t iEnd =
+                std::min(iFirstChild + RTREE_NODE_SIZE, iLevelEnd);
+            for (size_t i = iFirstChild; i < iEnd; ++i)
+                anStack.push_back(i);
+        }
+    }
+
+    std::sort(m_anCandidates.begin(), m_anCandidates.end());
+}
+
+/************************************************************************/
+/*                           GetNextFeature()                           */
+/************************************************************************/
+
+OGRFeature *OGRSpatialIndexedLayer::GetNextFeature()
+{
+    if (!m_bUseIndex)
+        return OGRLayerDecorator::GetNextFeature();
+
+    if (m_iIndexedGeomField != m_iGeomFieldFilter)
+    {
+        if (!BuildIndex(m_iGeomFieldFilter))
+        {
+            // Fallback to the decorated layer for the rest of our life
+            InvalidateIndex();
+            m_bIndexBuildFailed = true;
+            m_bUseIndex = false;
+            m_poDecoratedLayer->SetSpatialFilter(m_iGeomFieldFilter,
+                                                 m_poFilterGeom);
+            m_poDecoratedLayer->ResetReading();
+            return OGRLayerDecorator::GetNextFeature();
+        }
+    }
+
+    if (!m_bCandidatesValid)
+        CollectCandidates();
+
+    if (m_bFetchByFID)
+    {
+        while (m_iNextCandidate < m_anCandidates.size())
+        {
+            OGRFeatureUniquePtr poFeature(m_poDecoratedLayer->GetFeature(
+                m_anCandidates[m_iNextCandidate++]));
+            // GetFeature() ignores filters
+            if (poFeature &&
+                FilterGeometry(
+                    poFeature->GetGeomFieldRef(m_iGeomFieldFilter)) &&
+                (m_poAttrQuery == nullptr ||
+                 m_poAttrQuery->Evaluate(poFeature.get())))
+            {
+                return poFeature.release();
+            }
+        }
+        return nullptr;
+    }
+
+    // The attribute filter is evaluated by the decorated layer
+    while (true)
+    {
+        OGRFeatureUniquePtr poFeature(m_poDecoratedLayer->GetNextFeature());
+        if (!poFeature)
+            return nullptr;
+        if (std::binary_search(m_anCandidates.begin(), m_anCandidates.end(),
+                               poFeature->GetFID()) &&
+            FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter)))
+        {
+            return poFeature.release();
+        }
+    }
+}
+
+/************************************************************************/
+/*                           SetNextByIndex()                           */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::SetNextByIndex(GIntBig nIndex)
+{
+    if (m_bUseIndex)
+        return OGRLayer::SetNextByIndex(nIndex);
+    return OGRLayerDecorator::SetNextByIndex(nIndex);
+}
+
+/************************************************************************/
+/*                         Feature modification                         */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::ISetFeature(OGRFeature *poFeature)
+{
+    InvalidateIndex();
+    m_bSidecarStale = true;
+    return OGRLayerDecorator::ISetFeature(poFeature);
+}
+
+OGRErr OGRSpatialIndexedLayer::ISetFeatureUniqPtr(
+    std::unique_ptr<OGRFeature> poFeature)
+{
+    InvalidateIndex();
+    m_bSidecarStale = true;
+    return OGRLayerDecorator::ISetFeatureUniqPtr(std::move(poFeature));
+}
+
+OGRErr OGRSpatialIndexedLayer::ICreateFeature(OGRFeature *poFeature)
+{
+    InvalidateIndex();
+    m_bSidecarStale = true;
+    return OGRLayerDecorator::ICreateFeature(poFeature);
+}
+
+OGRErr OGRSpatialIndexedLayer::ICreateFeatureUniqPtr(
+    std::unique_ptr<OGRFeature> poFeature, GIntBig *pnFID)
+{
+    InvalidateIndex();
+    m_bSidecarStale = true;
+    return OGRLayerDecorator::ICreateFeatureUniqPtr(std::move(poFeature),
+                                                    pnFID);
+}
+
+OGRErr OGRSpatialIndexedLayer::IUpsertFeature(OGRFeature *poFeature)
+{
+    InvalidateIndex();
+    m_bSidecarStale = true;
+    return OGRLayerDecorator::IUpsertFeature(poFeature);
+}
+
+OGRErr OGRSpatialIndexedLayer::IUpdateFeature(
+    OGRFeature *poFeature, int nUpdatedFieldsCount,
+    const int *panUpdatedFieldsIdx, int nUpdatedGeomFieldsCount,
+    const int *panUpdatedGeomFieldsIdx, bool bUpdateStyleString)
+{
+    InvalidateIndex();
+    m_bSidecarStale = true;
+    return OGRLayerDecorator::IUpdateFeature(
+        poFeature, nUpdatedFieldsCount, panUpdatedFieldsIdx,
+        nUpdatedGeomFieldsCount, panUpdatedGeomFieldsIdx, bUpdateStyleString);
+}
+
+OGRErr OGRSpatialIndexedLayer::DeleteFeature(GIntBig nFID)
+{
+    InvalidateIndex();
+    m_bSidecarStale = true;
+    return OGRLayerDecorator::DeleteFeature(nFID);
+}
+
+/************************************************************************/
+/*                          GetFeatureCount()                           */
+/************************************************************************/
+
+GIntBig OGRSpatialIndexedLayer::GetFeatureCount(int bForce)
+{
+    if (m_bUseIndex)
+        return OGRLayer::GetFeatureCount(bForce);
+    return OGRLayerDecorator::GetFeatureCount(bForce);
+}
+
+/************************************************************************/
+/*                             IGetExtent()                             */
+/************************************************************************/
+
+OGRErr OGRSpatialIndexedLayer::IGetExtent(int iGeomField,
+                                          OGREnvelope *psExtent, bool bForce)
+{
+    if (iGeomField == m_iIndexedGeomField && !m_asBoxes.empty())
+    {
+        const Box &sRoot = m_asBoxes.back();
+        psExtent->MinX = sRoot.dfMinX;
+        psExtent->MinY = sRoot.dfMinY;
+        psExtent->MaxX = sRoot.dfMaxX;
+        psExtent->MaxY = sRoot.dfMaxY;
+        return OGRERR_NONE;
+    }
+    return OGRLayerDecorator::IGetExtent(iGeomField, psExtent, bForce);
+}
+
+/************************************************************************/
+/*                           TestCapability()                           */
+/************************************************************************/
+
+int OGRSpatialIndexedLayer::TestCapability(const char *pszCapability) const
+{
+    if (EQUAL(pszCapability, OLCFastSpatialFilter))
+    {
+        return m_bFetchByFID ||
+               m_poDecoratedLayer->TestCapability(pszCapability);
+    }
+    if (EQUAL(pszCapability, OLCFastGetExtent) && m_iIndexedGeomField == 0 &&
+        !m_asBoxes.empty())
+    {
+        return TRUE;
+    }
+    if (m_bUseIndex && (EQUAL(pszCapability, OLCFastFeatureCount) ||
+                        EQUAL(pszCapability, OLCFastSetNextByIndex) ||
+                        EQUAL(pszCapability, OLCFastGetArrowStream)))
+    {
+        return FALSE;
+    }
+    return OGRLayerDecorator::TestCapability(pszCapability);
+}
+
+/************************************************************************/
+/*                           GetArrowStream()                           */
+/************************************************************************/
+
+bool OGRSpatialIndexedLayer::GetArrowStream(struct ArrowArrayStream *out_stream,
+                                            CSLConstList papszOptions)
+{
+    // The decorated layer does not know about the spatial filter
+    if (m_bUseIndex)
+        return OGRLayer::GetArrowStream(out_stream, papszOptions);
+    return OGRLayerDecorator::GetArrowStream(out_stream, papszOptions);
+}
+
+#endif /* #ifndef DOXYGEN_SKIP */
@@ -0,0 +1,129 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Defines OGRSpatialIndexedLayer class
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGRSPATIALINDEXEDLAYER_H_INCLUDED
+#define OGRSPATIALINDEXEDLAYER_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "ogrlayerdecorator.h"
+
+#include <string>
+#include <vector>
+
+/************************************************************************/
+/*                        OGRSpatialIndexedLayer                        */
+/************************************************************************/
+
+/** Layer decorator that serves spatial filters from a packed Hilbert R-tree
+ * of the feature envelopes, built on the first spatial query.
+ *
+ * This is meant for layers of drivers that have no spatial index of their
+ * own, and which otherwise evaluate each spatial filter by reading all
+ * features. The R-tree can optionally be persisted into a sidecar file,
+ * which is reused as long as the size and modification time of the source
+ * file, and the feature count of the layer when it is cheap to get, do not
+ * change.
+ */
+class CPL_DLL OGRSpatialIndexedLayer final : public OGRLayerDecorator
+{
+    CPL_DISALLOW_COPY_ASSIGN(OGRSpatialIndexedLayer)
+
+    struct Box
+    {
+        double dfMinX;
+        double dfMinY;
+        double dfMaxX;
+        double dfMaxY;
+    };
+
+    const std::string m_osIndexFilename;
+    const std::string m_osSourceFilename;
+    const bool m_bFetchByFID;
+    const bool m_bWriteIndex;
+
+    // Index of the geometry field indexed, or -1 if not built yet
+    int m_iIndexedGeomField = -1;
+    // Number of features of the decorated layer when the R-tree was built
+    GIntBig m_nIndexedFeatureCount = 0;
+    bool m_bIndexBuildFailed = false;
+    // Set once features have been modified through this layer, in which case
+    // the sidecar file must no longer be read nor written.
+    bool m_bSidecarStale = false;
+
+    // R-tree nodes, starting with the leaves in Hilbert order, followed by
+    // each upper level, up to the root node.
+    std::vector<Box> m_asBoxes{};
+    // For leaves, the FID of the feature. For other nodes, the index in
+    // m_asBoxes of their first child.
+    std::vector<GIntBig> m_anIndices{};
+    // Index in m_asBoxes of the end of each level, starting with leaves.
+    std::vector<size_t> m_anLevelEnds{};
+
+    // Whether the current spatial filter is evaluated with the R-tree
+    bool m_bUseIndex = false;
+    bool m_bCandidatesValid = false;
+    std::vector<GIntBig> m_anCandidates{};
+    size_t m_iNextCandidate = 0;
+
+    bool CanUseIndex(int iGeomField) const;
+    bool BuildIndex(int iGeomField);
+    void BuildLevels(std::vector<Box> &&asLeaves,
+                     std::vector<GIntBig> &&anFIDs);
+    bool LoadIndex(int iGeomField);
+    void SaveIndex() const;
+    bool GetSourceFileKey(GUIntBig &nSize, GIntBig &nMTime) const;
+    GIntBig GetSourceFeatureCount();
+    void InvalidateIndex();
+    void CollectCandidates();
+
+  public:
+    OGRSpatialIndexedLayer(OGRLayer *poDecoratedLayer, int bTakeOwnership,
+                           const char *pszIndexFilename = nullptr,
+                           const char *pszSourceFilename = nullptr,
+                           bool bFetchByFID = false,
+                           bool bWriteIndex = false);
+
+    OGRGeometry *GetSpatialFilter() override;
+    virtual OGRErr ISetSpatialFilter(int iGeomField,
+                                     const OGRGeometry *) override;
+    OGRErr SetAttributeFilter(const char *) override;
+
+    void ResetReading() override;
+    OGRFeature *GetNextFeature() override;
+    OGRErr SetNextByIndex(GIntBig nIndex) override;
+
+    OGRErr ISetFeature(OGRFeature *poFeature) override;
+    OGRErr ISetFeatureUniqPtr(std::unique_ptr<OGRFeature> poFeature) override;
+    OGRErr ICreateFeature(OGRFeature *poFeature) override;
+    OGRErr ICreateFeatureUniqPtr(std::unique_ptr<OGRFeature> poFeature,
+                                 GIntBig *pnFID) override;
+    OGRErr IUpsertFeature(OGRFeature *poFeature) override;
+    OGRErr IUpdateFeature(OGRFeature *poFeature, int nUpdatedFieldsCount,
+                          const int *panUpdatedFieldsIdx,
+                          int nUpdatedGeomFieldsCount,
+                          const int *panUpdatedGeomFieldsIdx,
+                          bool bUpdateStyleString) override;
+    OGRErr DeleteFeature(GIntBig nFID) override;
+
+    GIntBig GetFeatureCount(int bForce = TRUE) override;
+    OGRErr IGetExtent(int iGeomField, OGREnvelope *psExtent,
+                      bool bForce = true) override;
+
+    int TestCapability(const char *) const override;
+
+    virtual bool GetArrowStream(struct ArrowArrayStream *out_stream,
+                                CSLConstList papszOptions = nullptr) override;
+};
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif  //  OGRSPATIALINDEXEDLAYER_H_INCLUDED
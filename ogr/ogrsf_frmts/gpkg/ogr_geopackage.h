@@ -598,12 +598,18 @@ class OGRGeoPackageLayer CPL_NON_FINAL : public OGRLayer,
     //! Whether to call OGRGeometry::SetPrecision() when reading back geometries from the database
     bool m_bUndoDiscardCoordLSBOnReading = false;
 
+    //! Whether geometries are attached to features as undecoded WKB
+    const bool m_bLazyGeometry;
+
     void ClearStatement();
     virtual OGRErr ResetStatement() = 0;
 
     void BuildFeatureDefn(const char *pszLayerName, sqlite3_stmt *hStmt);
 
-    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt);
+    OGRFeature *TranslateFeature(sqlite3_stmt *hStmt,
+                                 OGRFeature *poFeatureToReuse = nullptr);
+    std::unique_ptr<OGRFeature>
+    GetNextFeatureInternal(std::unique_ptr<OGRFeature> poFeatureToReuse);
     bool ParseDateField(const char *pszTxt, OGRField *psField,
                         const OGRFieldDefn *poFieldDefn, GIntBig nFID);
     bool ParseDateField(sqlite3_stmt *hStmt, int iRawField, int nSqlite3ColType,
@@ -889,6 +895,8 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr SetAttributeFilter(const char *pszQuery) override;
     OGRErr SyncToDisk() override;
     OGRFeature *GetNextFeature() override;
+    std::unique_ptr<OGRFeature>
+    GetNextFeatureReusing(std::unique_ptr<OGRFeature> poFeature) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     OGRErr StartTransaction() override;
     OGRErr CommitTransaction() override;
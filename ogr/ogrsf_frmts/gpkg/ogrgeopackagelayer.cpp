@@ -24,7 +24,8 @@
 /************************************************************************/
 
 OGRGeoPackageLayer::OGRGeoPackageLayer(GDALGeoPackageDataset *poDS)
-    : m_poDS(poDS)
+    : m_poDS(poDS), m_bLazyGeometry(CPLTestBool(
+                        CPLGetConfigOption("OGR_GPKG_LAZY_GEOMETRY", "YES")))
 {
 }
 
@@ -77,6 +78,19 @@ void OGRGeoPackageLayer::ClearStatement()
 
 OGRFeature *OGRGeoPackageLayer::GetNextFeature()
 
+{
+    return GetNextFeatureInternal(nullptr).release();
+}
+
+/************************************************************************/
+/*                       GetNextFeatureInternal()                       */
+/************************************************************************/
+
+/* Implementation of GetNextFeature() that refills poFeatureToReuse, when */
+/* provided, instead of allocating a new feature. */
+std::unique_ptr<OGRFeature> OGRGeoPackageLayer::GetNextFeatureInternal(
+    std::unique_ptr<OGRFeature> poFeatureToReuse)
+
 {
     if (m_bEOF)
         return nullptr;
@@ -119,14 +133,35 @@ OGRFeature *OGRGeoPackageLayer::GetNextFeature()
             m_bDoStep = true;
         }
 
-        OGRFeature *poFeature = TranslateFeature(m_poQueryStatement);
+        auto poFeature = std::unique_ptr<OGRFeature>(TranslateFeature(
+            m_poQueryStatement, poFeatureToReuse.release()));
 
-        if ((m_poFilterGeom == nullptr ||
-             FilterGeometry(poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
-            (m_poAttrQuery == nullptr || m_poAttrQuery->Evaluate(poFeature)))
+        bool bPassSpatialFilter = true;
+        if (m_poFilterGeom != nullptr)
+        {
+            size_t nWKBSize = 0;
+            const GByte *pabyWKB =
+                poFeature->GetGeomFieldWKB(m_iGeomFieldFilter, nWKBSize);
+            if (pabyWKB)
+            {
+                OGREnvelope sEnvelope;
+                bPassSpatialFilter =
+                    FilterWKBGeometry(pabyWKB, nWKBSize,
+                                      /* bEnvelopeAlreadySet = */ false,
+                                      sEnvelope);
+            }
+            else
+            {
+                bPassSpatialFilter = CPL_TO_BOOL(FilterGeometry(
+                    poFeature->GetGeomFieldRef(m_iGeomFieldFilter)));
+            }
+        }
+
+        if (bPassSpatialFilter && (m_poAttrQuery == nullptr ||
+                                   m_poAttrQuery->Evaluate(poFeature.get())))
             return poFeature;
 
-        delete poFeature;
+        poFeatureToReuse = std::move(poFeature);
     }
 }
 
@@ -328,13 +363,24 @@ bool OGRGeoPackageLayer::ParseDateTimeField(const char *pszTxt,
 /*                          TranslateFeature()                          */
 /************************************************************************/
 
-OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
+OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt,
+                                                 OGRFeature *poFeatureToReuse)
 
 {
     /* -------------------------------------------------------------------- */
-    /*      Create a feature from the current result.                       */
+    /*      Create a feature from the current result, or recycle the        */
+    /*      provided one.                                                   */
     /* -------------------------------------------------------------------- */
-    OGRFeature *poFeature = new OGRFeature(m_poFeatureDefn);
+    OGRFeature *poFeature = poFeatureToReuse;
+    if (poFeature && poFeature->GetDefnRef() == m_poFeatureDefn)
+    {
+        poFeature->Reset();
+    }
+    else
+    {
+        delete poFeature;
+        poFeature = new OGRFeature(m_poFeatureDefn);
+    }
 
     /* -------------------------------------------------------------------- */
     /*      Set FID if we have a column to set it from.                     */
@@ -370,29 +416,51 @@ OGRFeature *OGRGeoPackageLayer::TranslateFeature(sqlite3_stmt *hStmt)
             // coverity[tainted_data_return]
             const GByte *pabyGpkg = static_cast<const GByte *>(
                 sqlite3_column_blob(hStmt, m_iGeomCol));
-            OGRGeometry *poGeom =
-                GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
-            if (poGeom == nullptr)
+
+            // Defer the decoding of the WKB to the first access to the
+            // geometry, which some consumers, like WKB-based writers or
+            // spatial filtering, may not need at all.
+            GPkgHeader oHeader;
+            OGRwkbGeometryType eWKBType = wkbUnknown;
+            if (m_bLazyGeometry && !m_bUndoDiscardCoordLSBOnReading &&
+                pabyGpkg != nullptr &&
+                GPkgHeaderFromWKB(pabyGpkg, iGpkgSize, &oHeader) ==
+                    OGRERR_NONE &&
+                !oHeader.bExtended &&
+                OGRReadWKBGeometryType(pabyGpkg + oHeader.nHeaderLen,
+                                       wkbVariantIso,
+                                       &eWKBType) == OGRERR_NONE)
             {
-                // Try also spatialite geometry blobs
-                if (OGRSQLiteImportSpatiaLiteGeometry(pabyGpkg, iGpkgSize,
-                                                      &poGeom) != OGRERR_NONE)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Unable to read geometry");
-                }
+                poFeature->SetGeomFieldFromWKB(
+                    0, pabyGpkg + oHeader.nHeaderLen,
+                    static_cast<size_t>(iGpkgSize) - oHeader.nHeaderLen);
             }
-            if (poGeom)
+            else
             {
-                if (m_bUndoDiscardCoordLSBOnReading)
+                OGRGeometry *poGeom =
+                    GPkgGeometryToOGR(pabyGpkg, iGpkgSize, nullptr);
+                if (poGeom == nullptr)
                 {
-                    poGeom->roundCoordinates(
-                        poGeomFieldDefn->GetCoordinatePrecision());
+                    // Try also spatialite geometry blobs
+                    if (OGRSQLiteImportSpatiaLiteGeometry(
+                            pabyGpkg, iGpkgSize, &poGeom) != OGRERR_NONE)
+                    {
+                        CPLError(CE_Failure, CPLE_AppDefined,
+                                 "Unable to read geometry");
+                    }
+                }
+                if (poGeom)
+                {
+                    if (m_bUndoDiscardCoordLSBOnReading)
+                    {
+                        poGeom->roundCoordinates(
+                            poGeomFieldDefn->GetCoordinatePrecision());
+                    }
+                    poGeom->assignSpatialReference(poSrs);
                 }
-                poGeom->assignSpatialReference(poSrs);
-            }
 
-            poFeature->SetGeometryDirectly(poGeom);
+                poFeature->SetGeometryDirectly(poGeom);
+            }
         }
     }
 
@@ -206,8 +206,10 @@ OGRErr OGRGeoPackageTableLayer::BuildColumns()
 //
 bool OGRGeoPackageTableLayer::IsGeomFieldSet(OGRFeature *poFeature)
 {
+    size_t nWKBSize = 0;
     return poFeature->GetDefnRef()->GetGeomFieldCount() &&
-           poFeature->GetGeomFieldRef(0);
+           (poFeature->GetGeomFieldWKB(0, nWKBSize) ||
+            poFeature->GetGeomFieldRef(0));
 }
 
 OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
@@ -240,13 +242,31 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
     if ((nUpdatedGeomFieldsCount < 0 || nUpdatedGeomFieldsCount == 1) &&
         poFeatureDefn->GetGeomFieldCount())
     {
+        // Undecoded WKB geometry that can be written as it is, provided that
+        // no precision is applied on coordinates.
+        size_t nSrcWKBSize = 0;
+        const GByte *pabySrcWKB = poFeature->GetGeomFieldWKB(0, nSrcWKBSize);
+        GByte *pabyWkb = nullptr;
+        size_t szWkb = 0;
+        if (pabySrcWKB &&
+            m_sBinaryPrecision.nXYBitPrecision == INT_MIN &&
+            m_sBinaryPrecision.nZBitPrecision == INT_MIN &&
+            m_sBinaryPrecision.nMBitPrecision == INT_MIN)
+        {
+            pabyWkb =
+                GPkgGeometryFromWKB(pabySrcWKB, nSrcWKBSize, m_iSrs, &szWkb);
+        }
+
         // Non-NULL geometry.
-        OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
-        if (poGeom)
+        OGRGeometry *poGeom =
+            pabyWkb ? nullptr : poFeature->GetGeomFieldRef(0);
+        if (pabyWkb || poGeom)
         {
-            size_t szWkb = 0;
-            GByte *pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
-                                                 &m_sBinaryPrecision, &szWkb);
+            if (!pabyWkb)
+            {
+                pabyWkb = GPkgGeometryFromOGR(poGeom, m_iSrs,
+                                              &m_sBinaryPrecision, &szWkb);
+            }
             if (!pabyWkb)
                 return OGRERR_FAILURE;
             int err = sqlite3_bind_blob(poStmt, nColCount++, pabyWkb,
@@ -2157,13 +2177,31 @@ void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
 {
     const OGRwkbGeometryType eLayerGeomType = GetGeomType();
     const OGRwkbGeometryType eFlattenLayerGeomType = wkbFlatten(eLayerGeomType);
-    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+
+    // Get the geometry type without decoding a WKB geometry
+    bool bHasGeom = false;
+    OGRwkbGeometryType eFeatureGeomType = wkbUnknown;
+    size_t nWKBSize = 0;
+    const GByte *pabyWKB =
+        poFeature->GetGeomFieldCount() > 0
+            ? poFeature->GetGeomFieldWKB(0, nWKBSize)
+            : nullptr;
+    if (pabyWKB && OGRReadWKBGeometryType(pabyWKB, wkbVariantIso,
+                                          &eFeatureGeomType) == OGRERR_NONE)
+    {
+        bHasGeom = true;
+    }
+    else if (const OGRGeometry *poGeom = poFeature->GetGeometryRef())
+    {
+        bHasGeom = true;
+        eFeatureGeomType = poGeom->getGeometryType();
+    }
+
     if (eFlattenLayerGeomType != wkbNone && eFlattenLayerGeomType != wkbUnknown)
     {
-        if (poGeom != nullptr)
+        if (bHasGeom)
         {
-            OGRwkbGeometryType eGeomType =
-                wkbFlatten(poGeom->getGeometryType());
+            OGRwkbGeometryType eGeomType = wkbFlatten(eFeatureGeomType);
             if (!OGR_GT_IsSubClassOf(eGeomType, eFlattenLayerGeomType) &&
                 !cpl::contains(m_eSetBadGeomTypeWarned, eGeomType))
             {
@@ -2188,10 +2226,10 @@ void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
     // if we have geometries with Z and M components
     if (m_nZFlag == 0 || m_nMFlag == 0)
     {
-        if (poGeom != nullptr)
+        if (bHasGeom)
         {
             bool bUpdateGpkgGeometryColumnsTable = false;
-            const OGRwkbGeometryType eGeomType = poGeom->getGeometryType();
+            const OGRwkbGeometryType eGeomType = eFeatureGeomType;
             if (m_nZFlag == 0 && wkbHasZ(eGeomType))
             {
                 if (eLayerGeomType != wkbUnknown && !wkbHasZ(eLayerGeomType))
@@ -2575,11 +2613,25 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
     /* Update the layer extents with this new object */
     if (IsGeomFieldSet(poFeature))
     {
-        OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
-        if (!poGeom->IsEmpty())
+        // If the geometry is still undecoded, it has been written as it is,
+        // and is thus a linear geometry whose envelope can be computed from
+        // its WKB.
+        OGREnvelope oEnv;
+        size_t nWKBSize = 0;
+        const GByte *pabyWKB = poFeature->GetGeomFieldWKB(0, nWKBSize);
+        if (pabyWKB)
+        {
+            if (!OGRWKBGetBoundingBox(pabyWKB, nWKBSize, oEnv))
+                oEnv = OGREnvelope();
+        }
+        else
+        {
+            const OGRGeometry *poGeom = poFeature->GetGeomFieldRef(0);
+            if (!poGeom->IsEmpty())
+                poGeom->getEnvelope(&oEnv);
+        }
+        if (oEnv.IsInit())
         {
-            OGREnvelope oEnv;
-            poGeom->getEnvelope(&oEnv);
             UpdateExtent(&oEnv);
 
             if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
@@ -3630,6 +3682,16 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 /************************************************************************/
 
 OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
+{
+    return GetNextFeatureReusing(nullptr).release();
+}
+
+/************************************************************************/
+/*                       GetNextFeatureReusing()                        */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature> OGRGeoPackageTableLayer::GetNextFeatureReusing(
+    std::unique_ptr<OGRFeature> poFeatureToReuse)
 {
     if (m_bEOF)
         return nullptr;
@@ -3648,7 +3710,7 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
             return nullptr;
     }
 
-    OGRFeature *poFeature = OGRGeoPackageLayer::GetNextFeature();
+    auto poFeature = GetNextFeatureInternal(std::move(poFeatureToReuse));
     if (poFeature && m_iFIDAsRegularColumnIndex >= 0)
     {
         poFeature->SetField(m_iFIDAsRegularColumnIndex, poFeature->GetFID());
@@ -14,6 +14,7 @@
 #include "ogr_p.h"
 #include "ogr_wkb.h"
 #include "sqlite/ogrsqlitebase.h"
+#include <cmath>
 #include <limits>
 
 /* Requirement 20: A GeoPackage SHALL store feature table geometries */
@@ -349,6 +350,86 @@ GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
     return pabyWkb;
 }
 
+/************************************************************************/
+/*                        GPkgGeometryFromWKB()                         */
+/************************************************************************/
+
+/* Build a GeoPackage geometry blob by prefixing an existing ISO WKB with */
+/* a header, without going through an OGRGeometry. This is only done for */
+/* simple linear geometries whose envelope can be computed exactly from */
+/* their WKB: NULL is returned, without error, for other geometries, which */
+/* must be encoded with GPkgGeometryFromOGR() instead. */
+
+GByte *GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBSize, int iSrsId,
+                           size_t *pnGpkgLen)
+{
+    if (nWKBSize < 5 || (pabyWKB[0] != wkbXDR && pabyWKB[0] != wkbNDR))
+        return nullptr;
+
+    uint32_t nType = 0;
+    memcpy(&nType, pabyWKB + 1, sizeof(nType));
+    if (OGR_SWAP(static_cast<OGRwkbByteOrder>(pabyWKB[0])))
+        CPL_SWAP32PTR(&nType);
+    // Reject the old 2.5D and the PostGIS EWKB flags, that are not allowed
+    // by the GeoPackage specification.
+    if ((nType & 0xFFFF0000U) != 0)
+        return nullptr;
+
+    OGRwkbGeometryType eGeomType = wkbUnknown;
+    if (OGRReadWKBGeometryType(pabyWKB, wkbVariantIso, &eGeomType) !=
+        OGRERR_NONE)
+        return nullptr;
+    const auto eFlatType = wkbFlatten(eGeomType);
+    if (eFlatType < wkbPoint || eFlatType > wkbMultiPolygon)
+        return nullptr;
+
+    const bool bPoint = eFlatType == wkbPoint;
+    const bool bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeomType));
+    OGREnvelope3D sEnvelope;
+    if (!OGRWKBGetBoundingBox(pabyWKB, nWKBSize, sEnvelope))
+        return nullptr;
+    const bool bEmpty = !sEnvelope.IsInit();
+    if (!bEmpty &&
+        (std::isnan(sEnvelope.MinX) || std::isnan(sEnvelope.MinY) ||
+         std::isnan(sEnvelope.MaxX) || std::isnan(sEnvelope.MaxY) ||
+         (bHasZ && (std::isnan(sEnvelope.MinZ) || std::isnan(sEnvelope.MaxZ)))))
+    {
+        return nullptr;
+    }
+
+    /* Same header layout as in GPkgGeometryFromOGR() */
+    const GByte byEnv = (bPoint || bEmpty) ? 0 : bHasZ ? 2 : 1;
+    const size_t nHeaderLen =
+        8 + (byEnv == 0 ? 0 : byEnv == 2 ? 6 : 4) * sizeof(double);
+    const size_t nGpkgLen = nHeaderLen + nWKBSize;
+    if (nGpkgLen > static_cast<size_t>(std::numeric_limits<int>::max()))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "too big geometry blob");
+        return nullptr;
+    }
+    GByte *pabyGpkg = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nGpkgLen));
+    if (!pabyGpkg)
+        return nullptr;
+    if (pnGpkgLen)
+        *pnGpkgLen = nGpkgLen;
+
+    pabyGpkg[0] = 0x47;
+    pabyGpkg[1] = 0x50;
+    pabyGpkg[2] = 0;
+    pabyGpkg[3] = static_cast<GByte>((bEmpty ? (1 << 4) : 0) | (byEnv << 1) |
+                                     static_cast<GByte>(CPL_IS_LSB));
+    memcpy(pabyGpkg + 4, &iSrsId, 4);
+    if (byEnv != 0)
+    {
+        double adfEnv[6] = {sEnvelope.MinX, sEnvelope.MaxX, sEnvelope.MinY,
+                            sEnvelope.MaxY, sEnvelope.MinZ, sEnvelope.MaxZ};
+        memcpy(pabyGpkg + 8, adfEnv, nHeaderLen - 8);
+    }
+    memcpy(pabyGpkg + nHeaderLen, pabyWKB, nWKBSize);
+
+    return pabyGpkg;
+}
+
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader)
 {
@@ -44,6 +44,8 @@ OGRwkbGeometryType GPkgGeometryTypeToWKB(const char *pszGpkgType, bool bHasZ,
 GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
                            const OGRGeomCoordinateBinaryPrecision *psPrecision,
                            size_t *pnWkbLen);
+GByte *GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBSize, int iSrsId,
+                           size_t *pnGpkgLen);
 OGRGeometry *GPkgGeometryToOGR(const GByte *pabyGpkg, size_t nGpkgLen,
                                OGRSpatialReference *poSrs);
 
@@ -35,6 +35,11 @@ class CPL_DLL OGRAttrIndex
     virtual GIntBig *GetAllMatches(OGRField *psKey) = 0;
     virtual GIntBig *GetAllMatches(OGRField *psKey, GIntBig *panFIDList,
                                    int *nFIDCount, int *nLength) = 0;
+    virtual GIntBig *GetAllMatchesInRange(const OGRField *psMin,
+                                          bool bMinIncluded,
+                                          const OGRField *psMax,
+                                          bool bMaxIncluded,
+                                          GIntBig *pnFIDCount);
 
     virtual OGRErr AddEntry(OGRField *psKey, GIntBig nFID) = 0;
     virtual OGRErr RemoveEntry(OGRField *psKey, GIntBig nFID) = 0;
@@ -74,6 +79,7 @@ class CPL_DLL OGRLayerAttrIndex
 };
 
 OGRLayerAttrIndex CPL_DLL *OGRCreateDefaultLayerIndex();
+OGRLayerAttrIndex CPL_DLL *OGRCreateMemoryLayerIndex();
 
 //! @endcond
 
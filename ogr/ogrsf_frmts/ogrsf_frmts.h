@@ -64,6 +64,7 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     std::unique_ptr<Private> m_poPrivate;
 
     void ConvertGeomsIfNecessary(OGRFeature *poFeature);
+    void UpdateMemoryAttrIndex(OGRFeature *poFeature, int iField = -1);
 
     class CPL_DLL FeatureIterator
     {
@@ -216,6 +217,9 @@ class CPL_DLL OGRLayer : public GDALMajorObject
 
     virtual void ResetReading() = 0;
     virtual OGRFeature *GetNextFeature() CPL_WARN_UNUSED_RESULT = 0;
+    virtual std::unique_ptr<OGRFeature>
+    GetNextFeatureReusing(std::unique_ptr<OGRFeature> poFeature)
+        CPL_WARN_UNUSED_RESULT;
     virtual OGRErr SetNextByIndex(GIntBig nIndex);
     virtual OGRFeature *GetFeature(GIntBig nFID) CPL_WARN_UNUSED_RESULT;
 
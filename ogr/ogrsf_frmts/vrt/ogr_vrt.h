@@ -230,6 +230,9 @@ class OGRVRTDataSource final : public GDALDataset
     OGRLayer *InstantiateUnionLayer(CPLXMLNode *psLTree,
                                     const char *pszVRTDirectory, int bUpdate,
                                     int nRecLevel);
+    OGRLayer *InstantiateSpatialIndexedLayer(CPLXMLNode *psLTree,
+                                             const char *pszVRTDirectory,
+                                             int bUpdate, int nRecLevel);
 
     CPL_DISALLOW_COPY_ASSIGN(OGRVRTDataSource)
 
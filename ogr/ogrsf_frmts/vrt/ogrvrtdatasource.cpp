@@ -29,6 +29,7 @@
 #include "ogr_feature.h"
 #include "ogr_spatialref.h"
 #include "ogrlayerpool.h"
+#include "ogrspatialindexedlayer.h"
 #include "ogrunionlayer.h"
 #include "ogrwarpedlayer.h"
 #include "ogrsf_frmts.h"
@@ -561,6 +562,82 @@ OGRLayer *OGRVRTDataSource::InstantiateUnionLayer(CPLXMLNode *psLTree,
     return poLayer;
 }
 
+/************************************************************************/
+/*                   InstantiateSpatialIndexedLayer()                   */
+/************************************************************************/
+
+OGRLayer *OGRVRTDataSource::InstantiateSpatialIndexedLayer(
+    CPLXMLNode *psLTree, const char *pszVRTDirectory, int bUpdate,
+    int nRecLevel)
+{
+    if (!EQUAL(psLTree->pszValue, "OGRVRTSpatialIndexedLayer"))
+        return nullptr;
+
+    std::unique_ptr<OGRLayer> poSrcLayer;
+
+    for (CPLXMLNode *psSubNode = psLTree->psChild; psSubNode != nullptr;
+         psSubNode = psSubNode->psNext)
+    {
+        if (psSubNode->eType != CXT_Element)
+            continue;
+
+        poSrcLayer.reset(InstantiateLayer(psSubNode, pszVRTDirectory, bUpdate,
+                                          nRecLevel + 1));
+        if (poSrcLayer != nullptr)
+            break;
+    }
+
+    if (poSrcLayer == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot instantiate source layer");
+        return nullptr;
+    }
+
+    // Sidecar file into which the R-tree is persisted.
+    std::string osIndexFile = CPLGetXMLValue(psLTree, "IndexFile", "");
+    if (!osIndexFile.empty() &&
+        CPLTestBool(CPLGetXMLValue(psLTree, "IndexFile.relativeToVRT", "0")))
+    {
+        osIndexFile = CPLProjectRelativeFilenameSafe(pszVRTDirectory,
+                                                     osIndexFile.c_str());
+    }
+
+    // File whose size and modification time are used to detect that the
+    // sidecar file is out of date. Defaults to the source datasource of a
+    // OGRVRTLayer.
+    std::string osSourceFile = CPLGetXMLValue(psLTree, "SourceFile", "");
+    if (!osSourceFile.empty() &&
+        CPLTestBool(CPLGetXMLValue(psLTree, "SourceFile.relativeToVRT", "0")))
+    {
+        osSourceFile = CPLProjectRelativeFilenameSafe(pszVRTDirectory,
+                                                      osSourceFile.c_str());
+    }
+    else if (osSourceFile.empty() && !osIndexFile.empty())
+    {
+        if (auto poVRTLayer = dynamic_cast<OGRVRTLayer *>(poSrcLayer.get()))
+        {
+            if (auto poSrcDS = poVRTLayer->GetSrcDataset())
+                osSourceFile = poSrcDS->GetDescription();
+        }
+    }
+
+    const bool bFetchByFID =
+        CPLTestBool(CPLGetXMLValue(psLTree, "FetchByFID", "NO"));
+
+    // Do not let a VRT file opened in read-only mode create files at a
+    // location it controls.
+    const bool bWriteIndex =
+        bUpdate ||
+        CPLTestBool(CPLGetConfigOption("OGR_VRT_WRITE_SPATIAL_INDEX", "NO"));
+
+    return new OGRSpatialIndexedLayer(
+        poSrcLayer.release(), TRUE,
+        osIndexFile.empty() ? nullptr : osIndexFile.c_str(),
+        osSourceFile.empty() ? nullptr : osSourceFile.c_str(), bFetchByFID,
+        bWriteIndex);
+}
+
 /************************************************************************/
 /*                      InstantiateLayerInternal()                      */
 /************************************************************************/
@@ -593,6 +670,12 @@ OGRVRTDataSource::InstantiateLayerInternal(CPLXMLNode *psLTree,
         return InstantiateUnionLayer(psLTree, pszVRTDirectory, bUpdate,
                                      nRecLevel + 1);
     }
+    else if (EQUAL(psLTree->pszValue, "OGRVRTSpatialIndexedLayer") &&
+             nRecLevel < 30)
+    {
+        return InstantiateSpatialIndexedLayer(psLTree, pszVRTDirectory,
+                                              bUpdate, nRecLevel + 1);
+    }
 
     return nullptr;
 }
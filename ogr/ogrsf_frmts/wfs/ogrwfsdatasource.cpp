@@ -2403,6 +2403,7 @@ OGRLayer *OGRWFSDataSource::ExecuteSQL(const char *pszSQLCommand,
             (iLayer = GetLayerIndex(psSelectInfo->table_defs[0].table_name)) >=
                 0 &&
             psSelectInfo->join_count == 0 && psSelectInfo->order_specs > 0 &&
+            psSelectInfo->group_by_count == 0 &&
             psSelectInfo->poOtherSelect == nullptr)
         {
             OGRWFSLayer *poSrcLayer = papoLayers[iLayer];
@@ -267,6 +267,10 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
             nReturn = SWQT_WHERE;
         else if (EQUAL(osToken, "ON"))
             nReturn = SWQT_ON;
+        else if (EQUAL(osToken, "GROUP"))
+            nReturn = SWQT_GROUP;
+        else if (EQUAL(osToken, "HAVING"))
+            nReturn = SWQT_HAVING;
         else if (EQUAL(osToken, "ORDER"))
             nReturn = SWQT_ORDER;
         else if (EQUAL(osToken, "BY"))
@@ -398,11 +402,23 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
         assert(!select_info->column_summary.empty());
     }
 
+    return swq_summary_accumulate(def, select_info->column_summary[dest_column],
+                                  pszValue, pdfValue,
+                                  select_info->order_specs == 0);
+}
+
+/************************************************************************/
+/*                       swq_summary_accumulate()                       */
+/************************************************************************/
+
+const char *swq_summary_accumulate(const swq_col_def *def,
+                                   swq_summary &summary, const char *pszValue,
+                                   const double *pdfValue,
+                                   bool bKeepDistinctValuesOrder)
+{
     /* -------------------------------------------------------------------- */
     /*      If distinct processing is on, process that now.                 */
     /* -------------------------------------------------------------------- */
-    swq_summary &summary = select_info->column_summary[dest_column];
-
     if (def->distinct_flag)
     {
         if (pszValue == nullptr)
@@ -412,7 +428,7 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
             if (!cpl::contains(summary.oSetDistinctValues, pszValue))
             {
                 summary.oSetDistinctValues.insert(pszValue);
-                if (select_info->order_specs == 0)
+                if (bKeepDistinctValuesOrder)
                 {
                     // If not sorted, keep values in their original order
                     summary.oVectorDistinctValues.emplace_back(pszValue);
@@ -588,6 +604,10 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
         case SWQCF_NONE:
             break;
 
+        case SWQCF_ST_UNION:
+        case SWQCF_ST_EXTENT:
+            return "swq_select_summarize() called on geometry aggregate.";
+
         case SWQCF_CUSTOM:
             return "swq_select_summarize() called on custom field function.";
     }
@@ -946,7 +966,8 @@ CPLErr swq_expr_compile2(const char *where_clause, swq_field_list *field_list,
 static const char *const apszSQLReservedKeywords[] = {
     "OR",    "AND",      "NOT",    "LIKE",   "IS",   "NULL", "IN",    "BETWEEN",
     "CAST",  "DISTINCT", "ESCAPE", "SELECT", "LEFT", "JOIN", "WHERE", "ON",
-    "ORDER", "BY",       "FROM",   "AS",     "ASC",  "DESC", "UNION", "ALL"};
+    "GROUP", "HAVING",   "ORDER",  "BY",     "FROM", "AS",   "ASC",   "DESC",
+    "UNION", "ALL"};
 
 int swq_is_reserved_keyword(const char *pszStr)
 {
@@ -563,7 +563,10 @@ char *swq_expr_node::Unparse(swq_field_list *field_list, char chColumnQuote)
     {
         if (field_list == nullptr)
         {
-            if (table_name)
+            // COUNT(*)
+            if (table_name == nullptr && strcmp(string_value, "*") == 0)
+                osExpr = "*";
+            else if (table_name)
                 osExpr.Printf(
                     "%s.%s",
                     QuoteIfNecessary(table_name, chColumnQuote).c_str(),
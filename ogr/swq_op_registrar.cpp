@@ -57,6 +57,8 @@ static const swq_operation swq_apsOperations[] = {
     {"SUM", SWQ_SUM, SWQGeneralEvaluator, SWQColumnFuncChecker},
     {"STDDEV_POP", SWQ_STDDEV_POP, SWQGeneralEvaluator, SWQColumnFuncChecker},
     {"STDDEV_SAMP", SWQ_STDDEV_SAMP, SWQGeneralEvaluator, SWQColumnFuncChecker},
+    {"ST_UNION", SWQ_ST_UNION, SWQGeneralEvaluator, SWQColumnFuncChecker},
+    {"ST_EXTENT", SWQ_ST_EXTENT, SWQGeneralEvaluator, SWQColumnFuncChecker},
 
     {"CAST", SWQ_CAST, SWQCastEvaluator, SWQCastChecker}};
 
@@ -170,53 +170,59 @@ enum yysymbol_kind_t
   YYSYMBOL_SWQT_EXCEPT = 31,               /* "EXCEPT"  */
   YYSYMBOL_SWQT_EXCLUDE = 32,              /* "EXCLUDE"  */
   YYSYMBOL_SWQT_HIDDEN = 33,               /* "HIDDEN"  */
-  YYSYMBOL_SWQT_VALUE_START = 34,          /* SWQT_VALUE_START  */
-  YYSYMBOL_SWQT_SELECT_START = 35,         /* SWQT_SELECT_START  */
-  YYSYMBOL_SWQT_NOT = 36,                  /* "NOT"  */
-  YYSYMBOL_SWQT_OR = 37,                   /* "OR"  */
-  YYSYMBOL_SWQT_AND = 38,                  /* "AND"  */
-  YYSYMBOL_39_ = 39,                       /* '='  */
-  YYSYMBOL_40_ = 40,                       /* '<'  */
-  YYSYMBOL_41_ = 41,                       /* '>'  */
-  YYSYMBOL_42_ = 42,                       /* '!'  */
-  YYSYMBOL_43_ = 43,                       /* '+'  */
-  YYSYMBOL_44_ = 44,                       /* '-'  */
-  YYSYMBOL_45_ = 45,                       /* '*'  */
-  YYSYMBOL_46_ = 46,                       /* '/'  */
-  YYSYMBOL_47_ = 47,                       /* '%'  */
-  YYSYMBOL_SWQT_UMINUS = 48,               /* SWQT_UMINUS  */
-  YYSYMBOL_SWQT_RESERVED_KEYWORD = 49,     /* "reserved keyword"  */
-  YYSYMBOL_50_ = 50,                       /* '('  */
-  YYSYMBOL_51_ = 51,                       /* ')'  */
-  YYSYMBOL_52_ = 52,                       /* ','  */
-  YYSYMBOL_53_ = 53,                       /* '.'  */
-  YYSYMBOL_YYACCEPT = 54,                  /* $accept  */
-  YYSYMBOL_input = 55,                     /* input  */
-  YYSYMBOL_value_expr = 56,                /* value_expr  */
-  YYSYMBOL_value_expr_list = 57,           /* value_expr_list  */
-  YYSYMBOL_identifier = 58,                /* identifier  */
-  YYSYMBOL_field_value = 59,               /* field_value  */
-  YYSYMBOL_value_expr_non_logical = 60,    /* value_expr_non_logical  */
-  YYSYMBOL_type_def = 61,                  /* type_def  */
-  YYSYMBOL_select_statement = 62,          /* select_statement  */
-  YYSYMBOL_select_core = 63,               /* select_core  */
-  YYSYMBOL_opt_union_all = 64,             /* opt_union_all  */
-  YYSYMBOL_union_all = 65,                 /* union_all  */
-  YYSYMBOL_select_field_list = 66,         /* select_field_list  */
-  YYSYMBOL_exclude_field = 67,             /* exclude_field  */
-  YYSYMBOL_exclude_field_list = 68,        /* exclude_field_list  */
-  YYSYMBOL_except_or_exclude = 69,         /* except_or_exclude  */
-  YYSYMBOL_column_spec = 70,               /* column_spec  */
-  YYSYMBOL_as_clause = 71,                 /* as_clause  */
-  YYSYMBOL_as_clause_with_hidden = 72,     /* as_clause_with_hidden  */
-  YYSYMBOL_opt_where = 73,                 /* opt_where  */
-  YYSYMBOL_opt_joins = 74,                 /* opt_joins  */
-  YYSYMBOL_opt_order_by = 75,              /* opt_order_by  */
-  YYSYMBOL_sort_spec_list = 76,            /* sort_spec_list  */
-  YYSYMBOL_sort_spec = 77,                 /* sort_spec  */
-  YYSYMBOL_opt_limit = 78,                 /* opt_limit  */
-  YYSYMBOL_opt_offset = 79,                /* opt_offset  */
-  YYSYMBOL_table_def = 80                  /* table_def  */
+  YYSYMBOL_SWQT_GROUP = 34,                /* "GROUP"  */
+  YYSYMBOL_SWQT_HAVING = 35,               /* "HAVING"  */
+  YYSYMBOL_SWQT_VALUE_START = 36,          /* SWQT_VALUE_START  */
+  YYSYMBOL_SWQT_SELECT_START = 37,         /* SWQT_SELECT_START  */
+  YYSYMBOL_SWQT_NOT = 38,                  /* "NOT"  */
+  YYSYMBOL_SWQT_OR = 39,                   /* "OR"  */
+  YYSYMBOL_SWQT_AND = 40,                  /* "AND"  */
+  YYSYMBOL_41_ = 41,                       /* '='  */
+  YYSYMBOL_42_ = 42,                       /* '<'  */
+  YYSYMBOL_43_ = 43,                       /* '>'  */
+  YYSYMBOL_44_ = 44,                       /* '!'  */
+  YYSYMBOL_45_ = 45,                       /* '+'  */
+  YYSYMBOL_46_ = 46,                       /* '-'  */
+  YYSYMBOL_47_ = 47,                       /* '*'  */
+  YYSYMBOL_48_ = 48,                       /* '/'  */
+  YYSYMBOL_49_ = 49,                       /* '%'  */
+  YYSYMBOL_SWQT_UMINUS = 50,               /* SWQT_UMINUS  */
+  YYSYMBOL_SWQT_RESERVED_KEYWORD = 51,     /* "reserved keyword"  */
+  YYSYMBOL_52_ = 52,                       /* '('  */
+  YYSYMBOL_53_ = 53,                       /* ')'  */
+  YYSYMBOL_54_ = 54,                       /* ','  */
+  YYSYMBOL_55_ = 55,                       /* '.'  */
+  YYSYMBOL_YYACCEPT = 56,                  /* $accept  */
+  YYSYMBOL_input = 57,                     /* input  */
+  YYSYMBOL_value_expr = 58,                /* value_expr  */
+  YYSYMBOL_value_expr_list = 59,           /* value_expr_list  */
+  YYSYMBOL_identifier = 60,                /* identifier  */
+  YYSYMBOL_field_value = 61,               /* field_value  */
+  YYSYMBOL_value_expr_non_logical = 62,    /* value_expr_non_logical  */
+  YYSYMBOL_type_def = 63,                  /* type_def  */
+  YYSYMBOL_select_statement = 64,          /* select_statement  */
+  YYSYMBOL_select_core = 65,               /* select_core  */
+  YYSYMBOL_opt_union_all = 66,             /* opt_union_all  */
+  YYSYMBOL_union_all = 67,                 /* union_all  */
+  YYSYMBOL_select_field_list = 68,         /* select_field_list  */
+  YYSYMBOL_exclude_field = 69,             /* exclude_field  */
+  YYSYMBOL_exclude_field_list = 70,        /* exclude_field_list  */
+  YYSYMBOL_except_or_exclude = 71,         /* except_or_exclude  */
+  YYSYMBOL_column_spec = 72,               /* column_spec  */
+  YYSYMBOL_as_clause = 73,                 /* as_clause  */
+  YYSYMBOL_as_clause_with_hidden = 74,     /* as_clause_with_hidden  */
+  YYSYMBOL_opt_where = 75,                 /* opt_where  */
+  YYSYMBOL_opt_joins = 76,                 /* opt_joins  */
+  YYSYMBOL_opt_group_by = 77,              /* opt_group_by  */
+  YYSYMBOL_group_spec_list = 78,           /* group_spec_list  */
+  YYSYMBOL_group_spec = 79,                /* group_spec  */
+  YYSYMBOL_opt_having = 80,                /* opt_having  */
+  YYSYMBOL_opt_order_by = 81,              /* opt_order_by  */
+  YYSYMBOL_sort_spec_list = 82,            /* sort_spec_list  */
+  YYSYMBOL_sort_spec = 83,                 /* sort_spec  */
+  YYSYMBOL_opt_limit = 84,                 /* opt_limit  */
+  YYSYMBOL_opt_offset = 85,                /* opt_offset  */
+  YYSYMBOL_table_def = 86                  /* table_def  */
 };
 typedef enum yysymbol_kind_t yysymbol_kind_t;
 
@@ -544,19 +550,19 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  22
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   469
+#define YYLAST   524
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  54
+#define YYNTOKENS  56
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  27
+#define YYNNTS  31
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  105
+#define YYNRULES  111
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  215
+#define YYNSTATES  226
 
 /* YYMAXUTOK -- Last valid token kind.  */
-#define YYMAXUTOK   295
+#define YYMAXUTOK   297
 
 
 /* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
@@ -573,10 +579,10 @@ static const yytype_int8 yytranslate[] =
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,    42,     2,     2,     2,    47,     2,     2,
-      50,    51,    45,    43,    52,    44,    53,    46,     2,     2,
+       2,     2,     2,    44,     2,     2,     2,    49,     2,     2,
+      52,    53,    47,    45,    54,    46,    55,    48,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-      40,    39,    41,     2,     2,     2,     2,     2,     2,     2,
+      42,    41,    43,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -599,24 +605,25 @@ static const yytype_int8 yytranslate[] =
        5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    48,    49
+      35,    36,    37,    38,    39,    40,    50,    51
 };
 
 #if YYDEBUG
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,   109,   109,   110,   116,   123,   128,   139,   150,   163,
-     177,   191,   205,   219,   233,   247,   261,   275,   289,   303,
-     321,   336,   355,   369,   387,   402,   421,   436,   455,   470,
-     489,   502,   520,   532,   545,   547,   550,   558,   571,   576,
-     581,   585,   590,   595,   600,   641,   654,   667,   680,   693,
-     706,   742,   756,   768,   775,   784,   802,   822,   823,   826,
-     831,   837,   838,   840,   848,   849,   852,   862,   863,   866,
-     867,   870,   879,   890,   905,   920,   941,   972,  1007,  1032,
-    1061,  1067,  1070,  1072,  1081,  1082,  1087,  1088,  1094,  1101,
-    1102,  1105,  1106,  1109,  1115,  1121,  1128,  1129,  1136,  1137,
-    1145,  1155,  1166,  1177,  1190,  1201
+       0,   111,   111,   112,   118,   125,   130,   141,   152,   165,
+     179,   193,   207,   221,   235,   249,   263,   277,   291,   305,
+     323,   338,   357,   371,   389,   404,   423,   438,   457,   472,
+     491,   504,   522,   534,   547,   549,   552,   560,   573,   578,
+     583,   587,   592,   597,   602,   643,   656,   669,   682,   695,
+     708,   744,   769,   783,   795,   802,   811,   829,   849,   850,
+     853,   858,   864,   865,   867,   875,   876,   879,   889,   890,
+     893,   894,   897,   906,   917,   932,   947,   968,   993,  1022,
+    1028,  1031,  1033,  1042,  1043,  1048,  1049,  1055,  1062,  1063,
+    1066,  1067,  1070,  1077,  1078,  1083,  1084,  1087,  1088,  1091,
+    1097,  1103,  1110,  1111,  1118,  1119,  1127,  1137,  1148,  1159,
+    1172,  1183
 };
 #endif
 
@@ -639,16 +646,17 @@ static const char *const yytname[] =
   "\"IS\"", "\"SELECT\"", "\"LEFT\"", "\"JOIN\"", "\"WHERE\"", "\"ON\"",
   "\"ORDER\"", "\"BY\"", "\"FROM\"", "\"AS\"", "\"ASC\"", "\"DESC\"",
   "\"DISTINCT\"", "\"CAST\"", "\"UNION\"", "\"ALL\"", "\"LIMIT\"",
-  "\"OFFSET\"", "\"EXCEPT\"", "\"EXCLUDE\"", "\"HIDDEN\"",
-  "SWQT_VALUE_START", "SWQT_SELECT_START", "\"NOT\"", "\"OR\"", "\"AND\"",
-  "'='", "'<'", "'>'", "'!'", "'+'", "'-'", "'*'", "'/'", "'%'",
-  "SWQT_UMINUS", "\"reserved keyword\"", "'('", "')'", "','", "'.'",
-  "$accept", "input", "value_expr", "value_expr_list", "identifier",
+  "\"OFFSET\"", "\"EXCEPT\"", "\"EXCLUDE\"", "\"HIDDEN\"", "\"GROUP\"",
+  "\"HAVING\"", "SWQT_VALUE_START", "SWQT_SELECT_START", "\"NOT\"",
+  "\"OR\"", "\"AND\"", "'='", "'<'", "'>'", "'!'", "'+'", "'-'", "'*'",
+  "'/'", "'%'", "SWQT_UMINUS", "\"reserved keyword\"", "'('", "')'", "','",
+  "'.'", "$accept", "input", "value_expr", "value_expr_list", "identifier",
   "field_value", "value_expr_non_logical", "type_def", "select_statement",
   "select_core", "opt_union_all", "union_all", "select_field_list",
   "exclude_field", "exclude_field_list", "except_or_exclude",
   "column_spec", "as_clause", "as_clause_with_hidden", "opt_where",
-  "opt_joins", "opt_order_by", "sort_spec_list", "sort_spec", "opt_limit",
+  "opt_joins", "opt_group_by", "group_spec_list", "group_spec",
+  "opt_having", "opt_order_by", "sort_spec_list", "sort_spec", "opt_limit",
   "opt_offset", "table_def", YY_NULLPTR
 };
 
@@ -660,7 +668,7 @@ yysymbol_name (yysymbol_kind_t yysymbol)
 }
 #endif
 
-#define YYPACT_NINF (-136)
+#define YYPACT_NINF (-141)
 
 #define yypact_value_is_default(Yyn) \
   ((Yyn) == YYPACT_NINF)
@@ -674,28 +682,29 @@ yysymbol_name (yysymbol_kind_t yysymbol)
    STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-      66,    93,   -13,    11,  -136,  -136,  -136,  -136,  -136,   -24,
-    -136,    93,   292,    93,   413,   -34,  -136,   174,   136,    21,
-    -136,    30,  -136,    93,   427,  -136,   315,    -9,    93,    93,
-     292,     2,   116,    93,    93,   172,   197,   239,    25,    93,
-       0,   292,   292,   292,   292,   292,   258,    84,   356,   -32,
-      27,    19,    23,    48,  -136,   -13,   377,  -136,    93,    73,
-      75,   145,  -136,    92,    57,    93,    93,   292,   420,   298,
-      93,    93,  -136,    93,    93,  -136,    93,  -136,    93,   308,
-      62,  -136,   -22,   -22,  -136,  -136,  -136,   107,  -136,  -136,
-      72,     0,  -136,   111,  -136,   223,    14,     7,   258,    30,
-    -136,  -136,     0,    95,    93,    93,   292,  -136,    93,   144,
-     149,   399,  -136,  -136,  -136,  -136,  -136,  -136,    93,  -136,
-       7,     0,  -136,  -136,     0,   109,  -136,   110,    55,   102,
-    -136,  -136,   114,   115,  -136,  -136,  -136,   174,   117,    93,
-      93,   292,  -136,   102,   118,  -136,   121,   119,   128,     9,
-       0,     0,  -136,   151,     7,   165,    -1,  -136,  -136,  -136,
-    -136,   174,   165,     0,  -136,     9,  -136,     9,     9,     7,
-     167,    93,   176,    83,   101,   176,  -136,  -136,  -136,  -136,
-     175,    93,   413,   179,   178,  -136,   193,  -136,   201,   178,
-      93,   364,     0,   207,   181,   163,   164,   181,   364,  -136,
-     134,  -136,   173,  -136,   221,  -136,  -136,  -136,  -136,  -136,
-    -136,  -136,     0,  -136,  -136
+     -29,   122,    -3,     1,  -141,  -141,  -141,  -141,  -141,   -37,
+    -141,   122,   335,   122,   458,   -31,  -141,   228,   158,     5,
+    -141,    17,  -141,   122,    88,  -141,   369,   -26,   122,   122,
+     335,     4,   164,   122,   122,   194,   212,   266,    18,   310,
+       7,   335,   335,   335,   335,   335,   320,    31,   412,    54,
+      27,   -16,    21,    65,  -141,    -3,   435,  -141,   122,    90,
+      92,   239,  -141,    98,    60,   122,   122,   335,   473,   480,
+     122,   122,  -141,   122,   122,  -141,   122,  -141,   122,    68,
+     362,    80,  -141,    75,    75,  -141,  -141,  -141,   123,  -141,
+    -141,    91,     7,  -141,   113,  -141,   256,    14,    74,   320,
+      17,  -141,  -141,     7,    96,   122,   122,   335,  -141,   122,
+     140,   141,   343,  -141,  -141,  -141,  -141,  -141,  -141,  -141,
+     122,  -141,    74,     7,  -141,  -141,     7,  -141,    97,    -4,
+      70,  -141,  -141,   115,   112,  -141,  -141,  -141,   228,   124,
+     122,   122,   335,  -141,    70,   111,  -141,   126,   125,   128,
+       7,     7,  -141,   160,    74,   168,    78,  -141,  -141,  -141,
+    -141,   228,   168,     7,  -141,    86,    86,    86,    74,   169,
+     122,   152,    62,    82,   152,  -141,  -141,  -141,  -141,   171,
+     122,   458,   170,   173,  -141,   191,  -141,   192,   173,   122,
+     420,     7,   181,   174,   154,   156,   174,   420,  -141,  -141,
+     176,   159,     7,   209,   189,  -141,  -141,   189,  -141,   122,
+    -141,     7,   114,  -141,   167,  -141,   219,  -141,  -141,   458,
+    -141,  -141,  -141,     7,  -141,  -141
 };
 
 /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
@@ -705,42 +714,45 @@ static const yytype_int8 yydefact[] =
 {
        2,     0,     0,     0,    38,    39,    40,    34,    43,     0,
       35,     0,     0,     0,     3,    36,    41,     5,     0,     0,
-       4,    61,     1,     0,     8,    44,     0,     0,     0,     0,
+       4,    62,     1,     0,     8,    44,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,    74,    71,    36,
-       0,    64,     0,     0,    57,     0,     0,    42,     0,    18,
+       0,     0,     0,     0,     0,     0,     0,    75,    72,    36,
+       0,    65,     0,     0,    58,     0,     0,    42,     0,    18,
       22,     0,    30,     0,     0,     0,     0,     0,     7,     6,
-       0,     0,     9,     0,     0,    12,     0,    13,     0,    33,
-       0,    37,    45,    46,    47,    48,    49,     0,    69,    70,
-       0,     0,    81,    82,    72,     0,     0,     0,     0,    61,
-      63,    62,     0,     0,     0,     0,     0,    31,     0,    19,
-      23,     0,    15,    16,    14,    10,    17,    11,     0,    50,
-       0,     0,    80,    83,     0,     0,    75,     0,   100,    86,
-      65,    58,    52,     0,    26,    20,    24,    28,     0,     0,
-       0,     0,    32,    86,    36,    66,    67,     0,     0,    76,
-       0,     0,   101,     0,     0,    84,     0,    51,    27,    21,
-      25,    29,    84,     0,    73,    78,    77,   102,   104,     0,
-       0,     0,    89,     0,     0,    89,    68,    79,   103,   105,
-       0,     0,    85,     0,    96,    53,     0,    55,     0,    96,
-       0,    86,     0,     0,    98,     0,     0,    98,    86,    87,
-      93,    90,    92,    97,     0,    59,    54,    56,    60,    88,
-      94,    95,     0,    99,    91
+       0,     0,     9,     0,     0,    12,     0,    13,     0,     0,
+      33,     0,    37,    45,    46,    47,    48,    49,     0,    70,
+      71,     0,     0,    80,    81,    73,     0,     0,     0,     0,
+      62,    64,    63,     0,     0,     0,     0,     0,    31,     0,
+      19,    23,     0,    15,    16,    14,    10,    17,    11,    51,
+       0,    50,     0,     0,    79,    82,     0,    76,     0,   106,
+      85,    66,    59,    53,     0,    26,    20,    24,    28,     0,
+       0,     0,     0,    32,    85,    36,    67,    68,     0,     0,
+       0,     0,   107,     0,     0,    83,     0,    52,    27,    21,
+      25,    29,    83,     0,    74,    77,   108,   110,     0,     0,
+       0,    88,     0,     0,    88,    69,    78,   109,   111,     0,
+       0,    84,     0,    95,    54,     0,    56,     0,    95,     0,
+      85,     0,     0,   102,     0,     0,   102,    85,    86,    92,
+      93,    91,     0,     0,   104,    55,    57,   104,    87,     0,
+      89,     0,    99,    96,    98,   103,     0,    60,    61,    94,
+      90,   100,   101,     0,   105,    97
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -136,  -136,    16,   -48,   -18,  -117,    24,  -136,   177,   212,
-     135,  -136,   -43,  -136,    74,  -136,  -136,   -56,  -136,    77,
-    -135,    65,    34,  -136,    61,    56,  -111
+    -141,  -141,    -1,   -33,    -9,  -120,    11,  -141,   175,   204,
+     129,  -141,   -41,  -141,    63,  -141,  -141,   -99,  -141,    66,
+    -140,    51,    20,  -141,  -141,    45,    12,  -141,    38,    32,
+    -108
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_uint8 yydefgoto[] =
 {
-       0,     3,    79,    80,    15,    16,    17,   133,    20,    21,
-      54,    55,    50,   146,   147,    90,    51,    93,    94,   172,
-     155,   184,   201,   202,   194,   205,   129
+       0,     3,    80,    81,    15,    16,    17,   134,    20,    21,
+      54,    55,    50,   147,   148,    91,    51,    94,    95,   171,
+     155,   183,   200,   201,   210,   193,   213,   214,   204,   217,
+     130
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
@@ -748,148 +760,162 @@ static const yytype_uint8 yydefgoto[] =
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
-      49,    18,   173,    87,   145,     7,     7,   148,   162,   143,
-     103,    22,   127,     7,    62,     7,    39,    14,    95,    40,
-       7,    96,    81,    43,    44,    45,    23,    24,    49,    26,
-      92,    91,    10,    10,    48,    18,    25,    19,    63,    56,
-      10,    58,    10,   170,    59,    60,   145,    10,    97,    68,
-      69,    72,    75,    77,    61,   130,   199,    53,   180,   126,
-     138,     7,    48,   209,    78,    82,    83,    84,    85,    86,
-     142,    98,   152,   122,    99,   200,   100,    91,    81,   128,
-      49,   109,   110,   104,   132,   105,   112,   113,    10,   114,
-     115,   111,   116,   166,   117,   200,     4,     5,     6,     7,
-       1,     2,   128,   144,   107,     8,   144,   108,   151,   177,
-      92,   178,   179,   119,    48,    88,    89,   153,   154,     9,
-     135,   136,   121,    64,    65,    66,    10,    67,   120,    11,
-     137,    92,   167,   168,   185,   186,   128,    12,   174,     4,
-       5,     6,     7,    13,   123,   144,   134,    92,     8,    92,
-      92,   128,   187,   188,   139,   159,   160,   210,   211,   140,
-     149,    46,     9,   150,   156,   161,   157,   169,   158,    10,
-     164,    40,    11,   163,   144,     4,     5,     6,     7,   165,
-      12,    47,   171,   106,     8,   181,    13,   182,    41,    42,
-      43,    44,    45,   190,   144,   183,   195,   191,     9,   192,
-       4,     5,     6,     7,   196,    10,   198,   193,    11,     8,
-     203,   204,    70,    71,   206,   207,    12,    41,    42,    43,
-      44,    45,    13,     9,   213,   212,     4,     5,     6,     7,
-      10,    52,   101,    11,   131,     8,    73,   176,    74,   175,
-     189,    12,     4,     5,     6,     7,   214,    13,   124,     9,
-     197,     8,     0,   208,     0,     0,    10,     0,     0,    11,
-       0,     4,     5,     6,     7,     9,     0,    12,   125,     0,
-       8,     0,    10,    13,     0,    11,     0,     0,    76,     0,
-       0,     0,     0,    12,     9,     0,     0,     0,     0,    13,
-       0,    10,     0,     0,    11,     4,     5,     6,     7,     0,
-       0,     0,    12,    47,     8,    27,    28,    29,    13,    30,
-       0,    31,     0,     0,     0,    27,    28,    29,     9,    30,
-       0,    31,    27,    28,    29,    10,    30,     0,    31,     0,
-       0,     0,     0,     0,    32,     0,    12,    35,    36,    37,
-      38,     0,    13,     0,    32,    33,    34,    35,    36,    37,
-      38,    32,    33,    34,    35,    36,    37,    38,     0,     0,
-     118,     0,     7,    27,    28,    29,    57,    30,     0,    31,
-       0,    27,    28,    29,     0,    30,     0,    31,    91,   153,
-     154,     0,     0,     0,    27,    28,    29,     0,    30,    10,
-      31,     0,    32,    33,    34,    35,    36,    37,    38,   102,
-      32,    33,    34,    35,    36,    37,    38,     0,     0,     0,
-       0,     0,     0,    32,    33,    34,    35,    36,    37,    38,
+      14,    22,     7,   146,   162,    88,   149,     1,     2,    49,
+      24,    18,    26,     7,   144,    23,    62,    48,    92,    18,
+       7,    39,    56,    25,    40,   104,    58,    59,    60,    10,
+     152,    82,    68,    69,    72,    75,    77,    49,    99,    93,
+      10,    61,    63,   146,    53,    48,   169,    10,    98,    19,
+     198,   151,    83,    84,    85,    86,    87,   208,   131,    78,
+     179,   127,    89,    90,   110,   111,   176,   177,   178,   113,
+     114,   199,   115,   116,   100,   117,   139,   118,   112,   128,
+       7,   172,   212,   124,     7,   153,   154,   143,    82,   129,
+      49,   199,     7,   101,   133,    27,    28,    29,    48,    30,
+     105,    31,   106,   212,   136,   137,    96,    10,    92,    97,
+     108,    10,   109,   129,   145,   184,   185,   145,   138,    10,
+      93,   119,    43,    44,    45,     4,     5,     6,     7,    35,
+      36,    37,    38,   121,     8,   186,   187,   221,   222,   159,
+     160,   166,   167,   123,   122,   129,   125,   173,     9,   135,
+     140,   141,   150,   161,   145,    10,    93,    93,    93,   129,
+      11,     4,     5,     6,     7,   157,    40,   156,    12,   181,
+       8,    64,    65,    66,    13,    67,   168,   158,   164,   190,
+     163,   165,   145,    46,     9,   170,   182,   180,   197,   189,
+     191,    10,   192,   145,   194,   195,    11,     4,     5,     6,
+       7,   202,   145,   203,    12,    47,     8,   205,   219,   206,
+      13,   209,   215,   211,   145,     4,     5,     6,     7,   216,
+       9,   223,   224,    52,     8,   188,   175,    10,   174,   132,
+     102,   220,    11,   196,   207,   225,    70,    71,     9,   218,
+      12,     0,     0,     0,     0,    10,    13,     0,     0,     0,
+      11,     0,     0,    73,     0,    74,     0,     0,    12,     4,
+       5,     6,     7,     0,    13,     0,     0,     0,     8,     4,
+       5,     6,     7,    41,    42,    43,    44,    45,     8,   107,
+       0,   126,     9,     0,    41,    42,    43,    44,    45,    10,
+       0,     0,     9,     0,    11,     0,     0,     0,     0,    10,
+       0,     0,    12,    79,    11,     0,     0,    76,    13,     0,
+       0,     0,    12,     4,     5,     6,     7,     0,    13,     0,
+       0,     0,     8,     4,     5,     6,     7,     0,     0,     0,
+       0,     0,     8,     0,     0,     0,     9,     0,     4,     5,
+       6,     7,     0,    10,     0,     0,     9,     8,    11,     0,
+       0,     0,     0,    10,     0,     0,    12,    79,    11,     0,
+       0,     9,    13,     0,     0,     0,    12,    47,    10,    27,
+      28,    29,    13,    30,     0,    31,    27,    28,    29,     0,
+      30,    12,    31,   142,     0,     0,     0,    13,    41,    42,
+      43,    44,    45,     0,     0,     0,     0,     0,     0,     0,
+      32,    33,    34,    35,    36,    37,    38,    32,    33,    34,
+      35,    36,    37,    38,     0,     0,   120,     0,     7,    27,
+      28,    29,    57,    30,     0,    31,     0,    27,    28,    29,
+       0,    30,     0,    31,    92,   153,   154,     0,     0,     0,
+       0,     0,    27,    28,    29,    10,    30,     0,    31,     0,
+      32,    33,    34,    35,    36,    37,    38,   103,    32,    33,
+      34,    35,    36,    37,    38,    27,    28,    29,     0,    30,
+       0,    31,     0,    32,    33,    34,    35,    36,    37,    38,
       27,    28,    29,     0,    30,     0,    31,    27,    28,    29,
-       0,    30,     0,    31,    27,    28,    29,   141,    30,     0,
-      31,     0,    41,    42,    43,    44,    45,     0,     0,    32,
-      33,    34,    35,    36,    37,    38,    32,     0,    34,    35,
-      36,    37,    38,     0,     0,     0,    35,    36,    37,    38
+       0,    30,     0,    31,     0,     0,    32,    33,    34,    35,
+      36,    37,    38,     0,     0,     0,     0,     0,     0,     0,
+       0,    32,     0,    34,    35,    36,    37,    38,    32,     0,
+       0,    35,    36,    37,    38
 };
 
 static const yytype_int16 yycheck[] =
 {
-      18,    14,     3,    46,   121,     6,     6,   124,   143,   120,
-      58,     0,     5,     6,    12,     6,    50,     1,    50,    53,
-       6,    53,    40,    45,    46,    47,    50,    11,    46,    13,
-      48,    22,    33,    33,    18,    14,    12,    50,    36,    23,
-      33,    50,    33,   154,    28,    29,   163,    33,    21,    33,
-      34,    35,    36,    37,    30,    98,   191,    27,   169,    45,
-     108,     6,    46,   198,    39,    41,    42,    43,    44,    45,
-     118,    52,   128,    91,    51,   192,    28,    22,    96,    97,
-      98,    65,    66,    10,   102,    10,    70,    71,    33,    73,
-      74,    67,    76,   149,    78,   212,     3,     4,     5,     6,
-      34,    35,   120,   121,    12,    12,   124,    50,    53,   165,
-     128,   167,   168,    51,    98,    31,    32,    15,    16,    26,
-     104,   105,    50,     7,     8,     9,    33,    11,    21,    36,
-     106,   149,   150,   151,    51,    52,   154,    44,   156,     3,
-       4,     5,     6,    50,    33,   163,    51,   165,    12,   167,
-     168,   169,    51,    52,    10,   139,   140,    23,    24,    10,
-      51,    25,    26,    53,    50,   141,    51,    16,    51,    33,
-      51,    53,    36,    52,   192,     3,     4,     5,     6,    51,
-      44,    45,    17,    38,    12,    18,    50,   171,    43,    44,
-      45,    46,    47,    18,   212,    19,     3,   181,    26,    20,
-       3,     4,     5,     6,     3,    33,   190,    29,    36,    12,
-       3,    30,    40,    41,    51,    51,    44,    43,    44,    45,
-      46,    47,    50,    26,     3,    52,     3,     4,     5,     6,
-      33,    19,    55,    36,    99,    12,    39,   163,    41,   162,
-     175,    44,     3,     4,     5,     6,   212,    50,    25,    26,
-     189,    12,    -1,   197,    -1,    -1,    33,    -1,    -1,    36,
-      -1,     3,     4,     5,     6,    26,    -1,    44,    45,    -1,
-      12,    -1,    33,    50,    -1,    36,    -1,    -1,    39,    -1,
-      -1,    -1,    -1,    44,    26,    -1,    -1,    -1,    -1,    50,
-      -1,    33,    -1,    -1,    36,     3,     4,     5,     6,    -1,
-      -1,    -1,    44,    45,    12,     7,     8,     9,    50,    11,
-      -1,    13,    -1,    -1,    -1,     7,     8,     9,    26,    11,
-      -1,    13,     7,     8,     9,    33,    11,    -1,    13,    -1,
-      -1,    -1,    -1,    -1,    36,    -1,    44,    39,    40,    41,
-      42,    -1,    50,    -1,    36,    37,    38,    39,    40,    41,
-      42,    36,    37,    38,    39,    40,    41,    42,    -1,    -1,
-      52,    -1,     6,     7,     8,     9,    51,    11,    -1,    13,
-      -1,     7,     8,     9,    -1,    11,    -1,    13,    22,    15,
-      16,    -1,    -1,    -1,     7,     8,     9,    -1,    11,    33,
-      13,    -1,    36,    37,    38,    39,    40,    41,    42,    22,
-      36,    37,    38,    39,    40,    41,    42,    -1,    -1,    -1,
-      -1,    -1,    -1,    36,    37,    38,    39,    40,    41,    42,
+       1,     0,     6,   123,   144,    46,   126,    36,    37,    18,
+      11,    14,    13,     6,   122,    52,    12,    18,    22,    14,
+       6,    52,    23,    12,    55,    58,    52,    28,    29,    33,
+     129,    40,    33,    34,    35,    36,    37,    46,    54,    48,
+      33,    30,    38,   163,    27,    46,   154,    33,    21,    52,
+     190,    55,    41,    42,    43,    44,    45,   197,    99,    41,
+     168,    47,    31,    32,    65,    66,   165,   166,   167,    70,
+      71,   191,    73,    74,    53,    76,   109,    78,    67,     5,
+       6,     3,   202,    92,     6,    15,    16,   120,    97,    98,
+      99,   211,     6,    28,   103,     7,     8,     9,    99,    11,
+      10,    13,    10,   223,   105,   106,    52,    33,    22,    55,
+      12,    33,    52,   122,   123,    53,    54,   126,   107,    33,
+     129,    53,    47,    48,    49,     3,     4,     5,     6,    41,
+      42,    43,    44,    53,    12,    53,    54,    23,    24,   140,
+     141,   150,   151,    52,    21,   154,    33,   156,    26,    53,
+      10,    10,    55,   142,   163,    33,   165,   166,   167,   168,
+      38,     3,     4,     5,     6,    53,    55,    52,    46,   170,
+      12,     7,     8,     9,    52,    11,    16,    53,    53,   180,
+      54,    53,   191,    25,    26,    17,    34,    18,   189,    18,
+      20,    33,    19,   202,     3,     3,    38,     3,     4,     5,
+       6,    20,   211,    29,    46,    47,    12,    53,   209,    53,
+      52,    35,     3,    54,   223,     3,     4,     5,     6,    30,
+      26,    54,     3,    19,    12,   174,   163,    33,   162,   100,
+      55,   211,    38,   188,   196,   223,    42,    43,    26,   207,
+      46,    -1,    -1,    -1,    -1,    33,    52,    -1,    -1,    -1,
+      38,    -1,    -1,    41,    -1,    43,    -1,    -1,    46,     3,
+       4,     5,     6,    -1,    52,    -1,    -1,    -1,    12,     3,
+       4,     5,     6,    45,    46,    47,    48,    49,    12,    40,
+      -1,    25,    26,    -1,    45,    46,    47,    48,    49,    33,
+      -1,    -1,    26,    -1,    38,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    46,    47,    38,    -1,    -1,    41,    52,    -1,
+      -1,    -1,    46,     3,     4,     5,     6,    -1,    52,    -1,
+      -1,    -1,    12,     3,     4,     5,     6,    -1,    -1,    -1,
+      -1,    -1,    12,    -1,    -1,    -1,    26,    -1,     3,     4,
+       5,     6,    -1,    33,    -1,    -1,    26,    12,    38,    -1,
+      -1,    -1,    -1,    33,    -1,    -1,    46,    47,    38,    -1,
+      -1,    26,    52,    -1,    -1,    -1,    46,    47,    33,     7,
+       8,     9,    52,    11,    -1,    13,     7,     8,     9,    -1,
+      11,    46,    13,    40,    -1,    -1,    -1,    52,    45,    46,
+      47,    48,    49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      38,    39,    40,    41,    42,    43,    44,    38,    39,    40,
+      41,    42,    43,    44,    -1,    -1,    54,    -1,     6,     7,
+       8,     9,    53,    11,    -1,    13,    -1,     7,     8,     9,
+      -1,    11,    -1,    13,    22,    15,    16,    -1,    -1,    -1,
+      -1,    -1,     7,     8,     9,    33,    11,    -1,    13,    -1,
+      38,    39,    40,    41,    42,    43,    44,    22,    38,    39,
+      40,    41,    42,    43,    44,     7,     8,     9,    -1,    11,
+      -1,    13,    -1,    38,    39,    40,    41,    42,    43,    44,
        7,     8,     9,    -1,    11,    -1,    13,     7,     8,     9,
-      -1,    11,    -1,    13,     7,     8,     9,    38,    11,    -1,
-      13,    -1,    43,    44,    45,    46,    47,    -1,    -1,    36,
-      37,    38,    39,    40,    41,    42,    36,    -1,    38,    39,
-      40,    41,    42,    -1,    -1,    -1,    39,    40,    41,    42
+      -1,    11,    -1,    13,    -1,    -1,    38,    39,    40,    41,
+      42,    43,    44,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    38,    -1,    40,    41,    42,    43,    44,    38,    -1,
+      -1,    41,    42,    43,    44
 };
 
 /* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
    state STATE-NUM.  */
 static const yytype_int8 yystos[] =
 {
-       0,    34,    35,    55,     3,     4,     5,     6,    12,    26,
-      33,    36,    44,    50,    56,    58,    59,    60,    14,    50,
-      62,    63,     0,    50,    56,    60,    56,     7,     8,     9,
-      11,    13,    36,    37,    38,    39,    40,    41,    42,    50,
-      53,    43,    44,    45,    46,    47,    25,    45,    56,    58,
-      66,    70,    63,    27,    64,    65,    56,    51,    50,    56,
-      56,    60,    12,    36,     7,     8,     9,    11,    56,    56,
-      40,    41,    56,    39,    41,    56,    39,    56,    39,    56,
-      57,    58,    60,    60,    60,    60,    60,    66,    31,    32,
-      69,    22,    58,    71,    72,    50,    53,    21,    52,    51,
-      28,    62,    22,    57,    10,    10,    38,    12,    50,    56,
-      56,    60,    56,    56,    56,    56,    56,    56,    52,    51,
-      21,    50,    58,    33,    25,    45,    45,     5,    58,    80,
-      66,    64,    58,    61,    51,    56,    56,    60,    57,    10,
-      10,    38,    57,    80,    58,    59,    67,    68,    59,    51,
-      53,    53,    71,    15,    16,    74,    50,    51,    51,    56,
-      56,    60,    74,    52,    51,    51,    71,    58,    58,    16,
-      80,    17,    73,     3,    58,    73,    68,    71,    71,    71,
-      80,    18,    56,    19,    75,    51,    52,    51,    52,    75,
-      18,    56,    20,    29,    78,     3,     3,    78,    56,    74,
-      59,    76,    77,     3,    30,    79,    51,    51,    79,    74,
-      23,    24,    52,     3,    76
+       0,    36,    37,    57,     3,     4,     5,     6,    12,    26,
+      33,    38,    46,    52,    58,    60,    61,    62,    14,    52,
+      64,    65,     0,    52,    58,    62,    58,     7,     8,     9,
+      11,    13,    38,    39,    40,    41,    42,    43,    44,    52,
+      55,    45,    46,    47,    48,    49,    25,    47,    58,    60,
+      68,    72,    65,    27,    66,    67,    58,    53,    52,    58,
+      58,    62,    12,    38,     7,     8,     9,    11,    58,    58,
+      42,    43,    58,    41,    43,    58,    41,    58,    41,    47,
+      58,    59,    60,    62,    62,    62,    62,    62,    68,    31,
+      32,    71,    22,    60,    73,    74,    52,    55,    21,    54,
+      53,    28,    64,    22,    59,    10,    10,    40,    12,    52,
+      58,    58,    62,    58,    58,    58,    58,    58,    58,    53,
+      54,    53,    21,    52,    60,    33,    25,    47,     5,    60,
+      86,    68,    66,    60,    63,    53,    58,    58,    62,    59,
+      10,    10,    40,    59,    86,    60,    61,    69,    70,    61,
+      55,    55,    73,    15,    16,    76,    52,    53,    53,    58,
+      58,    62,    76,    54,    53,    53,    60,    60,    16,    86,
+      17,    75,     3,    60,    75,    70,    73,    73,    73,    86,
+      18,    58,    34,    77,    53,    54,    53,    54,    77,    18,
+      58,    20,    19,    81,     3,     3,    81,    58,    76,    61,
+      78,    79,    20,    29,    84,    53,    53,    84,    76,    35,
+      80,    54,    61,    82,    83,     3,    30,    85,    85,    58,
+      78,    23,    24,    54,     3,    82
 };
 
 /* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_int8 yyr1[] =
 {
-       0,    54,    55,    55,    55,    56,    56,    56,    56,    56,
-      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-      56,    56,    56,    56,    56,    56,    56,    56,    56,    56,
-      56,    56,    57,    57,    58,    58,    59,    59,    60,    60,
-      60,    60,    60,    60,    60,    60,    60,    60,    60,    60,
-      60,    60,    61,    61,    61,    61,    61,    62,    62,    63,
-      63,    64,    64,    65,    66,    66,    67,    68,    68,    69,
-      69,    70,    70,    70,    70,    70,    70,    70,    70,    70,
-      71,    71,    72,    72,    73,    73,    74,    74,    74,    75,
-      75,    76,    76,    77,    77,    77,    78,    78,    79,    79,
-      80,    80,    80,    80,    80,    80
+       0,    56,    57,    57,    57,    58,    58,    58,    58,    58,
+      58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
+      58,    58,    58,    58,    58,    58,    58,    58,    58,    58,
+      58,    58,    59,    59,    60,    60,    61,    61,    62,    62,
+      62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
+      62,    62,    62,    63,    63,    63,    63,    63,    64,    64,
+      65,    65,    66,    66,    67,    68,    68,    69,    70,    70,
+      71,    71,    72,    72,    72,    72,    72,    72,    72,    73,
+      73,    74,    74,    75,    75,    76,    76,    76,    77,    77,
+      78,    78,    79,    80,    80,    81,    81,    82,    82,    83,
+      83,    83,    84,    84,    85,    85,    86,    86,    86,    86,
+      86,    86
 };
 
 /* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
@@ -900,12 +926,13 @@ static const yytype_int8 yyr2[] =
        5,     6,     3,     4,     5,     6,     5,     6,     5,     6,
        3,     4,     3,     1,     1,     1,     1,     3,     1,     1,
        1,     1,     3,     1,     2,     3,     3,     3,     3,     3,
-       4,     6,     1,     4,     6,     4,     6,     2,     4,     9,
-      10,     0,     2,     2,     1,     3,     1,     1,     3,     1,
-       1,     1,     2,     5,     1,     3,     4,     5,     5,     6,
-       2,     1,     1,     2,     0,     2,     0,     5,     6,     0,
-       3,     3,     1,     1,     2,     2,     0,     2,     0,     2,
-       1,     2,     3,     4,     3,     4
+       4,     4,     6,     1,     4,     6,     4,     6,     2,     4,
+      10,    11,     0,     2,     2,     1,     3,     1,     1,     3,
+       1,     1,     1,     2,     5,     1,     3,     5,     6,     2,
+       1,     1,     2,     0,     2,     0,     5,     6,     0,     4,
+       3,     1,     1,     0,     2,     0,     3,     3,     1,     1,
+       2,     2,     0,     2,     0,     2,     1,     2,     3,     4,
+       3,     4
 };
 
 
@@ -2376,7 +2403,33 @@ yyreduce:
         }
     break;
 
-  case 51: /* value_expr_non_logical: "CAST" '(' value_expr "AS" type_def ')'  */
+  case 51: /* value_expr_non_logical: identifier '(' '*' ')'  */
+        {
+            // special case for COUNT(*), confirm it.
+            if( !EQUAL(yyvsp[-3]->string_value, "COUNT") )
+            {
+                CPLError( CE_Failure, CPLE_AppDefined,
+                        "Syntax Error with %s(*).",
+                        yyvsp[-3]->string_value );
+                delete yyvsp[-3];
+                YYERROR;
+            }
+
+            delete yyvsp[-3];
+            yyvsp[-3] = nullptr;
+
+            swq_expr_node *poNode = new swq_expr_node();
+            poNode->eNodeType = SNT_COLUMN;
+            poNode->string_value = CPLStrdup( "*" );
+            poNode->table_index = -1;
+            poNode->field_index = -1;
+
+            yyval = new swq_expr_node( SWQ_COUNT );
+            yyval->PushSubExpression( poNode );
+        }
+    break;
+
+  case 52: /* value_expr_non_logical: "CAST" '(' value_expr "AS" type_def ')'  */
         {
             yyval = yyvsp[-1];
             yyval->PushSubExpression( yyvsp[-3] );
@@ -2390,7 +2443,7 @@ yyreduce:
         }
     break;
 
-  case 52: /* type_def: identifier  */
+  case 53: /* type_def: identifier  */
     {
         yyval = new swq_expr_node( SWQ_CAST );
         yyval->PushSubExpression( yyvsp[0] );
@@ -2403,7 +2456,7 @@ yyreduce:
     }
     break;
 
-  case 53: /* type_def: identifier '(' "integer number" ')'  */
+  case 54: /* type_def: identifier '(' "integer number" ')'  */
     {
         yyval = new swq_expr_node( SWQ_CAST );
         yyval->PushSubExpression( yyvsp[-1] );
@@ -2411,7 +2464,7 @@ yyreduce:
     }
     break;
 
-  case 54: /* type_def: identifier '(' "integer number" ',' "integer number" ')'  */
+  case 55: /* type_def: identifier '(' "integer number" ',' "integer number" ')'  */
     {
         yyval = new swq_expr_node( SWQ_CAST );
         yyval->PushSubExpression( yyvsp[-1] );
@@ -2420,7 +2473,7 @@ yyreduce:
     }
     break;
 
-  case 55: /* type_def: identifier '(' identifier ')'  */
+  case 56: /* type_def: identifier '(' identifier ')'  */
     {
         OGRwkbGeometryType eType = OGRFromOGCGeomType(yyvsp[-1]->string_value);
         if( !EQUAL(yyvsp[-3]->string_value, "GEOMETRY") ||
@@ -2438,7 +2491,7 @@ yyreduce:
     }
     break;
 
-  case 56: /* type_def: identifier '(' identifier ',' "integer number" ')'  */
+  case 57: /* type_def: identifier '(' identifier ',' "integer number" ')'  */
     {
         OGRwkbGeometryType eType = OGRFromOGCGeomType(yyvsp[-3]->string_value);
         if( !EQUAL(yyvsp[-5]->string_value, "GEOMETRY") ||
@@ -2458,20 +2511,20 @@ yyreduce:
     }
     break;
 
-  case 59: /* select_core: "SELECT" select_field_list "FROM" table_def opt_joins opt_where opt_order_by opt_limit opt_offset  */
+  case 60: /* select_core: "SELECT" select_field_list "FROM" table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset  */
     {
-        delete yyvsp[-5];
+        delete yyvsp[-6];
     }
     break;
 
-  case 60: /* select_core: "SELECT" "DISTINCT" select_field_list "FROM" table_def opt_joins opt_where opt_order_by opt_limit opt_offset  */
+  case 61: /* select_core: "SELECT" "DISTINCT" select_field_list "FROM" table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset  */
     {
         context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
-        delete yyvsp[-5];
+        delete yyvsp[-6];
     }
     break;
 
-  case 63: /* union_all: "UNION" "ALL"  */
+  case 64: /* union_all: "UNION" "ALL"  */
     {
         swq_select* poNewSelect = new swq_select();
         context->poCurSelect->PushUnionAll(poNewSelect);
@@ -2479,7 +2532,7 @@ yyreduce:
     }
     break;
 
-  case 66: /* exclude_field: field_value  */
+  case 67: /* exclude_field: field_value  */
         {
             if ( !context->poCurSelect->PushExcludeField( yyvsp[0] ) )
             {
@@ -2489,7 +2542,7 @@ yyreduce:
         }
     break;
 
-  case 71: /* column_spec: value_expr  */
+  case 72: /* column_spec: value_expr  */
         {
             if( !context->poCurSelect->PushField( yyvsp[0], nullptr, false, false ) )
             {
@@ -2499,7 +2552,7 @@ yyreduce:
         }
     break;
 
-  case 72: /* column_spec: value_expr as_clause_with_hidden  */
+  case 73: /* column_spec: value_expr as_clause_with_hidden  */
         {
             if( !context->poCurSelect->PushField( yyvsp[-1], yyvsp[0]->string_value, false, yyvsp[0]->bHidden ) )
             {
@@ -2511,7 +2564,7 @@ yyreduce:
         }
     break;
 
-  case 73: /* column_spec: '*' except_or_exclude '(' exclude_field_list ')'  */
+  case 74: /* column_spec: '*' except_or_exclude '(' exclude_field_list ')'  */
         {
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
@@ -2527,7 +2580,7 @@ yyreduce:
         }
     break;
 
-  case 74: /* column_spec: '*'  */
+  case 75: /* column_spec: '*'  */
         {
             swq_expr_node *poNode = new swq_expr_node();
             poNode->eNodeType = SNT_COLUMN;
@@ -2543,7 +2596,7 @@ yyreduce:
         }
     break;
 
-  case 75: /* column_spec: identifier '.' '*'  */
+  case 76: /* column_spec: identifier '.' '*'  */
         {
             CPLString osTableName = yyvsp[-2]->string_value;
 
@@ -2565,75 +2618,7 @@ yyreduce:
         }
     break;
 
-  case 76: /* column_spec: identifier '(' '*' ')'  */
-        {
-                // special case for COUNT(*), confirm it.
-            if( !EQUAL(yyvsp[-3]->string_value, "COUNT") )
-            {
-                CPLError( CE_Failure, CPLE_AppDefined,
-                        "Syntax Error with %s(*).",
-                        yyvsp[-3]->string_value );
-                delete yyvsp[-3];
-                YYERROR;
-            }
-
-            delete yyvsp[-3];
-            yyvsp[-3] = nullptr;
-
-            swq_expr_node *poNode = new swq_expr_node();
-            poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup( "*" );
-            poNode->table_index = -1;
-            poNode->field_index = -1;
-
-            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
-            count->PushSubExpression( poNode );
-
-            if( !context->poCurSelect->PushField( count, nullptr, false, false ) )
-            {
-                delete count;
-                YYERROR;
-            }
-        }
-    break;
-
-  case 77: /* column_spec: identifier '(' '*' ')' as_clause  */
-        {
-                // special case for COUNT(*), confirm it.
-            if( !EQUAL(yyvsp[-4]->string_value, "COUNT") )
-            {
-                CPLError( CE_Failure, CPLE_AppDefined,
-                        "Syntax Error with %s(*).",
-                        yyvsp[-4]->string_value );
-                delete yyvsp[-4];
-                delete yyvsp[0];
-                YYERROR;
-            }
-
-            delete yyvsp[-4];
-            yyvsp[-4] = nullptr;
-
-            swq_expr_node *poNode = new swq_expr_node();
-            poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup( "*" );
-            poNode->table_index = -1;
-            poNode->field_index = -1;
-
-            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
-            count->PushSubExpression( poNode );
-
-            if( !context->poCurSelect->PushField( count, yyvsp[0]->string_value, false, yyvsp[0]->bHidden ) )
-            {
-                delete count;
-                delete yyvsp[0];
-                YYERROR;
-            }
-
-            delete yyvsp[0];
-        }
-    break;
-
-  case 78: /* column_spec: identifier '(' "DISTINCT" field_value ')'  */
+  case 77: /* column_spec: identifier '(' "DISTINCT" field_value ')'  */
         {
                 // special case for COUNT(DISTINCT x), confirm it.
             if( !EQUAL(yyvsp[-4]->string_value, "COUNT") )
@@ -2659,7 +2644,7 @@ yyreduce:
         }
     break;
 
-  case 79: /* column_spec: identifier '(' "DISTINCT" field_value ')' as_clause  */
+  case 78: /* column_spec: identifier '(' "DISTINCT" field_value ')' as_clause  */
         {
             // special case for COUNT(DISTINCT x), confirm it.
             if( !EQUAL(yyvsp[-5]->string_value, "COUNT") )
@@ -2688,14 +2673,14 @@ yyreduce:
         }
     break;
 
-  case 80: /* as_clause: "AS" identifier  */
+  case 79: /* as_clause: "AS" identifier  */
         {
             yyval = yyvsp[0];
             yyvsp[0] = nullptr;
         }
     break;
 
-  case 83: /* as_clause_with_hidden: as_clause "HIDDEN"  */
+  case 82: /* as_clause_with_hidden: as_clause "HIDDEN"  */
         {
             yyval = yyvsp[-1];
             yyvsp[-1] = nullptr;
@@ -2705,13 +2690,13 @@ yyreduce:
         }
     break;
 
-  case 85: /* opt_where: "WHERE" value_expr  */
+  case 84: /* opt_where: "WHERE" value_expr  */
         {
             context->poCurSelect->where_expr = yyvsp[0];
         }
     break;
 
-  case 87: /* opt_joins: "JOIN" table_def "ON" value_expr opt_joins  */
+  case 86: /* opt_joins: "JOIN" table_def "ON" value_expr opt_joins  */
         {
             context->poCurSelect->PushJoin( static_cast<int>(yyvsp[-3]->int_value),
                                             yyvsp[-1] );
@@ -2719,7 +2704,7 @@ yyreduce:
         }
     break;
 
-  case 88: /* opt_joins: "LEFT" "JOIN" table_def "ON" value_expr opt_joins  */
+  case 87: /* opt_joins: "LEFT" "JOIN" table_def "ON" value_expr opt_joins  */
         {
             context->poCurSelect->PushJoin( static_cast<int>(yyvsp[-3]->int_value),
                                             yyvsp[-1] );
@@ -2727,7 +2712,21 @@ yyreduce:
         }
     break;
 
-  case 93: /* sort_spec: field_value  */
+  case 92: /* group_spec: field_value  */
+        {
+            context->poCurSelect->PushGroupBy( yyvsp[0]->table_name, yyvsp[0]->string_value );
+            delete yyvsp[0];
+            yyvsp[0] = nullptr;
+        }
+    break;
+
+  case 94: /* opt_having: "HAVING" value_expr  */
+        {
+            context->poCurSelect->having_expr = yyvsp[0];
+        }
+    break;
+
+  case 99: /* sort_spec: field_value  */
         {
             context->poCurSelect->PushOrderBy( yyvsp[0]->table_name, yyvsp[0]->string_value, TRUE );
             delete yyvsp[0];
@@ -2735,7 +2734,7 @@ yyreduce:
         }
     break;
 
-  case 94: /* sort_spec: field_value "ASC"  */
+  case 100: /* sort_spec: field_value "ASC"  */
         {
             context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, TRUE );
             delete yyvsp[-1];
@@ -2743,7 +2742,7 @@ yyreduce:
         }
     break;
 
-  case 95: /* sort_spec: field_value "DESC"  */
+  case 101: /* sort_spec: field_value "DESC"  */
         {
             context->poCurSelect->PushOrderBy( yyvsp[-1]->table_name, yyvsp[-1]->string_value, FALSE );
             delete yyvsp[-1];
@@ -2751,7 +2750,7 @@ yyreduce:
         }
     break;
 
-  case 97: /* opt_limit: "LIMIT" "integer number"  */
+  case 103: /* opt_limit: "LIMIT" "integer number"  */
     {
         context->poCurSelect->SetLimit( yyvsp[0]->int_value );
         delete yyvsp[0];
@@ -2759,7 +2758,7 @@ yyreduce:
     }
     break;
 
-  case 99: /* opt_offset: "OFFSET" "integer number"  */
+  case 105: /* opt_offset: "OFFSET" "integer number"  */
     {
         context->poCurSelect->SetOffset( yyvsp[0]->int_value );
         delete yyvsp[0];
@@ -2767,7 +2766,7 @@ yyreduce:
     }
     break;
 
-  case 100: /* table_def: identifier  */
+  case 106: /* table_def: identifier  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( nullptr, yyvsp[0]->string_value,
@@ -2778,7 +2777,7 @@ yyreduce:
     }
     break;
 
-  case 101: /* table_def: identifier as_clause  */
+  case 107: /* table_def: identifier as_clause  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( nullptr, yyvsp[-1]->string_value,
@@ -2790,7 +2789,7 @@ yyreduce:
     }
     break;
 
-  case 102: /* table_def: "string" '.' identifier  */
+  case 108: /* table_def: "string" '.' identifier  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
@@ -2802,7 +2801,7 @@ yyreduce:
     }
     break;
 
-  case 103: /* table_def: "string" '.' identifier as_clause  */
+  case 109: /* table_def: "string" '.' identifier as_clause  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
@@ -2816,7 +2815,7 @@ yyreduce:
     }
     break;
 
-  case 104: /* table_def: identifier '.' identifier  */
+  case 110: /* table_def: identifier '.' identifier  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-2]->string_value,
@@ -2828,7 +2827,7 @@ yyreduce:
     }
     break;
 
-  case 105: /* table_def: identifier '.' identifier as_clause  */
+  case 111: /* table_def: identifier '.' identifier as_clause  */
     {
         const int iTable =
             context->poCurSelect->PushTableDef( yyvsp[-3]->string_value,
@@ -85,13 +85,15 @@ extern int swqdebug;
     SWQT_EXCEPT = 286,             /* "EXCEPT"  */
     SWQT_EXCLUDE = 287,            /* "EXCLUDE"  */
     SWQT_HIDDEN = 288,             /* "HIDDEN"  */
-    SWQT_VALUE_START = 289,        /* SWQT_VALUE_START  */
-    SWQT_SELECT_START = 290,       /* SWQT_SELECT_START  */
-    SWQT_NOT = 291,                /* "NOT"  */
-    SWQT_OR = 292,                 /* "OR"  */
-    SWQT_AND = 293,                /* "AND"  */
-    SWQT_UMINUS = 294,             /* SWQT_UMINUS  */
-    SWQT_RESERVED_KEYWORD = 295    /* "reserved keyword"  */
+    SWQT_GROUP = 289,              /* "GROUP"  */
+    SWQT_HAVING = 290,             /* "HAVING"  */
+    SWQT_VALUE_START = 291,        /* SWQT_VALUE_START  */
+    SWQT_SELECT_START = 292,       /* SWQT_SELECT_START  */
+    SWQT_NOT = 293,                /* "NOT"  */
+    SWQT_OR = 294,                 /* "OR"  */
+    SWQT_AND = 295,                /* "AND"  */
+    SWQT_UMINUS = 296,             /* SWQT_UMINUS  */
+    SWQT_RESERVED_KEYWORD = 297    /* "reserved keyword"  */
   };
   typedef enum yytokentype yytoken_kind_t;
 #endif
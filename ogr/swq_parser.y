@@ -76,6 +76,8 @@
 %token SWQT_EXCEPT              "EXCEPT"
 %token SWQT_EXCLUDE             "EXCLUDE"
 %token SWQT_HIDDEN              "HIDDEN"
+%token SWQT_GROUP               "GROUP"
+%token SWQT_HAVING              "HAVING"
 
 %token SWQT_VALUE_START
 %token SWQT_SELECT_START
@@ -739,6 +741,31 @@ value_expr_non_logical:
             }
         }
 
+    | identifier '(' '*' ')'
+        {
+            // special case for COUNT(*), confirm it.
+            if( !EQUAL($1->string_value, "COUNT") )
+            {
+                CPLError( CE_Failure, CPLE_AppDefined,
+                        "Syntax Error with %s(*).",
+                        $1->string_value );
+                delete $1;
+                YYERROR;
+            }
+
+            delete $1;
+            $1 = nullptr;
+
+            swq_expr_node *poNode = new swq_expr_node();
+            poNode->eNodeType = SNT_COLUMN;
+            poNode->string_value = CPLStrdup( "*" );
+            poNode->table_index = -1;
+            poNode->field_index = -1;
+
+            $$ = new swq_expr_node( SWQ_COUNT );
+            $$->PushSubExpression( poNode );
+        }
+
     | SWQT_CAST '(' value_expr SWQT_AS type_def ')'
         {
             $$ = $5;
@@ -823,12 +850,12 @@ select_statement:
     | '(' select_core ')' opt_union_all
 
 select_core:
-    SWQT_SELECT select_field_list SWQT_FROM table_def opt_joins opt_where opt_order_by opt_limit opt_offset
+    SWQT_SELECT select_field_list SWQT_FROM table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset
     {
         delete $4;
     }
 
-    | SWQT_SELECT SWQT_DISTINCT select_field_list SWQT_FROM table_def opt_joins opt_where opt_order_by opt_limit opt_offset
+    | SWQT_SELECT SWQT_DISTINCT select_field_list SWQT_FROM table_def opt_joins opt_where opt_group_by opt_order_by opt_limit opt_offset
     {
         context->poCurSelect->query_mode = SWQM_DISTINCT_LIST;
         delete $5;
@@ -938,72 +965,6 @@ column_spec:
             }
         }
 
-    | identifier '(' '*' ')'
-        {
-                // special case for COUNT(*), confirm it.
-            if( !EQUAL($1->string_value, "COUNT") )
-            {
-                CPLError( CE_Failure, CPLE_AppDefined,
-                        "Syntax Error with %s(*).",
-                        $1->string_value );
-                delete $1;
-                YYERROR;
-            }
-
-            delete $1;
-            $1 = nullptr;
-
-            swq_expr_node *poNode = new swq_expr_node();
-            poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup( "*" );
-            poNode->table_index = -1;
-            poNode->field_index = -1;
-
-            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
-            count->PushSubExpression( poNode );
-
-            if( !context->poCurSelect->PushField( count, nullptr, false, false ) )
-            {
-                delete count;
-                YYERROR;
-            }
-        }
-
-    | identifier '(' '*' ')' as_clause
-        {
-                // special case for COUNT(*), confirm it.
-            if( !EQUAL($1->string_value, "COUNT") )
-            {
-                CPLError( CE_Failure, CPLE_AppDefined,
-                        "Syntax Error with %s(*).",
-                        $1->string_value );
-                delete $1;
-                delete $5;
-                YYERROR;
-            }
-
-            delete $1;
-            $1 = nullptr;
-
-            swq_expr_node *poNode = new swq_expr_node();
-            poNode->eNodeType = SNT_COLUMN;
-            poNode->string_value = CPLStrdup( "*" );
-            poNode->table_index = -1;
-            poNode->field_index = -1;
-
-            swq_expr_node *count = new swq_expr_node( SWQ_COUNT );
-            count->PushSubExpression( poNode );
-
-            if( !context->poCurSelect->PushField( count, $5->string_value, false, $5->bHidden ) )
-            {
-                delete count;
-                delete $5;
-                YYERROR;
-            }
-
-            delete $5;
-        }
-
     | identifier '(' SWQT_DISTINCT field_value ')'
         {
                 // special case for COUNT(DISTINCT x), confirm it.
@@ -1098,6 +1059,27 @@ opt_joins:
             delete $3;
         }
 
+opt_group_by:
+    | SWQT_GROUP SWQT_BY group_spec_list opt_having
+
+group_spec_list:
+    group_spec ',' group_spec_list
+    | group_spec
+
+group_spec:
+    field_value
+        {
+            context->poCurSelect->PushGroupBy( $1->table_name, $1->string_value );
+            delete $1;
+            $1 = nullptr;
+        }
+
+opt_having:
+    | SWQT_HAVING value_expr
+        {
+            context->poCurSelect->having_expr = $2;
+        }
+
 opt_order_by:
     | SWQT_ORDER SWQT_BY sort_spec_list
 
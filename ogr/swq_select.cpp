@@ -84,6 +84,16 @@ swq_select::~swq_select()
 
     CPLFree(order_defs);
 
+    for (int i = 0; i < group_by_count; i++)
+    {
+        CPLFree(group_by_defs[i].table_name);
+        CPLFree(group_by_defs[i].field_name);
+    }
+
+    CPLFree(group_by_defs);
+
+    delete having_expr;
+
     for (int i = 0; i < join_count; i++)
     {
         delete join_defs[i].poExpr;
@@ -212,6 +222,12 @@ char *swq_select::Unparse()
                 case SWQCF_STDDEV_SAMP:
                     osSelect += "STDDEV_SAMP(";
                     break;
+                case SWQCF_ST_UNION:
+                    osSelect += "ST_UNION(";
+                    break;
+                case SWQCF_ST_EXTENT:
+                    osSelect += "ST_EXTENT(";
+                    break;
                 case SWQCF_CUSTOM:
                     break;
             }
@@ -288,6 +304,32 @@ char *swq_select::Unparse()
         CPLFree(pszTmp);
     }
 
+    if (group_by_count > 0)
+    {
+        osSelect += " GROUP BY ";
+        for (int i = 0; i < group_by_count; i++)
+        {
+            if (i > 0)
+                osSelect += ", ";
+            if (group_by_defs[i].table_name[0] != '\0')
+            {
+                osSelect += swq_expr_node::QuoteIfNecessary(
+                    group_by_defs[i].table_name, '"');
+                osSelect += ".";
+            }
+            osSelect += swq_expr_node::QuoteIfNecessary(
+                group_by_defs[i].field_name, '"');
+        }
+
+        if (having_expr != nullptr)
+        {
+            osSelect += " HAVING ";
+            char *pszTmp = having_expr->Unparse(nullptr, '"');
+            osSelect += pszTmp;
+            CPLFree(pszTmp);
+        }
+    }
+
     if (order_specs > 0)
     {
         osSelect += " ORDER BY ";
@@ -716,6 +758,24 @@ void swq_select::PushOrderBy(const char *pszTableName, const char *pszFieldName,
     order_defs[order_specs - 1].ascending_flag = bAscending;
 }
 
+/************************************************************************/
+/*                            PushGroupBy()                             */
+/************************************************************************/
+
+void swq_select::PushGroupBy(const char *pszTableName, const char *pszFieldName)
+
+{
+    group_by_count++;
+    group_by_defs = static_cast<swq_group_by_def *>(
+        CPLRealloc(group_by_defs, sizeof(swq_group_by_def) * group_by_count));
+
+    group_by_defs[group_by_count - 1].table_name =
+        CPLStrdup(pszTableName ? pszTableName : "");
+    group_by_defs[group_by_count - 1].field_name = CPLStrdup(pszFieldName);
+    group_by_defs[group_by_count - 1].table_index = -1;
+    group_by_defs[group_by_count - 1].field_index = -1;
+}
+
 /************************************************************************/
 /*                              PushJoin()                              */
 /************************************************************************/
@@ -955,6 +1015,76 @@ static bool CheckCompatibleJoinExpr(swq_expr_node *poExpr, int secondary_table,
     return false;
 }
 
+/************************************************************************/
+/*                    IsValidColumnFunctionForType()                    */
+/************************************************************************/
+
+static bool IsValidColumnFunctionForType(swq_col_func col_func,
+                                         swq_field_type field_type)
+{
+    switch (col_func)
+    {
+        case SWQCF_NONE:
+        case SWQCF_CUSTOM:
+        case SWQCF_COUNT:
+            return true;
+
+        case SWQCF_MIN:
+        case SWQCF_MAX:
+            return field_type != SWQ_GEOMETRY;
+
+        case SWQCF_AVG:
+        case SWQCF_SUM:
+        case SWQCF_STDDEV_POP:
+        case SWQCF_STDDEV_SAMP:
+            return field_type != SWQ_GEOMETRY && field_type != SWQ_STRING;
+
+        case SWQCF_ST_UNION:
+        case SWQCF_ST_EXTENT:
+            return field_type == SWQ_GEOMETRY;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                     GetColumnFunctionResultType()                    */
+/*                                                                      */
+/*      Type of the value of a column function applied to a field of    */
+/*      the specified type.                                             */
+/************************************************************************/
+
+static swq_field_type GetColumnFunctionResultType(swq_col_func col_func,
+                                                  swq_field_type field_type)
+{
+    switch (col_func)
+    {
+        case SWQCF_COUNT:
+            return SWQ_INTEGER64;
+
+        case SWQCF_AVG:
+            if (field_type == SWQ_DATE || field_type == SWQ_TIME ||
+                field_type == SWQ_TIMESTAMP)
+                return field_type;
+            return SWQ_FLOAT;
+
+        case SWQCF_SUM:
+        case SWQCF_STDDEV_POP:
+        case SWQCF_STDDEV_SAMP:
+            return SWQ_FLOAT;
+
+        case SWQCF_ST_UNION:
+        case SWQCF_ST_EXTENT:
+            return SWQ_GEOMETRY;
+
+        case SWQCF_NONE:
+        case SWQCF_MIN:
+        case SWQCF_MAX:
+        case SWQCF_CUSTOM:
+            break;
+    }
+    return field_type;
+}
+
 /************************************************************************/
 /*                               parse()                                */
 /*                                                                      */
@@ -1017,11 +1147,7 @@ CPLErr swq_select::parse(swq_field_list *field_list,
         }
 
         // Identify column function if present.
-        if (def->col_func != SWQCF_NONE && def->col_func != SWQCF_CUSTOM &&
-            def->col_func != SWQCF_COUNT &&
-            (def->field_type == SWQ_GEOMETRY ||
-             (def->field_type == SWQ_STRING && def->col_func != SWQCF_MIN &&
-              def->col_func != SWQCF_MAX)))
+        if (!IsValidColumnFunctionForType(def->col_func, def->field_type))
         {
             // Possibly this is already enforced by the checker?
             const swq_operation *op = swq_op_registrar::GetOperator(
@@ -1034,6 +1160,13 @@ CPLErr swq_select::parse(swq_field_list *field_list,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      GROUP BY queries follow their own rules for the select list,    */
+    /*      and for the HAVING and ORDER BY clauses.                        */
+    /* -------------------------------------------------------------------- */
+    if (group_by_count > 0)
+        return ParseGroupBy(field_list, poCustomFuncRegistrar);
+
     /* -------------------------------------------------------------------- */
     /*      Check if we are producing a one row summary result or a set     */
     /*      of records.  Generate an error if we get conflicting            */
@@ -1179,6 +1312,435 @@ CPLErr swq_select::parse(swq_field_list *field_list,
     return CE_None;
 }
 
+/************************************************************************/
+/*                            ParseGroupBy()                            */
+/*                                                                      */
+/*      Post-parse processing of a SELECT with a GROUP BY clause.       */
+/************************************************************************/
+
+CPLErr
+swq_select::ParseGroupBy(swq_field_list *field_list,
+                         swq_custom_func_registrar *poCustomFuncRegistrar)
+{
+    if (query_mode == SWQM_DISTINCT_LIST)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "SELECT DISTINCT not supported with GROUP BY.");
+        return CE_Failure;
+    }
+
+    if (join_count > 0)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GROUP BY not supported on a JOIN.");
+        return CE_Failure;
+    }
+
+    query_mode = SWQM_GROUP_BY;
+
+    /* -------------------------------------------------------------------- */
+    /*      Identify the grouping fields.                                   */
+    /* -------------------------------------------------------------------- */
+    for (int i = 0; i < group_by_count; i++)
+    {
+        swq_group_by_def *def = group_by_defs + i;
+
+        swq_field_type field_type;
+        def->field_index =
+            swq_identify_field(def->table_name, def->field_name, field_list,
+                               &field_type, &(def->table_index));
+        if (def->field_index == -1)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Unrecognized field name %s in GROUP BY.",
+                     def->table_name[0]
+                         ? CPLSPrintf("%s.%s", def->table_name, def->field_name)
+                         : def->field_name);
+            return CE_Failure;
+        }
+
+        if (def->table_index != 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use field '%s' of a secondary table in "
+                     "a GROUP BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+
+        if (field_type == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use geometry field '%s' in a GROUP BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Columns are either grouping fields or aggregates.               */
+    /* -------------------------------------------------------------------- */
+    for (int i = 0; i < result_columns(); i++)
+    {
+        const swq_col_def *def = &column_defs[i];
+
+        if (def->col_func == SWQCF_CUSTOM || def->target_type != SWQ_OTHER)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Only fields and aggregate functions are supported "
+                     "in the column list of a GROUP BY query.");
+            return CE_Failure;
+        }
+
+        if (def->col_func == SWQCF_COUNT && def->distinct_flag &&
+            def->field_type == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "SELECT COUNT DISTINCT on a geometry not supported.");
+            return CE_Failure;
+        }
+
+        if (def->col_func != SWQCF_NONE)
+            continue;
+
+        bool bIsGroupingField = false;
+        if (def->expr == nullptr || def->expr->eNodeType == SNT_COLUMN)
+        {
+            for (int j = 0; j < group_by_count; j++)
+            {
+                if (group_by_defs[j].table_index == def->table_index &&
+                    group_by_defs[j].field_index == def->field_index)
+                {
+                    bIsGroupingField = true;
+                    break;
+                }
+            }
+        }
+        if (!bIsGroupingField)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Field %s should appear in the GROUP BY clause or be "
+                     "used in an aggregate function.",
+                     def->field_name[0] ? def->field_name
+                     : def->field_alias ? def->field_alias
+                                        : "(expression)");
+            return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Replace the aggregates and fields of the HAVING clause by       */
+    /*      references to (possibly hidden) columns.                        */
+    /* -------------------------------------------------------------------- */
+    if (having_expr != nullptr)
+    {
+        if (!RewriteHavingExpr(having_expr, field_list))
+            return CE_Failure;
+        if (having_expr->Check(field_list, FALSE, FALSE,
+                               poCustomFuncRegistrar) == SWQ_ERROR)
+            return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      ORDER BY applies to the result columns. field_index is set to   */
+    /*      the index of the column and table_index to -1.                  */
+    /* -------------------------------------------------------------------- */
+    for (int i = 0; i < order_specs; i++)
+    {
+        swq_order_def *def = order_defs + i;
+
+        int iColumn = -1;
+        for (int j = 0; iColumn < 0 && j < result_columns(); j++)
+        {
+            const swq_col_def *col_def = &column_defs[j];
+            if (col_def->bHidden)
+                continue;
+            if (def->table_name[0] == '\0' && col_def->field_alias != nullptr &&
+                EQUAL(col_def->field_alias, def->field_name))
+            {
+                iColumn = j;
+            }
+            else if (col_def->field_alias == nullptr &&
+                     col_def->col_func != SWQCF_NONE &&
+                     def->table_name[0] == '\0')
+            {
+                const swq_operation *op = swq_op_registrar::GetOperator(
+                    static_cast<swq_op>(col_def->col_func));
+                if (EQUAL(CPLSPrintf("%s_%s", op->pszName,
+                                     col_def->field_name),
+                          def->field_name))
+                    iColumn = j;
+            }
+        }
+
+        if (iColumn < 0)
+        {
+            // Grouping field, not necessarily under its own name.
+            swq_field_type field_type;
+            int table_index = 0;
+            const int field_index =
+                swq_identify_field(def->table_name, def->field_name, field_list,
+                                   &field_type, &table_index);
+            for (int j = 0; field_index >= 0 && j < result_columns(); j++)
+            {
+                const swq_col_def *col_def = &column_defs[j];
+                if (!col_def->bHidden && col_def->col_func == SWQCF_NONE &&
+                    col_def->table_index == table_index &&
+                    col_def->field_index == field_index)
+                {
+                    iColumn = j;
+                    break;
+                }
+            }
+        }
+
+        if (iColumn < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "ORDER BY item %s should be a column of the result of "
+                     "a GROUP BY query.",
+                     def->table_name[0]
+                         ? CPLSPrintf("%s.%s", def->table_name, def->field_name)
+                         : def->field_name);
+            return CE_Failure;
+        }
+
+        const swq_col_def *col_def = &column_defs[iColumn];
+        if (GetColumnFunctionResultType(col_def->col_func,
+                                        col_def->field_type) == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot use geometry field '%s' in an ORDER BY clause",
+                     def->field_name);
+            return CE_Failure;
+        }
+
+        def->field_index = iColumn;
+        def->table_index = -1;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Post process the where clause, which applies to source          */
+    /*      features.                                                       */
+    /* -------------------------------------------------------------------- */
+    if (where_expr != nullptr &&
+        where_expr->Check(field_list, FALSE, FALSE, poCustomFuncRegistrar) ==
+            SWQ_ERROR)
+    {
+        return CE_Failure;
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                       FindOrAddHavingColumn()                        */
+/*                                                                      */
+/*      Return the index of the column computing the specified          */
+/*      aggregate (or grouping field if col_func is SWQCF_NONE),        */
+/*      adding a hidden one if there is none.                           */
+/************************************************************************/
+
+int swq_select::FindOrAddHavingColumn(swq_col_func col_func,
+                                      const char *table_name,
+                                      const char *field_name, int table_index,
+                                      int field_index,
+                                      swq_field_type field_type)
+{
+    for (int i = 0; i < result_columns(); i++)
+    {
+        const swq_col_def *def = &column_defs[i];
+        if (def->col_func == col_func && !def->distinct_flag &&
+            def->table_index == table_index &&
+            def->field_index == field_index &&
+            (def->expr == nullptr || def->expr->eNodeType == SNT_COLUMN ||
+             def->col_func != SWQCF_NONE) &&
+            (field_index >= 0 || EQUAL(def->field_name, field_name)))
+        {
+            return i;
+        }
+    }
+
+    column_defs.emplace_back();
+    swq_col_def *def = &column_defs.back();
+    memset(def, 0, sizeof(swq_col_def));
+    def->table_name = CPLStrdup(table_name ? table_name : "");
+    def->field_name = CPLStrdup(field_name);
+    def->col_func = col_func;
+    def->table_index = table_index;
+    def->field_index = field_index;
+    def->field_type = field_type;
+    def->field_precision = -1;
+    def->target_type = SWQ_OTHER;
+    def->target_subtype = OFSTNone;
+    def->bHidden = true;
+
+    return result_columns() - 1;
+}
+
+/************************************************************************/
+/*                         RewriteHavingExpr()                          */
+/************************************************************************/
+
+bool swq_select::RewriteHavingExpr(swq_expr_node *poExpr,
+                                   swq_field_list *field_list)
+{
+    if (poExpr->eNodeType == SNT_CONSTANT)
+        return true;
+
+    int iColumn = -1;
+    if (poExpr->eNodeType == SNT_OPERATION &&
+        poExpr->nOperation >= SWQ_AGGREGATE_BEGIN &&
+        poExpr->nOperation <= SWQ_AGGREGATE_END)
+    {
+        const swq_operation *op = swq_op_registrar::GetOperator(
+            static_cast<swq_op>(poExpr->nOperation));
+        if (poExpr->nSubExprCount != 1 ||
+            poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Argument of %s() in HAVING clause should be a field.",
+                     op->pszName);
+            return false;
+        }
+
+        const swq_expr_node *poArg = poExpr->papoSubExpr[0];
+        const swq_col_func col_func =
+            static_cast<swq_col_func>(poExpr->nOperation);
+        swq_field_type field_type = SWQ_OTHER;
+        int table_index = 0;
+        int field_index = -1;
+        if (!(col_func == SWQCF_COUNT && poArg->table_name == nullptr &&
+              strcmp(poArg->string_value, "*") == 0))
+        {
+            field_index =
+                swq_identify_field(poArg->table_name, poArg->string_value,
+                                   field_list, &field_type, &table_index);
+            if (field_index < 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Unrecognized field name %s in HAVING clause.",
+                         poArg->string_value);
+                return false;
+            }
+            if (table_index != 0)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Cannot use field '%s' of a secondary table in "
+                         "a HAVING clause",
+                         poArg->string_value);
+                return false;
+            }
+        }
+
+        if (!IsValidColumnFunctionForType(col_func, field_type))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Use of field function %s() on %s field %s illegal.",
+                     op->pszName, SWQFieldTypeToString(field_type),
+                     poArg->string_value);
+            return false;
+        }
+        if (GetColumnFunctionResultType(col_func, field_type) == SWQ_GEOMETRY)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "%s() not supported in HAVING clause.", op->pszName);
+            return false;
+        }
+
+        iColumn = FindOrAddHavingColumn(col_func, poArg->table_name,
+                                        poArg->string_value, table_index,
+                                        field_index, field_type);
+    }
+    else if (poExpr->eNodeType == SNT_OPERATION)
+    {
+        for (int i = 0; i < poExpr->nSubExprCount; i++)
+        {
+            if (!RewriteHavingExpr(poExpr->papoSubExpr[i], field_list))
+                return false;
+        }
+        return true;
+    }
+    else
+    {
+        // Alias of a column of the result?
+        for (int i = 0; poExpr->table_name == nullptr && i < result_columns();
+             i++)
+        {
+            const swq_col_def *def = &column_defs[i];
+            if (!def->bHidden && def->field_alias != nullptr &&
+                EQUAL(def->field_alias, poExpr->string_value))
+            {
+                if (GetColumnFunctionResultType(def->col_func,
+                                                def->field_type) ==
+                    SWQ_GEOMETRY)
+                {
+                    CPLError(CE_Failure, CPLE_NotSupported,
+                             "Geometry column %s not supported in HAVING "
+                             "clause.",
+                             poExpr->string_value);
+                    return false;
+                }
+                iColumn = i;
+                break;
+            }
+        }
+
+        // Otherwise, a grouping field.
+        if (iColumn < 0)
+        {
+            swq_field_type field_type;
+            int table_index = 0;
+            const int field_index =
+                swq_identify_field(poExpr->table_name, poExpr->string_value,
+                                   field_list, &field_type, &table_index);
+            for (int i = 0; field_index >= 0 && i < group_by_count; i++)
+            {
+                if (group_by_defs[i].table_index == table_index &&
+                    group_by_defs[i].field_index == field_index)
+                {
+                    iColumn = FindOrAddHavingColumn(
+                        SWQCF_NONE, poExpr->table_name, poExpr->string_value,
+                        table_index, field_index, field_type);
+                    break;
+                }
+            }
+        }
+
+        if (iColumn < 0)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Field %s should appear in the GROUP BY clause or be "
+                     "used in an aggregate function.",
+                     poExpr->string_value);
+            return false;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Turn the node into a reference to the column.                   */
+    /* -------------------------------------------------------------------- */
+    const swq_col_def *def = &column_defs[iColumn];
+    const swq_field_type field_type =
+        GetColumnFunctionResultType(def->col_func, def->field_type);
+    if (poExpr->eNodeType == SNT_OPERATION)
+    {
+        for (int i = 0; i < poExpr->nSubExprCount; i++)
+            delete poExpr->papoSubExpr[i];
+        CPLFree(poExpr->papoSubExpr);
+        poExpr->papoSubExpr = nullptr;
+        poExpr->nSubExprCount = 0;
+        CPLFree(poExpr->string_value);
+        poExpr->string_value = CPLStrdup(def->field_name);
+        poExpr->eNodeType = SNT_COLUMN;
+    }
+    poExpr->field_type = field_type;
+    poExpr->table_index = 0;
+    poExpr->field_index = iColumn;
+
+    return true;
+}
+
 bool swq_select::IsFieldExcluded(int src_index, const char *pszTableName,
                                  const char *pszFieldName)
 {
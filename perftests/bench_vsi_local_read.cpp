@@ -0,0 +1,223 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  bench_vsi_local_read: random reads of COG tiles from a local file
+ *           through VSIFReadMultiRangeL() at various queue depths
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <vector>
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: bench_vsi_local_read [-n <tile_count>] "
+           "[-qd <depth>[,<depth>]...]\n");
+    printf("                            [-seed <seed>] [-no-io-uring] "
+           "[-direct]\n");
+    printf("                            <cog_filename>\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                                main()                                */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    /* -------------------------------------------------------------------- */
+    /*      Process arguments.                                              */
+    /* -------------------------------------------------------------------- */
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    const char *pszDataset = nullptr;
+    int nTileCount = 10000;
+    CPLStringList aosQueueDepths(CSLTokenizeString2("1,4,16,64,256", ",", 0));
+    unsigned nSeed = 0;
+    bool bUseIoUring = true;
+    bool bDirectIO = false;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (iArg + 1 < argc && strcmp(argv[iArg], "-n") == 0)
+        {
+            nTileCount = std::max(1, atoi(argv[iArg + 1]));
+            ++iArg;
+        }
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-qd") == 0)
+        {
+            aosQueueDepths.Assign(CSLTokenizeString2(argv[iArg + 1], ",", 0));
+            ++iArg;
+        }
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-seed") == 0)
+        {
+            nSeed = static_cast<unsigned>(atoi(argv[iArg + 1]));
+            ++iArg;
+        }
+        else if (strcmp(argv[iArg], "-no-io-uring") == 0)
+        {
+            bUseIoUring = false;
+        }
+        else if (strcmp(argv[iArg], "-direct") == 0)
+        {
+            bDirectIO = true;
+        }
+        else if (argv[iArg][0] == '-')
+        {
+            Usage();
+        }
+        else if (pszDataset == nullptr)
+        {
+            pszDataset = argv[iArg];
+        }
+        else
+        {
+            Usage();
+        }
+    }
+    if (pszDataset == nullptr || aosQueueDepths.empty())
+    {
+        Usage();
+    }
+
+    GDALAllRegister();
+
+    /* -------------------------------------------------------------------- */
+    /*      Collect the location of the tiles of the full resolution        */
+    /*      image.                                                          */
+    /* -------------------------------------------------------------------- */
+    std::vector<vsi_l_offset> anTileOffsets;
+    std::vector<size_t> anTileSizes;
+    {
+        auto poDS = std::unique_ptr<GDALDataset>(GDALDataset::Open(
+            pszDataset, GDAL_OF_RASTER | GDAL_OF_VERBOSE_ERROR));
+        if (poDS == nullptr || poDS->GetRasterCount() == 0)
+        {
+            CSLDestroy(argv);
+            exit(1);
+        }
+        auto poBand = poDS->GetRasterBand(1);
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        const int nXBlocks = DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize);
+        const int nYBlocks = DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+        for (int nY = 0; nY < nYBlocks; ++nY)
+        {
+            for (int nX = 0; nX < nXBlocks; ++nX)
+            {
+                const char *pszOffset = poBand->GetMetadataItem(
+                    CPLSPrintf("BLOCK_OFFSET_%d_%d", nX, nY), "TIFF");
+                const char *pszSize = poBand->GetMetadataItem(
+                    CPLSPrintf("BLOCK_SIZE_%d_%d", nX, nY), "TIFF");
+                if (pszOffset && pszSize && atoi(pszSize) > 0)
+                {
+                    anTileOffsets.push_back(static_cast<vsi_l_offset>(
+                        std::strtoull(pszOffset, nullptr, 10)));
+                    anTileSizes.push_back(static_cast<size_t>(atoi(pszSize)));
+                }
+            }
+        }
+    }
+    if (anTileOffsets.empty())
+    {
+        fprintf(stderr, "No tile found. Is %s a tiled GeoTIFF?\n", pszDataset);
+        CSLDestroy(argv);
+        exit(1);
+    }
+
+    std::mt19937 oGenerator(nSeed);
+    std::uniform_int_distribution<size_t> oDistribution(
+        0, anTileOffsets.size() - 1);
+    std::vector<size_t> anTiles(nTileCount);
+    for (auto &nTile : anTiles)
+        nTile = oDistribution(oGenerator);
+
+    CPLSetConfigOption("CPL_VSIL_USE_IO_URING", bUseIoUring ? "YES" : "NO");
+    CPLSetConfigOption("CPL_VSIL_LOCAL_DIRECT_IO", bDirectIO ? "YES" : "NO");
+
+    printf("%d random reads among %d tiles, io_uring=%s, direct_io=%s\n",
+           nTileCount, static_cast<int>(anTileOffsets.size()),
+           bUseIoUring ? "yes" : "no", bDirectIO ? "yes" : "no");
+
+    /* -------------------------------------------------------------------- */
+    /*      Read the tiles in batches of <queue depth> ranges.              */
+    /* -------------------------------------------------------------------- */
+    for (const char *pszQueueDepth : aosQueueDepths)
+    {
+        const int nQueueDepth = std::max(1, atoi(pszQueueDepth));
+        CPLSetConfigOption("CPL_VSIL_IO_URING_QUEUE_DEPTH",
+                           CPLSPrintf("%d", nQueueDepth));
+
+        VSILFILE *fp = VSIFOpenL(pszDataset, "rb");
+        if (fp == nullptr)
+        {
+            fprintf(stderr, "Cannot open %s\n", pszDataset);
+            CSLDestroy(argv);
+            exit(1);
+        }
+
+        std::vector<std::vector<GByte>> aabyBuffers(nQueueDepth);
+        std::vector<void *> apData(nQueueDepth);
+        std::vector<vsi_l_offset> anOffsets(nQueueDepth);
+        std::vector<size_t> anSizes(nQueueDepth);
+        GUIntBig nTotalBytes = 0;
+        bool bOK = true;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int iStart = 0; bOK && iStart < nTileCount; iStart += nQueueDepth)
+        {
+            const int nRanges = std::min(nQueueDepth, nTileCount - iStart);
+            for (int i = 0; i < nRanges; ++i)
+            {
+                const size_t nTile = anTiles[iStart + i];
+                anOffsets[i] = anTileOffsets[nTile];
+                anSizes[i] = anTileSizes[nTile];
+                if (aabyBuffers[i].size() < anSizes[i])
+                    aabyBuffers[i].resize(anSizes[i]);
+                apData[i] = aabyBuffers[i].data();
+                nTotalBytes += anSizes[i];
+            }
+            bOK = VSIFReadMultiRangeL(nRanges, apData.data(), anOffsets.data(),
+                                      anSizes.data(), fp) == 0;
+        }
+        const double dfSeconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          start)
+                .count();
+        VSIFCloseL(fp);
+
+        if (!bOK)
+        {
+            fprintf(stderr, "VSIFReadMultiRangeL() failed\n");
+            CSLDestroy(argv);
+            exit(1);
+        }
+
+        printf("queue depth %4d: %.3f s, %.0f tiles/s, %.1f MB/s\n",
+               nQueueDepth, dfSeconds, nTileCount / dfSeconds,
+               static_cast<double>(nTotalBytes) / (1024 * 1024) / dfSeconds);
+    }
+
+    CSLDestroy(argv);
+
+    GDALDestroyDriverManager();
+
+    return 0;
+}
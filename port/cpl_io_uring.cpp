@@ -0,0 +1,507 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Minimal wrapper over the Linux io_uring interface
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_io_uring.h"
+
+#include "cpl_error.h"
+#include "cpl_multiproc.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <vector>
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//! @cond Doxygen_Suppress
+
+// Minimum and maximum number of entries of the rings used by Run()
+constexpr unsigned RUN_MIN_RING_ENTRIES = 64;
+constexpr unsigned RUN_MAX_RING_ENTRIES = 4096;
+
+// Maximum number of bytes of a single read or write operation
+constexpr size_t MAX_CHUNK_SIZE = 1024 * 1024 * 1024;
+
+// User data of the cancellation requests issued by CancelAndDrain()
+constexpr uint64_t CANCEL_USER_DATA = UINT64_MAX;
+
+/************************************************************************/
+/*                            ~CPLIoUring()                             */
+/************************************************************************/
+
+CPLIoUring::~CPLIoUring()
+{
+    if (m_pSQEs)
+        munmap(m_pSQEs, m_nSQEsSize);
+    if (m_pCQRing && m_pCQRing != m_pSQRing)
+        munmap(m_pCQRing, m_nCQRingSize);
+    if (m_pSQRing)
+        munmap(m_pSQRing, m_nSQRingSize);
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Create rings with (at least) nEntries submission entries.
+ *
+ * @return nullptr if io_uring is not available, for example because of the
+ * kernel version, of kernel.io_uring_disabled or of a seccomp profile.
+ */
+std::unique_ptr<CPLIoUring> CPLIoUring::Create(unsigned nEntries)
+{
+    io_uring_params sParams;
+    memset(&sParams, 0, sizeof(sParams));
+    const int fd =
+        static_cast<int>(syscall(__NR_io_uring_setup, nEntries, &sParams));
+    if (fd < 0)
+    {
+        CPLDebug("CPL", "io_uring_setup() failed: %s", strerror(errno));
+        return nullptr;
+    }
+
+    auto poRing = std::unique_ptr<CPLIoUring>(new CPLIoUring());
+    poRing->m_fd = fd;
+    poRing->m_nEntries = sParams.sq_entries;
+
+    poRing->m_nSQRingSize =
+        sParams.sq_off.array + sParams.sq_entries * sizeof(unsigned);
+    poRing->m_nCQRingSize =
+        sParams.cq_off.cqes + sParams.cq_entries * sizeof(io_uring_cqe);
+    const bool bSingleMMap = (sParams.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMMap)
+    {
+        poRing->m_nSQRingSize =
+            std::max(poRing->m_nSQRingSize, poRing->m_nCQRingSize);
+        poRing->m_nCQRingSize = poRing->m_nSQRingSize;
+    }
+
+    void *pSQRing =
+        mmap(nullptr, poRing->m_nSQRingSize, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (pSQRing == MAP_FAILED)
+        return nullptr;
+    poRing->m_pSQRing = pSQRing;
+
+    void *pCQRing = pSQRing;
+    if (!bSingleMMap)
+    {
+        pCQRing = mmap(nullptr, poRing->m_nCQRingSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (pCQRing == MAP_FAILED)
+            return nullptr;
+    }
+    poRing->m_pCQRing = pCQRing;
+
+    poRing->m_nSQEsSize = sParams.sq_entries * sizeof(io_uring_sqe);
+    void *pSQEs = mmap(nullptr, poRing->m_nSQEsSize, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (pSQEs == MAP_FAILED)
+        return nullptr;
+    poRing->m_pSQEs = pSQEs;
+
+    GByte *pabySQRing = static_cast<GByte *>(pSQRing);
+    poRing->m_pnSQTail =
+        reinterpret_cast<unsigned *>(pabySQRing + sParams.sq_off.tail);
+    poRing->m_nSQMask =
+        *reinterpret_cast<unsigned *>(pabySQRing + sParams.sq_off.ring_mask);
+    poRing->m_pnSQArray =
+        reinterpret_cast<unsigned *>(pabySQRing + sParams.sq_off.array);
+
+    GByte *pabyCQRing = static_cast<GByte *>(pCQRing);
+    poRing->m_pnCQHead =
+        reinterpret_cast<unsigned *>(pabyCQRing + sParams.cq_off.head);
+    poRing->m_pnCQTail =
+        reinterpret_cast<unsigned *>(pabyCQRing + sParams.cq_off.tail);
+    poRing->m_nCQMask =
+        *reinterpret_cast<unsigned *>(pabyCQRing + sParams.cq_off.ring_mask);
+    poRing->m_pCQEs = pabyCQRing + sParams.cq_off.cqes;
+
+    return poRing;
+}
+
+/************************************************************************/
+/*                            IsAvailable()                             */
+/************************************************************************/
+
+/** Return whether io_uring can be used, and supports the operations needed
+ * by PrepareRead(), PrepareWrite() and PrepareCancel() (Linux >= 5.6).
+ */
+bool CPLIoUring::IsAvailable()
+{
+    static const bool bAvailable = []()
+    {
+        auto poRing = Create(1);
+        if (!poRing)
+            return false;
+
+        constexpr int MAX_OPS = 256;
+        std::vector<GByte> abyProbe(sizeof(io_uring_probe) +
+                                    MAX_OPS * sizeof(io_uring_probe_op));
+        auto psProbe = reinterpret_cast<io_uring_probe *>(abyProbe.data());
+        if (syscall(__NR_io_uring_register, poRing->m_fd,
+                    IORING_REGISTER_PROBE, psProbe, MAX_OPS) < 0)
+        {
+            CPLDebug("CPL", "io_uring probe failed: %s", strerror(errno));
+            return false;
+        }
+        const auto IsSupported = [psProbe](int nOpCode)
+        {
+            return nOpCode <= psProbe->last_op &&
+                   (psProbe->ops[nOpCode].flags & IO_URING_OP_SUPPORTED) != 0;
+        };
+        return IsSupported(IORING_OP_READ) && IsSupported(IORING_OP_WRITE) &&
+               IsSupported(IORING_OP_ASYNC_CANCEL);
+    }();
+    return bAvailable;
+}
+
+/************************************************************************/
+/*                              Prepare()                               */
+/************************************************************************/
+
+bool CPLIoUring::Prepare(int nOpCode, int fd, uint64_t nAddr, unsigned nSize,
+                         uint64_t nOffset, uint64_t nUserData)
+{
+    if (GetFreeSlotCount() == 0)
+        return false;
+
+    // We are the only producer of the submission queue, so the tail can be
+    // read without synchronization.
+    const unsigned nTail = *m_pnSQTail;
+    const unsigned nIndex = nTail & m_nSQMask;
+    io_uring_sqe *psSQE = static_cast<io_uring_sqe *>(m_pSQEs) + nIndex;
+    memset(psSQE, 0, sizeof(*psSQE));
+    psSQE->opcode = static_cast<__u8>(nOpCode);
+    psSQE->fd = fd;
+    psSQE->addr = nAddr;
+    psSQE->len = nSize;
+    psSQE->off = nOffset;
+    psSQE->user_data = nUserData;
+    m_pnSQArray[nIndex] = nIndex;
+    __atomic_store_n(m_pnSQTail, nTail + 1, __ATOMIC_RELEASE);
+    ++m_nPending;
+    return true;
+}
+
+/************************************************************************/
+/*                            PrepareRead()                             */
+/************************************************************************/
+
+/** Queue a read of nSize bytes at nOffset into pBuffer, which must be kept
+ * alive until the completion identified by nUserData has been reaped.
+ *
+ * @return false if no slot is free.
+ */
+bool CPLIoUring::PrepareRead(int fd, void *pBuffer, unsigned nSize,
+                             uint64_t nOffset, uint64_t nUserData)
+{
+    return Prepare(IORING_OP_READ, fd, reinterpret_cast<uintptr_t>(pBuffer),
+                   nSize, nOffset, nUserData);
+}
+
+/************************************************************************/
+/*                            PrepareWrite()                            */
+/************************************************************************/
+
+/** Queue a write of nSize bytes of pBuffer at nOffset, pBuffer being kept
+ * alive until the completion identified by nUserData has been reaped.
+ *
+ * @return false if no slot is free.
+ */
+bool CPLIoUring::PrepareWrite(int fd, const void *pBuffer, unsigned nSize,
+                              uint64_t nOffset, uint64_t nUserData)
+{
+    return Prepare(IORING_OP_WRITE, fd, reinterpret_cast<uintptr_t>(pBuffer),
+                   nSize, nOffset, nUserData);
+}
+
+/************************************************************************/
+/*                           PrepareCancel()                            */
+/************************************************************************/
+
+/** Queue the cancellation of the submitted operation identified by
+ * nTargetUserData. The operation still produces a completion, which may
+ * report a successful transfer if it could not be cancelled in time.
+ *
+ * @return false if no slot is free.
+ */
+bool CPLIoUring::PrepareCancel(uint64_t nTargetUserData, uint64_t nUserData)
+{
+    return Prepare(IORING_OP_ASYNC_CANCEL, -1, nTargetUserData, 0, 0,
+                   nUserData);
+}
+
+/************************************************************************/
+/*                               Submit()                               */
+/************************************************************************/
+
+/** Submit prepared entries, and optionally wait for at least one completion.
+ *
+ * @return false on error, in which case the entries that have not been
+ * consumed by the kernel can be dropped with DiscardPending().
+ */
+bool CPLIoUring::Submit(bool bWaitForCompletion)
+{
+    while (true)
+    {
+        const bool bWait =
+            bWaitForCompletion && m_nPending + m_nInFlight > 0;
+        const int nRet = static_cast<int>(
+            syscall(__NR_io_uring_enter, m_fd, m_nPending, bWait ? 1 : 0,
+                    bWait ? IORING_ENTER_GETEVENTS : 0, nullptr, 0));
+        if (nRet < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            CPLDebug("CPL", "io_uring_enter() failed: %s", strerror(errno));
+            return false;
+        }
+        m_nPending -= nRet;
+        m_nInFlight += nRet;
+        if (m_nPending == 0)
+            return true;
+        if (nRet == 0)
+            return false;
+    }
+}
+
+/************************************************************************/
+/*                           DiscardPending()                           */
+/************************************************************************/
+
+/** Drop the prepared entries that have not been consumed by the kernel,
+ * which are the last prepared ones.
+ *
+ * @return the number of dropped entries.
+ */
+unsigned CPLIoUring::DiscardPending()
+{
+    const unsigned nDiscarded = m_nPending;
+    __atomic_store_n(m_pnSQTail, *m_pnSQTail - nDiscarded, __ATOMIC_RELEASE);
+    m_nPending = 0;
+    return nDiscarded;
+}
+
+/************************************************************************/
+/*                           PeekCompletion()                           */
+/************************************************************************/
+
+/** Reap a completion, if one is available, without blocking.
+ *
+ * @param[out] nUserData User data of the completed operation.
+ * @param[out] nResult Number of bytes transferred, or -errno.
+ * @return true if a completion was reaped.
+ */
+bool CPLIoUring::PeekCompletion(uint64_t &nUserData, int &nResult)
+{
+    // We are the only consumer of the completion queue, so the head can be
+    // read without synchronization.
+    const unsigned nHead = *m_pnCQHead;
+    if (nHead == __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE))
+        return false;
+    const io_uring_cqe *psCQE =
+        static_cast<const io_uring_cqe *>(m_pCQEs) + (nHead & m_nCQMask);
+    nUserData = psCQE->user_data;
+    nResult = psCQE->res;
+    __atomic_store_n(m_pnCQHead, nHead + 1, __ATOMIC_RELEASE);
+    --m_nInFlight;
+    return true;
+}
+
+/************************************************************************/
+/*                           CancelAndDrain()                           */
+/************************************************************************/
+
+/** Cancel the submitted operations identified by anUserData, and wait until
+ * no operation is in flight, discarding their completions.
+ *
+ * The kernel may keep on accessing the buffers of an operation until its
+ * completion has been posted, so this must be called before those buffers
+ * are released when giving up on the operations.
+ */
+void CPLIoUring::CancelAndDrain(const std::vector<uint64_t> &anUserData)
+{
+    size_t iNextCancel = 0;
+    while (m_nPending + m_nInFlight > 0)
+    {
+        while (iNextCancel < anUserData.size() && GetFreeSlotCount() > 0)
+        {
+            CPL_IGNORE_RET_VAL(
+                PrepareCancel(anUserData[iNextCancel++], CANCEL_USER_DATA));
+        }
+        if (!Submit(true))
+        {
+            // The operations still complete without being cancelled, so
+            // keep on reaping completions until they are all posted.
+            DiscardPending();
+            CPLSleep(0.001);
+        }
+
+        uint64_t nUserData = 0;
+        int nResult = 0;
+        while (PeekCompletion(nUserData, nResult))
+        {
+        }
+    }
+}
+
+/************************************************************************/
+/*                                Run()                                 */
+/************************************************************************/
+
+/** Service read or write requests on a file descriptor with io_uring, and
+ * wait for all of them to be completed.
+ *
+ * Up to nQueueDepth requests are kept in flight concurrently, and short
+ * transfers are resubmitted until the request is fully serviced or the end
+ * of file is reached. oCompleted(iRequest, nTransferred, bError) is called
+ * once for each request, from the calling thread.
+ *
+ * A ring is created the first time a thread calls this method, and reused
+ * by later calls from the same thread.
+ *
+ * @return false, without calling oCompleted(), if io_uring cannot be used.
+ */
+bool CPLIoUring::Run(int fd, bool bWrite, int nRequests,
+                     const VSIAsyncRequest *pasRequests, unsigned nQueueDepth,
+                     const std::function<void(int, size_t, bool)> &oCompleted)
+{
+    nQueueDepth = std::clamp(nQueueDepth, 1U, RUN_MAX_RING_ENTRIES);
+    thread_local std::unique_ptr<CPLIoUring> tlpoRing;
+    if (!tlpoRing || tlpoRing->m_nEntries < nQueueDepth)
+    {
+        tlpoRing = Create(std::max(nQueueDepth, RUN_MIN_RING_ENTRIES));
+        if (!tlpoRing)
+            return false;
+    }
+    CPLIoUring &oRing = *tlpoRing;
+    // Number of free slots below which no new request is started
+    const unsigned nMinFreeSlots = oRing.m_nEntries - nQueueDepth;
+
+    std::vector<size_t> anTransferred(nRequests, 0);
+    std::vector<bool> abCompleted(nRequests, false);
+    // Requests prepared since the last call to Submit()
+    std::vector<int> aiPrepared;
+    int iNext = 0;
+    int nRemaining = nRequests;
+
+    const auto Prepare = [&](int i)
+    {
+        const VSIAsyncRequest &sRequest = pasRequests[i];
+        const unsigned nChunkSize = static_cast<unsigned>(std::min(
+            sRequest.nSize - anTransferred[i], MAX_CHUNK_SIZE));
+        GByte *pabyBuffer =
+            static_cast<GByte *>(sRequest.pBuffer) + anTransferred[i];
+        const uint64_t nOffset = sRequest.nOffset + anTransferred[i];
+        const bool bOK =
+            bWrite ? oRing.PrepareWrite(fd, pabyBuffer, nChunkSize, nOffset, i)
+                   : oRing.PrepareRead(fd, pabyBuffer, nChunkSize, nOffset, i);
+        CPL_IGNORE_RET_VAL(bOK);
+        CPLAssert(bOK);
+        aiPrepared.push_back(i);
+    };
+
+    const auto Complete = [&](int i, bool bError)
+    {
+        abCompleted[i] = true;
+        --nRemaining;
+        oCompleted(i, anTransferred[i], bError);
+    };
+
+    while (nRemaining > 0)
+    {
+        while (iNext < nRequests && oRing.GetFreeSlotCount() > nMinFreeSlots)
+        {
+            const int i = iNext++;
+            if (pasRequests[i].nSize == 0)
+                Complete(i, false);
+            else
+                Prepare(i);
+        }
+        if (nRemaining == 0)
+            break;
+
+        if (!oRing.Submit(true))
+        {
+            const unsigned nDiscarded = oRing.DiscardPending();
+            if (nDiscarded == 0)
+            {
+                // Waiting for completions failed: the state of the requests
+                // in flight is unknown.
+                break;
+            }
+            for (size_t j = aiPrepared.size() - nDiscarded;
+                 j < aiPrepared.size(); ++j)
+            {
+                Complete(aiPrepared[j], true);
+            }
+        }
+        aiPrepared.clear();
+
+        uint64_t nUserData = 0;
+        int nResult = 0;
+        while (oRing.PeekCompletion(nUserData, nResult))
+        {
+            const int i = static_cast<int>(nUserData);
+            if (nResult == -EINTR || nResult == -EAGAIN)
+            {
+                Prepare(i);
+            }
+            else if (nResult < 0)
+            {
+                Complete(i, true);
+            }
+            else if (nResult == 0)
+            {
+                // End of file for reads. Writes never legitimately return 0.
+                Complete(i, bWrite);
+            }
+            else
+            {
+                anTransferred[i] += static_cast<size_t>(nResult);
+                if (anTransferred[i] == pasRequests[i].nSize)
+                    Complete(i, false);
+                else
+                    Prepare(i);
+            }
+        }
+    }
+
+    if (nRemaining > 0)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "io_uring request failed");
+        // The buffers of the requests must not be released by oCompleted()
+        // while the kernel may still access them.
+        std::vector<uint64_t> anUserData;
+        for (int i = 0; i < iNext; ++i)
+        {
+            if (!abCompleted[i])
+                anUserData.push_back(static_cast<uint64_t>(i));
+        }
+        oRing.CancelAndDrain(anUserData);
+        tlpoRing.reset();
+        for (int i = 0; i < nRequests; ++i)
+        {
+            if (!abCompleted[i])
+                Complete(i, true);
+        }
+    }
+
+    return true;
+}
+
+//! @endcond
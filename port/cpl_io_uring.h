@@ -0,0 +1,96 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Minimal wrapper over the Linux io_uring interface
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_IO_URING_H_INCLUDED
+#define CPL_IO_URING_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                              CPLIoUring                              */
+/************************************************************************/
+
+/** io_uring submission and completion queues, driven through the raw system
+ * calls so that liburing is not needed.
+ *
+ * An instance must only be used by one thread at a time.
+ */
+class CPLIoUring
+{
+    int m_fd = -1;
+
+    void *m_pSQRing = nullptr;
+    size_t m_nSQRingSize = 0;
+    void *m_pCQRing = nullptr;
+    size_t m_nCQRingSize = 0;
+    void *m_pSQEs = nullptr;
+    size_t m_nSQEsSize = 0;
+
+    unsigned *m_pnSQTail = nullptr;
+    unsigned m_nSQMask = 0;
+    unsigned *m_pnSQArray = nullptr;
+    unsigned m_nEntries = 0;
+
+    unsigned *m_pnCQHead = nullptr;
+    unsigned *m_pnCQTail = nullptr;
+    unsigned m_nCQMask = 0;
+    void *m_pCQEs = nullptr;
+
+    // Number of prepared, not yet submitted, entries
+    unsigned m_nPending = 0;
+    // Number of submitted entries whose completion has not been reaped
+    unsigned m_nInFlight = 0;
+
+    CPLIoUring() = default;
+    CPL_DISALLOW_COPY_ASSIGN(CPLIoUring)
+
+    bool Prepare(int nOpCode, int fd, uint64_t nAddr, unsigned nSize,
+                 uint64_t nOffset, uint64_t nUserData);
+
+  public:
+    ~CPLIoUring();
+
+    static bool IsAvailable();
+    static std::unique_ptr<CPLIoUring> Create(unsigned nEntries);
+
+    /** Return the number of entries that can be prepared before some
+     * completions must be reaped. */
+    unsigned GetFreeSlotCount() const
+    {
+        return m_nEntries - m_nPending - m_nInFlight;
+    }
+
+    bool PrepareRead(int fd, void *pBuffer, unsigned nSize, uint64_t nOffset,
+                     uint64_t nUserData);
+    bool PrepareWrite(int fd, const void *pBuffer, unsigned nSize,
+                      uint64_t nOffset, uint64_t nUserData);
+    bool PrepareCancel(uint64_t nTargetUserData, uint64_t nUserData);
+    bool Submit(bool bWaitForCompletion);
+    unsigned DiscardPending();
+    bool PeekCompletion(uint64_t &nUserData, int &nResult);
+    void CancelAndDrain(const std::vector<uint64_t> &anUserData);
+
+    static bool Run(int fd, bool bWrite, int nRequests,
+                    const VSIAsyncRequest *pasRequests, unsigned nQueueDepth,
+                    const std::function<void(int, size_t, bool)> &oCompleted);
+};
+
+//! @endcond
+
+#endif  // CPL_IO_URING_H_INCLUDED
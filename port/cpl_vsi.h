@@ -217,6 +217,54 @@ typedef enum
 VSIRangeStatus CPL_DLL VSIFGetRangeStatusL(VSILFILE *fp, vsi_l_offset nStart,
                                            vsi_l_offset nLength);
 
+/** Asynchronous read or write request, submitted with VSIFSubmitReadBatchL()
+ * or VSIFSubmitWriteBatchL().
+ *
+ * @since GDAL 3.13
+ */
+typedef struct
+{
+    /** Offset in the file (input) */
+    vsi_l_offset nOffset;
+    /** Number of bytes to read or write (input) */
+    size_t nSize;
+    /** Buffer of at least nSize bytes (input) */
+    void *pBuffer;
+    /** Number of bytes read or written (output). For reads, a value lower
+     * than nSize without bError set means that the end of file was reached. */
+    size_t nTransferred;
+    /** Set to TRUE if the request failed (output) */
+    int bError;
+    /** User data, not used by GDAL */
+    void *pUserData;
+} VSIAsyncRequest;
+
+/** Callback invoked when a request of a batch has completed.
+ *
+ * It may be called from any thread, and concurrently for several requests
+ * of the same batch.
+ *
+ * @since GDAL 3.13
+ */
+typedef void (*VSIAsyncCompletionFunc)(VSIAsyncRequest *psRequest,
+                                       void *pUserData);
+
+/** Opaque type for a batch of asynchronous requests */
+typedef struct VSIAsyncBatch VSIAsyncBatch;
+
+VSIAsyncBatch CPL_DLL *
+VSIFSubmitReadBatchL(VSILFILE *fp, int nRequests, VSIAsyncRequest *pasRequests,
+                     VSIAsyncCompletionFunc pfnCompletion,
+                     void *pCompletionUserData);
+VSIAsyncBatch CPL_DLL *
+VSIFSubmitWriteBatchL(VSILFILE *fp, int nRequests, VSIAsyncRequest *pasRequests,
+                      VSIAsyncCompletionFunc pfnCompletion,
+                      void *pCompletionUserData);
+int CPL_DLL VSIAsyncBatchWait(VSIAsyncBatch *poBatch, double dfTimeout);
+int CPL_DLL VSIAsyncBatchGetCompletedCount(VSIAsyncBatch *poBatch);
+int CPL_DLL VSIAsyncBatchGetErrorCount(VSIAsyncBatch *poBatch);
+void CPL_DLL VSIAsyncBatchFree(VSIAsyncBatch *poBatch);
+
 int CPL_DLL VSIIngestFile(VSILFILE *fp, const char *pszFilename,
                           GByte **ppabyRet, vsi_l_offset *pnSize,
                           GIntBig nMaxSize) CPL_WARN_UNUSED_RESULT;
@@ -89,13 +89,20 @@ constexpr const char *szHIDDEN_DIRNAME = "/vsimem/.#!HIDDEN!#.";
 /*
 ** Notes on Multithreading:
 **
-** VSIMemFilesystemHandler: This class maintains a mutex to protect
-** access and update of the oFileList array which has all the "files" in
-** the memory filesystem area.  It is expected that multiple threads would
+** VSIMemFilesystemHandler: This class maintains a reader-writer mutex to
+** protect access and update of the oFileList array which has all the "files"
+** in the memory filesystem area.  It is expected that multiple threads would
 ** want to create and read different files at the same time and so might
-** collide access oFileList without the mutex.
+** collide access oFileList without the mutex.  Lookups (open, stat, read dir)
+** only take it in shared mode.
 **
-** VSIMemFile: A mutex protects accesses to the file
+** VSIMemFile: A mutex protects accesses to the file.  Its content is stored
+** in a reference-counted VSIMemBuffer.  While no handle opened in update
+** mode exists on the file, read-only handles keep a reference to it (a
+** "snapshot"), and read from it without any locking as long as the
+** generation counter of the file has not changed.  A buffer referenced by
+** snapshots is never modified: a writer first makes a private copy of it
+** (copy-on-write).
 **
 ** VSIMemHandle: This is essentially a "current location" representing
 ** on accessor to a file, and is inherently intended only to be used in
@@ -108,6 +115,28 @@ constexpr const char *szHIDDEN_DIRNAME = "/vsimem/.#!HIDDEN!#.";
 ** threads at once.
 */
 
+/************************************************************************/
+/* ==================================================================== */
+/*                             VSIMemBuffer                             */
+/* ==================================================================== */
+/************************************************************************/
+
+struct VSIMemBuffer
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIMemBuffer)
+
+    GByte *pabyData = nullptr;
+    bool bOwnData = true;
+
+    VSIMemBuffer() = default;
+
+    ~VSIMemBuffer()
+    {
+        if (bOwnData)
+            CPLFree(pabyData);
+    }
+};
+
 /************************************************************************/
 /* ==================================================================== */
 /*                              VSIMemFile                              */
@@ -123,8 +152,7 @@ class VSIMemFile final
 
     bool bIsDirectory = false;
 
-    bool bOwnData = true;
-    GByte *pabyData = nullptr;
+    std::shared_ptr<VSIMemBuffer> poBuffer = std::make_shared<VSIMemBuffer>();
     vsi_l_offset nLength = 0;
     vsi_l_offset nAllocLength = 0;
     vsi_l_offset nMaxLength = GUINTBIG_MAX;
@@ -132,10 +160,27 @@ class VSIMemFile final
     time_t mTime = 0;
     CPL_SHARED_MUTEX_TYPE m_oMutex{};
 
+    // Incremented, under exclusive lock, each time the content changes.
+    std::atomic<uint64_t> m_nGeneration{0};
+    // Number of open handles in update mode
+    std::atomic<int> m_nUpdateHandles{0};
+
     VSIMemFile();
-    ~VSIMemFile();
 
     bool SetLength(vsi_l_offset nNewSize);
+    bool MakeWritable();
+
+    GByte *GetData() const
+    {
+        return poBuffer->pabyData;
+    }
+
+    // Must be called under exclusive lock, after the content was modified
+    void Touch()
+    {
+        time(&mTime);
+        m_nGeneration.fetch_add(1, std::memory_order_release);
+    }
 };
 
 /************************************************************************/
@@ -148,6 +193,18 @@ class VSIMemHandle final : public VSIVirtualHandle
 {
     CPL_DISALLOW_COPY_ASSIGN(VSIMemHandle)
 
+    // Snapshot of the file content, for lock-free reads by read-only handles
+    std::shared_ptr<const VSIMemBuffer> m_poSnapshot{};
+    vsi_l_offset m_nSnapshotLength = 0;
+    uint64_t m_nSnapshotGeneration = 0;
+
+    bool IsSnapshotValid() const
+    {
+        return m_poSnapshot &&
+               poFile->m_nGeneration.load(std::memory_order_acquire) ==
+                   m_nSnapshotGeneration;
+    }
+
   public:
     std::shared_ptr<VSIMemFile> poFile = nullptr;
     vsi_l_offset m_nOffset = 0;
@@ -159,6 +216,9 @@ class VSIMemHandle final : public VSIVirtualHandle
     VSIMemHandle() = default;
     ~VSIMemHandle() override;
 
+    void SetFile(std::shared_ptr<VSIMemFile> poFileIn, bool bUpdateIn);
+    void RefreshSnapshot();
+
     int Seek(vsi_l_offset nOffset, int nWhence) override;
     vsi_l_offset Tell() override;
     size_t Read(void *pBuffer, size_t nBytes) override;
@@ -191,7 +251,7 @@ class VSIMemFilesystemHandler final : public VSIFilesystemHandler
 
   public:
     std::map<std::string, std::shared_ptr<VSIMemFile>> oFileList{};
-    CPLMutex *hMutex = nullptr;
+    CPL_SHARED_MUTEX_TYPE m_oMutex{};
 
     explicit VSIMemFilesystemHandler(const char *pszPrefix)
         : m_osPrefix(pszPrefix)
@@ -246,13 +306,40 @@ VSIMemFile::VSIMemFile()
 }
 
 /************************************************************************/
-/*                            ~VSIMemFile()                             */
+/*                            MakeWritable()                            */
 /************************************************************************/
 
-VSIMemFile::~VSIMemFile()
+// Must be called under exclusive lock, before modifying the buffer.
+// If the buffer is referenced by snapshots of read-only handles, replace it
+// by a private copy.
+bool VSIMemFile::MakeWritable()
 {
-    if (bOwnData && pabyData)
-        CPLFree(pabyData);
+    if (poBuffer.use_count() == 1 || !poBuffer->bOwnData)
+        return true;
+
+    auto poNewBuffer = std::make_shared<VSIMemBuffer>();
+    if (nAllocLength > 0)
+    {
+        // Beyond nLength, the buffer is filled with zeroes.
+        if (static_cast<vsi_l_offset>(static_cast<size_t>(nAllocLength)) ==
+            nAllocLength)
+        {
+            poNewBuffer->pabyData = static_cast<GByte *>(
+                VSICalloc(1, static_cast<size_t>(nAllocLength)));
+        }
+        if (poNewBuffer->pabyData == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate " CPL_FRMT_GUIB
+                     " bytes for in-memory file",
+                     nAllocLength);
+            return false;
+        }
+        memcpy(poNewBuffer->pabyData, poBuffer->pabyData,
+               static_cast<size_t>(nLength));
+    }
+    poBuffer = std::move(poNewBuffer);
+    return true;
 }
 
 /************************************************************************/
@@ -278,13 +365,15 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
         // the return address might be different from the one passed by
         // the caller. Hence, the caller would not be able to free
         // the buffer.
-        if (!bOwnData)
+        if (!poBuffer->bOwnData)
         {
             CPLError(CE_Failure, CPLE_NotSupported,
                      "Cannot extended in-memory file whose ownership was not "
                      "transferred");
             return false;
         }
+        if (!MakeWritable())
+            return false;
 
         // If the first allocation is 1 MB or above, just take that value
         // as the one to allocate
@@ -300,7 +389,8 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
             pabyNewData = static_cast<GByte *>(
                 nAllocLength == 0
                     ? VSICalloc(1, static_cast<size_t>(nNewAlloc))
-                    : VSIRealloc(pabyData, static_cast<size_t>(nNewAlloc)));
+                    : VSIRealloc(poBuffer->pabyData,
+                                 static_cast<size_t>(nNewAlloc)));
         }
         if (pabyNewData == nullptr)
         {
@@ -320,17 +410,19 @@ bool VSIMemFile::SetLength(vsi_l_offset nNewLength)
                    static_cast<size_t>(nNewAlloc - nAllocLength));
         }
 
-        pabyData = pabyNewData;
+        poBuffer->pabyData = pabyNewData;
         nAllocLength = nNewAlloc;
     }
     else if (nNewLength < nLength)
     {
-        memset(pabyData + nNewLength, 0,
+        if (!MakeWritable())
+            return false;
+        memset(poBuffer->pabyData + nNewLength, 0,
                static_cast<size_t>(nLength - nNewLength));
     }
 
     nLength = nNewLength;
-    time(&mTime);
+    Touch();
 
     return true;
 }
@@ -364,12 +456,53 @@ int VSIMemHandle::Close()
                  this, poFile->osFilename.c_str(),
                  static_cast<int>(poFile.use_count()));
 #endif
+        if (bUpdate)
+            --poFile->m_nUpdateHandles;
+        m_poSnapshot.reset();
         poFile = nullptr;
     }
 
     return 0;
 }
 
+/************************************************************************/
+/*                              SetFile()                               */
+/************************************************************************/
+
+void VSIMemHandle::SetFile(std::shared_ptr<VSIMemFile> poFileIn,
+                           bool bUpdateIn)
+{
+    poFile = std::move(poFileIn);
+    bUpdate = bUpdateIn;
+    if (bUpdate)
+        ++poFile->m_nUpdateHandles;
+    else
+        RefreshSnapshot();
+}
+
+/************************************************************************/
+/*                          RefreshSnapshot()                           */
+/************************************************************************/
+
+void VSIMemHandle::RefreshSnapshot()
+{
+    CPL_SHARED_LOCK oLock(poFile->m_oMutex);
+    // Snapshots are not taken while the file can be modified, to avoid
+    // copies of the buffer by each write, or if the buffer is owned by the
+    // user, who may modify it directly.
+    if (poFile->m_nUpdateHandles == 0 && poFile->poBuffer->bOwnData)
+    {
+        m_poSnapshot = poFile->poBuffer;
+        m_nSnapshotLength = poFile->nLength;
+        m_nSnapshotGeneration =
+            poFile->m_nGeneration.load(std::memory_order_relaxed);
+    }
+    else
+    {
+        m_poSnapshot.reset();
+    }
+}
+
 /************************************************************************/
 /*                                Seek()                                */
 /************************************************************************/
@@ -378,6 +511,15 @@ int VSIMemHandle::Seek(vsi_l_offset nOffset, int nWhence)
 
 {
     vsi_l_offset nLength;
+    if (nWhence != SEEK_END)
+    {
+        nLength = 0;
+    }
+    else if (IsSnapshotValid())
+    {
+        nLength = m_nSnapshotLength;
+    }
+    else
     {
         CPL_SHARED_LOCK oLock(poFile->m_oMutex);
         nLength = poFile->nLength;
@@ -438,6 +580,31 @@ size_t VSIMemHandle::Read(void *pBuffer, size_t nBytesToRead)
         return 0;
     }
 
+    // Lock-free path for read-only handles
+    if (!bUpdate)
+    {
+        if (!IsSnapshotValid())
+            RefreshSnapshot();
+        if (m_poSnapshot)
+        {
+            if (m_nSnapshotLength <= nOffset ||
+                nBytesToRead + nOffset < nBytesToRead)
+            {
+                bEOF = true;
+                return 0;
+            }
+            size_t nBytesRead = nBytesToRead;
+            if (nBytesToRead + nOffset > m_nSnapshotLength)
+            {
+                nBytesRead = static_cast<size_t>(m_nSnapshotLength - nOffset);
+                bEOF = true;
+            }
+            memcpy(pBuffer, m_poSnapshot->pabyData + nOffset, nBytesRead);
+            m_nOffset += nBytesRead;
+            return nBytesRead;
+        }
+    }
+
     bool bEOFTmp = bEOF;
     size_t nBytesRead = nBytesToRead;
 
@@ -460,7 +627,7 @@ size_t VSIMemHandle::Read(void *pBuffer, size_t nBytesToRead)
         }
 
         if (nBytesToRead)
-            memcpy(pBuffer, poFile->pabyData + nOffset, nBytesRead);
+            memcpy(pBuffer, poFile->GetData() + nOffset, nBytesRead);
         return true;
     };
 
@@ -481,6 +648,23 @@ size_t VSIMemHandle::Read(void *pBuffer, size_t nBytesToRead)
 size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
                            vsi_l_offset nOffset) const
 {
+    // The snapshot is not refreshed here, as PRead() may be called
+    // concurrently from several threads.
+    if (IsSnapshotValid())
+    {
+        if (nOffset < m_nSnapshotLength)
+        {
+            const size_t nToCopy = static_cast<size_t>(
+                std::min(static_cast<vsi_l_offset>(m_nSnapshotLength - nOffset),
+                         static_cast<vsi_l_offset>(nSize)));
+            memcpy(pBuffer,
+                   m_poSnapshot->pabyData + static_cast<size_t>(nOffset),
+                   nToCopy);
+            return nToCopy;
+        }
+        return 0;
+    }
+
     CPL_SHARED_LOCK oLock(poFile->m_oMutex);
 
     if (nOffset < poFile->nLength)
@@ -488,7 +672,7 @@ size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
         const size_t nToCopy = static_cast<size_t>(
             std::min(static_cast<vsi_l_offset>(poFile->nLength - nOffset),
                      static_cast<vsi_l_offset>(nSize)));
-        memcpy(pBuffer, poFile->pabyData + static_cast<size_t>(nOffset),
+        memcpy(pBuffer, poFile->GetData() + static_cast<size_t>(nOffset),
                nToCopy);
         return nToCopy;
     }
@@ -524,10 +708,13 @@ size_t VSIMemHandle::Write(const void *pBuffer, size_t nBytesToWrite)
                 return 0;
         }
 
+        if (!poFile->MakeWritable())
+            return 0;
+
         if (nBytesToWrite)
-            memcpy(poFile->pabyData + nOffset, pBuffer, nBytesToWrite);
+            memcpy(poFile->GetData() + nOffset, pBuffer, nBytesToWrite);
 
-        time(&poFile->mTime);
+        poFile->Touch();
     }
 
     m_nOffset += nBytesToWrite;
@@ -542,7 +729,6 @@ size_t VSIMemHandle::Write(const void *pBuffer, size_t nBytesToWrite)
 void VSIMemHandle::ClearErr()
 
 {
-    CPL_SHARED_LOCK oLock(poFile->m_oMutex);
     bEOF = false;
     m_bError = false;
 }
@@ -554,7 +740,6 @@ void VSIMemHandle::ClearErr()
 int VSIMemHandle::Error()
 
 {
-    CPL_SHARED_LOCK oLock(poFile->m_oMutex);
     return m_bError ? TRUE : FALSE;
 }
 
@@ -565,7 +750,6 @@ int VSIMemHandle::Error()
 int VSIMemHandle::Eof()
 
 {
-    CPL_SHARED_LOCK oLock(poFile->m_oMutex);
     return bEOF ? TRUE : FALSE;
 }
 
@@ -602,10 +786,6 @@ VSIMemFilesystemHandler::~VSIMemFilesystemHandler()
 
 {
     oFileList.clear();
-
-    if (hMutex != nullptr)
-        CPLDestroyMutex(hMutex);
-    hMutex = nullptr;
 }
 
 /************************************************************************/
@@ -617,7 +797,6 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
                               bool bSetError, CSLConstList /* papszOptions */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
     const CPLString osFilename = NormalizePath(pszFilename);
     if (osFilename.empty())
         return nullptr;
@@ -634,10 +813,13 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /*      Get the filename we are opening, create if needed.              */
     /* -------------------------------------------------------------------- */
     std::shared_ptr<VSIMemFile> poFile = nullptr;
-    const auto oIter = oFileList.find(osFilename);
-    if (oIter != oFileList.end())
     {
-        poFile = oIter->second;
+        CPL_SHARED_LOCK oLock(m_oMutex);
+        const auto oIter = oFileList.find(osFilename);
+        if (oIter != oFileList.end())
+        {
+            poFile = oIter->second;
+        }
     }
 
     // If no file and opening in read, error out.
@@ -653,6 +835,7 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     }
 
     // Create.
+    bool bCreated = false;
     if (poFile == nullptr)
     {
         const std::string osFileDir = CPLGetPathSafe(osFilename.c_str());
@@ -668,17 +851,24 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
             return nullptr;
         }
 
-        poFile = std::make_shared<VSIMemFile>();
-        poFile->osFilename = osFilename;
-        oFileList[poFile->osFilename] = poFile;
+        CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
+        // The file might have been created by another thread in the meantime
+        auto &poFileInList = oFileList[osFilename];
+        if (poFileInList == nullptr)
+        {
+            poFileInList = std::make_shared<VSIMemFile>();
+            poFileInList->osFilename = osFilename;
+            poFileInList->nMaxLength = nMaxLength;
 #ifdef DEBUG_VERBOSE
-        CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
-                 static_cast<int>(poFile.use_count()));
+            CPLDebug("VSIMEM", "Creating file %s: ref_count=%d", pszFilename,
+                     static_cast<int>(poFileInList.use_count()));
 #endif
-        poFile->nMaxLength = nMaxLength;
+            bCreated = true;
+        }
+        poFile = poFileInList;
     }
     // Overwrite
-    else if (strstr(pszAccess, "w"))
+    if (!bCreated && strstr(pszAccess, "w"))
     {
         CPL_EXCLUSIVE_LOCK oLock(poFile->m_oMutex);
         poFile->SetLength(0);
@@ -696,11 +886,11 @@ VSIMemFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /* -------------------------------------------------------------------- */
     auto poHandle = std::make_unique<VSIMemHandle>();
 
-    poHandle->poFile = poFile;
+    const bool bUpdate = strchr(pszAccess, 'w') || strchr(pszAccess, '+') ||
+                         strchr(pszAccess, 'a');
+    poHandle->SetFile(poFile, bUpdate);
     poHandle->m_nOffset = 0;
     poHandle->bEOF = false;
-    poHandle->bUpdate = strchr(pszAccess, 'w') || strchr(pszAccess, '+') ||
-                        strchr(pszAccess, 'a');
     poHandle->m_bReadAllowed = strchr(pszAccess, 'r') || strchr(pszAccess, '+');
 
 #ifdef DEBUG_VERBOSE
@@ -728,8 +918,6 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
                                   VSIStatBufL *pStatBuf, int /* nFlags */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
-
     const CPLString osFilename = NormalizePath(pszFilename);
 
     memset(pStatBuf, 0, sizeof(VSIStatBufL));
@@ -741,17 +929,18 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
         return 0;
     }
 
-    auto oIter = oFileList.find(osFilename);
-    if (oIter == oFileList.end())
+    std::shared_ptr<VSIMemFile> poFile;
     {
-        errno = ENOENT;
-        return -1;
+        CPL_SHARED_LOCK oListLock(m_oMutex);
+        auto oIter = oFileList.find(osFilename);
+        if (oIter == oFileList.end())
+        {
+            errno = ENOENT;
+            return -1;
+        }
+        poFile = oIter->second;
     }
 
-    std::shared_ptr<VSIMemFile> poFile = oIter->second;
-
-    memset(pStatBuf, 0, sizeof(VSIStatBufL));
-
     CPL_SHARED_LOCK oLock(poFile->m_oMutex);
     if (poFile->bIsDirectory)
     {
@@ -784,7 +973,7 @@ int VSIMemFilesystemHandler::Stat(const char *pszFilename,
 int VSIMemFilesystemHandler::Unlink(const char *pszFilename)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
     return Unlink_unlocked(pszFilename);
 }
 
@@ -821,7 +1010,7 @@ int VSIMemFilesystemHandler::Unlink_unlocked(const char *pszFilename)
 int VSIMemFilesystemHandler::Mkdir(const char *pszPathname, long /* nMode */)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
 
     const CPLString osPathname = NormalizePath(pszPathname);
     if (STARTS_WITH(osPathname.c_str(), szHIDDEN_DIRNAME))
@@ -871,7 +1060,7 @@ int VSIMemFilesystemHandler::Rmdir(const char *pszPathname)
 
 int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 {
-    CPLMutexHolder oHolder(&hMutex);
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
 
     const CPLString osPath = NormalizePath(pszDirname);
     const size_t nPathLen = osPath.size();
@@ -935,7 +1124,7 @@ int VSIMemFilesystemHandler::RmdirRecursive(const char *pszDirname)
 char **VSIMemFilesystemHandler::ReadDirEx(const char *pszPath, int nMaxFiles)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
+    CPL_SHARED_LOCK oLock(m_oMutex);
 
     const CPLString osPath = NormalizePath(pszPath);
 
@@ -1038,7 +1227,7 @@ int VSIMemFilesystemHandler::Rename(const char *pszOldPath,
                                     void *)
 
 {
-    CPLMutexHolder oHolder(&hMutex);
+    CPL_EXCLUSIVE_LOCK oLock(m_oMutex);
 
     const std::string osOldPath = NormalizePath(pszOldPath);
     const std::string osNewPath = NormalizePath(pszNewPath);
@@ -1227,14 +1416,14 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
     std::shared_ptr<VSIMemFile> poFile = std::make_shared<VSIMemFile>();
 
     poFile->osFilename = osFilename;
-    poFile->bOwnData = CPL_TO_BOOL(bTakeOwnership);
-    poFile->pabyData = pabyData;
+    poFile->poBuffer->bOwnData = CPL_TO_BOOL(bTakeOwnership);
+    poFile->poBuffer->pabyData = pabyData;
     poFile->nLength = nDataLength;
     poFile->nAllocLength = nDataLength;
 
     if (!osFilename.empty())
     {
-        CPLMutexHolder oHolder(&poHandler->hMutex);
+        CPL_EXCLUSIVE_LOCK oLock(poHandler->m_oMutex);
         poHandler->Unlink_unlocked(osFilename);
         poHandler->oFileList[poFile->osFilename] = poFile;
 #ifdef DEBUG_VERBOSE
@@ -1249,8 +1438,7 @@ VSILFILE *VSIFileFromMemBuffer(const char *pszFilename, GByte *pabyData,
     /* -------------------------------------------------------------------- */
     VSIMemHandle *poHandle = new VSIMemHandle;
 
-    poHandle->poFile = std::move(poFile);
-    poHandle->bUpdate = true;
+    poHandle->SetFile(std::move(poFile), /* bUpdate = */ true);
     poHandle->m_bReadAllowed = true;
     return poHandle;
 }
@@ -1289,23 +1477,26 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
     const std::string osFilename =
         VSIMemFilesystemHandler::NormalizePath(pszFilename);
 
-    CPLMutexHolder oHolder(&poHandler->hMutex);
+    CPL_EXCLUSIVE_LOCK oLock(poHandler->m_oMutex);
 
     if (poHandler->oFileList.find(osFilename) == poHandler->oFileList.end())
         return nullptr;
 
     std::shared_ptr<VSIMemFile> poFile = poHandler->oFileList[osFilename];
-    GByte *pabyData = poFile->pabyData;
+    CPL_EXCLUSIVE_LOCK oFileLock(poFile->m_oMutex);
+    if (bUnlinkAndSeize && !poFile->MakeWritable())
+        return nullptr;
+    GByte *pabyData = poFile->GetData();
     if (pnDataLength != nullptr)
         *pnDataLength = poFile->nLength;
 
     if (bUnlinkAndSeize)
     {
-        if (!poFile->bOwnData)
+        if (!poFile->poBuffer->bOwnData)
             CPLDebug("VSIMemFile",
                      "File doesn't own data in VSIGetMemFileBuffer!");
         else
-            poFile->bOwnData = false;
+            poFile->poBuffer->bOwnData = false;
 
         poHandler->oFileList.erase(poHandler->oFileList.find(osFilename));
 #ifdef DEBUG_VERBOSE
@@ -1313,9 +1504,10 @@ GByte *VSIGetMemFileBuffer(const char *pszFilename, vsi_l_offset *pnDataLength,
                  poFile->osFilename.c_str(),
                  static_cast<int>(poFile.use_count()));
 #endif
-        poFile->pabyData = nullptr;
+        poFile->poBuffer->pabyData = nullptr;
         poFile->nLength = 0;
         poFile->nAllocLength = 0;
+        poFile->Touch();
     }
 
     return pabyData;
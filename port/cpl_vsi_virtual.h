@@ -23,6 +23,7 @@
 #include "cpl_string.h"
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -39,6 +40,58 @@
 #undef CopyFile
 #endif
 
+/************************************************************************/
+/*                            VSIAsyncBatch                             */
+/************************************************************************/
+
+/** Batch of asynchronous read or write requests.
+ *
+ * Instances are returned by VSIVirtualHandle::SubmitReadBatch() and
+ * VSIVirtualHandle::SubmitWriteBatch(). Implementations of those methods
+ * call Complete() once for each request, from any thread. The destructor
+ * waits for all requests to be completed.
+ *
+ * @since GDAL 3.13
+ */
+struct CPL_DLL VSIAsyncBatch
+{
+    VSIAsyncBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                  VSIAsyncCompletionFunc pfnCompletion,
+                  void *pCompletionUserData);
+    virtual ~VSIAsyncBatch();
+
+    /** Return the number of requests of the batch */
+    int GetRequestCount() const
+    {
+        return m_nRequests;
+    }
+
+    /** Return the i-th request of the batch */
+    VSIAsyncRequest *GetRequest(int i) const
+    {
+        return m_pasRequests + i;
+    }
+
+    void SubmitJob(std::function<void()> task);
+    void Complete(int iRequest, size_t nTransferred, bool bError);
+
+    bool Wait(double dfTimeout);
+    int GetCompletedCount() const;
+    int GetErrorCount() const;
+
+    /*! @cond Doxygen_Suppress */
+    struct Private;
+    /*! @endcond */
+
+  private:
+    const int m_nRequests;
+    VSIAsyncRequest *const m_pasRequests;
+    std::unique_ptr<Private> m_poPrivate;
+
+    VSIAsyncBatch(const VSIAsyncBatch &) = delete;
+    VSIAsyncBatch &operator=(const VSIAsyncBatch &) = delete;
+};
+
 /************************************************************************/
 /*                           VSIVirtualHandle                           */
 /************************************************************************/
@@ -207,6 +260,16 @@ struct CPL_DLL VSIVirtualHandle
     virtual size_t PRead(void *pBuffer, size_t nSize,
                          vsi_l_offset nOffset) const;
 
+    virtual std::unique_ptr<VSIAsyncBatch>
+    SubmitReadBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                    VSIAsyncCompletionFunc pfnCompletion,
+                    void *pCompletionUserData);
+
+    virtual std::unique_ptr<VSIAsyncBatch>
+    SubmitWriteBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                     VSIAsyncCompletionFunc pfnCompletion,
+                     void *pCompletionUserData);
+
     /** Ask current operations to be interrupted.
      * Implementations must be thread-safe, as this will typically be called
      * from another thread than the active one for this file.
@@ -361,6 +424,26 @@ class VSIProxyFileHandle /* non final */ : public VSIVirtualHandle
         return m_nativeHandle->PRead(pBuffer, nSize, nOffset);
     }
 
+    std::unique_ptr<VSIAsyncBatch>
+    SubmitReadBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                    VSIAsyncCompletionFunc pfnCompletion,
+                    void *pCompletionUserData) override
+    {
+        return m_nativeHandle->SubmitReadBatch(nRequests, pasRequests,
+                                               pfnCompletion,
+                                               pCompletionUserData);
+    }
+
+    std::unique_ptr<VSIAsyncBatch>
+    SubmitWriteBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                     VSIAsyncCompletionFunc pfnCompletion,
+                     void *pCompletionUserData) override
+    {
+        return m_nativeHandle->SubmitWriteBatch(nRequests, pasRequests,
+                                                pfnCompletion,
+                                                pCompletionUserData);
+    }
+
     void Interrupt() override
     {
         m_nativeHandle->Interrupt();
@@ -734,6 +817,13 @@ class VSIArchiveFilesystemHandler /* non final */ : public VSIFilesystemHandler
                            const char *fileInArchiveName,
                            const VSIArchiveEntry **archiveEntry);
 
+    std::string GetCatalogFilename(const char *archiveFilename) const;
+    std::unique_ptr<VSIArchiveContent>
+    LoadCatalog(const char *archiveFilename, const VSIStatBufL &sStat,
+                const std::string &osETag) const;
+    void SaveCatalog(const char *archiveFilename, const std::string &osETag,
+                     const VSIArchiveContent &content) const;
+
   protected:
     mutable std::recursive_mutex oMutex{};
 
@@ -749,6 +839,15 @@ class VSIArchiveFilesystemHandler /* non final */ : public VSIFilesystemHandler
     virtual std::unique_ptr<VSIArchiveReader>
     CreateReader(const char *pszArchiveFileName) = 0;
 
+    // Conversion of entry offsets from/to two integers, so that the content
+    // of archives can be persisted in CPL_VSIL_ARCHIVE_CATALOG_CACHE_DIR.
+    // The default implementations disable persistence.
+    virtual bool SerializeFileOffset(const VSIArchiveEntryFileOffset *poOffset,
+                                     GUIntBig &nValue1,
+                                     GUIntBig &nValue2) const;
+    virtual std::unique_ptr<VSIArchiveEntryFileOffset>
+    DeserializeFileOffset(GUIntBig nValue1, GUIntBig nValue2) const;
+
   public:
     VSIArchiveFilesystemHandler();
     ~VSIArchiveFilesystemHandler() override;
@@ -810,6 +909,11 @@ VSIVirtualHandle *
 VSICreateBufferedReaderHandle(VSIVirtualHandle *poBaseHandle,
                               const GByte *pabyBeginningContent,
                               vsi_l_offset nCheatFileSize);
+class CPLWorkerThreadPool;
+CPLWorkerThreadPool *VSIGetAsyncIOThreadPool();
+void VSICleanupAsyncIOThreadPool();
+std::string VSICurlGetCachedETag(const char *pszFilename);
+
 constexpr int VSI_CACHED_DEFAULT_CHUNK_SIZE = 32768;
 VSIVirtualHandle CPL_DLL *
 VSICreateCachedFile(VSIVirtualHandle *poBaseHandle,
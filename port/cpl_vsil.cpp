@@ -4387,6 +4387,8 @@ void VSIFileManager::RemoveHandler(const std::string &osPrefix)
 void VSICleanupFileManager()
 
 {
+    VSICleanupAsyncIOThreadPool();
+
     if (poManager)
     {
         delete poManager;
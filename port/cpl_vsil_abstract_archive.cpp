@@ -26,6 +26,7 @@
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 
@@ -116,6 +117,260 @@ static void BuildDirectoryIndex(VSIArchiveContent *content)
     }
 }
 
+/************************************************************************/
+/*                        SerializeFileOffset()                         */
+/************************************************************************/
+
+bool VSIArchiveFilesystemHandler::SerializeFileOffset(
+    const VSIArchiveEntryFileOffset *, GUIntBig &, GUIntBig &) const
+{
+    return false;
+}
+
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+std::unique_ptr<VSIArchiveEntryFileOffset>
+VSIArchiveFilesystemHandler::DeserializeFileOffset(GUIntBig, GUIntBig) const
+{
+    return nullptr;
+}
+
+/************************************************************************/
+/*                          Catalog encoding                            */
+/************************************************************************/
+
+// A catalog is made of a header, with the signature, the name of the archive
+// and the validators of its content, followed by the entries. All integers
+// are little-endian. Strings are prefixed with their 32-bit length.
+constexpr char CATALOG_SIGNATURE[] = "GDAL_ARCHIVE_CATALOG_1";
+
+namespace
+{
+struct CatalogWriter
+{
+    std::string osData{};
+
+    template <class T> void Write(T nVal)
+    {
+        nVal = CPL_AS_LSB(nVal);
+        osData.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    }
+
+    void Write(const std::string &osStr)
+    {
+        Write(static_cast<uint32_t>(osStr.size()));
+        osData += osStr;
+    }
+};
+
+struct CatalogReader
+{
+    const std::string &osData;
+    size_t nPos = 0;
+    bool bError = false;
+
+    explicit CatalogReader(const std::string &osDataIn) : osData(osDataIn)
+    {
+    }
+
+    template <class T> T Read()
+    {
+        T nVal = 0;
+        if (osData.size() - nPos < sizeof(nVal))
+        {
+            bError = true;
+            return nVal;
+        }
+        memcpy(&nVal, osData.data() + nPos, sizeof(nVal));
+        nPos += sizeof(nVal);
+        return CPL_AS_LSB(nVal);
+    }
+
+    std::string ReadString()
+    {
+        const uint32_t nSize = Read<uint32_t>();
+        if (bError || osData.size() - nPos < nSize)
+        {
+            bError = true;
+            return std::string();
+        }
+        std::string osRet(osData, nPos, nSize);
+        nPos += nSize;
+        return osRet;
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                         GetCatalogFilename()                         */
+/************************************************************************/
+
+/* Return the name of the file that persists the content of archiveFilename,
+ * or an empty string if CPL_VSIL_ARCHIVE_CATALOG_CACHE_DIR is not set. */
+std::string VSIArchiveFilesystemHandler::GetCatalogFilename(
+    const char *archiveFilename) const
+{
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_ARCHIVE_CATALOG_CACHE_DIR", nullptr);
+    if (pszDirectory == nullptr || pszDirectory[0] == '\0' ||
+        STARTS_WITH(archiveFilename, "/vsimem/"))
+    {
+        return std::string();
+    }
+
+    std::string osKey(GetPrefix());
+    osKey += '\n';
+    osKey += archiveFilename;
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osFilename =
+        CPLFormFilenameSafe(pszDirectory, pszHex, "catalog");
+    CPLFree(pszHex);
+    return osFilename;
+}
+
+/************************************************************************/
+/*                            LoadCatalog()                             */
+/************************************************************************/
+
+std::unique_ptr<VSIArchiveContent>
+VSIArchiveFilesystemHandler::LoadCatalog(const char *archiveFilename,
+                                         const VSIStatBufL &sStat,
+                                         const std::string &osETag) const
+{
+    const std::string osCatalogFilename = GetCatalogFilename(archiveFilename);
+    if (osCatalogFilename.empty())
+        return nullptr;
+
+    GByte *pabyData = nullptr;
+    vsi_l_offset nDataSize = 0;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        if (!VSIIngestFile(nullptr, osCatalogFilename.c_str(), &pabyData,
+                           &nDataSize, -1))
+        {
+            return nullptr;
+        }
+    }
+    const std::string osData(reinterpret_cast<const char *>(pabyData),
+                             static_cast<size_t>(nDataSize));
+    VSIFree(pabyData);
+
+    CatalogReader oReader(osData);
+    auto content = std::make_unique<VSIArchiveContent>();
+    if (oReader.ReadString() != CATALOG_SIGNATURE ||
+        oReader.ReadString() != archiveFilename)
+    {
+        return nullptr;
+    }
+    content->nFileSize = oReader.Read<uint64_t>();
+    content->mTime = static_cast<time_t>(oReader.Read<int64_t>());
+    if (oReader.bError ||
+        content->nFileSize != static_cast<vsi_l_offset>(sStat.st_size) ||
+        content->mTime != static_cast<time_t>(sStat.st_mtime) ||
+        oReader.ReadString() != osETag)
+    {
+        CPLDebug("VSIArchive", "Catalog %s of %s is stale",
+                 osCatalogFilename.c_str(), archiveFilename);
+        return nullptr;
+    }
+
+    const uint64_t nEntries = oReader.Read<uint64_t>();
+    // Each entry takes at least 37 bytes
+    if (oReader.bError || nEntries > (osData.size() - oReader.nPos) / 37)
+        return nullptr;
+    content->entries.resize(static_cast<size_t>(nEntries));
+    for (auto &entry : content->entries)
+    {
+        entry.fileName = oReader.ReadString();
+        entry.uncompressed_size = oReader.Read<uint64_t>();
+        entry.nModifiedTime = oReader.Read<int64_t>();
+        const uint8_t nFlags = oReader.Read<uint8_t>();
+        entry.bIsDir = (nFlags & 1) != 0;
+        const GUIntBig nValue1 = oReader.Read<uint64_t>();
+        const GUIntBig nValue2 = oReader.Read<uint64_t>();
+        if (oReader.bError)
+            return nullptr;
+        if (nFlags & 2)
+        {
+            entry.file_pos = DeserializeFileOffset(nValue1, nValue2);
+            if (!entry.file_pos)
+                return nullptr;
+        }
+    }
+    if (oReader.nPos != osData.size())
+        return nullptr;
+
+    CPLDebug("VSIArchive", "Content of %s read from catalog %s",
+             archiveFilename, osCatalogFilename.c_str());
+    return content;
+}
+
+/************************************************************************/
+/*                            SaveCatalog()                             */
+/************************************************************************/
+
+void VSIArchiveFilesystemHandler::SaveCatalog(
+    const char *archiveFilename, const std::string &osETag,
+    const VSIArchiveContent &content) const
+{
+    const std::string osCatalogFilename = GetCatalogFilename(archiveFilename);
+    if (osCatalogFilename.empty())
+        return;
+
+    CatalogWriter oWriter;
+    oWriter.Write(std::string(CATALOG_SIGNATURE));
+    oWriter.Write(std::string(archiveFilename));
+    oWriter.Write(static_cast<uint64_t>(content.nFileSize));
+    oWriter.Write(static_cast<int64_t>(content.mTime));
+    oWriter.Write(osETag);
+    oWriter.Write(static_cast<uint64_t>(content.entries.size()));
+    for (const auto &entry : content.entries)
+    {
+        GUIntBig nValue1 = 0;
+        GUIntBig nValue2 = 0;
+        if (entry.file_pos &&
+            !SerializeFileOffset(entry.file_pos.get(), nValue1, nValue2))
+        {
+            return;
+        }
+        oWriter.Write(entry.fileName);
+        oWriter.Write(static_cast<uint64_t>(entry.uncompressed_size));
+        oWriter.Write(static_cast<int64_t>(entry.nModifiedTime));
+        oWriter.Write(static_cast<uint8_t>((entry.bIsDir ? 1 : 0) |
+                                           (entry.file_pos ? 2 : 0)));
+        oWriter.Write(static_cast<uint64_t>(nValue1));
+        oWriter.Write(static_cast<uint64_t>(nValue2));
+    }
+
+    // Write into a temporary file, and rename it afterwards, so that other
+    // processes never see partially written catalogs.
+    CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+    VSIMkdirRecursive(CPLGetPathSafe(osCatalogFilename.c_str()).c_str(), 0755);
+    const std::string osTmpFilename =
+        osCatalogFilename + CPLSPrintf(".tmp.%d", CPLGetCurrentProcessID());
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLDebug("VSIArchive", "Cannot create %s", osTmpFilename.c_str());
+        return;
+    }
+    bool bOK = VSIFWriteL(oWriter.osData.data(), 1, oWriter.osData.size(),
+                          fp) == oWriter.osData.size();
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK ||
+        VSIRename(osTmpFilename.c_str(), osCatalogFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+    CPLDebug("VSIArchive", "Content of %s written in catalog %s",
+             archiveFilename, osCatalogFilename.c_str());
+}
+
 /************************************************************************/
 /*                        GetContentOfArchive()                         */
 /************************************************************************/
@@ -148,6 +403,20 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
         }
     }
 
+    const std::string osETag = VSICurlGetCachedETag(archiveFilename);
+    {
+        auto content = LoadCatalog(archiveFilename, sStat, osETag);
+        if (content)
+        {
+            BuildDirectoryIndex(content.get());
+            return oFileList
+                .insert(std::pair<CPLString,
+                                  std::unique_ptr<VSIArchiveContent>>(
+                    archiveFilename, std::move(content)))
+                .first->second.get();
+        }
+    }
+
     std::unique_ptr<VSIArchiveReader> temporaryReader;  // keep in that scope
     if (poReader == nullptr)
     {
@@ -227,6 +496,8 @@ VSIArchiveFilesystemHandler::GetContentOfArchive(const char *archiveFilename,
     // Build directory index for fast lookups
     BuildDirectoryIndex(content.get());
 
+    SaveCatalog(archiveFilename, osETag, *content);
+
     return oFileList
         .insert(std::pair<CPLString, std::unique_ptr<VSIArchiveContent>>(
             archiveFilename, std::move(content)))
@@ -0,0 +1,560 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Asynchronous batched I/O for VSI virtual file handles
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_error_internal.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+
+//! @cond Doxygen_Suppress
+
+// Default number of threads of the pool used to service asynchronous
+// requests. They mostly wait for I/O, so this does not need to be related to
+// the number of CPUs.
+constexpr int ASYNC_IO_NUM_THREADS_DEFAULT = 8;
+
+static std::mutex goAsyncIOPoolMutex;
+static CPLWorkerThreadPool *gpoAsyncIOPool = nullptr;
+static bool gbAsyncIOPoolSetupFailed = false;
+
+/************************************************************************/
+/*                      VSIGetAsyncIOThreadPool()                       */
+/************************************************************************/
+
+/** Return the thread pool used to service asynchronous I/O requests, or
+ * nullptr if threads are not available.
+ */
+CPLWorkerThreadPool *VSIGetAsyncIOThreadPool()
+{
+#ifdef CPL_MULTIPROC_STUB
+    return nullptr;
+#else
+    std::lock_guard<std::mutex> oLock(goAsyncIOPoolMutex);
+    if (gpoAsyncIOPool == nullptr && !gbAsyncIOPoolSetupFailed)
+    {
+        const char *pszNumThreads =
+            CPLGetConfigOption("CPL_VSIL_ASYNC_NUM_THREADS", nullptr);
+        int nThreads = ASYNC_IO_NUM_THREADS_DEFAULT;
+        if (pszNumThreads)
+        {
+            nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                           ? CPLGetNumCPUs()
+                           : std::max(1, atoi(pszNumThreads));
+        }
+        auto poPool = new CPLWorkerThreadPool();
+        if (poPool->Setup(nThreads, nullptr, nullptr))
+        {
+            gpoAsyncIOPool = poPool;
+        }
+        else
+        {
+            delete poPool;
+            gbAsyncIOPoolSetupFailed = true;
+        }
+    }
+    return gpoAsyncIOPool;
+#endif
+}
+
+/************************************************************************/
+/*                    VSICleanupAsyncIOThreadPool()                     */
+/************************************************************************/
+
+void VSICleanupAsyncIOThreadPool()
+{
+    std::lock_guard<std::mutex> oLock(goAsyncIOPoolMutex);
+    delete gpoAsyncIOPool;
+    gpoAsyncIOPool = nullptr;
+    gbAsyncIOPoolSetupFailed = false;
+}
+
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSIAsyncBatch                             */
+/* ==================================================================== */
+/************************************************************************/
+
+struct VSIAsyncBatch::Private
+{
+    VSIAsyncCompletionFunc m_pfnCompletion = nullptr;
+    void *m_pCompletionUserData = nullptr;
+    CPLStringList m_aosThreadLocalConfigOptions{};
+    CPLErrorAccumulator m_oErrorAccumulator{};
+    bool m_bErrorsReplayed = false;
+
+    mutable std::mutex m_oMutex{};
+    std::condition_variable m_oCond{};
+    int m_nCompleted = 0;
+    int m_nErrors = 0;
+    // Number of jobs submitted by SubmitJob() that have not returned yet
+    int m_nPendingJobs = 0;
+};
+
+/************************************************************************/
+/*                           VSIAsyncBatch()                            */
+/************************************************************************/
+
+/** Constructor.
+ *
+ * @param nRequests Number of requests.
+ * @param pasRequests Array of nRequests requests, that must be kept alive
+ *                    until the batch is destroyed.
+ * @param pfnCompletion Callback invoked once for each request when it has
+ *                      completed, or nullptr.
+ * @param pCompletionUserData User data passed to pfnCompletion.
+ */
+VSIAsyncBatch::VSIAsyncBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                             VSIAsyncCompletionFunc pfnCompletion,
+                             void *pCompletionUserData)
+    : m_nRequests(nRequests), m_pasRequests(pasRequests),
+      m_poPrivate(std::make_unique<Private>())
+{
+    m_poPrivate->m_pfnCompletion = pfnCompletion;
+    m_poPrivate->m_pCompletionUserData = pCompletionUserData;
+    m_poPrivate->m_aosThreadLocalConfigOptions.Assign(
+        CPLGetThreadLocalConfigOptions(), true);
+    for (int i = 0; i < nRequests; ++i)
+    {
+        pasRequests[i].nTransferred = 0;
+        pasRequests[i].bError = FALSE;
+    }
+}
+
+/************************************************************************/
+/*                           ~VSIAsyncBatch()                           */
+/************************************************************************/
+
+/** Destructor. Waits for all requests to be completed. */
+VSIAsyncBatch::~VSIAsyncBatch()
+{
+    Wait(-1);
+}
+
+/************************************************************************/
+/*                              SubmitJob()                             */
+/************************************************************************/
+
+/** Run a task servicing requests of the batch in the asynchronous I/O
+ * thread pool.
+ *
+ * The task sees the thread-local configuration options of the thread that
+ * created the batch, and errors it emits are replayed by Wait().
+ * If no thread pool is available, the task is run synchronously.
+ */
+void VSIAsyncBatch::SubmitJob(std::function<void()> task)
+{
+    auto poPool = VSIGetAsyncIOThreadPool();
+    if (poPool == nullptr)
+    {
+        task();
+        return;
+    }
+
+    Private *psPrivate = m_poPrivate.get();
+    {
+        std::lock_guard<std::mutex> oLock(psPrivate->m_oMutex);
+        ++psPrivate->m_nPendingJobs;
+    }
+    poPool->SubmitJob(
+        [psPrivate, task = std::move(task)]()
+        {
+            const CPLStringList aosTLConfigOptionsBackup(
+                CPLGetThreadLocalConfigOptions());
+            CPLSetThreadLocalConfigOptions(
+                psPrivate->m_aosThreadLocalConfigOptions.List());
+            {
+                auto oAccumulatorContext =
+                    psPrivate->m_oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulatorContext);
+                task();
+            }
+            CPLSetThreadLocalConfigOptions(aosTLConfigOptionsBackup.List());
+
+            // Wait() does not return before this point, so that the
+            // batch outlives the error accumulator context.
+            std::lock_guard<std::mutex> oLock(psPrivate->m_oMutex);
+            --psPrivate->m_nPendingJobs;
+            psPrivate->m_oCond.notify_all();
+        });
+}
+
+/************************************************************************/
+/*                              Complete()                              */
+/************************************************************************/
+
+/** Declare that a request has completed.
+ *
+ * This sets the output members of the request, invokes the completion
+ * callback, and then wakes up threads waiting for the batch. It must be
+ * called exactly once per request, from any thread.
+ *
+ * @param iRequest Index of the request.
+ * @param nTransferred Number of bytes read or written.
+ * @param bError Whether the request failed.
+ */
+void VSIAsyncBatch::Complete(int iRequest, size_t nTransferred, bool bError)
+{
+    VSIAsyncRequest *psRequest = m_pasRequests + iRequest;
+    psRequest->nTransferred = nTransferred;
+    psRequest->bError = bError;
+    if (m_poPrivate->m_pfnCompletion)
+        m_poPrivate->m_pfnCompletion(psRequest,
+                                     m_poPrivate->m_pCompletionUserData);
+
+    std::lock_guard<std::mutex> oLock(m_poPrivate->m_oMutex);
+    ++m_poPrivate->m_nCompleted;
+    if (bError)
+        ++m_poPrivate->m_nErrors;
+    m_poPrivate->m_oCond.notify_all();
+}
+
+/************************************************************************/
+/*                                Wait()                                */
+/************************************************************************/
+
+/** Wait for all requests of the batch to be completed.
+ *
+ * Once they are, errors emitted by worker threads are replayed in the calling
+ * thread.
+ *
+ * @param dfTimeout Maximum time to wait, in seconds. A negative value means
+ *                  an infinite wait.
+ * @return true if all requests have completed.
+ */
+bool VSIAsyncBatch::Wait(double dfTimeout)
+{
+    {
+        std::unique_lock<std::mutex> oLock(m_poPrivate->m_oMutex);
+        const auto IsFinished = [this]()
+        {
+            return m_poPrivate->m_nCompleted == m_nRequests &&
+                   m_poPrivate->m_nPendingJobs == 0;
+        };
+        if (dfTimeout < 0)
+        {
+            m_poPrivate->m_oCond.wait(oLock, IsFinished);
+        }
+        else if (!m_poPrivate->m_oCond.wait_for(
+                     oLock, std::chrono::duration<double>(dfTimeout),
+                     IsFinished))
+        {
+            return false;
+        }
+        if (m_poPrivate->m_bErrorsReplayed)
+            return true;
+        m_poPrivate->m_bErrorsReplayed = true;
+    }
+    m_poPrivate->m_oErrorAccumulator.ReplayErrors();
+    return true;
+}
+
+/************************************************************************/
+/*                         GetCompletedCount()                          */
+/************************************************************************/
+
+/** Return the number of requests that have completed. */
+int VSIAsyncBatch::GetCompletedCount() const
+{
+    std::lock_guard<std::mutex> oLock(m_poPrivate->m_oMutex);
+    return m_poPrivate->m_nCompleted;
+}
+
+/************************************************************************/
+/*                           GetErrorCount()                            */
+/************************************************************************/
+
+/** Return the number of requests that have completed with an error. */
+int VSIAsyncBatch::GetErrorCount() const
+{
+    std::lock_guard<std::mutex> oLock(m_poPrivate->m_oMutex);
+    return m_poPrivate->m_nErrors;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                          SubmitReadBatch()                           */
+/************************************************************************/
+
+/** Submit a batch of asynchronous read requests.
+ *
+ * The default implementation services the requests with PRead() from the
+ * asynchronous I/O thread pool when HasPRead() returns true, and otherwise
+ * with Seek() and Read() in a single job, in which case the handle must not
+ * be used until the batch has completed.
+ *
+ * @param nRequests Number of requests.
+ * @param pasRequests Array of nRequests requests, that must be kept alive
+ *                    until the returned batch is destroyed.
+ * @param pfnCompletion Callback invoked once for each request when it has
+ *                      completed, or nullptr.
+ * @param pCompletionUserData User data passed to pfnCompletion.
+ * @return a batch, to be destroyed before the handle is closed.
+ * @since GDAL 3.13
+ */
+std::unique_ptr<VSIAsyncBatch>
+VSIVirtualHandle::SubmitReadBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                                  VSIAsyncCompletionFunc pfnCompletion,
+                                  void *pCompletionUserData)
+{
+    auto poBatch = std::make_unique<VSIAsyncBatch>(
+        nRequests, pasRequests, pfnCompletion, pCompletionUserData);
+    VSIAsyncBatch *poBatchRaw = poBatch.get();
+    if (HasPRead())
+    {
+        for (int i = 0; i < nRequests; ++i)
+        {
+            poBatch->SubmitJob(
+                [this, poBatchRaw, i]()
+                {
+                    const VSIAsyncRequest *psRequest =
+                        poBatchRaw->GetRequest(i);
+                    const size_t nRead = PRead(
+                        psRequest->pBuffer, psRequest->nSize,
+                        psRequest->nOffset);
+                    // pread() returns -1 on error
+                    if (nRead > psRequest->nSize)
+                        poBatchRaw->Complete(i, 0, true);
+                    else
+                        poBatchRaw->Complete(i, nRead, false);
+                });
+        }
+    }
+    else
+    {
+        poBatch->SubmitJob(
+            [this, poBatchRaw]()
+            {
+                for (int i = 0; i < poBatchRaw->GetRequestCount(); ++i)
+                {
+                    const VSIAsyncRequest *psRequest =
+                        poBatchRaw->GetRequest(i);
+                    if (Seek(psRequest->nOffset, SEEK_SET) != 0)
+                    {
+                        poBatchRaw->Complete(i, 0, true);
+                        continue;
+                    }
+                    const size_t nRead =
+                        Read(psRequest->pBuffer, psRequest->nSize);
+                    poBatchRaw->Complete(
+                        i, nRead, nRead < psRequest->nSize && Error() != 0);
+                }
+            });
+    }
+    return poBatch;
+}
+
+/************************************************************************/
+/*                          SubmitWriteBatch()                          */
+/************************************************************************/
+
+/** Submit a batch of asynchronous write requests.
+ *
+ * The default implementation services the requests with Seek() and Write()
+ * in a single job of the asynchronous I/O thread pool. The handle must not
+ * be used until the batch has completed.
+ *
+ * @param nRequests Number of requests.
+ * @param pasRequests Array of nRequests requests, that must be kept alive
+ *                    until the returned batch is destroyed.
+ * @param pfnCompletion Callback invoked once for each request when it has
+ *                      completed, or nullptr.
+ * @param pCompletionUserData User data passed to pfnCompletion.
+ * @return a batch, to be destroyed before the handle is closed.
+ * @since GDAL 3.13
+ */
+std::unique_ptr<VSIAsyncBatch>
+VSIVirtualHandle::SubmitWriteBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                                   VSIAsyncCompletionFunc pfnCompletion,
+                                   void *pCompletionUserData)
+{
+    auto poBatch = std::make_unique<VSIAsyncBatch>(
+        nRequests, pasRequests, pfnCompletion, pCompletionUserData);
+    VSIAsyncBatch *poBatchRaw = poBatch.get();
+    poBatch->SubmitJob(
+        [this, poBatchRaw]()
+        {
+            for (int i = 0; i < poBatchRaw->GetRequestCount(); ++i)
+            {
+                const VSIAsyncRequest *psRequest = poBatchRaw->GetRequest(i);
+                if (Seek(psRequest->nOffset, SEEK_SET) != 0)
+                {
+                    poBatchRaw->Complete(i, 0, true);
+                    continue;
+                }
+                const size_t nWritten =
+                    Write(psRequest->pBuffer, psRequest->nSize);
+                poBatchRaw->Complete(i, nWritten,
+                                     nWritten != psRequest->nSize);
+            }
+        });
+    return poBatch;
+}
+
+/************************************************************************/
+/*                        VSIFSubmitReadBatchL()                        */
+/************************************************************************/
+
+/**
+ * \brief Submit a batch of asynchronous read requests.
+ *
+ * The requests are serviced in the background, possibly concurrently and in
+ * any order, with the mechanism best suited to the file system: io_uring for
+ * local files on Linux, multiplexed HTTP range requests for network file
+ * systems, and a thread pool for other file systems.
+ *
+ * pfnCompletion, if not NULL, is called once for each request when it has
+ * completed, with its nTransferred and bError members set. It may be called
+ * from any thread, including the calling one, and even before this function
+ * returns. It should not block.
+ *
+ * The requests and their buffers must be kept alive, and the file handle must
+ * not be closed, until the batch is freed with VSIAsyncBatchFree(). Unless
+ * the file system natively supports concurrent accesses, the file handle
+ * should not be used for other operations until all requests have completed.
+ *
+ * Errors emitted while servicing the requests are reported by
+ * VSIAsyncBatchWait() or VSIAsyncBatchFree().
+ *
+ * The number of threads used when no native asynchronous mechanism is
+ * available can be set with the CPL_VSIL_ASYNC_NUM_THREADS configuration
+ * option (default 8).
+ *
+ * @param fp file handle opened with VSIFOpenL().
+ * @param nRequests number of requests.
+ * @param pasRequests array of nRequests requests, with their nOffset, nSize
+ *                    and pBuffer members set.
+ * @param pfnCompletion completion callback, or NULL.
+ * @param pCompletionUserData user data passed to pfnCompletion.
+ * @return a batch to free with VSIAsyncBatchFree(), or NULL on error.
+ * @since GDAL 3.13
+ */
+VSIAsyncBatch *VSIFSubmitReadBatchL(VSILFILE *fp, int nRequests,
+                                    VSIAsyncRequest *pasRequests,
+                                    VSIAsyncCompletionFunc pfnCompletion,
+                                    void *pCompletionUserData)
+{
+    if (nRequests < 0 || (nRequests > 0 && pasRequests == nullptr))
+        return nullptr;
+    return fp->SubmitReadBatch(nRequests, pasRequests, pfnCompletion,
+                               pCompletionUserData)
+        .release();
+}
+
+/************************************************************************/
+/*                       VSIFSubmitWriteBatchL()                        */
+/************************************************************************/
+
+/**
+ * \brief Submit a batch of asynchronous write requests.
+ *
+ * This is the write counterpart of VSIFSubmitReadBatchL(), with the same
+ * lifetime rules. Requests of the same batch must not overlap.
+ *
+ * @param fp file handle opened with VSIFOpenL() in a writable mode.
+ * @param nRequests number of requests.
+ * @param pasRequests array of nRequests requests, with their nOffset, nSize
+ *                    and pBuffer members set.
+ * @param pfnCompletion completion callback, or NULL.
+ * @param pCompletionUserData user data passed to pfnCompletion.
+ * @return a batch to free with VSIAsyncBatchFree(), or NULL on error.
+ * @since GDAL 3.13
+ */
+VSIAsyncBatch *VSIFSubmitWriteBatchL(VSILFILE *fp, int nRequests,
+                                     VSIAsyncRequest *pasRequests,
+                                     VSIAsyncCompletionFunc pfnCompletion,
+                                     void *pCompletionUserData)
+{
+    if (nRequests < 0 || (nRequests > 0 && pasRequests == nullptr))
+        return nullptr;
+    return fp->SubmitWriteBatch(nRequests, pasRequests, pfnCompletion,
+                                pCompletionUserData)
+        .release();
+}
+
+/************************************************************************/
+/*                         VSIAsyncBatchWait()                          */
+/************************************************************************/
+
+/**
+ * \brief Wait for all requests of a batch to be completed.
+ *
+ * @param poBatch batch returned by VSIFSubmitReadBatchL() or
+ *                VSIFSubmitWriteBatchL().
+ * @param dfTimeout maximum time to wait, in seconds. A negative value means
+ *                  an infinite wait.
+ * @return TRUE if all requests have completed, FALSE on timeout.
+ * @since GDAL 3.13
+ */
+int VSIAsyncBatchWait(VSIAsyncBatch *poBatch, double dfTimeout)
+{
+    return poBatch->Wait(dfTimeout);
+}
+
+/************************************************************************/
+/*                   VSIAsyncBatchGetCompletedCount()                   */
+/************************************************************************/
+
+/**
+ * \brief Return the number of requests of a batch that have completed.
+ *
+ * @param poBatch batch returned by VSIFSubmitReadBatchL() or
+ *                VSIFSubmitWriteBatchL().
+ * @since GDAL 3.13
+ */
+int VSIAsyncBatchGetCompletedCount(VSIAsyncBatch *poBatch)
+{
+    return poBatch->GetCompletedCount();
+}
+
+/************************************************************************/
+/*                     VSIAsyncBatchGetErrorCount()                     */
+/************************************************************************/
+
+/**
+ * \brief Return the number of requests of a batch that have failed.
+ *
+ * @param poBatch batch returned by VSIFSubmitReadBatchL() or
+ *                VSIFSubmitWriteBatchL().
+ * @since GDAL 3.13
+ */
+int VSIAsyncBatchGetErrorCount(VSIAsyncBatch *poBatch)
+{
+    return poBatch->GetErrorCount();
+}
+
+/************************************************************************/
+/*                         VSIAsyncBatchFree()                          */
+/************************************************************************/
+
+/**
+ * \brief Wait for all requests of a batch to be completed, and free it.
+ *
+ * @param poBatch batch returned by VSIFSubmitReadBatchL() or
+ *                VSIFSubmitWriteBatchL(), or NULL.
+ * @since GDAL 3.13
+ */
+void VSIAsyncBatchFree(VSIAsyncBatch *poBatch)
+{
+    delete poBatch;
+}
@@ -2225,7 +2225,11 @@ std::string VSIAzureFSHandler::PutBlock(
         const long response_code =
             requestHelper.perform(hCurlHandle, headers, this, poS3HandleHelper);
 
-        NetworkStatisticsLogger::LogPUT(nBufferSize);
+        double dfElapsedSec = -1;
+        if (curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME,
+                              &dfElapsedSec) != CURLE_OK)
+            dfElapsedSec = -1;
+        NetworkStatisticsLogger::LogPUT(nBufferSize, dfElapsedSec);
 
         if (!bHasAlreadyHandled409 && response_code == 409)
         {
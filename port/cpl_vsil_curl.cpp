@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <limits>
 #include <map>
 #include <memory>
@@ -34,6 +35,7 @@
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
 #include "cpl_mem_cache.h"
+#include "cpl_vsil_curl_disk_cache.h"
 
 #ifndef S_IRUSR
 #define S_IRUSR 00400
@@ -101,6 +103,19 @@ int VSICurlUninstallReadCbk(VSILFILE * /* fp */)
     return FALSE;
 }
 
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                        VSICurlGetCachedETag()                        */
+/************************************************************************/
+
+std::string VSICurlGetCachedETag(const char * /* pszFilename */)
+{
+    return std::string();
+}
+
+//! @endcond
+
 #else
 
 //! @cond Doxygen_Suppress
@@ -541,6 +556,20 @@ VSICurlHandle::~VSICurlHandle()
     {
         curl_multi_cleanup(m_hCurlMultiHandleForAdviseRead);
     }
+    if (m_oThreadReadAhead.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> oLock(m_oReadAheadMutex);
+            m_bStopReadAhead = true;
+        }
+        m_oReadAheadCV.notify_all();
+        curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+        m_oThreadReadAhead.join();
+    }
+    if (m_hCurlMultiHandleForReadAhead)
+    {
+        curl_multi_cleanup(m_hCurlMultiHandleForReadAhead);
+    }
 
     if (!m_bCached)
     {
@@ -1610,8 +1639,8 @@ retry:
                         const size_t nToCache =
                             std::min<size_t>(sWriteFuncData.nSize - nOffset,
                                              knDOWNLOAD_CHUNK_SIZE);
-                        poFS->AddRegion(m_pszURL, nOffset, nToCache,
-                                        sWriteFuncData.pBuffer + nOffset);
+                        AddRegionToCache(nOffset, nToCache,
+                                         sWriteFuncData.pBuffer + nOffset);
                         nOffset += nToCache;
                     }
                 }
@@ -2015,6 +2044,134 @@ void VSICurlFilesystemHandlerBase::NotifyStopDownloadRegion(
     m_oMutex.unlock();
 }
 
+/************************************************************************/
+/*                        Endpoint statistics                           */
+/************************************************************************/
+
+// Smoothed latency and throughput measured for each server, used to size
+// requests when GDAL_HTTP_MERGE_RANGES_MAX_GAP=AUTO.
+namespace
+{
+struct EndpointStats
+{
+    double dfLatency = 0;    // in seconds
+    double dfBandwidth = 0;  // in bytes per second
+};
+}  // namespace
+
+static std::mutex goEndpointStatsMutex;
+static std::map<std::string, EndpointStats> goMapEndpointStats;
+
+/************************************************************************/
+/*                          GetEndpointKey()                            */
+/************************************************************************/
+
+// Return the scheme://host[:port] part of a URL
+static std::string GetEndpointKey(const std::string &osURL)
+{
+    const auto nPosSchemeEnd = osURL.find("://");
+    if (nPosSchemeEnd == std::string::npos)
+        return osURL;
+    const auto nPosPathStart = osURL.find('/', nPosSchemeEnd + strlen("://"));
+    return osURL.substr(0, nPosPathStart);
+}
+
+/************************************************************************/
+/*                       RecordTransferTimings()                        */
+/************************************************************************/
+
+static void RecordTransferTimings(const std::string &osURL, CURL *hCurlHandle,
+                                  size_t nDownloadedBytes)
+{
+    curl_off_t nPreTransferTime = 0;
+    curl_off_t nStartTransferTime = 0;
+    curl_off_t nTotalTime = 0;
+    if (curl_easy_getinfo(hCurlHandle, CURLINFO_PRETRANSFER_TIME_T,
+                          &nPreTransferTime) != CURLE_OK ||
+        curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME_T,
+                          &nStartTransferTime) != CURLE_OK ||
+        curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME_T, &nTotalTime) !=
+            CURLE_OK ||
+        nStartTransferTime <= nPreTransferTime)
+    {
+        return;
+    }
+
+    // Time between the request being sent and the first byte of the
+    // response: this is the latency paid for each request, independently
+    // of its size.
+    const double dfLatency =
+        static_cast<double>(nStartTransferTime - nPreTransferTime) * 1e-6;
+    // Only consider transfers large enough to give a meaningful throughput
+    constexpr size_t MIN_SIZE_FOR_BANDWIDTH = 64 * 1024;
+    const double dfTransferTime =
+        static_cast<double>(nTotalTime - nStartTransferTime) * 1e-6;
+    const double dfBandwidth =
+        nDownloadedBytes >= MIN_SIZE_FOR_BANDWIDTH && dfTransferTime > 1e-4
+            ? static_cast<double>(nDownloadedBytes) / dfTransferTime
+            : 0;
+
+    constexpr double SMOOTHING_FACTOR = 0.25;
+    std::lock_guard<std::mutex> oLock(goEndpointStatsMutex);
+    auto &oStats = goMapEndpointStats[GetEndpointKey(osURL)];
+    oStats.dfLatency =
+        oStats.dfLatency == 0
+            ? dfLatency
+            : oStats.dfLatency +
+                  SMOOTHING_FACTOR * (dfLatency - oStats.dfLatency);
+    if (dfBandwidth > 0)
+    {
+        oStats.dfBandwidth =
+            oStats.dfBandwidth == 0
+                ? dfBandwidth
+                : oStats.dfBandwidth +
+                      SMOOTHING_FACTOR * (dfBandwidth - oStats.dfBandwidth);
+    }
+}
+
+/************************************************************************/
+/*                      GetBandwidthDelayProduct()                      */
+/************************************************************************/
+
+// Return the number of bytes that can be downloaded from the server during
+// the latency of a request, or 0 if not known yet. Below that amount, the
+// duration of a request is dominated by its latency, so bridging a gap
+// between two ranges that is smaller than it is cheaper than issuing an
+// additional request.
+static size_t GetBandwidthDelayProduct(const std::string &osURL)
+{
+    constexpr double MAX_BDP = 8 * 1024 * 1024;
+    std::lock_guard<std::mutex> oLock(goEndpointStatsMutex);
+    const auto oIter = goMapEndpointStats.find(GetEndpointKey(osURL));
+    if (oIter == goMapEndpointStats.end())
+        return 0;
+    return static_cast<size_t>(std::min(
+        MAX_BDP, oIter->second.dfLatency * oIter->second.dfBandwidth));
+}
+
+/************************************************************************/
+/*                          GetMaxMergeGap()                            */
+/************************************************************************/
+
+// Return the maximum number of unrequested bytes that can be downloaded to
+// merge two ranges, according to GDAL_HTTP_MERGE_RANGES_MAX_GAP, or
+// std::numeric_limits<size_t>::max() if AUTO.
+static size_t GetMaxMergeGap()
+{
+    const char *pszMaxGap =
+        CPLGetConfigOption("GDAL_HTTP_MERGE_RANGES_MAX_GAP", "0");
+    if (EQUAL(pszMaxGap, "AUTO"))
+        return std::numeric_limits<size_t>::max();
+    GIntBig nMaxGap = 0;
+    if (CPLParseMemorySize(pszMaxGap, &nMaxGap, nullptr) != CE_None ||
+        nMaxGap < 0)
+    {
+        return 0;
+    }
+    return static_cast<size_t>(
+        std::min<GUIntBig>(nMaxGap, std::numeric_limits<size_t>::max()));
+}
+
 /************************************************************************/
 /*                           DownloadRegion()                           */
 /************************************************************************/
@@ -2145,6 +2302,9 @@ retry:
                  static_cast<int>(response_code), szCurlErrBuf);
     }
 
+    if (response_code == 200 || response_code == 206)
+        RecordTransferTimings(osURL, hCurlHandle, sWriteFuncData.nSize);
+
     long mtime = 0;
     curl_easy_getinfo(hCurlHandle, CURLINFO_FILETIME, &mtime);
     if (mtime > 0)
@@ -2400,6 +2560,93 @@ void VSICurlHandle::UpdateRedirectInfo(
     }
 }
 
+/************************************************************************/
+/*                           GetDiskCacheKey()                          */
+/************************************************************************/
+
+/* Return the key of the block at nOffset in the persistent disk cache, or an
+ * empty string if the remote content has no validator (ETag or last
+ * modification time) that would guarantee that the cached data is not stale.
+ */
+static std::string GetDiskCacheKey(VSICurlFilesystemHandlerBase *poFS,
+                                   const char *pszURL, vsi_l_offset nOffset)
+{
+    FileProp oCachedFileProp;
+    if (!poFS->GetCachedFileProp(pszURL, oCachedFileProp))
+        return std::string();
+    std::string osValidator;
+    if (!oCachedFileProp.ETag.empty())
+    {
+        osValidator = "ETag:";
+        osValidator += oCachedFileProp.ETag;
+    }
+    else if (oCachedFileProp.mTime != 0 &&
+             oCachedFileProp.bHasComputedFileSize)
+    {
+        osValidator = CPLSPrintf(
+            "Last-Modified:" CPL_FRMT_GIB ",Size:" CPL_FRMT_GUIB,
+            static_cast<GIntBig>(oCachedFileProp.mTime),
+            static_cast<GUIntBig>(oCachedFileProp.fileSize));
+    }
+    else
+    {
+        return std::string();
+    }
+    return VSICurlDiskCache::BuildKey(pszURL, osValidator, nOffset,
+                                      VSICURLGetDownloadChunkSize());
+}
+
+/************************************************************************/
+/*                         GetRegionFromCache()                         */
+/************************************************************************/
+
+/* Look for the block at nOffset in the in-memory region cache, and then in
+ * the persistent disk cache (CPL_VSIL_CURL_DISK_CACHE_DIR) if enabled. */
+std::shared_ptr<std::string>
+VSICurlHandle::GetRegionFromCache(vsi_l_offset nOffset, bool bLogDiskCacheMiss)
+{
+    auto psRegion = poFS->GetRegion(m_pszURL, nOffset);
+    if (psRegion || !m_bCached)
+        return psRegion;
+
+    const auto poDiskCache = VSICurlDiskCache::Get();
+    if (!poDiskCache)
+        return nullptr;
+    const std::string osKey = GetDiskCacheKey(poFS, m_pszURL, nOffset);
+    if (osKey.empty())
+        return nullptr;
+
+    std::string osData;
+    if (!poDiskCache->Read(osKey, osData))
+    {
+        if (bLogDiskCacheMiss)
+            NetworkStatisticsLogger::LogDiskCacheMiss();
+        return nullptr;
+    }
+    NetworkStatisticsLogger::LogDiskCacheHit(osData.size());
+    poFS->AddRegion(m_pszURL, nOffset, osData.size(), osData.data());
+    return std::make_shared<std::string>(std::move(osData));
+}
+
+/************************************************************************/
+/*                          AddRegionToCache()                          */
+/************************************************************************/
+
+void VSICurlHandle::AddRegionToCache(vsi_l_offset nOffset, size_t nSize,
+                                     const char *pData)
+{
+    poFS->AddRegion(m_pszURL, nOffset, nSize, pData);
+    if (!m_bCached)
+        return;
+
+    if (const auto poDiskCache = VSICurlDiskCache::Get())
+    {
+        const std::string osKey = GetDiskCacheKey(poFS, m_pszURL, nOffset);
+        if (!osKey.empty())
+            poDiskCache->Write(osKey, pData, nSize);
+    }
+}
+
 /************************************************************************/
 /*                     DownloadRegionPostProcess()                      */
 /************************************************************************/
@@ -2438,7 +2685,7 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
 #endif
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
-        poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        AddRegionToCache(l_startOffset, nChunkSize, pBuffer);
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
@@ -2469,6 +2716,8 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
     vsi_l_offset iterOffset = curOffset;
     const int knMAX_REGIONS = GetMaxRegions();
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    const bool bAdaptiveMergeGap =
+        GetMaxMergeGap() == std::numeric_limits<size_t>::max();
     while (nBufferRequestSize)
     {
         // Don't try to read after end of file.
@@ -2487,14 +2736,40 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
 
         const vsi_l_offset nOffsetToDownload =
             (iterOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+        const vsi_l_offset nEndOffsetToDownload =
+            ((iterOffset + nBufferRequestSize + knDOWNLOAD_CHUNK_SIZE - 1) /
+             knDOWNLOAD_CHUNK_SIZE) *
+            knDOWNLOAD_CHUNK_SIZE;
         std::string osRegion;
         std::shared_ptr<std::string> psRegion =
-            poFS->GetRegion(m_pszURL, nOffsetToDownload);
+            GetRegionFromCache(nOffsetToDownload,
+                               /* bLogDiskCacheMiss = */ true);
         if (psRegion != nullptr)
         {
             osRegion = *psRegion;
         }
         else
+        {
+            // Sequential reads: keep several ranges downloaded in parallel
+            // ahead of the current position.
+            const int nReadAheadConnections = GetParallelReadAheadConnections();
+            if (nReadAheadConnections > 1 &&
+                (nOffsetToDownload == lastDownloadedOffset ||
+                 IsInReadAhead(nOffsetToDownload)))
+            {
+                ScheduleReadAhead(nOffsetToDownload, nReadAheadConnections);
+                ReadFromReadAhead(
+                    nOffsetToDownload,
+                    static_cast<size_t>(nEndOffsetToDownload -
+                                        nOffsetToDownload),
+                    osRegion);
+            }
+            else if (m_poReadAheadCurrent || !m_apoReadAheadRanges.empty())
+            {
+                CancelReadAhead();
+            }
+        }
+        if (osRegion.empty() && psRegion == nullptr)
         {
             if (nOffsetToDownload == lastDownloadedOffset)
             {
@@ -2505,6 +2780,17 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
                 constexpr int MAX_CHUNK_SIZE_INCREASE_FACTOR = 128;
                 if (nBlocksToDownload < MAX_CHUNK_SIZE_INCREASE_FACTOR)
                     nBlocksToDownload *= 2;
+                // In adaptive mode, directly request at least as much as
+                // can be downloaded during the latency of a request.
+                if (bAdaptiveMergeGap)
+                {
+                    const int nBDPBlocks = static_cast<int>(std::min<size_t>(
+                        MAX_CHUNK_SIZE_INCREASE_FACTOR,
+                        GetBandwidthDelayProduct(m_pszURL) /
+                            knDOWNLOAD_CHUNK_SIZE));
+                    nBlocksToDownload =
+                        std::max(nBlocksToDownload, nBDPBlocks);
+                }
             }
             else
             {
@@ -2514,10 +2800,6 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
 
             // Ensure that we will request at least the number of blocks
             // to satisfy the remaining buffer size to read.
-            const vsi_l_offset nEndOffsetToDownload =
-                ((iterOffset + nBufferRequestSize + knDOWNLOAD_CHUNK_SIZE - 1) /
-                 knDOWNLOAD_CHUNK_SIZE) *
-                knDOWNLOAD_CHUNK_SIZE;
             const int nMinBlocksToDownload =
                 static_cast<int>((nEndOffsetToDownload - nOffsetToDownload) /
                                  knDOWNLOAD_CHUNK_SIZE);
@@ -2529,9 +2811,10 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nBytes)
             // this should not cause bugs. Just missed optimization.
             for (int i = 1; i < nBlocksToDownload; i++)
             {
-                if (poFS->GetRegion(m_pszURL, nOffsetToDownload +
-                                                  static_cast<vsi_l_offset>(i) *
-                                                      knDOWNLOAD_CHUNK_SIZE) !=
+                if (GetRegionFromCache(nOffsetToDownload +
+                                           static_cast<vsi_l_offset>(i) *
+                                               knDOWNLOAD_CHUNK_SIZE,
+                                       /* bLogDiskCacheMiss = */ false) !=
                     nullptr)
                 {
                     nBlocksToDownload = i;
@@ -2677,6 +2960,12 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     const bool bMergeConsecutiveRanges = CPLTestBool(
         CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
 
+    // Ranges separated by less than nMaxGap bytes are also merged, the
+    // unrequested bytes in between being downloaded and discarded.
+    size_t nMaxGap = bMergeConsecutiveRanges ? GetMaxMergeGap() : 0;
+    if (nMaxGap == std::numeric_limits<size_t>::max())
+        nMaxGap = GetBandwidthDelayProduct(osURL);
+
     // Build list of merged requests upfront, each with its own retry context
     struct MergedRequest
     {
@@ -2696,25 +2985,33 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     };
 
     std::vector<MergedRequest> asMergedRequests;
+    size_t nWastedBytes = 0;
     for (int i = 0; i < nRanges;)
     {
-        size_t nSize = 0;
         int iNext = i;
-        // Identify consecutive ranges
+        vsi_l_offset nEndOffset = anSortedOffsets[i] + anSortedSizes[i];
+        size_t nRequestedSize = anSortedSizes[i];
+        // Identify consecutive (or close enough) ranges
         while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
-               anSortedOffsets[iNext] + anSortedSizes[iNext] ==
-                   anSortedOffsets[iNext + 1])
+               (anSortedOffsets[iNext + 1] == nEndOffset ||
+                (nMaxGap > 0 && anSortedSizes[iNext + 1] > 0 &&
+                 anSortedOffsets[iNext + 1] <= nEndOffset + nMaxGap)))
         {
-            nSize += anSortedSizes[iNext];
             iNext++;
+            nRequestedSize += anSortedSizes[iNext];
+            nEndOffset = std::max(nEndOffset, anSortedOffsets[iNext] +
+                                                  anSortedSizes[iNext]);
         }
-        nSize += anSortedSizes[iNext];
+        const size_t nSize =
+            static_cast<size_t>(nEndOffset - anSortedOffsets[i]);
 
         if (nSize == 0)
         {
             i = iNext + 1;
             continue;
         }
+        if (nSize > nRequestedSize)
+            nWastedBytes += nSize - nRequestedSize;
 
         asMergedRequests.emplace_back(i, iNext, anSortedOffsets[i], nSize,
                                       m_oRetryParameters);
@@ -2724,6 +3021,15 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
     if (asMergedRequests.empty())
         return 0;
 
+    if (nWastedBytes > 0)
+    {
+        CPLDebug(poFS->GetDebugKey(),
+                 "ReadMultiRange(): %d ranges merged into %d requests, "
+                 "downloading " CPL_FRMT_GUIB " unrequested bytes",
+                 nRanges, static_cast<int>(asMergedRequests.size()),
+                 static_cast<GUIntBig>(nWastedBytes));
+    }
+
     int nRet = 0;
     size_t nTotalDownloaded = 0;
 
@@ -2882,13 +3188,16 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
             }
             else if (nRet == 0)
             {
-                size_t nOffset = 0;
-                size_t nRemainingSize = asWriteFuncData[iReq].nSize;
-                nTotalDownloaded += nRemainingSize;
+                const size_t nDownloadedSize = asWriteFuncData[iReq].nSize;
+                nTotalDownloaded += nDownloadedSize;
+                RecordTransferTimings(osURL, aHandles[iReq], nDownloadedSize);
                 for (int iRange = asMergedRequests[iReq].iFirstRange;
                      iRange <= asMergedRequests[iReq].iLastRange; iRange++)
                 {
-                    if (nRemainingSize < anSortedSizes[iRange])
+                    const size_t nOffset = static_cast<size_t>(
+                        anSortedOffsets[iRange] -
+                        asMergedRequests[iReq].nStartOffset);
+                    if (nDownloadedSize < nOffset + anSortedSizes[iRange])
                     {
                         nRet = -1;
                         break;
@@ -2900,8 +3209,6 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
                                asWriteFuncData[iReq].pBuffer + nOffset,
                                anSortedSizes[iRange]);
                     }
-                    nOffset += anSortedSizes[iRange];
-                    nRemainingSize -= anSortedSizes[iRange];
                 }
             }
 
@@ -2920,7 +3227,9 @@ int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
         CPLSleep(dfMaxDelay);
     }
 
-    NetworkStatisticsLogger::LogGET(nTotalDownloaded);
+    // Only account for unrequested bytes when all requests succeeded
+    NetworkStatisticsLogger::LogGET(nTotalDownloaded,
+                                    nRet == 0 ? nWastedBytes : 0);
 
     if constexpr (ENABLE_DEBUG)
     {
@@ -3524,6 +3833,349 @@ static CURLM *VSICURLMultiInit()
     return hCurlMultiHandle;
 }
 
+/************************************************************************/
+/*                          SubmitReadBatch()                           */
+/************************************************************************/
+
+// Maximum number of requests of a batch whose transfer is in progress
+constexpr size_t ASYNC_READ_MAX_IN_FLIGHT = 64;
+
+std::unique_ptr<VSIAsyncBatch>
+VSICurlHandle::SubmitReadBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                               VSIAsyncCompletionFunc pfnCompletion,
+                               void *pCompletionUserData)
+{
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    UpdateQueryString();
+
+    bool bHasExpired = false;
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    const std::string osURL(GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    if (oFileProp.eExists == EXIST_NO || bHasExpired)
+    {
+        // Let PRead() deal with errors and redirects
+        return VSIVirtualHandle::SubmitReadBatch(
+            nRequests, pasRequests, pfnCompletion, pCompletionUserData);
+    }
+
+    auto poBatch = std::make_unique<VSIAsyncBatch>(
+        nRequests, pasRequests, pfnCompletion, pCompletionUserData);
+
+    struct Transfer
+    {
+        int iRequest = 0;
+        CURL *hCurlHandle = nullptr;
+        WriteFuncStruct sWriteFuncData{};
+        WriteFuncStruct sWriteFuncHeaderData{};
+        struct curl_slist *psHeaders = nullptr;
+        std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf{};
+        CPLHTTPRetryContext oRetryContext;
+        std::chrono::steady_clock::time_point oRetryTime{};
+
+        Transfer(int iRequestIn, const CPLHTTPRetryParameters &oParams)
+            : iRequest(iRequestIn), oRetryContext(oParams)
+        {
+        }
+    };
+
+    // Easy handles are set up, and requests signed, in the calling thread,
+    // as GetCurlHeaders() may not be safe to call concurrently with other
+    // methods of the handle.
+    auto papoTransfers =
+        std::make_shared<std::vector<std::unique_ptr<Transfer>>>();
+    for (int i = 0; i < nRequests; ++i)
+    {
+        const VSIAsyncRequest &sRequest = pasRequests[i];
+        size_t nSize = sRequest.nSize;
+        if (oFileProp.bHasComputedFileSize)
+        {
+            nSize = sRequest.nOffset >= oFileProp.fileSize
+                        ? 0
+                        : static_cast<size_t>(std::min<vsi_l_offset>(
+                              nSize, oFileProp.fileSize - sRequest.nOffset));
+        }
+        if (nSize == 0)
+        {
+            poBatch->Complete(i, 0, false);
+            continue;
+        }
+
+        auto poTransfer = std::make_unique<Transfer>(i, m_oRetryParameters);
+        CURL *hCurlHandle = curl_easy_init();
+        poTransfer->hCurlHandle = hCurlHandle;
+
+        struct curl_slist *headers = VSICurlSetOptions(
+            hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
+
+        VSICURLInitWriteFuncStruct(&poTransfer->sWriteFuncData, nullptr,
+                                   nullptr, nullptr);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                                   &poTransfer->sWriteFuncData);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                                   VSICurlHandleWriteFunc);
+
+        VSICURLInitWriteFuncStruct(&poTransfer->sWriteFuncHeaderData, nullptr,
+                                   nullptr, nullptr);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                                   &poTransfer->sWriteFuncHeaderData);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                                   VSICurlHandleWriteFunc);
+        poTransfer->sWriteFuncHeaderData.bIsHTTP =
+            STARTS_WITH(m_pszURL, "http");
+        poTransfer->sWriteFuncHeaderData.nStartOffset = sRequest.nOffset;
+        poTransfer->sWriteFuncHeaderData.nEndOffset =
+            sRequest.nOffset + nSize - 1;
+
+        char rangeStr[512] = {};
+        snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                 poTransfer->sWriteFuncHeaderData.nStartOffset,
+                 poTransfer->sWriteFuncHeaderData.nEndOffset);
+
+        if (poTransfer->sWriteFuncHeaderData.bIsHTTP)
+        {
+            // So it gets included in Azure signature
+            headers = curl_slist_append(
+                headers, CPLSPrintf("Range: bytes=%s", rangeStr));
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
+        }
+        else
+        {
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
+        }
+
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
+                                   poTransfer->szCurlErrBuf.data());
+
+        headers = GetCurlHeaders("GET", headers);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
+        poTransfer->psHeaders = headers;
+        papoTransfers->push_back(std::move(poTransfer));
+    }
+
+    if (papoTransfers->empty())
+        return poBatch;
+
+    VSIAsyncBatch *poBatchRaw = poBatch.get();
+    const std::string osDebugKey(poFS->GetDebugKey());
+    const std::string osFSPrefix(poFS->GetFSPrefix());
+    const std::string osFilename(m_osFilename);
+    poBatch->SubmitJob(
+        [poBatchRaw, papoTransfers, osURL, osDebugKey, osFSPrefix,
+         osFilename]()
+        {
+            NetworkStatisticsFileSystem oContextFS(osFSPrefix.c_str());
+            NetworkStatisticsFile oContextFile(osFilename.c_str());
+            NetworkStatisticsAction oContextAction("SubmitReadBatch");
+
+            CURLM *hMultiHandle = VSICURLMultiInit();
+#ifdef CURLPIPE_MULTIPLEX
+            if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+            {
+                curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
+                                  CURLPIPE_MULTIPLEX);
+            }
+#endif
+
+            std::map<CURL *, Transfer *> oMapInFlight;
+            std::vector<Transfer *> apoToRetry;
+
+            const auto Cleanup = [](Transfer &oTransfer)
+            {
+                VSICURLResetHeaderAndWriterFunctions(oTransfer.hCurlHandle);
+                curl_easy_cleanup(oTransfer.hCurlHandle);
+                oTransfer.hCurlHandle = nullptr;
+                CPLFree(oTransfer.sWriteFuncData.pBuffer);
+                oTransfer.sWriteFuncData.pBuffer = nullptr;
+                CPLFree(oTransfer.sWriteFuncHeaderData.pBuffer);
+                oTransfer.sWriteFuncHeaderData.pBuffer = nullptr;
+                curl_slist_free_all(oTransfer.psHeaders);
+                oTransfer.psHeaders = nullptr;
+            };
+
+            const auto Finish = [&](CURL *hCurlHandle)
+            {
+                auto oIter = oMapInFlight.find(hCurlHandle);
+                CPLAssert(oIter != oMapInFlight.end());
+                Transfer &oTransfer = *(oIter->second);
+                oMapInFlight.erase(oIter);
+                curl_multi_remove_handle(hMultiHandle, hCurlHandle);
+
+                const VSIAsyncRequest *psRequest =
+                    poBatchRaw->GetRequest(oTransfer.iRequest);
+                long response_code = 0;
+                curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE,
+                                  &response_code);
+                // As in DownloadRegion(), a server that does not support
+                // range requests may be used for a range starting at the
+                // beginning of the file, whose whole content it returns.
+                // Other ranges are rejected by VSICurlHandleWriteFunc().
+                const bool bWholeContent =
+                    response_code == 200 &&
+                    oTransfer.sWriteFuncHeaderData.nStartOffset == 0 &&
+                    !oTransfer.sWriteFuncHeaderData.bError;
+                if (response_code == 206 || response_code == 225 ||
+                    bWholeContent)
+                {
+                    const size_t nDownloaded = oTransfer.sWriteFuncData.nSize;
+                    const size_t nCopied =
+                        std::min(nDownloaded, psRequest->nSize);
+                    if (nCopied > 0)
+                    {
+                        memcpy(psRequest->pBuffer,
+                               oTransfer.sWriteFuncData.pBuffer, nCopied);
+                    }
+                    RecordTransferTimings(osURL, hCurlHandle, nDownloaded);
+                    NetworkStatisticsLogger::LogGET(nDownloaded);
+                    Cleanup(oTransfer);
+                    poBatchRaw->Complete(oTransfer.iRequest, nCopied, false);
+                    return;
+                }
+                if (response_code == 416)
+                {
+                    // Range not satisfiable: beyond end of file
+                    Cleanup(oTransfer);
+                    poBatchRaw->Complete(oTransfer.iRequest, 0, false);
+                    return;
+                }
+
+                const std::string osRange(CPLSPrintf(
+                    CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                    oTransfer.sWriteFuncHeaderData.nStartOffset,
+                    oTransfer.sWriteFuncHeaderData.nEndOffset));
+                if (oTransfer.oRetryContext.CanRetry(
+                        static_cast<int>(response_code),
+                        oTransfer.sWriteFuncData.pBuffer,
+                        oTransfer.szCurlErrBuf.data()))
+                {
+                    const double dfDelay =
+                        oTransfer.oRetryContext.GetCurrentDelay();
+                    CPLError(CE_Warning, CPLE_AppDefined,
+                             "HTTP error code for %s range %s: %d. "
+                             "Retrying again in %.1f secs",
+                             osURL.c_str(), osRange.c_str(),
+                             static_cast<int>(response_code), dfDelay);
+
+                    // Reset the received data, but keep the easy handle
+                    // and its signed headers.
+                    CPLFree(oTransfer.sWriteFuncData.pBuffer);
+                    VSICURLInitWriteFuncStruct(&oTransfer.sWriteFuncData,
+                                               nullptr, nullptr, nullptr);
+                    const WriteFuncStruct sHeaderData(
+                        oTransfer.sWriteFuncHeaderData);
+                    CPLFree(oTransfer.sWriteFuncHeaderData.pBuffer);
+                    VSICURLInitWriteFuncStruct(
+                        &oTransfer.sWriteFuncHeaderData, nullptr, nullptr,
+                        nullptr);
+                    oTransfer.sWriteFuncHeaderData.bIsHTTP =
+                        sHeaderData.bIsHTTP;
+                    oTransfer.sWriteFuncHeaderData.nStartOffset =
+                        sHeaderData.nStartOffset;
+                    oTransfer.sWriteFuncHeaderData.nEndOffset =
+                        sHeaderData.nEndOffset;
+                    oTransfer.szCurlErrBuf[0] = '\0';
+                    oTransfer.oRetryTime =
+                        std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<
+                            std::chrono::steady_clock::duration>(
+                            std::chrono::duration<double>(dfDelay));
+                    apoToRetry.push_back(&oTransfer);
+                    return;
+                }
+
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Request for %s range %s failed with "
+                         "response_code=%ld",
+                         osURL.c_str(), osRange.c_str(), response_code);
+                if (oTransfer.szCurlErrBuf[0] != '\0')
+                {
+                    CPLDebug(osDebugKey.c_str(), "%s",
+                             oTransfer.szCurlErrBuf.data());
+                }
+                Cleanup(oTransfer);
+                poBatchRaw->Complete(oTransfer.iRequest, 0, true);
+            };
+
+            const auto Start = [&](Transfer &oTransfer)
+            {
+                oMapInFlight[oTransfer.hCurlHandle] = &oTransfer;
+                curl_multi_add_handle(hMultiHandle, oTransfer.hCurlHandle);
+            };
+
+            void *old_handler = CPLHTTPIgnoreSigPipe();
+            auto &apoTransfers = *papoTransfers;
+            size_t iNext = 0;
+            while (iNext < apoTransfers.size() || !oMapInFlight.empty() ||
+                   !apoToRetry.empty())
+            {
+                const auto oNow = std::chrono::steady_clock::now();
+                for (auto oIter = apoToRetry.begin();
+                     oIter != apoToRetry.end() &&
+                     oMapInFlight.size() < ASYNC_READ_MAX_IN_FLIGHT;)
+                {
+                    if ((*oIter)->oRetryTime <= oNow)
+                    {
+                        Start(**oIter);
+                        oIter = apoToRetry.erase(oIter);
+                    }
+                    else
+                    {
+                        ++oIter;
+                    }
+                }
+                while (iNext < apoTransfers.size() &&
+                       oMapInFlight.size() < ASYNC_READ_MAX_IN_FLIGHT)
+                {
+                    Start(*(apoTransfers[iNext++]));
+                }
+
+                if (oMapInFlight.empty())
+                {
+                    // Only retries, that are not due yet
+                    CPLSleep(0.01);
+                    continue;
+                }
+
+                int still_running = 0;
+                while (curl_multi_perform(hMultiHandle, &still_running) ==
+                       CURLM_CALL_MULTI_PERFORM)
+                {
+                    // loop
+                }
+
+                CURLMsg *msg;
+                do
+                {
+                    int msgq = 0;
+                    msg = curl_multi_info_read(hMultiHandle, &msgq);
+                    if (msg && (msg->msg == CURLMSG_DONE))
+                        Finish(msg->easy_handle);
+                } while (msg);
+
+                if (still_running)
+                {
+                    int repeats = 0;
+                    CPLMultiPerformWait(hMultiHandle, repeats);
+                }
+                else
+                {
+                    // Should not happen, but make sure the caller is not
+                    // blocked forever.
+                    for (auto &[hCurlHandle, poTransfer] : oMapInFlight)
+                    {
+                        curl_multi_remove_handle(hMultiHandle, hCurlHandle);
+                        Cleanup(*poTransfer);
+                        poBatchRaw->Complete(poTransfer->iRequest, 0, true);
+                    }
+                    oMapInFlight.clear();
+                }
+            }
+            CPLHTTPRestoreSigPipeHandler(old_handler);
+            curl_multi_cleanup(hMultiHandle);
+        });
+
+    return poBatch;
+}
+
 /************************************************************************/
 /*                             AdviseRead()                             */
 /************************************************************************/
@@ -3567,6 +4219,9 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
     const bool bMergeConsecutiveRanges = CPLTestBool(
         CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    size_t nMaxGap = bMergeConsecutiveRanges ? GetMaxMergeGap() : 0;
+    if (nMaxGap == std::numeric_limits<size_t>::max())
+        nMaxGap = GetBandwidthDelayProduct(l_osURL);
 
     try
     {
@@ -3580,7 +4235,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             auto nEndOffset = panOffsets[iNext] + panSizes[iNext];
             while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
                    panOffsets[iNext + 1] > panOffsets[iNext] &&
-                   panOffsets[iNext] + panSizes[iNext] + SIZE_COG_MARKERS >=
+                   panOffsets[iNext] + panSizes[iNext] +
+                           std::max(SIZE_COG_MARKERS, nMaxGap) >=
                        panOffsets[iNext + 1] &&
                    panOffsets[iNext + 1] + panSizes[iNext + 1] > nEndOffset)
             {
@@ -3917,6 +4573,464 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
     m_oThreadAdviseRead = std::thread(task, l_osURL);
 }
 
+/************************************************************************/
+/*                  GetParallelReadAheadConnections()                   */
+/************************************************************************/
+
+// Return the number of ranges that are downloaded in parallel ahead of
+// sequential reads, according to the GDAL_HTTP_PARALLEL_READAHEAD option,
+// that may be set per path prefix with VSISetPathSpecificOption().
+// Values lower than 2 disable the parallel read-ahead.
+int VSICurlHandle::GetParallelReadAheadConnections()
+{
+    if (!AllowParallelReadAhead())
+        return 0;
+    constexpr int MAX_CONNECTIONS = 64;
+    return std::min(MAX_CONNECTIONS,
+                    atoi(VSIGetPathSpecificOption(
+                        m_osFilename.c_str(), "GDAL_HTTP_PARALLEL_READAHEAD",
+                        "0")));
+}
+
+/************************************************************************/
+/*                      GetParallelReadAheadSize()                      */
+/************************************************************************/
+
+// Return the size of each range of the parallel read-ahead, as a multiple of
+// the download chunk size.
+static size_t GetParallelReadAheadSize(const char *pszFilename)
+{
+    constexpr GIntBig DEFAULT_SIZE = 8 * 1024 * 1024;
+    constexpr GIntBig MAX_SIZE = 256 * 1024 * 1024;
+    GIntBig nSize = 0;
+    if (CPLParseMemorySize(
+            VSIGetPathSpecificOption(pszFilename,
+                                     "GDAL_HTTP_PARALLEL_READAHEAD_SIZE",
+                                     "8MB"),
+            &nSize, nullptr) != CE_None ||
+        nSize <= 0)
+    {
+        nSize = DEFAULT_SIZE;
+    }
+    nSize = std::min(nSize, MAX_SIZE);
+    const GIntBig nChunkSize = VSICURLGetDownloadChunkSize();
+    return static_cast<size_t>(
+        std::max<GIntBig>(1, (nSize + nChunkSize - 1) / nChunkSize) *
+        nChunkSize);
+}
+
+/************************************************************************/
+/*                           IsInReadAhead()                            */
+/************************************************************************/
+
+bool VSICurlHandle::IsInReadAhead(vsi_l_offset nOffset) const
+{
+    if (m_poReadAheadCurrent &&
+        nOffset >= m_poReadAheadCurrent->nStartOffset &&
+        nOffset < m_poReadAheadCurrent->nStartOffset +
+                      m_poReadAheadCurrent->nSize)
+    {
+        return true;
+    }
+    return !m_apoReadAheadRanges.empty() &&
+           nOffset >= m_apoReadAheadRanges.front()->nStartOffset &&
+           nOffset < m_apoReadAheadRanges.back()->nStartOffset +
+                         m_apoReadAheadRanges.back()->nSize;
+}
+
+/************************************************************************/
+/*                         ScheduleReadAhead()                          */
+/************************************************************************/
+
+// Make sure that nConnections ranges following nOffset are being downloaded
+// by the read-ahead thread.
+void VSICurlHandle::ScheduleReadAhead(vsi_l_offset nOffset, int nConnections)
+{
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (!oFileProp.bHasComputedFileSize)
+        return;
+
+    vsi_l_offset nNextOffset = nOffset;
+    if (!m_apoReadAheadRanges.empty())
+    {
+        nNextOffset = m_apoReadAheadRanges.back()->nStartOffset +
+                      m_apoReadAheadRanges.back()->nSize;
+    }
+    else if (m_poReadAheadCurrent && IsInReadAhead(nOffset))
+    {
+        nNextOffset =
+            m_poReadAheadCurrent->nStartOffset + m_poReadAheadCurrent->nSize;
+    }
+    if (static_cast<int>(m_apoReadAheadRanges.size()) >= nConnections ||
+        nNextOffset >= oFileProp.fileSize)
+    {
+        return;
+    }
+
+    UpdateQueryString();
+
+    bool bHasExpired = false;
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    const std::string osURL(GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    if (bHasExpired)
+        return;
+
+    const size_t nRangeSize = GetParallelReadAheadSize(m_osFilename.c_str());
+    std::vector<std::shared_ptr<ReadAheadRange>> apoNewRanges;
+    while (static_cast<int>(m_apoReadAheadRanges.size()) < nConnections &&
+           nNextOffset < oFileProp.fileSize)
+    {
+        auto poRange = std::make_shared<ReadAheadRange>();
+        poRange->nStartOffset = nNextOffset;
+        poRange->nSize = static_cast<size_t>(std::min<vsi_l_offset>(
+            nRangeSize, oFileProp.fileSize - nNextOffset));
+        poRange->osURL = osURL;
+        nNextOffset += poRange->nSize;
+
+        poRange->hCurlHandle = curl_easy_init();
+        struct curl_slist *headers = VSICurlSetOptions(
+            poRange->hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
+
+        char rangeStr[512] = {};
+        snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(poRange->nStartOffset),
+                 static_cast<GUIntBig>(poRange->nStartOffset +
+                                       poRange->nSize - 1));
+        if (STARTS_WITH(osURL.c_str(), "http"))
+        {
+            // So it gets included in Azure signature
+            headers = curl_slist_append(
+                headers, CPLSPrintf("Range: bytes=%s", rangeStr));
+            unchecked_curl_easy_setopt(poRange->hCurlHandle, CURLOPT_RANGE,
+                                       nullptr);
+        }
+        else
+        {
+            unchecked_curl_easy_setopt(poRange->hCurlHandle, CURLOPT_RANGE,
+                                       rangeStr);
+        }
+        poRange->psHeaders = GetCurlHeaders("GET", headers);
+
+        m_apoReadAheadRanges.push_back(poRange);
+        apoNewRanges.push_back(std::move(poRange));
+    }
+
+    if (!m_hCurlMultiHandleForReadAhead)
+    {
+        m_hCurlMultiHandleForReadAhead = VSICURLMultiInit();
+#ifdef CURLPIPE_MULTIPLEX
+        if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+        {
+            curl_multi_setopt(m_hCurlMultiHandleForReadAhead,
+                              CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        }
+#endif
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oReadAheadMutex);
+        m_apoReadAheadPending.insert(m_apoReadAheadPending.end(),
+                                     apoNewRanges.begin(), apoNewRanges.end());
+    }
+    if (!m_oThreadReadAhead.joinable())
+    {
+        m_oThreadReadAhead = std::thread([this]() { ReadAheadThreadFunc(); });
+    }
+    m_oReadAheadCV.notify_all();
+    curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+}
+
+/************************************************************************/
+/*                         ReadFromReadAhead()                          */
+/************************************************************************/
+
+// Return in osRegion at most nMaxSize bytes starting at nOffset, which must
+// be a multiple of the download chunk size, waiting for the read-ahead range
+// that contains it to be downloaded. Returns false if nOffset is not in the
+// read-ahead window or if its download failed, in which case the caller
+// must fall back to DownloadRegion().
+bool VSICurlHandle::ReadFromReadAhead(vsi_l_offset nOffset, size_t nMaxSize,
+                                      std::string &osRegion)
+{
+    if (!m_poReadAheadCurrent ||
+        nOffset < m_poReadAheadCurrent->nStartOffset ||
+        nOffset >= m_poReadAheadCurrent->nStartOffset +
+                       m_poReadAheadCurrent->nSize)
+    {
+        m_poReadAheadCurrent.reset();
+        while (!m_apoReadAheadRanges.empty())
+        {
+            auto poRange = m_apoReadAheadRanges.front();
+            if (nOffset < poRange->nStartOffset)
+                return false;
+            m_apoReadAheadRanges.pop_front();
+            if (nOffset >= poRange->nStartOffset + poRange->nSize)
+            {
+                // Skipped by a forward seek
+                std::lock_guard<std::mutex> oLock(m_oReadAheadMutex);
+                poRange->bCancelled = true;
+                continue;
+            }
+
+            {
+                std::unique_lock<std::mutex> oLock(m_oReadAheadMutex);
+                while (!poRange->bDone)
+                    m_oReadAheadCV.wait(oLock);
+            }
+            if (poRange->osData.empty())
+            {
+                CancelReadAhead();
+                return false;
+            }
+
+            const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+            DownloadRegionPostProcess(
+                poRange->nStartOffset,
+                static_cast<int>(
+                    (poRange->nSize + knDOWNLOAD_CHUNK_SIZE - 1) /
+                    knDOWNLOAD_CHUNK_SIZE),
+                poRange->osData.data(), poRange->osData.size());
+            m_poReadAheadCurrent = std::move(poRange);
+            break;
+        }
+        if (!m_poReadAheadCurrent)
+            return false;
+    }
+
+    const size_t nRangeOffset =
+        static_cast<size_t>(nOffset - m_poReadAheadCurrent->nStartOffset);
+    const std::string &osData = m_poReadAheadCurrent->osData;
+    if (nRangeOffset >= osData.size())
+        return false;
+    osRegion.assign(osData.data() + nRangeOffset,
+                    std::min(nMaxSize, osData.size() - nRangeOffset));
+    return true;
+}
+
+/************************************************************************/
+/*                          CancelReadAhead()                           */
+/************************************************************************/
+
+void VSICurlHandle::CancelReadAhead()
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oReadAheadMutex);
+        for (auto &poRange : m_apoReadAheadRanges)
+            poRange->bCancelled = true;
+        m_apoReadAheadPending.clear();
+    }
+    m_apoReadAheadRanges.clear();
+    m_poReadAheadCurrent.reset();
+    if (m_hCurlMultiHandleForReadAhead)
+        curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+}
+
+/************************************************************************/
+/*                          ~ReadAheadRange()                           */
+/************************************************************************/
+
+VSICurlHandle::ReadAheadRange::~ReadAheadRange()
+{
+    // Only set if the range was cancelled before being submitted
+    if (hCurlHandle)
+        curl_easy_cleanup(hCurlHandle);
+    curl_slist_free_all(psHeaders);
+}
+
+/************************************************************************/
+/*                        ReadAheadThreadFunc()                         */
+/************************************************************************/
+
+// Body of the thread that runs the transfers of the parallel read-ahead,
+// until the handle is closed. It must not call virtual methods of the
+// handle, as it is only joined by the destructor of the base class.
+void VSICurlHandle::ReadAheadThreadFunc()
+{
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsAction oContextAction("Read");
+
+    struct Transfer
+    {
+        std::shared_ptr<ReadAheadRange> poRange{};
+        WriteFuncStruct sWriteFuncData{};
+        WriteFuncStruct sWriteFuncHeaderData{};
+        struct curl_slist *psHeaders = nullptr;
+        std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf{};
+    };
+
+    std::map<CURL *, std::unique_ptr<Transfer>> oMapTransfers;
+
+    const auto FinishTransfer =
+        [this, &oMapTransfers](CURL *hCurlHandle, bool bCompleted)
+    {
+        auto oIter = oMapTransfers.find(hCurlHandle);
+        CPLAssert(oIter != oMapTransfers.end());
+        Transfer &oTransfer = *(oIter->second);
+        ReadAheadRange &oRange = *(oTransfer.poRange);
+
+        std::string osData;
+        if (bCompleted)
+        {
+            long response_code = 0;
+            curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+            const size_t nSize = oTransfer.sWriteFuncData.nSize;
+            if ((response_code == 206 || response_code == 225) &&
+                nSize == oRange.nSize)
+            {
+                osData.assign(oTransfer.sWriteFuncData.pBuffer, nSize);
+                RecordTransferTimings(oRange.osURL, hCurlHandle, nSize);
+                NetworkStatisticsLogger::LogGET(nSize);
+            }
+            else
+            {
+                CPLDebug(poFS->GetDebugKey(),
+                         "Read-ahead of %s range " CPL_FRMT_GUIB
+                         "-" CPL_FRMT_GUIB
+                         " failed: response_code=%d, msg=%s",
+                         oRange.osURL.c_str(),
+                         static_cast<GUIntBig>(oRange.nStartOffset),
+                         static_cast<GUIntBig>(oRange.nStartOffset +
+                                               oRange.nSize - 1),
+                         static_cast<int>(response_code),
+                         oTransfer.szCurlErrBuf.data());
+            }
+        }
+
+        curl_multi_remove_handle(m_hCurlMultiHandleForReadAhead, hCurlHandle);
+        VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
+        curl_easy_cleanup(hCurlHandle);
+        CPLFree(oTransfer.sWriteFuncData.pBuffer);
+        CPLFree(oTransfer.sWriteFuncHeaderData.pBuffer);
+        curl_slist_free_all(oTransfer.psHeaders);
+
+        {
+            std::lock_guard<std::mutex> oLock(m_oReadAheadMutex);
+            oRange.osData = std::move(osData);
+            oRange.bDone = true;
+        }
+        m_oReadAheadCV.notify_all();
+        oMapTransfers.erase(oIter);
+    };
+
+    void *old_handler = CPLHTTPIgnoreSigPipe();
+    while (true)
+    {
+        std::vector<std::shared_ptr<ReadAheadRange>> apoNewRanges;
+        std::vector<CURL *> ahCancelledHandles;
+        {
+            std::unique_lock<std::mutex> oLock(m_oReadAheadMutex);
+            while (!m_bStopReadAhead && m_apoReadAheadPending.empty() &&
+                   oMapTransfers.empty())
+            {
+                m_oReadAheadCV.wait(oLock);
+            }
+            if (m_bStopReadAhead)
+                break;
+            std::swap(apoNewRanges, m_apoReadAheadPending);
+            apoNewRanges.erase(
+                std::remove_if(apoNewRanges.begin(), apoNewRanges.end(),
+                               [](const std::shared_ptr<ReadAheadRange> &p)
+                               { return p->bCancelled; }),
+                apoNewRanges.end());
+            for (const auto &[hCurlHandle, poTransfer] : oMapTransfers)
+            {
+                if (poTransfer->poRange->bCancelled)
+                    ahCancelledHandles.push_back(hCurlHandle);
+            }
+        }
+
+        for (CURL *hCurlHandle : ahCancelledHandles)
+            FinishTransfer(hCurlHandle, false);
+
+        for (auto &poRange : apoNewRanges)
+        {
+            auto poTransfer = std::make_unique<Transfer>();
+            CURL *hCurlHandle = poRange->hCurlHandle;
+            struct curl_slist *headers = poRange->psHeaders;
+            poRange->hCurlHandle = nullptr;
+            poRange->psHeaders = nullptr;
+
+            VSICURLInitWriteFuncStruct(&poTransfer->sWriteFuncData, nullptr,
+                                       nullptr, nullptr);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                                       &poTransfer->sWriteFuncData);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                                       VSICurlHandleWriteFunc);
+
+            VSICURLInitWriteFuncStruct(&poTransfer->sWriteFuncHeaderData,
+                                       nullptr, nullptr, nullptr);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                                       &poTransfer->sWriteFuncHeaderData);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                                       VSICurlHandleWriteFunc);
+            poTransfer->sWriteFuncHeaderData.bIsHTTP =
+                STARTS_WITH(poRange->osURL.c_str(), "http");
+            poTransfer->sWriteFuncHeaderData.nStartOffset =
+                poRange->nStartOffset;
+            poTransfer->sWriteFuncHeaderData.nEndOffset =
+                poRange->nStartOffset + poRange->nSize - 1;
+
+            if constexpr (ENABLE_DEBUG)
+            {
+                CPLDebug(poFS->GetDebugKey(),
+                         "Read-ahead of " CPL_FRMT_GUIB "-" CPL_FRMT_GUIB
+                         " (%s)...",
+                         poTransfer->sWriteFuncHeaderData.nStartOffset,
+                         poTransfer->sWriteFuncHeaderData.nEndOffset,
+                         poRange->osURL.c_str());
+            }
+
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
+                                       poTransfer->szCurlErrBuf.data());
+
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER,
+                                       headers);
+            poTransfer->psHeaders = headers;
+            poTransfer->poRange = std::move(poRange);
+            oMapTransfers[hCurlHandle] = std::move(poTransfer);
+            curl_multi_add_handle(m_hCurlMultiHandleForReadAhead, hCurlHandle);
+        }
+
+        int still_running = 0;
+        while (curl_multi_perform(m_hCurlMultiHandleForReadAhead,
+                                  &still_running) == CURLM_CALL_MULTI_PERFORM)
+        {
+            // loop
+        }
+
+        CURLMsg *msg;
+        do
+        {
+            int msgq = 0;
+            msg = curl_multi_info_read(m_hCurlMultiHandleForReadAhead, &msgq);
+            if (msg && (msg->msg == CURLMSG_DONE))
+            {
+                FinishTransfer(msg->easy_handle, true);
+            }
+        } while (msg);
+
+        if (still_running)
+        {
+            // Also woken up by curl_multi_wakeup() when new ranges are
+            // scheduled or cancelled.
+            int repeats = 0;
+            CPLMultiPerformWait(m_hCurlMultiHandleForReadAhead, repeats);
+        }
+        else
+        {
+            // Should not happen, but make sure the reader is not blocked
+            // forever.
+            while (!oMapTransfers.empty())
+                FinishTransfer(oMapTransfers.begin()->first, false);
+        }
+    }
+
+    while (!oMapTransfers.empty())
+        FinishTransfer(oMapTransfers.begin()->first, false);
+    CPLHTTPRestoreSigPipeHandler(old_handler);
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -4432,6 +5546,16 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='GDAL_HTTP_MERGE_CONSECUTIVE_RANGES' type='boolean' "      \
     "description='Whether to merge consecutive ranges in multirange "          \
     "requests' default='YES'/>"                                                \
+    "  <Option name='GDAL_HTTP_MERGE_RANGES_MAX_GAP' type='string' "           \
+    "description='Maximum number of bytes between two ranges of a multirange " \
+    "request for them to be merged, or AUTO to derive it from the measured "   \
+    "latency and bandwidth of the server' default='0'/>"                       \
+    "  <Option name='GDAL_HTTP_PARALLEL_READAHEAD' type='int' "                \
+    "description='Number of ranges downloaded in parallel ahead of "           \
+    "sequential reads' default='0'/>"                                          \
+    "  <Option name='GDAL_HTTP_PARALLEL_READAHEAD_SIZE' type='string' "        \
+    "description='Size of each range downloaded by the parallel "              \
+    "read-ahead' default='8MB'/>"                                              \
     "  <Option name='CPL_VSIL_CURL_NON_CACHED' type='string' "                 \
     "description='Colon-separated list of filenames whose content"             \
     "must not be cached across open attempts'/>"                               \
@@ -6207,7 +7331,8 @@ NetworkStatisticsLogger::GetCountersForContext()
     return v;
 }
 
-void NetworkStatisticsLogger::LogGET(size_t nDownloadedBytes)
+void NetworkStatisticsLogger::LogGET(size_t nDownloadedBytes,
+                                     size_t nWastedBytes)
 {
     if (!IsEnabled())
         return;
@@ -6216,10 +7341,12 @@ void NetworkStatisticsLogger::LogGET(size_t nDownloadedBytes)
     {
         counters->nGET++;
         counters->nGETDownloadedBytes += nDownloadedBytes;
+        counters->nGETWastedBytes += nWastedBytes;
     }
 }
 
-void NetworkStatisticsLogger::LogPUT(size_t nUploadedBytes)
+void NetworkStatisticsLogger::LogPUT(size_t nUploadedBytes,
+                                     double dfElapsedSec)
 {
     if (!IsEnabled())
         return;
@@ -6228,6 +7355,11 @@ void NetworkStatisticsLogger::LogPUT(size_t nUploadedBytes)
     {
         counters->nPUT++;
         counters->nPUTUploadedBytes += nUploadedBytes;
+        if (dfElapsedSec >= 0)
+        {
+            counters->nPUTTimedBytes += nUploadedBytes;
+            counters->dfPUTElapsedSec += dfElapsedSec;
+        }
     }
 }
 
@@ -6267,6 +7399,29 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogDiskCacheHit(size_t nBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nDiskCacheHit++;
+        counters->nDiskCacheHitBytes += nBytes;
+    }
+}
+
+void NetworkStatisticsLogger::LogDiskCacheMiss()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nDiskCacheMiss++;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -6283,10 +7438,22 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
         oMethods.Add("GET/count", counters.nGET);
     if (counters.nGETDownloadedBytes)
         oMethods.Add("GET/downloaded_bytes", counters.nGETDownloadedBytes);
+    if (counters.nGETWastedBytes)
+        oMethods.Add("GET/wasted_bytes", counters.nGETWastedBytes);
     if (counters.nPUT)
         oMethods.Add("PUT/count", counters.nPUT);
     if (counters.nPUTUploadedBytes)
         oMethods.Add("PUT/uploaded_bytes", counters.nPUTUploadedBytes);
+    if (counters.dfPUTElapsedSec > 0)
+    {
+        // Cumulated duration of requests, and per-connection throughput.
+        // When parts are uploaded in parallel, the aggregated throughput is
+        // higher.
+        oMethods.Add("PUT/elapsed_sec", counters.dfPUTElapsedSec);
+        oMethods.Add("PUT/throughput_bytes_per_sec",
+                     static_cast<GIntBig>(counters.nPUTTimedBytes /
+                                          counters.dfPUTElapsedSec));
+    }
     if (counters.nPOST)
         oMethods.Add("POST/count", counters.nPOST);
     if (counters.nPOSTUploadedBytes)
@@ -6296,6 +7463,18 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    if (counters.nDiskCacheHit || counters.nDiskCacheMiss)
+    {
+        CPLJSONObject oDiskCache;
+        if (counters.nDiskCacheHit)
+        {
+            oDiskCache.Add("hit/count", counters.nDiskCacheHit);
+            oDiskCache.Add("hit/bytes", counters.nDiskCacheHitBytes);
+        }
+        if (counters.nDiskCacheMiss)
+            oDiskCache.Add("miss/count", counters.nDiskCacheMiss);
+        oJSON.Add("disk_cache", oDiskCache);
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
@@ -6389,6 +7568,27 @@ bool VSICURLGetCachedFileProp(const char *pszURL, cpl::FileProp &oFileProp)
              gnGenerationAuthParameters != oFileProp.nGenerationAuthParameters);
 }
 
+/************************************************************************/
+/*                        VSICurlGetCachedETag()                        */
+/************************************************************************/
+
+/* Return the ETag of a file of a network file system, as found in the cache
+ * of file properties filled by a previous VSIStatL(), or an empty string. */
+std::string VSICurlGetCachedETag(const char *pszFilename)
+{
+    auto poFS = dynamic_cast<cpl::VSICurlFilesystemHandlerBase *>(
+        VSIFileManager::GetHandler(pszFilename));
+    if (poFS == nullptr)
+        return std::string();
+    cpl::FileProp oFileProp;
+    if (!poFS->GetCachedFileProp(poFS->GetURLFromFilename(pszFilename).c_str(),
+                                 oFileProp))
+    {
+        return std::string();
+    }
+    return oFileProp.ETag;
+}
+
 /************************************************************************/
 /*                      VSICURLSetCachedFileProp()                      */
 /************************************************************************/
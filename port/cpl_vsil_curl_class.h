@@ -18,18 +18,21 @@
 #include "cpl_aws.h"
 #include "cpl_azure.h"
 #include "cpl_port.h"
+#include "cpl_error_internal.h"
 #include "cpl_json.h"
 #include "cpl_http.h"
 #include "cpl_string.h"
 #include "cpl_vsil_curl_priv.h"
 #include "cpl_mem_cache.h"
 #include "cpl_multiproc.h"
+#include "cpl_worker_thread_pool.h"
 
 #include "cpl_curl_priv.h"
 
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <set>
 #include <map>
 #include <memory>
@@ -386,6 +389,11 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
                                    const int nBlocks, const char *pBuffer,
                                    size_t nSize);
 
+    std::shared_ptr<std::string> GetRegionFromCache(vsi_l_offset nOffset,
+                                                    bool bLogDiskCacheMiss);
+    void AddRegionToCache(vsi_l_offset nOffset, size_t nSize,
+                          const char *pData);
+
   private:
     vsi_l_offset curOffset = 0;
 
@@ -444,6 +452,48 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     std::thread m_oThreadAdviseRead{};
     CURLM *m_hCurlMultiHandleForAdviseRead = nullptr;
 
+    // Used by the parallel read-ahead of sequential reads
+    struct ReadAheadRange
+    {
+        vsi_l_offset nStartOffset = 0;
+        size_t nSize = 0;
+        std::string osURL{};
+        // Request prepared by the thread that schedules the range, so that
+        // the read-ahead thread does not need to call GetCurlHeaders(),
+        // which is overridden by the derived classes. Ownership is taken by
+        // the read-ahead thread when it submits the request.
+        CURL *hCurlHandle = nullptr;
+        struct curl_slist *psHeaders = nullptr;
+        // Below members are protected by m_oReadAheadMutex
+        bool bDone = false;
+        bool bCancelled = false;
+        std::string osData{};
+
+        ReadAheadRange() = default;
+        ~ReadAheadRange();
+        CPL_DISALLOW_COPY_ASSIGN(ReadAheadRange)
+    };
+
+    // Ranges scheduled ahead of the reader, in increasing offset order
+    std::deque<std::shared_ptr<ReadAheadRange>> m_apoReadAheadRanges{};
+    // Last range consumed by Read()
+    std::shared_ptr<ReadAheadRange> m_poReadAheadCurrent{};
+    // Ranges not yet submitted by the read-ahead thread
+    std::vector<std::shared_ptr<ReadAheadRange>> m_apoReadAheadPending{};
+    std::mutex m_oReadAheadMutex{};
+    std::condition_variable m_oReadAheadCV{};
+    bool m_bStopReadAhead = false;
+    std::thread m_oThreadReadAhead{};
+    CURLM *m_hCurlMultiHandleForReadAhead = nullptr;
+
+    int GetParallelReadAheadConnections();
+    bool IsInReadAhead(vsi_l_offset nOffset) const;
+    void ScheduleReadAhead(vsi_l_offset nOffset, int nConnections);
+    bool ReadFromReadAhead(vsi_l_offset nOffset, size_t nMaxSize,
+                           std::string &osRegion);
+    void CancelReadAhead();
+    void ReadAheadThreadFunc();
+
   protected:
     virtual struct curl_slist *GetCurlHeaders(const std::string & /*osVerb*/,
                                               struct curl_slist *psHeaders)
@@ -466,6 +516,11 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
         return false;
     }
 
+    virtual bool AllowParallelReadAhead()
+    {
+        return true;
+    }
+
     virtual bool IsDirectoryFromExists(const char * /*pszVerb*/,
                                        int /*response_code*/)
     {
@@ -514,6 +569,11 @@ class VSICurlHandle /* non final*/ : public VSIVirtualHandle
     size_t PRead(void *pBuffer, size_t nSize,
                  vsi_l_offset nOffset) const override;
 
+    std::unique_ptr<VSIAsyncBatch>
+    SubmitReadBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                    VSIAsyncCompletionFunc pfnCompletion,
+                    void *pCompletionUserData) override;
+
     void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                     const size_t *panSizes) override;
 
@@ -850,7 +910,27 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
 
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Background upload of parts, when NUM_THREADS > 1
+    int m_nMaxParallelUploads = 1;
+    // Maximum number of part buffers, including the one being filled
+    int m_nMaxBuffers = 1;
+    CPLStringList m_aosThreadLocalConfigOptions{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+    CPLErrorAccumulator m_oErrorAccumulator{};
+    bool m_bErrorsReplayed = false;
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCond{};
+    // Below members are protected by m_oMutex
+    std::vector<GByte *> m_apabyFreeBuffers{};
+    int m_nAllocatedBuffers = 1;
+    int m_nPendingUploads = 0;
+    std::atomic<bool> m_bUploadError{false};
+
     bool UploadPart();
+    bool SubmitPartUpload(bool bAcquireNextBuffer);
+    void UploadPartJob(int nPartNumber, GByte *pabyBuffer, size_t nSize);
+    bool WaitForPendingUploads();
+    void ReplayUploadErrors();
     bool DoSinglePartPUT();
 
     void InvalidateParentDirectory();
@@ -1120,9 +1200,16 @@ class NetworkStatisticsLogger
         GIntBig nPOST = 0;
         GIntBig nDELETE = 0;
         GIntBig nGETDownloadedBytes = 0;
+        GIntBig nGETWastedBytes = 0;  // downloaded but not requested
         GIntBig nPUTUploadedBytes = 0;
+        // Bytes and cumulated duration of the PUT requests that were timed
+        GIntBig nPUTTimedBytes = 0;
+        double dfPUTElapsedSec = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nDiskCacheHit = 0;
+        GIntBig nDiskCacheMiss = 0;
+        GIntBig nDiskCacheHitBytes = 0;
     };
 
     enum class ContextPathType
@@ -1194,14 +1281,18 @@ class NetworkStatisticsLogger
 
     static void LogHEAD();
 
-    static void LogGET(size_t nDownloadedBytes);
+    static void LogGET(size_t nDownloadedBytes, size_t nWastedBytes = 0);
 
-    static void LogPUT(size_t nUploadedBytes);
+    static void LogPUT(size_t nUploadedBytes, double dfElapsedSec = -1);
 
     static void LogPOST(size_t nUploadedBytes, size_t nDownloadedBytes);
 
     static void LogDELETE();
 
+    static void LogDiskCacheHit(size_t nBytes);
+
+    static void LogDiskCacheMiss();
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
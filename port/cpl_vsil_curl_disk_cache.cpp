@@ -0,0 +1,337 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of blocks downloaded by /vsicurl/
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_vsil_curl_disk_cache.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <limits>
+#include <vector>
+
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+// Default maximum size of the cache directory
+constexpr GIntBig DISK_CACHE_SIZE_DEFAULT = 1024 * 1024 * 1024;
+
+// Number of writes after which the content of the cache directory is
+// rescanned, to take into account blocks written by other processes.
+constexpr int SCAN_PERIOD = 256;
+
+// Delay after which temporary files are considered to be leftovers of a
+// crashed process.
+constexpr int TMP_FILE_MAX_AGE_SEC = 3600;
+
+constexpr const char *LOCK_FILENAME = "lock";
+constexpr const char *TMP_FILE_MARKER = ".tmp.";
+
+/************************************************************************/
+/*                          VSICurlDiskCache()                          */
+/************************************************************************/
+
+VSICurlDiskCache::VSICurlDiskCache(const std::string &osDirectory,
+                                   GIntBig nMaxSize)
+    : m_osDirectory(osDirectory), m_nMaxSize(nMaxSize)
+{
+}
+
+/************************************************************************/
+/*                                Get()                                 */
+/************************************************************************/
+
+std::shared_ptr<VSICurlDiskCache> VSICurlDiskCache::Get()
+{
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", nullptr);
+    if (pszDirectory == nullptr || pszDirectory[0] == '\0')
+        return nullptr;
+
+    GIntBig nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+    const char *pszMaxSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+    if (pszMaxSize &&
+        CPLParseMemorySize(pszMaxSize, &nMaxSize, nullptr) != CE_None)
+    {
+        nMaxSize = DISK_CACHE_SIZE_DEFAULT;
+    }
+
+    static std::mutex goMutex;
+    static std::shared_ptr<VSICurlDiskCache> gpoCache;
+    static std::string gosInvalidDirectory;
+
+    std::lock_guard<std::mutex> oLock(goMutex);
+    if (gpoCache && gpoCache->m_osDirectory == pszDirectory &&
+        gpoCache->m_nMaxSize == nMaxSize)
+    {
+        return gpoCache;
+    }
+    if (gosInvalidDirectory == pszDirectory)
+        return nullptr;
+
+    VSIStatBufL sStat;
+    if ((VSIStatL(pszDirectory, &sStat) != 0 || !VSI_ISDIR(sStat.st_mode)) &&
+        (VSIMkdirRecursive(pszDirectory, 0755) != 0 ||
+         VSIStatL(pszDirectory, &sStat) != 0 || !VSI_ISDIR(sStat.st_mode)))
+    {
+        CPLError(CE_Warning, CPLE_FileIO,
+                 "Cannot create CPL_VSIL_CURL_DISK_CACHE_DIR=%s. "
+                 "Disk cache disabled",
+                 pszDirectory);
+        gosInvalidDirectory = pszDirectory;
+        gpoCache.reset();
+        return nullptr;
+    }
+    gosInvalidDirectory.clear();
+    gpoCache = std::make_shared<VSICurlDiskCache>(pszDirectory, nMaxSize);
+    return gpoCache;
+}
+
+/************************************************************************/
+/*                              BuildKey()                              */
+/************************************************************************/
+
+std::string VSICurlDiskCache::BuildKey(const std::string &osURL,
+                                       const std::string &osValidator,
+                                       vsi_l_offset nOffset, int nChunkSize)
+{
+    std::string osContent(osURL);
+    osContent += '\n';
+    osContent += osValidator;
+    osContent += CPLSPrintf("\n" CPL_FRMT_GUIB "\n%d",
+                            static_cast<GUIntBig>(nOffset), nChunkSize);
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osContent.data(), osContent.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    std::string osKey(pszHex);
+    CPLFree(pszHex);
+    return osKey;
+}
+
+/************************************************************************/
+/*                            GetFilename()                             */
+/************************************************************************/
+
+std::string VSICurlDiskCache::GetFilename(const std::string &osKey) const
+{
+    // Spread files into 256 sub-directories to keep them reasonably small
+    return CPLFormFilenameSafe(
+        CPLFormFilenameSafe(m_osDirectory.c_str(), osKey.substr(0, 2).c_str(),
+                            nullptr)
+            .c_str(),
+        osKey.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+bool VSICurlDiskCache::Read(const std::string &osKey, std::string &osData)
+{
+    const std::string osFilename = GetFilename(osKey);
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+
+    bool bOK = VSIFSeekL(fp, 0, SEEK_END) == 0;
+    const vsi_l_offset nSize = VSIFTellL(fp);
+    bOK = bOK && nSize > 0 &&
+          nSize < static_cast<vsi_l_offset>(std::numeric_limits<int>::max()) &&
+          VSIFSeekL(fp, 0, SEEK_SET) == 0;
+    if (bOK)
+    {
+        try
+        {
+            osData.resize(static_cast<size_t>(nSize));
+        }
+        catch (const std::exception &)
+        {
+            bOK = false;
+        }
+    }
+    bOK = bOK && VSIFReadL(osData.data(), 1, osData.size(), fp) == nSize;
+    VSIFCloseL(fp);
+    if (!bOK)
+    {
+        osData.clear();
+        return false;
+    }
+
+    // Update the modification time, which is used as the last access time
+    // by the LRU eviction.
+#ifdef _WIN32
+    _utime(osFilename.c_str(), nullptr);
+#else
+    utime(osFilename.c_str(), nullptr);
+#endif
+
+    return true;
+}
+
+/************************************************************************/
+/*                               Write()                                */
+/************************************************************************/
+
+void VSICurlDiskCache::Write(const std::string &osKey, const char *pData,
+                             size_t nSize)
+{
+    if (nSize == 0 || static_cast<GIntBig>(nSize) > m_nMaxSize)
+        return;
+
+    const std::string osFilename = GetFilename(osKey);
+    VSIMkdir(CPLGetPathSafe(osFilename.c_str()).c_str(), 0755);
+
+    unsigned nCounter;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        nCounter = ++m_nTmpCounter;
+    }
+
+    // Write into a temporary file, and rename it afterwards, so that
+    // concurrent readers, possibly in other processes, never see partially
+    // written blocks.
+    const std::string osTmpFilename =
+        osFilename + CPLSPrintf("%s%d.%u", TMP_FILE_MARKER,
+                                CPLGetCurrentProcessID(), nCounter);
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+        return;
+    bool bOK = VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (m_nApproxSize >= 0)
+            m_nApproxSize += static_cast<GIntBig>(nSize);
+        ++m_nWritesSinceLastScan;
+    }
+    EvictIfNeeded();
+}
+
+/************************************************************************/
+/*                           EvictIfNeeded()                            */
+/************************************************************************/
+
+void VSICurlDiskCache::EvictIfNeeded()
+{
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (m_nApproxSize >= 0 && m_nApproxSize <= m_nMaxSize &&
+            m_nWritesSinceLastScan < SCAN_PERIOD)
+        {
+            return;
+        }
+        m_nWritesSinceLastScan = 0;
+    }
+
+    // Only one process at a time scans and prunes the directory. If another
+    // one is already doing it, there is no need to wait for it.
+    const std::string osLockFilename =
+        CPLFormFilenameSafe(m_osDirectory.c_str(), LOCK_FILENAME, nullptr);
+    CPLLockFileHandle hLockFile = nullptr;
+    CPLStringList aosLockOptions;
+    aosLockOptions.SetNameValue("WAIT_TIME", "0");
+    if (CPLLockFileEx(osLockFilename.c_str(), &hLockFile,
+                      aosLockOptions.List()) != CLFS_OK)
+    {
+        return;
+    }
+
+    struct Entry
+    {
+        std::string osFilename{};
+        GIntBig nSize = 0;
+        time_t nMTime = 0;
+    };
+
+    std::vector<Entry> aoEntries;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    const CPLStringList aosSubDirs(VSIReadDir(m_osDirectory.c_str()));
+    for (const char *pszSubDir : aosSubDirs)
+    {
+        if (strlen(pszSubDir) != 2)
+            continue;
+        const std::string osSubDir =
+            CPLFormFilenameSafe(m_osDirectory.c_str(), pszSubDir, nullptr);
+        const CPLStringList aosFiles(VSIReadDir(osSubDir.c_str()));
+        for (const char *pszFile : aosFiles)
+        {
+            Entry oEntry;
+            oEntry.osFilename =
+                CPLFormFilenameSafe(osSubDir.c_str(), pszFile, nullptr);
+            VSIStatBufL sStat;
+            if (VSIStatL(oEntry.osFilename.c_str(), &sStat) != 0 ||
+                !VSI_ISREG(sStat.st_mode))
+            {
+                continue;
+            }
+            if (strstr(pszFile, TMP_FILE_MARKER))
+            {
+                if (nNow - sStat.st_mtime > TMP_FILE_MAX_AGE_SEC)
+                    VSIUnlink(oEntry.osFilename.c_str());
+                continue;
+            }
+            oEntry.nSize = static_cast<GIntBig>(sStat.st_size);
+            oEntry.nMTime = sStat.st_mtime;
+            nTotalSize += oEntry.nSize;
+            aoEntries.push_back(std::move(oEntry));
+        }
+    }
+
+    if (nTotalSize > m_nMaxSize)
+    {
+        // Evict least recently used blocks until we are 10% below the limit,
+        // so that eviction does not happen on each write.
+        const GIntBig nTargetSize = m_nMaxSize - m_nMaxSize / 10;
+        std::sort(aoEntries.begin(), aoEntries.end(),
+                  [](const Entry &a, const Entry &b)
+                  { return a.nMTime < b.nMTime; });
+        for (const auto &oEntry : aoEntries)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            if (VSIUnlink(oEntry.osFilename.c_str()) == 0)
+                nTotalSize -= oEntry.nSize;
+        }
+        CPLDebug("VSICURL", "Disk cache %s pruned to " CPL_FRMT_GIB " bytes",
+                 m_osDirectory.c_str(), nTotalSize);
+    }
+
+    CPLUnlockFileEx(hLockFile);
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    m_nApproxSize = nTotalSize;
+}
+
+}  // namespace cpl
+
+//! @endcond
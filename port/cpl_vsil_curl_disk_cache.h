@@ -0,0 +1,76 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of blocks downloaded by /vsicurl/
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_VSIL_CURL_DISK_CACHE_H_INCLUDED
+#define CPL_VSIL_CURL_DISK_CACHE_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+//! @cond Doxygen_Suppress
+
+namespace cpl
+{
+
+/************************************************************************/
+/*                          VSICurlDiskCache                            */
+/************************************************************************/
+
+/** Size-bounded cache of downloaded blocks, stored as one file per block in
+ * the directory pointed by the CPL_VSIL_CURL_DISK_CACHE_DIR configuration
+ * option, so that it can be shared by several processes and survives their
+ * termination.
+ *
+ * Blocks are addressed by a hash of the URL, of a validator of the remote
+ * content (ETag, or last modification time and size) and of their offset.
+ * Files are written under a temporary name and atomically renamed, so that
+ * readers never see partial content. Eviction of the least recently used
+ * blocks is serialized between processes with a lock file.
+ */
+class VSICurlDiskCache
+{
+    const std::string m_osDirectory;
+    const GIntBig m_nMaxSize;
+
+    std::mutex m_oMutex{};
+    GIntBig m_nApproxSize = -1;  // -1 = not computed yet
+    int m_nWritesSinceLastScan = 0;
+    unsigned m_nTmpCounter = 0;
+
+    std::string GetFilename(const std::string &osKey) const;
+    void EvictIfNeeded();
+
+    CPL_DISALLOW_COPY_ASSIGN(VSICurlDiskCache)
+
+  public:
+    VSICurlDiskCache(const std::string &osDirectory, GIntBig nMaxSize);
+
+    /** Return the cache configured by CPL_VSIL_CURL_DISK_CACHE_DIR and
+     * CPL_VSIL_CURL_DISK_CACHE_SIZE, or nullptr if it is disabled. */
+    static std::shared_ptr<VSICurlDiskCache> Get();
+
+    static std::string BuildKey(const std::string &osURL,
+                                const std::string &osValidator,
+                                vsi_l_offset nOffset, int nChunkSize);
+
+    bool Read(const std::string &osKey, std::string &osData);
+    void Write(const std::string &osKey, const char *pData, size_t nSize);
+};
+
+}  // namespace cpl
+
+//! @endcond
+
+#endif  // CPL_VSIL_CURL_DISK_CACHE_H_INCLUDED
@@ -79,6 +79,8 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -90,12 +92,14 @@
 #include <vector>
 
 #include "cpl_error.h"
+#include "cpl_mem_cache.h"
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_vsil_gzip_index.h"
 #include "cpl_worker_thread_pool.h"
 #include "../gcore/gdal_thread_pool.h"
 
@@ -178,6 +182,8 @@ class VSIGZipHandle final : public VSIVirtualHandle
     vsi_l_offset snapshot_byte_interval =
         0; /* number of compressed bytes at which we create a "snapshot" */
 
+    std::shared_ptr<VSIGZipIndex> m_poIndex{};
+
     void check_header();
     int get_byte();
     bool gzseek(vsi_l_offset nOffset, int nWhence);
@@ -238,6 +244,13 @@ class VSIGZipHandle final : public VSIVirtualHandle
     {
         m_bCanSaveInfo = false;
     }
+
+    void SetIndex(std::shared_ptr<VSIGZipIndex> poIndex)
+    {
+        m_poIndex = std::move(poIndex);
+        if (m_poIndex && m_uncompressed_size == 0)
+            m_uncompressed_size = m_poIndex->GetUncompressedSize();
+    }
 };
 
 #ifdef ENABLE_DEFLATE64
@@ -347,6 +360,20 @@ class VSIGZipFilesystemHandler final : public VSIFilesystemHandler
     std::unique_ptr<VSIGZipHandle> poHandleLastGZipFile{};
     bool m_bInSaveInfo = false;
 
+    // Random access indexes of gzip files, reused as long as the size and
+    // modification time of the gzip file do not change.
+    struct CachedIndex
+    {
+        GUIntBig nSize = 0;
+        GIntBig nMTime = 0;
+        std::shared_ptr<VSIGZipIndex> poIndex{};
+    };
+
+    lru11::Cache<std::string, CachedIndex> m_oCacheIndex{32};
+
+    std::shared_ptr<VSIGZipIndex> GetIndex(const char *pszBaseFilename,
+                                           const VSIStatBufL &sStat);
+
   public:
     VSIGZipFilesystemHandler() = default;
     ~VSIGZipFilesystemHandler() override;
@@ -402,6 +429,7 @@ VSIGZipHandle *VSIGZipHandle::Duplicate()
     }
 
     poHandle->m_nLastReadOffset = m_nLastReadOffset;
+    poHandle->m_poIndex = m_poIndex;
 
     // Most important: duplicate the snapshots!
 
@@ -897,6 +925,38 @@ bool VSIGZipHandle::gzseek(vsi_l_offset offset, int whence)
         }
     }
 
+    // Use the persistent index if it has an access point closer to the
+    // target offset than the current position or the best snapshot.
+    if (m_poIndex && offset > 0)
+    {
+        const vsi_l_offset nTargetOffset = out + offset;
+        const auto psPoint = m_poIndex->GetAccessPoint(nTargetOffset);
+        if (psPoint && psPoint->nUncompressedOffset > out)
+        {
+#ifdef ENABLE_DEBUG
+            CPLDebug("GZIP",
+                     "using index access point: in=" CPL_FRMT_GUIB
+                     " out=" CPL_FRMT_GUIB,
+                     psPoint->nCompressedOffset, psPoint->nUncompressedOffset);
+#endif
+            if (!m_poIndex->InitStream(*psPoint, &stream, m_poBaseHandle.get()))
+            {
+                z_err = Z_ERRNO;
+                CPL_VSIL_GZ_RETURN(FALSE);
+                return false;
+            }
+            stream.avail_in = 0;
+            stream.next_in = inbuf;
+            z_err = Z_OK;
+            z_eof = 0;
+            crc = psPoint->nCRC;
+            m_transparent = 0;
+            in = psPoint->nCompressedOffset - startOff;
+            out = psPoint->nUncompressedOffset;
+            offset = nTargetOffset - out;
+        }
+    }
+
     // Offset is now the number of bytes to skip.
 
     if (offset != 0 && outbuf == nullptr)
@@ -1017,6 +1077,30 @@ size_t VSIGZipHandle::Read(void *const buf, size_t const nBytes)
         return 0;
     }
 
+    // Large reads spanning several access points of the index are
+    // decompressed in parallel, if GDAL_NUM_THREADS allows it.
+    constexpr size_t MIN_SIZE_PARALLEL_READ = 1024 * 1024;
+    if (m_poIndex && nBytes >= MIN_SIZE_PARALLEL_READ &&
+        out < m_uncompressed_size)
+    {
+        const size_t nToRead = static_cast<size_t>(
+            std::min<vsi_l_offset>(nBytes, m_uncompressed_size - out));
+        const int nThreads = GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                               /* bDefaultAllCPUs = */ false);
+        const vsi_l_offset nOffset = out;
+        if (nToRead >= MIN_SIZE_PARALLEL_READ && nThreads > 1 &&
+            m_poIndex->ReadParallel(nOffset, nToRead, buf, nThreads))
+        {
+            // Resynchronize the sequential decompression state after the
+            // data that has been read.
+            if (!gzseek(nOffset + nToRead, SEEK_SET))
+                return 0;
+            if (nToRead < nBytes)
+                m_bEOF = true;
+            return nToRead;
+        }
+    }
+
     const unsigned len = static_cast<unsigned int>(nBytes);
     Bytef *pStart =
         static_cast<Bytef *>(buf);  // Start off point for crc computation.
@@ -3122,15 +3206,68 @@ VSIGZipFilesystemHandler::OpenGZipReadOnly(const char *pszFilename,
         poHandleLastGZipFile.reset();
     }
 
-    auto poHandle = std::make_unique<VSIGZipHandle>(
-        std::move(poVirtualHandle), pszFilename + strlen("/vsigzip/"));
+    const char *pszBaseFilename = pszFilename + strlen("/vsigzip/");
+    auto poHandle = std::make_unique<VSIGZipHandle>(std::move(poVirtualHandle),
+                                                    pszBaseFilename);
     if (!(poHandle->IsInitOK()))
     {
         return nullptr;
     }
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszBaseFilename, &sStat) == 0)
+    {
+        auto poIndex = GetIndex(pszBaseFilename, sStat);
+        if (!poIndex &&
+            CPLTestBool(
+                CPLGetConfigOption("CPL_VSIL_GZIP_WRITE_INDEX", "NO")) &&
+            VSIGZipIndex::Build(pszBaseFilename))
+        {
+            poIndex = GetIndex(pszBaseFilename, sStat);
+        }
+        if (poIndex)
+            poHandle->SetIndex(std::move(poIndex));
+    }
+
     return poHandle.release();
 }
 
+/************************************************************************/
+/*                              GetIndex()                              */
+/************************************************************************/
+
+// Return the index of a gzip file whose status is sStat, from the cache if
+// possible. Must be called with oMutex held.
+std::shared_ptr<VSIGZipIndex>
+VSIGZipFilesystemHandler::GetIndex(const char *pszBaseFilename,
+                                   const VSIStatBufL &sStat)
+{
+    const std::string osKey(pszBaseFilename);
+    CachedIndex oCachedIndex;
+    if (m_oCacheIndex.tryGet(osKey, oCachedIndex) &&
+        oCachedIndex.nSize == static_cast<GUIntBig>(sStat.st_size) &&
+        oCachedIndex.nMTime == static_cast<GIntBig>(sStat.st_mtime))
+    {
+        return oCachedIndex.poIndex;
+    }
+
+    // Only successfully opened indexes are cached, as a missing one may be
+    // built afterwards.
+    auto poIndex = VSIGZipIndex::Open(pszBaseFilename);
+    if (poIndex)
+    {
+        oCachedIndex.nSize = static_cast<GUIntBig>(sStat.st_size);
+        oCachedIndex.nMTime = static_cast<GIntBig>(sStat.st_mtime);
+        oCachedIndex.poIndex = poIndex;
+        m_oCacheIndex.insert(osKey, oCachedIndex);
+    }
+    else
+    {
+        m_oCacheIndex.remove(osKey);
+    }
+    return poIndex;
+}
+
 /************************************************************************/
 /*                                Stat()                                */
 /************************************************************************/
@@ -3160,6 +3297,17 @@ int VSIGZipFilesystemHandler::Stat(const char *pszFilename,
     // Begin by doing a stat on the real file.
     int ret = VSIStatExL(pszFilename + strlen("/vsigzip/"), pStatBuf, nFlags);
 
+    if (ret == 0 && (nFlags & VSI_STAT_SIZE_FLAG))
+    {
+        // The index stores the uncompressed size.
+        auto poIndex = GetIndex(pszFilename + strlen("/vsigzip/"), *pStatBuf);
+        if (poIndex)
+        {
+            pStatBuf->st_size = poIndex->GetUncompressedSize();
+            return ret;
+        }
+    }
+
     if (ret == 0 && (nFlags & VSI_STAT_SIZE_FLAG))
     {
         CPLString osCacheFilename(pszFilename + strlen("/vsigzip/"));
@@ -3493,6 +3641,8 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     struct VSIFileInZipInfo
     {
         VSIVirtualHandleUniquePtr poVirtualHandle{};
+        std::string osArchiveFilename{};
+        std::string osFilenameInArchive{};
         std::map<std::string, std::string> oMapProperties{};
         int nCompressionMethod = 0;
         uint64_t nUncompressedSize = 0;
@@ -3524,6 +3674,15 @@ class VSIZipFilesystemHandler final : public VSIArchiveFilesystemHandler
     std::unique_ptr<VSIArchiveReader>
     CreateReader(const char *pszZipFileName) override;
 
+  protected:
+    bool SerializeFileOffset(const VSIArchiveEntryFileOffset *poOffset,
+                             GUIntBig &nValue1,
+                             GUIntBig &nValue2) const override;
+    std::unique_ptr<VSIArchiveEntryFileOffset>
+    DeserializeFileOffset(GUIntBig nValue1, GUIntBig nValue2) const override;
+
+  public:
+
     VSIVirtualHandleUniquePtr Open(const char *pszFilename,
                                    const char *pszAccess, bool bSetError,
                                    CSLConstList /* papszOptions */) override;
@@ -3661,6 +3820,35 @@ std::vector<CPLString> VSIZipFilesystemHandler::GetExtensions() const
     return oList;
 }
 
+/************************************************************************/
+/*                        SerializeFileOffset()                         */
+/************************************************************************/
+
+bool VSIZipFilesystemHandler::SerializeFileOffset(
+    const VSIArchiveEntryFileOffset *poOffset, GUIntBig &nValue1,
+    GUIntBig &nValue2) const
+{
+    const auto poZipOffset =
+        static_cast<const VSIZipEntryFileOffset *>(poOffset);
+    nValue1 = poZipOffset->m_file_pos.pos_in_zip_directory;
+    nValue2 = poZipOffset->m_file_pos.num_of_file;
+    return true;
+}
+
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+std::unique_ptr<VSIArchiveEntryFileOffset>
+VSIZipFilesystemHandler::DeserializeFileOffset(GUIntBig nValue1,
+                                               GUIntBig nValue2) const
+{
+    unz_file_pos file_pos;
+    file_pos.pos_in_zip_directory = nValue1;
+    file_pos.num_of_file = nValue2;
+    return std::make_unique<VSIZipEntryFileOffset>(file_pos);
+}
+
 /************************************************************************/
 /*                            CreateReader()                            */
 /************************************************************************/
@@ -3678,6 +3866,149 @@ VSIZipFilesystemHandler::CreateReader(const char *pszZipFileName)
     return poReader;
 }
 
+/************************************************************************/
+/*                         VSISOZipDecompressor                         */
+/************************************************************************/
+
+// Decompressor of SOZip chunks. Instances must not be shared between
+// threads.
+class VSISOZipDecompressor
+{
+#ifdef HAVE_LIBDEFLATE
+    struct libdeflate_decompressor *pDecompressor_ = nullptr;
+#else
+    z_stream sStream_{};
+    bool bInit_ = false;
+#endif
+
+    CPL_DISALLOW_COPY_ASSIGN(VSISOZipDecompressor)
+
+  public:
+    VSISOZipDecompressor();
+    ~VSISOZipDecompressor();
+
+    bool IsOK() const
+    {
+#ifdef HAVE_LIBDEFLATE
+        return pDecompressor_ != nullptr;
+#else
+        return bInit_;
+#endif
+    }
+
+    bool Decompress(GByte *pabyCompressed, size_t nCompressedSize,
+                    GByte *pabyOut, size_t nOutSize, vsi_l_offset nPos);
+};
+
+/************************************************************************/
+/*                        VSISOZipDecompressor()                        */
+/************************************************************************/
+
+VSISOZipDecompressor::VSISOZipDecompressor()
+{
+#ifdef HAVE_LIBDEFLATE
+    pDecompressor_ = libdeflate_alloc_decompressor();
+#else
+    memset(&sStream_, 0, sizeof(sStream_));
+    bInit_ = inflateInit2(&sStream_, -MAX_WBITS) == Z_OK;
+#endif
+}
+
+/************************************************************************/
+/*                       ~VSISOZipDecompressor()                        */
+/************************************************************************/
+
+VSISOZipDecompressor::~VSISOZipDecompressor()
+{
+#ifdef HAVE_LIBDEFLATE
+    if (pDecompressor_)
+        libdeflate_free_decompressor(pDecompressor_);
+#else
+    if (bInit_)
+        inflateEnd(&sStream_);
+#endif
+}
+
+/************************************************************************/
+/*                             Decompress()                             */
+/************************************************************************/
+
+// Decompress a chunk, whose uncompressed size is nOutSize, and that starts
+// at nPos in the uncompressed stream. pabyCompressed may be modified.
+bool VSISOZipDecompressor::Decompress(GByte *pabyCompressed,
+                                      size_t nCompressedSize, GByte *pabyOut,
+                                      size_t nOutSize, vsi_l_offset nPos)
+{
+    if (nCompressedSize >= 5 && pabyCompressed[nCompressedSize - 5] == 0x00 &&
+        memcmp(&pabyCompressed[nCompressedSize - 4], "\x00\x00\xFF\xFF", 4) ==
+            0)
+    {
+        // Tag this flush block as the last one.
+        pabyCompressed[nCompressedSize - 5] = 0x01;
+    }
+
+#ifdef HAVE_LIBDEFLATE
+    size_t nOut = 0;
+    if (libdeflate_deflate_decompress(pDecompressor_, pabyCompressed,
+                                      nCompressedSize, pabyOut, nOutSize,
+                                      &nOut) != LIBDEFLATE_SUCCESS)
+    {
+        CPLError(
+            CE_Failure, CPLE_AppDefined,
+            "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
+            static_cast<GUIntBig>(nPos));
+        return false;
+    }
+    if (nOut != nOutSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+                 " whereas %u where expected",
+                 static_cast<unsigned>(nOut), static_cast<GUIntBig>(nPos),
+                 static_cast<unsigned>(nOutSize));
+        return false;
+    }
+#else
+    if constexpr (sizeof(size_t) > sizeof(uInt))
+    {
+        if (nCompressedSize > UINT32_MAX)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "nCompressedToRead > UINT32_MAX");
+            return false;
+        }
+    }
+    sStream_.avail_in = static_cast<uInt>(nCompressedSize);
+    sStream_.next_in = pabyCompressed;
+    sStream_.avail_out = static_cast<int>(nOutSize);
+    sStream_.next_out = pabyOut;
+
+    int err = inflate(&sStream_, Z_FINISH);
+    if ((err != Z_OK && err != Z_STREAM_END))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "inflate() failed at pos " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(nPos));
+        inflateReset(&sStream_);
+        return false;
+    }
+    if (sStream_.avail_in != 0)
+        CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
+    if (sStream_.avail_out != 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
+                 " whereas %u where expected",
+                 static_cast<unsigned>(nOutSize - sStream_.avail_out),
+                 static_cast<GUIntBig>(nPos), static_cast<unsigned>(nOutSize));
+        inflateReset(&sStream_);
+        return false;
+    }
+    inflateReset(&sStream_);
+#endif
+    return true;
+}
+
 /************************************************************************/
 /*                            VSISOZipHandle                            */
 /************************************************************************/
@@ -3694,16 +4025,45 @@ class VSISOZipHandle final : public VSIVirtualHandle
     bool bEOF_ = false;
     bool bError_ = false;
     vsi_l_offset nCurPos_ = 0;
-    bool bOK_ = true;
-#ifdef HAVE_LIBDEFLATE
-    struct libdeflate_decompressor *pDecompressor_ = nullptr;
-#else
-    z_stream sStream_{};
-#endif
+    VSISOZipDecompressor oDecompressor_{};
+
+    // Chunks are independently compressed, so when GDAL_NUM_THREADS > 1,
+    // reads of several chunks are decompressed in parallel, and the chunks
+    // following sequential reads are decompressed in advance.
+    struct ReadAheadChunk
+    {
+        std::vector<GByte> abyData{};
+        bool bDone = false;
+        bool bOK = false;
+    };
+
+    int nThreads_ = 1;
+    CPLJobQueuePtr poJobQueue_{};
+    std::mutex oReadAheadMutex_{};
+    std::condition_variable oReadAheadCV_{};
+    std::map<uint64_t, std::shared_ptr<ReadAheadChunk>> oMapReadAhead_{};
+    uint64_t nNextSequentialChunk_ = 0;
+    int nSequentialReads_ = 0;
 
     VSISOZipHandle(const VSISOZipHandle &) = delete;
     VSISOZipHandle &operator=(const VSISOZipHandle &) = delete;
 
+    uint64_t GetChunkCount() const
+    {
+        return 1 + (uncompressed_size_ - 1) / nChunkSize_;
+    }
+
+    CPLJobQueue *GetJobQueue();
+    bool ReadCompressedChunks(uint64_t nFirstChunk, size_t nChunkCount,
+                              std::vector<uint64_t> &anOffsets,
+                              std::vector<GByte> &abyCompressed);
+    bool ReadChunk(uint64_t nChunk, GByte *pabyOut, size_t nOutSize);
+    bool ReadChunksParallel(uint64_t nFirstChunk, size_t nChunkCount,
+                            GByte *pabyOut, size_t nOutSize);
+    bool ReadChunkFromReadAhead(uint64_t nChunk, GByte *pabyOut,
+                                size_t nOutSize);
+    void ScheduleReadAhead(uint64_t nFirstChunk);
+
   public:
     VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
                    vsi_l_offset nPosCompressedStream, uint64_t compressed_size,
@@ -3745,7 +4105,7 @@ class VSISOZipHandle final : public VSIVirtualHandle
 
     bool IsOK() const
     {
-        return bOK_;
+        return oDecompressor_.IsOK();
     }
 };
 
@@ -3762,18 +4122,10 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
     : poBaseHandle_(std::move(poVirtualHandleIn)),
       nPosCompressedStream_(nPosCompressedStream),
       compressed_size_(compressed_size), uncompressed_size_(uncompressed_size),
-      indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize)
+      indexPos_(indexPos), nToSkip_(nToSkip), nChunkSize_(nChunkSize),
+      nThreads_(GDALGetNumThreads(GDAL_DEFAULT_MAX_THREAD_COUNT,
+                                  /* bDefaultAllCPUs = */ false))
 {
-#ifdef HAVE_LIBDEFLATE
-    pDecompressor_ = libdeflate_alloc_decompressor();
-    if (!pDecompressor_)
-        bOK_ = false;
-#else
-    memset(&sStream_, 0, sizeof(sStream_));
-    int err = inflateInit2(&sStream_, -MAX_WBITS);
-    if (err != Z_OK)
-        bOK_ = false;
-#endif
 }
 
 /************************************************************************/
@@ -3782,15 +4134,9 @@ VSISOZipHandle::VSISOZipHandle(VSIVirtualHandleUniquePtr poVirtualHandleIn,
 
 VSISOZipHandle::~VSISOZipHandle()
 {
+    if (poJobQueue_)
+        poJobQueue_->WaitCompletion();
     VSISOZipHandle::Close();
-    if (bOK_)
-    {
-#ifdef HAVE_LIBDEFLATE
-        libdeflate_free_decompressor(pDecompressor_);
-#else
-        inflateEnd(&sStream_);
-#endif
-    }
 }
 
 /************************************************************************/
@@ -3824,6 +4170,296 @@ int VSISOZipHandle::Seek(vsi_l_offset nOffset, int nWhence)
     return 0;
 }
 
+/************************************************************************/
+/*                            GetJobQueue()                             */
+/************************************************************************/
+
+CPLJobQueue *VSISOZipHandle::GetJobQueue()
+{
+    if (!poJobQueue_ && nThreads_ > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads_);
+        if (poThreadPool)
+            poJobQueue_ = poThreadPool->CreateJobQueue();
+        else
+            nThreads_ = 1;
+    }
+    return poJobQueue_.get();
+}
+
+/************************************************************************/
+/*                        ReadCompressedChunks()                        */
+/************************************************************************/
+
+// Read the compressed data of nChunkCount consecutive chunks, which are
+// contiguous in the compressed stream. anOffsets receives the offsets of the
+// chunks, and of the end of the last one, in the compressed stream.
+bool VSISOZipHandle::ReadCompressedChunks(uint64_t nFirstChunk,
+                                          size_t nChunkCount,
+                                          std::vector<uint64_t> &anOffsets,
+                                          std::vector<GByte> &abyCompressed)
+{
+    const uint64_t nTotalChunks = GetChunkCount();
+    anOffsets.resize(nChunkCount + 1);
+
+    // The offsets of chunks 1 to nTotalChunks - 1 are stored in the index.
+    const uint64_t nFirstInIndex = std::max<uint64_t>(1, nFirstChunk);
+    const uint64_t nLastInIndex =
+        std::min<uint64_t>(nFirstChunk + nChunkCount, nTotalChunks - 1);
+    if (nLastInIndex >= nFirstInIndex)
+    {
+        constexpr size_t nOffsetSize = 8;
+        const size_t nCount =
+            static_cast<size_t>(nLastInIndex - nFirstInIndex + 1);
+        uint64_t *panOffsets =
+            anOffsets.data() + static_cast<size_t>(nFirstInIndex - nFirstChunk);
+        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
+                                    (nFirstInIndex - 1) * nOffsetSize,
+                                SEEK_SET) != 0 ||
+            poBaseHandle_->Read(panOffsets, nCount * nOffsetSize) !=
+                nCount * nOffsetSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot read nOffsetInCompressedStream");
+            return false;
+        }
+        for (size_t i = 0; i < nCount; ++i)
+            CPL_LSBPTR64(&panOffsets[i]);
+    }
+    if (nFirstChunk == 0)
+        anOffsets[0] = 0;
+    if (nFirstChunk + nChunkCount == nTotalChunks)
+        anOffsets[nChunkCount] = compressed_size_;
+
+    for (size_t i = 0; i < nChunkCount; ++i)
+    {
+        if (anOffsets[i + 1] <= anOffsets[i] ||
+            anOffsets[i + 1] - anOffsets[i] > 13 + 2 * nChunkSize_ ||
+            anOffsets[i + 1] > compressed_size_)
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Invalid values for nOffsetInCompressedStream (" CPL_FRMT_GUIB
+                ") / "
+                "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
+                static_cast<GUIntBig>(anOffsets[i]),
+                static_cast<GUIntBig>(anOffsets[i + 1]));
+            return false;
+        }
+    }
+
+    // CPLDebug("VSIZIP", "Seek to compressed data at offset "
+    // CPL_FRMT_GUIB, static_cast<GUIntBig>(nPosCompressedStream_ +
+    // anOffsets[0]));
+    const size_t nCompressedToRead =
+        static_cast<size_t>(anOffsets[nChunkCount] - anOffsets[0]);
+    try
+    {
+        abyCompressed.resize(nCompressedToRead);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for compressed data");
+        return false;
+    }
+    return poBaseHandle_->Seek(nPosCompressedStream_ + anOffsets[0],
+                               SEEK_SET) == 0 &&
+           poBaseHandle_->Read(abyCompressed.data(), nCompressedToRead) ==
+               nCompressedToRead;
+}
+
+/************************************************************************/
+/*                             ReadChunk()                              */
+/************************************************************************/
+
+bool VSISOZipHandle::ReadChunk(uint64_t nChunk, GByte *pabyOut,
+                               size_t nOutSize)
+{
+    if (ReadChunkFromReadAhead(nChunk, pabyOut, nOutSize))
+        return true;
+
+    std::vector<uint64_t> anOffsets;
+    std::vector<GByte> abyCompressed;
+    return ReadCompressedChunks(nChunk, 1, anOffsets, abyCompressed) &&
+           oDecompressor_.Decompress(abyCompressed.data(),
+                                     abyCompressed.size(), pabyOut, nOutSize,
+                                     nChunk * nChunkSize_);
+}
+
+/************************************************************************/
+/*                         ReadChunksParallel()                         */
+/************************************************************************/
+
+// Decompress nChunkCount chunks, split in groups of consecutive chunks, each
+// group being decompressed by a different thread.
+bool VSISOZipHandle::ReadChunksParallel(uint64_t nFirstChunk,
+                                        size_t nChunkCount, GByte *pabyOut,
+                                        size_t nOutSize)
+{
+    std::vector<uint64_t> anOffsets;
+    std::vector<GByte> abyCompressed;
+    if (!ReadCompressedChunks(nFirstChunk, nChunkCount, anOffsets,
+                              abyCompressed))
+    {
+        return false;
+    }
+
+    auto poJobQueue = GetJobQueue();
+    const size_t nChunksPerJob =
+        poJobQueue ? cpl::div_round_up(nChunkCount, nThreads_) : nChunkCount;
+    std::atomic<bool> bOK{true};
+    for (size_t iFirst = 0; iFirst < nChunkCount; iFirst += nChunksPerJob)
+    {
+        const size_t iLast = std::min(nChunkCount, iFirst + nChunksPerJob);
+        const auto DecompressGroup = [this, &bOK, &anOffsets, &abyCompressed,
+                                      nFirstChunk, pabyOut, nOutSize, iFirst,
+                                      iLast]()
+        {
+            VSISOZipDecompressor oDecompressor;
+            for (size_t i = iFirst; bOK && i < iLast; ++i)
+            {
+                const size_t nOffsetInOutput =
+                    i * static_cast<size_t>(nChunkSize_);
+                if (!oDecompressor.IsOK() ||
+                    !oDecompressor.Decompress(
+                        abyCompressed.data() + (anOffsets[i] - anOffsets[0]),
+                        static_cast<size_t>(anOffsets[i + 1] - anOffsets[i]),
+                        pabyOut + nOffsetInOutput,
+                        std::min(static_cast<size_t>(nChunkSize_),
+                                 nOutSize - nOffsetInOutput),
+                        (nFirstChunk + i) * nChunkSize_))
+                {
+                    bOK = false;
+                }
+            }
+        };
+        if (!poJobQueue || !poJobQueue->SubmitJob(DecompressGroup))
+            DecompressGroup();
+    }
+    if (poJobQueue)
+        poJobQueue->WaitCompletion();
+    return bOK;
+}
+
+/************************************************************************/
+/*                       ReadChunkFromReadAhead()                       */
+/************************************************************************/
+
+bool VSISOZipHandle::ReadChunkFromReadAhead(uint64_t nChunk, GByte *pabyOut,
+                                            size_t nOutSize)
+{
+    std::shared_ptr<ReadAheadChunk> poChunk;
+    {
+        std::unique_lock oLock(oReadAheadMutex_);
+        auto oIter = oMapReadAhead_.find(nChunk);
+        if (oIter == oMapReadAhead_.end())
+            return false;
+        poChunk = std::move(oIter->second);
+        oMapReadAhead_.erase(oIter);
+        oReadAheadCV_.wait(oLock, [&poChunk] { return poChunk->bDone; });
+    }
+    if (!poChunk->bOK || poChunk->abyData.size() != nOutSize)
+        return false;
+    memcpy(pabyOut, poChunk->abyData.data(), nOutSize);
+    return true;
+}
+
+/************************************************************************/
+/*                         ScheduleReadAhead()                          */
+/************************************************************************/
+
+// Start decompressing the chunks from nFirstChunk on, if they are not
+// already.
+void VSISOZipHandle::ScheduleReadAhead(uint64_t nFirstChunk)
+{
+    constexpr int READAHEAD_CHUNKS_PER_THREAD = 2;
+    const uint64_t nMaxChunks =
+        static_cast<uint64_t>(READAHEAD_CHUNKS_PER_THREAD) * nThreads_;
+    const uint64_t nEndChunk =
+        std::min(GetChunkCount(), nFirstChunk + nMaxChunks);
+    uint64_t nStartChunk = nFirstChunk;
+    {
+        std::lock_guard oLock(oReadAheadMutex_);
+        // Discard chunks that have been skipped over
+        oMapReadAhead_.erase(oMapReadAhead_.begin(),
+                             oMapReadAhead_.lower_bound(nFirstChunk));
+        while (nStartChunk < nEndChunk && oMapReadAhead_.count(nStartChunk))
+            ++nStartChunk;
+    }
+    // Wait for half of the read-ahead chunks to be consumed before
+    // scheduling new ones, to get reasonably sized batches.
+    if (nStartChunk >= nEndChunk ||
+        nEndChunk - nStartChunk < static_cast<uint64_t>(nThreads_))
+    {
+        return;
+    }
+    auto poJobQueue = GetJobQueue();
+    if (!poJobQueue)
+        return;
+
+    const size_t nChunkCount = static_cast<size_t>(nEndChunk - nStartChunk);
+    std::vector<uint64_t> anOffsets;
+    auto poCompressed = std::make_shared<std::vector<GByte>>();
+    {
+        // Errors will be reported when the chunks are actually read.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        if (!ReadCompressedChunks(nStartChunk, nChunkCount, anOffsets,
+                                  *poCompressed))
+        {
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < nChunkCount; ++i)
+    {
+        const uint64_t nChunk = nStartChunk + i;
+        const size_t nOffsetInCompressed =
+            static_cast<size_t>(anOffsets[i] - anOffsets[0]);
+        const size_t nCompressedSize =
+            static_cast<size_t>(anOffsets[i + 1] - anOffsets[i]);
+        const size_t nOutSize = static_cast<size_t>(std::min<uint64_t>(
+            nChunkSize_, uncompressed_size_ - nChunk * nChunkSize_));
+        auto poChunk = std::make_shared<ReadAheadChunk>();
+        {
+            std::lock_guard oLock(oReadAheadMutex_);
+            oMapReadAhead_[nChunk] = poChunk;
+        }
+        if (!poJobQueue->SubmitJob(
+                [this, poChunk, poCompressed, nOffsetInCompressed,
+                 nCompressedSize, nOutSize, nChunk]()
+                {
+                    CPLErrorStateBackuper oErrorStateBackuper(
+                        CPLQuietErrorHandler);
+                    bool bOK = false;
+                    try
+                    {
+                        poChunk->abyData.resize(nOutSize);
+                        VSISOZipDecompressor oDecompressor;
+                        bOK = oDecompressor.IsOK() &&
+                              oDecompressor.Decompress(
+                                  poCompressed->data() + nOffsetInCompressed,
+                                  nCompressedSize, poChunk->abyData.data(),
+                                  nOutSize, nChunk * nChunkSize_);
+                    }
+                    catch (const std::exception &)
+                    {
+                    }
+                    {
+                        std::lock_guard oLock(oReadAheadMutex_);
+                        poChunk->bDone = true;
+                        poChunk->bOK = bOK;
+                    }
+                    oReadAheadCV_.notify_all();
+                }))
+        {
+            std::lock_guard oLock(oReadAheadMutex_);
+            oMapReadAhead_.erase(nChunk);
+            break;
+        }
+    }
+}
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -3857,171 +4493,47 @@ size_t VSISOZipHandle::Read(void *pBuffer, size_t nBytes)
                  "nToRead is not a multiple of nChunkSize");
         return 0;
     }
+    if (nToRead == 0)
+        return 0;
 
-    const auto ReadOffsetInCompressedStream =
-        [this](uint64_t nChunkIdx) -> uint64_t
-    {
-        if (nChunkIdx == 0)
-            return 0;
-        if (nChunkIdx == 1 + (uncompressed_size_ - 1) / nChunkSize_)
-            return compressed_size_;
-        constexpr size_t nOffsetSize = 8;
-        if (poBaseHandle_->Seek(indexPos_ + 32 + nToSkip_ +
-                                    (nChunkIdx - 1) * nOffsetSize,
-                                SEEK_SET) != 0)
-            return static_cast<uint64_t>(-1);
-
-        uint64_t nOffset;
-        if (!poBaseHandle_->ReadLSB(nOffset))
-            return static_cast<uint64_t>(-1);
-        return nOffset;
-    };
-
-    size_t nOffsetInOutputBuffer = 0;
-    while (true)
+    const uint64_t nFirstChunk = nCurPos_ / nChunkSize_;
+    const size_t nChunkCount =
+        cpl::div_round_up(nToRead, static_cast<size_t>(nChunkSize_));
+    GByte *pabyOut = static_cast<GByte *>(pBuffer);
+    if (nThreads_ > 1 && nChunkCount > 1)
     {
-        uint64_t nOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(nCurPos_ / nChunkSize_);
-        if (nOffsetInCompressedStream == static_cast<uint64_t>(-1))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nOffsetInCompressedStream");
-            return 0;
-        }
-        uint64_t nNextOffsetInCompressedStream =
-            ReadOffsetInCompressedStream(1 + nCurPos_ / nChunkSize_);
-        if (nNextOffsetInCompressedStream == static_cast<uint64_t>(-1))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Cannot read nNextOffsetInCompressedStream");
-            return 0;
-        }
-
-        if (nNextOffsetInCompressedStream <= nOffsetInCompressedStream ||
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream >
-                13 + 2 * nChunkSize_ ||
-            nNextOffsetInCompressedStream > compressed_size_)
-        {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Invalid values for nOffsetInCompressedStream (" CPL_FRMT_GUIB
-                ") / "
-                "nNextOffsetInCompressedStream(" CPL_FRMT_GUIB ")",
-                static_cast<GUIntBig>(nOffsetInCompressedStream),
-                static_cast<GUIntBig>(nNextOffsetInCompressedStream));
-            return 0;
-        }
-
-        // CPLDebug("VSIZIP", "Seek to compressed data at offset "
-        // CPL_FRMT_GUIB, static_cast<GUIntBig>(nPosCompressedStream_ +
-        // nOffsetInCompressedStream));
-        if (poBaseHandle_->Seek(
-                nPosCompressedStream_ + nOffsetInCompressedStream, SEEK_SET) !=
-            0)
-        {
-            bError_ = true;
-            return 0;
-        }
-
-        const size_t nCompressedToRead = static_cast<size_t>(
-            nNextOffsetInCompressedStream - nOffsetInCompressedStream);
-        // CPLDebug("VSIZIP", "nCompressedToRead = %d", nCompressedToRead);
-        std::vector<GByte> abyCompressedData(nCompressedToRead);
-        if (poBaseHandle_->Read(&abyCompressedData[0], nCompressedToRead) !=
-            nCompressedToRead)
+        if (!ReadChunksParallel(nFirstChunk, nChunkCount, pabyOut, nToRead))
         {
             bError_ = true;
             return 0;
         }
-
-        size_t nToReadThisIter =
-            std::min(nToRead, static_cast<size_t>(nChunkSize_));
-
-        if (nCompressedToRead >= 5 &&
-            abyCompressedData[nCompressedToRead - 5] == 0x00 &&
-            memcmp(&abyCompressedData[nCompressedToRead - 4],
-                   "\x00\x00\xFF\xFF", 4) == 0)
-        {
-            // Tag this flush block as the last one.
-            abyCompressedData[nCompressedToRead - 5] = 0x01;
-        }
-
-#ifdef HAVE_LIBDEFLATE
-        size_t nOut = 0;
-        if (libdeflate_deflate_decompress(
-                pDecompressor_, &abyCompressedData[0], nCompressedToRead,
-                static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer,
-                nToReadThisIter, &nOut) != LIBDEFLATE_SUCCESS)
-        {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "libdeflate_deflate_decompress() failed at pos " CPL_FRMT_GUIB,
-                static_cast<GUIntBig>(nCurPos_));
-            return 0;
-        }
-        if (nOut != nToReadThisIter)
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                     " whereas %u where expected",
-                     static_cast<unsigned>(nOut),
-                     static_cast<GUIntBig>(nCurPos_),
-                     static_cast<unsigned>(nToReadThisIter));
-            return 0;
-        }
-#else
-        if constexpr (sizeof(size_t) > sizeof(uInt))
+    }
+    else
+    {
+        for (size_t i = 0; i < nChunkCount; ++i)
         {
-            if (nCompressedToRead > UINT32_MAX)
+            const size_t nOffsetInOutputBuffer =
+                i * static_cast<size_t>(nChunkSize_);
+            if (!ReadChunk(nFirstChunk + i, pabyOut + nOffsetInOutputBuffer,
+                           std::min(static_cast<size_t>(nChunkSize_),
+                                    nToRead - nOffsetInOutputBuffer)))
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "nCompressedToRead > UINT32_MAX");
+                bError_ = true;
                 return 0;
             }
         }
-        sStream_.avail_in = static_cast<uInt>(nCompressedToRead);
-        sStream_.next_in = &abyCompressedData[0];
-        sStream_.avail_out = static_cast<int>(nToReadThisIter);
-        sStream_.next_out =
-            static_cast<Bytef *>(pBuffer) + nOffsetInOutputBuffer;
-
-        int err = inflate(&sStream_, Z_FINISH);
-        if ((err != Z_OK && err != Z_STREAM_END))
-        {
-            bError_ = true;
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "inflate() failed at pos " CPL_FRMT_GUIB,
-                     static_cast<GUIntBig>(nCurPos_));
-            inflateReset(&sStream_);
-            return 0;
-        }
-        if (sStream_.avail_in != 0)
-            CPLDebug("VSIZIP", "avail_in = %d", sStream_.avail_in);
-        if (sStream_.avail_out != 0)
-        {
-            bError_ = true;
-            CPLError(
-                CE_Failure, CPLE_AppDefined,
-                "Only %u bytes decompressed at pos " CPL_FRMT_GUIB
-                " whereas %u where expected",
-                static_cast<unsigned>(nToReadThisIter - sStream_.avail_out),
-                static_cast<GUIntBig>(nCurPos_),
-                static_cast<unsigned>(nToReadThisIter));
-            inflateReset(&sStream_);
-            return 0;
-        }
-        inflateReset(&sStream_);
-#endif
-        nOffsetInOutputBuffer += nToReadThisIter;
-        nCurPos_ += nToReadThisIter;
-        nToRead -= nToReadThisIter;
-        if (nToRead == 0)
-            break;
+    }
+    nCurPos_ += nToRead;
+
+    if (nThreads_ > 1)
+    {
+        if (nFirstChunk == nNextSequentialChunk_)
+            ++nSequentialReads_;
+        else
+            nSequentialReads_ = 0;
+        nNextSequentialChunk_ = nFirstChunk + nChunkCount;
+        if (nSequentialReads_ >= 2)
+            ScheduleReadAhead(nNextSequentialChunk_);
     }
 
     return nRet;
@@ -4297,6 +4809,8 @@ bool VSIZipFilesystemHandler::GetFileInfo(const char *pszFilename,
     cpl_unzCloseCurrentFile(unzF);
 
     info.poVirtualHandle = std::move(poVirtualHandle);
+    info.osArchiveFilename = zipFilename.get();
+    info.osFilenameInArchive = osZipInFileName;
 
     return true;
 }
@@ -4369,6 +4883,30 @@ VSIZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
             return nullptr;
         }
 
+        // Deflate-compressed members without SOZip index can use a
+        // random-access index stored in CPL_VSIL_GZIP_INDEX_DIR.
+        if (info.nCompressionMethod == 8)
+        {
+            const char *pszArchiveFilename = info.osArchiveFilename.c_str();
+            const char *pszMemberName = info.osFilenameInArchive.c_str();
+            auto poIndex = VSIGZipIndex::OpenMember(
+                pszArchiveFilename, pszMemberName, info.nStartDataStream,
+                info.nCompressedSize);
+            if (!poIndex &&
+                CPLTestBool(
+                    CPLGetConfigOption("CPL_VSIL_GZIP_WRITE_INDEX", "NO")) &&
+                VSIGZipIndex::BuildMember(pszArchiveFilename, pszMemberName,
+                                          info.nStartDataStream,
+                                          info.nCompressedSize))
+            {
+                poIndex = VSIGZipIndex::OpenMember(
+                    pszArchiveFilename, pszMemberName, info.nStartDataStream,
+                    info.nCompressedSize);
+            }
+            if (poIndex)
+                poGZIPHandle->SetIndex(std::move(poIndex));
+        }
+
         // Wrap the VSIGZipHandle inside a buffered reader that will
         // improve dramatically performance when doing small backward
         // seeks.
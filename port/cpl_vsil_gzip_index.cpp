@@ -0,0 +1,815 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent random-access index of /vsigzip/ files
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_vsil_gzip_index.h"
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+#include "../gcore/gdal_thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+
+//! @cond Doxygen_Suppress
+
+// Size of the deflate dictionary
+constexpr int WINDOW_SIZE = 32768;
+
+constexpr int INPUT_CHUNK_SIZE = 65536;
+
+constexpr const char INDEX_SIGNATURE[] = "GDALGZI1";
+constexpr size_t INDEX_SIGNATURE_SIZE = 8;
+constexpr size_t INDEX_HEADER_SIZE = INDEX_SIGNATURE_SIZE + 5 * 8;
+constexpr size_t INDEX_POINT_SIZE = 5 * 8;
+
+constexpr const char *INDEX_EXTENSION = ".gzidx";
+
+/************************************************************************/
+/*                         Serialization helpers                        */
+/************************************************************************/
+
+static void AppendUInt64(std::vector<GByte> &abyBuffer, uint64_t nVal)
+{
+    CPL_LSBPTR64(&nVal);
+    const GByte *pabyVal = reinterpret_cast<const GByte *>(&nVal);
+    abyBuffer.insert(abyBuffer.end(), pabyVal, pabyVal + sizeof(nVal));
+}
+
+static uint64_t GetUInt64(const GByte *pabyBuffer)
+{
+    uint64_t nVal;
+    memcpy(&nVal, pabyBuffer, sizeof(nVal));
+    CPL_LSBPTR64(&nVal);
+    return nVal;
+}
+
+/************************************************************************/
+/*                            SkipGZipHeader()                          */
+/************************************************************************/
+
+// Advance pabyData after the gzip member header it points to.
+static bool SkipGZipHeader(const Bytef *&pabyData, uInt &nSize)
+{
+    constexpr int FHCRC = 0x02;
+    constexpr int FEXTRA = 0x04;
+    constexpr int FNAME = 0x08;
+    constexpr int FCOMMENT = 0x10;
+
+    if (nSize < 10 || pabyData[0] != 0x1f || pabyData[1] != 0x8b ||
+        pabyData[2] != Z_DEFLATED)
+    {
+        return false;
+    }
+    const int nFlags = pabyData[3];
+    uInt nPos = 10;
+    if (nFlags & FEXTRA)
+    {
+        if (nPos + 2 > nSize)
+            return false;
+        nPos += 2 + (pabyData[nPos] | (pabyData[nPos + 1] << 8));
+    }
+    for (const int nFlag : {FNAME, FCOMMENT})
+    {
+        if (nFlags & nFlag)
+        {
+            while (nPos < nSize && pabyData[nPos] != 0)
+                ++nPos;
+            ++nPos;
+        }
+    }
+    if (nFlags & FHCRC)
+        nPos += 2;
+    if (nPos > nSize)
+        return false;
+    pabyData += nPos;
+    nSize -= nPos;
+    return true;
+}
+
+/************************************************************************/
+/*                          GetIndexFilename()                          */
+/************************************************************************/
+
+std::string VSIGZipIndex::GetIndexFilename(const char *pszFilename)
+{
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    if (pszDirectory == nullptr || pszDirectory[0] == '\0')
+        return std::string(pszFilename).append(INDEX_EXTENSION);
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(pszFilename, strlen(pszFilename), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osIndexFilename = CPLFormFilenameSafe(
+        pszDirectory, std::string(pszHex).append(INDEX_EXTENSION).c_str(),
+        nullptr);
+    CPLFree(pszHex);
+    return osIndexFilename;
+}
+
+/************************************************************************/
+/*                       GetMemberIndexFilename()                       */
+/************************************************************************/
+
+// Indexes of members of archives can only be stored in
+// CPL_VSIL_GZIP_INDEX_DIR. Returns an empty string if it is not set.
+std::string VSIGZipIndex::GetMemberIndexFilename(const char *pszArchiveFilename,
+                                                 const char *pszMemberName)
+{
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    if (pszDirectory == nullptr || pszDirectory[0] == '\0' ||
+        !CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_USE_INDEX", "YES")))
+    {
+        return std::string();
+    }
+    std::string osKey(pszArchiveFilename);
+    osKey += '/';
+    osKey += pszMemberName;
+    return GetIndexFilename(osKey.c_str());
+}
+
+/************************************************************************/
+/*                             IsEnabled()                              */
+/************************************************************************/
+
+// Whether indexes of pszFilename must be looked for and built, according
+// to CPL_VSIL_GZIP_USE_INDEX. In the default AUTO mode, sidecar indexes are
+// not looked for next to remote files, to avoid a useless network request,
+// unless CPL_VSIL_GZIP_INDEX_DIR is set.
+bool VSIGZipIndex::IsEnabled(const char *pszFilename)
+{
+    const char *pszUseIndex =
+        CPLGetConfigOption("CPL_VSIL_GZIP_USE_INDEX", "AUTO");
+    if (!EQUAL(pszUseIndex, "AUTO"))
+        return CPLTestBool(pszUseIndex);
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    return (pszDirectory != nullptr && pszDirectory[0] != '\0') ||
+           VSIIsLocal(pszFilename);
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+std::shared_ptr<VSIGZipIndex> VSIGZipIndex::Open(const char *pszFilename)
+{
+    if (!IsEnabled(pszFilename))
+        return nullptr;
+    return OpenInternal(pszFilename, GetIndexFilename(pszFilename), 0);
+}
+
+/************************************************************************/
+/*                             OpenMember()                             */
+/************************************************************************/
+
+// Open the index of the raw deflate stream of nCompressedSize bytes at
+// nStartOffset in pszArchiveFilename, for member pszMemberName.
+std::shared_ptr<VSIGZipIndex>
+VSIGZipIndex::OpenMember(const char *pszArchiveFilename,
+                         const char *pszMemberName, vsi_l_offset nStartOffset,
+                         vsi_l_offset nCompressedSize)
+{
+    const std::string osIndexFilename =
+        GetMemberIndexFilename(pszArchiveFilename, pszMemberName);
+    if (osIndexFilename.empty() || nCompressedSize == 0)
+        return nullptr;
+    return OpenInternal(pszArchiveFilename, osIndexFilename,
+                        nStartOffset + nCompressedSize);
+}
+
+/************************************************************************/
+/*                            OpenInternal()                            */
+/************************************************************************/
+
+// nEndOffset is the end of the raw deflate stream of an archive member, or
+// 0 for a gzip file.
+std::shared_ptr<VSIGZipIndex>
+VSIGZipIndex::OpenInternal(const char *pszFilename,
+                           const std::string &osIndexFilename,
+                           vsi_l_offset nEndOffset)
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osIndexFilename.c_str(), "rb"));
+    if (!fp)
+        return nullptr;
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszFilename, &sStat) != 0)
+        return nullptr;
+
+    GByte abyHeader[INDEX_HEADER_SIZE];
+    if (fp->Read(abyHeader, sizeof(abyHeader)) != sizeof(abyHeader) ||
+        memcmp(abyHeader, INDEX_SIGNATURE, INDEX_SIGNATURE_SIZE) != 0)
+    {
+        CPLDebug("GZIP", "%s is not a valid index", osIndexFilename.c_str());
+        return nullptr;
+    }
+
+    const GByte *pabyHeader = abyHeader + INDEX_SIGNATURE_SIZE;
+    const uint64_t nCompressedSize = GetUInt64(pabyHeader);
+    const int64_t nMTime = static_cast<int64_t>(GetUInt64(pabyHeader + 8));
+    const uint64_t nUncompressedSize = GetUInt64(pabyHeader + 16);
+    const uint64_t nTableOffset = GetUInt64(pabyHeader + 24);
+    const uint64_t nPoints = GetUInt64(pabyHeader + 32);
+    if (nCompressedSize != static_cast<uint64_t>(sStat.st_size) ||
+        (nMTime != 0 && sStat.st_mtime != 0 &&
+         nMTime != static_cast<int64_t>(sStat.st_mtime)))
+    {
+        CPLDebug("GZIP", "%s is out of date", osIndexFilename.c_str());
+        return nullptr;
+    }
+    // Access points are at least separated by one byte of compressed data
+    if (nPoints == 0 || nPoints > nCompressedSize)
+        return nullptr;
+
+    std::vector<GByte> abyTable;
+    try
+    {
+        abyTable.resize(static_cast<size_t>(nPoints) * INDEX_POINT_SIZE);
+    }
+    catch (const std::exception &)
+    {
+        return nullptr;
+    }
+    if (fp->Seek(nTableOffset, SEEK_SET) != 0 ||
+        fp->Read(abyTable.data(), abyTable.size()) != abyTable.size())
+    {
+        CPLDebug("GZIP", "%s is truncated", osIndexFilename.c_str());
+        return nullptr;
+    }
+
+    auto poIndex = std::make_shared<VSIGZipIndex>();
+    poIndex->m_osFilename = pszFilename;
+    poIndex->m_osIndexFilename = osIndexFilename;
+    poIndex->m_nCompressedSize = nEndOffset ? nEndOffset : nCompressedSize;
+    poIndex->m_bRawDeflate = nEndOffset != 0;
+    poIndex->m_nUncompressedSize = nUncompressedSize;
+    poIndex->m_aoPoints.resize(static_cast<size_t>(nPoints));
+    for (size_t i = 0; i < poIndex->m_aoPoints.size(); ++i)
+    {
+        const GByte *pabyPoint = abyTable.data() + i * INDEX_POINT_SIZE;
+        AccessPoint &oPoint = poIndex->m_aoPoints[i];
+        oPoint.nUncompressedOffset = GetUInt64(pabyPoint);
+        oPoint.nCompressedOffset = GetUInt64(pabyPoint + 8);
+        oPoint.nWindowOffset = GetUInt64(pabyPoint + 16);
+        const uint64_t nVal = GetUInt64(pabyPoint + 24);
+        oPoint.nWindowSize = static_cast<uint32_t>(nVal & 0xFFFFFFFFU);
+        oPoint.nCRC = static_cast<uint32_t>(nVal >> 32);
+        oPoint.nBits = static_cast<int>(GetUInt64(pabyPoint + 32) & 7);
+        if (oPoint.nCompressedOffset > poIndex->m_nCompressedSize ||
+            oPoint.nUncompressedOffset > nUncompressedSize ||
+            (i > 0 && oPoint.nUncompressedOffset <
+                          poIndex->m_aoPoints[i - 1].nUncompressedOffset))
+        {
+            CPLDebug("GZIP", "%s is corrupted", osIndexFilename.c_str());
+            return nullptr;
+        }
+    }
+
+    CPLDebug("GZIP", "Using index %s with %u access points",
+             osIndexFilename.c_str(),
+             static_cast<unsigned>(poIndex->m_aoPoints.size()));
+    return poIndex;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+bool VSIGZipIndex::Build(const char *pszFilename)
+{
+    if (!IsEnabled(pszFilename))
+        return false;
+    return BuildInternal(pszFilename, GetIndexFilename(pszFilename), 0, 0);
+}
+
+/************************************************************************/
+/*                            BuildMember()                             */
+/************************************************************************/
+
+bool VSIGZipIndex::BuildMember(const char *pszArchiveFilename,
+                               const char *pszMemberName,
+                               vsi_l_offset nStartOffset,
+                               vsi_l_offset nCompressedSize)
+{
+    const std::string osIndexFilename =
+        GetMemberIndexFilename(pszArchiveFilename, pszMemberName);
+    if (osIndexFilename.empty() || nCompressedSize == 0)
+        return false;
+    return BuildInternal(pszArchiveFilename, osIndexFilename, nStartOffset,
+                         nCompressedSize);
+}
+
+/************************************************************************/
+/*                           BuildInternal()                            */
+/************************************************************************/
+
+// nCompressedSize is the size of the raw deflate stream of an archive member
+// starting at nStartOffset, or 0 for a gzip file.
+bool VSIGZipIndex::BuildInternal(const char *pszFilename,
+                                 const std::string &osIndexFilename,
+                                 vsi_l_offset nStartOffset,
+                                 vsi_l_offset nCompressedSize)
+{
+    const bool bRawDeflate = nCompressedSize != 0;
+    VSIStatBufL sStat;
+    if (VSIStatL(pszFilename, &sStat) != 0)
+        return false;
+    VSIVirtualHandleUniquePtr fpIn(VSIFOpenL(pszFilename, "rb"));
+    if (!fpIn || fpIn->Seek(nStartOffset, SEEK_SET) != 0)
+        return false;
+
+    GIntBig nSpacing = 0;
+    if (CPLParseMemorySize(
+            CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_SPACING", "16MB"),
+            &nSpacing, nullptr) != CE_None ||
+        nSpacing < WINDOW_SIZE)
+    {
+        nSpacing = WINDOW_SIZE;
+    }
+
+    const char *pszDirectory =
+        CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    if (pszDirectory && pszDirectory[0] != '\0')
+        VSIMkdirRecursive(pszDirectory, 0755);
+
+    // Write into a temporary file, and rename it afterwards, so that
+    // concurrent readers never see a partial index.
+    const std::string osTmpFilename =
+        osIndexFilename + CPLSPrintf(".tmp.%d", CPLGetCurrentProcessID());
+    VSIVirtualHandleUniquePtr fpOut;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        fpOut.reset(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+    }
+    if (!fpOut)
+    {
+        CPLDebug("GZIP", "Cannot create %s", osTmpFilename.c_str());
+        return false;
+    }
+
+    CPLDebug("GZIP", "Building index %s", osIndexFilename.c_str());
+
+    std::vector<GByte> abyHeader(INDEX_HEADER_SIZE);
+    bool bOK = fpOut->Write(abyHeader.data(), abyHeader.size()) ==
+               abyHeader.size();
+    vsi_l_offset nOffsetInIndex = abyHeader.size();
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    // 15 + 32: automatic detection of the gzip header
+    if (inflateInit2(&sStream, bRawDeflate ? -MAX_WBITS : 15 + 32) != Z_OK)
+    {
+        fpOut.reset();
+        VSIUnlink(osTmpFilename.c_str());
+        return false;
+    }
+
+    std::vector<AccessPoint> aoPoints;
+    std::vector<GByte> abyIn(INPUT_CHUNK_SIZE);
+    std::vector<GByte> abyWindow(WINDOW_SIZE);
+    std::vector<GByte> abyPointWindow(WINDOW_SIZE);
+    std::vector<GByte> abyCompressedWindow(compressBound(WINDOW_SIZE));
+    vsi_l_offset nTotalIn = nStartOffset;
+    vsi_l_offset nTotalOut = 0;
+    vsi_l_offset nLastPointOut = 0;
+    uLong nCRC = crc32(0, nullptr, 0);
+    while (bOK)
+    {
+        if (sStream.avail_in == 0)
+        {
+            size_t nToRead = abyIn.size();
+            if (bRawDeflate)
+                nToRead = static_cast<size_t>(std::min<vsi_l_offset>(
+                    nToRead, nStartOffset + nCompressedSize - nTotalIn));
+            sStream.avail_in =
+                static_cast<uInt>(fpIn->Read(abyIn.data(), nToRead));
+            if (sStream.avail_in == 0)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "%s: unexpected end of file", pszFilename);
+                bOK = false;
+                break;
+            }
+            sStream.next_in = abyIn.data();
+        }
+        if (sStream.avail_out == 0)
+        {
+            sStream.avail_out = WINDOW_SIZE;
+            sStream.next_out = abyWindow.data();
+        }
+
+        // Stop at the end of each deflate block, which are the only
+        // locations where decompression can be resumed.
+        const Bytef *pabyOutBefore = sStream.next_out;
+        nTotalIn += sStream.avail_in;
+        nTotalOut += sStream.avail_out;
+        const int nRet = inflate(&sStream, Z_BLOCK);
+        nTotalIn -= sStream.avail_in;
+        nTotalOut -= sStream.avail_out;
+        nCRC = crc32(nCRC, pabyOutBefore,
+                     static_cast<uInt>(sStream.next_out - pabyOutBefore));
+        if (nRet != Z_OK && nRet != Z_STREAM_END)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "%s: decompression failed with error %d", pszFilename,
+                     nRet);
+            bOK = false;
+            break;
+        }
+
+        if (nRet == Z_STREAM_END)
+        {
+            if (bRawDeflate)
+                break;
+            // Look for another gzip member
+            if (sStream.avail_in == 0)
+            {
+                sStream.avail_in = static_cast<uInt>(
+                    fpIn->Read(abyIn.data(), abyIn.size()));
+                sStream.next_in = abyIn.data();
+            }
+            if (sStream.avail_in == 0 || sStream.next_in[0] != 0x1f)
+                break;
+            inflateReset(&sStream);
+            nCRC = crc32(0, nullptr, 0);
+            continue;
+        }
+
+        if ((sStream.data_type & 128) != 0 && (sStream.data_type & 64) == 0 &&
+            (nTotalOut == 0 ||
+             nTotalOut - nLastPointOut >= static_cast<vsi_l_offset>(nSpacing)))
+        {
+            // Copy the circular window in order
+            const uInt nLeft = sStream.avail_out;
+            if (nLeft)
+                memcpy(abyPointWindow.data(),
+                       abyWindow.data() + WINDOW_SIZE - nLeft, nLeft);
+            if (nLeft < WINDOW_SIZE)
+                memcpy(abyPointWindow.data() + nLeft, abyWindow.data(),
+                       WINDOW_SIZE - nLeft);
+
+            uLongf nCompressedWindowSize =
+                static_cast<uLongf>(abyCompressedWindow.size());
+            if (compress2(abyCompressedWindow.data(), &nCompressedWindowSize,
+                          abyPointWindow.data(), WINDOW_SIZE,
+                          Z_BEST_SPEED) != Z_OK)
+            {
+                bOK = false;
+                break;
+            }
+
+            AccessPoint oPoint;
+            oPoint.nUncompressedOffset = nTotalOut;
+            oPoint.nCompressedOffset = nTotalIn;
+            oPoint.nBits = sStream.data_type & 7;
+            oPoint.nCRC = static_cast<uint32_t>(nCRC);
+            oPoint.nWindowOffset = nOffsetInIndex;
+            oPoint.nWindowSize = static_cast<uint32_t>(nCompressedWindowSize);
+            bOK = fpOut->Write(abyCompressedWindow.data(),
+                               nCompressedWindowSize) == nCompressedWindowSize;
+            nOffsetInIndex += nCompressedWindowSize;
+            aoPoints.push_back(oPoint);
+            nLastPointOut = nTotalOut;
+        }
+    }
+    inflateEnd(&sStream);
+
+    if (bOK)
+    {
+        std::vector<GByte> abyTable;
+        for (const auto &oPoint : aoPoints)
+        {
+            AppendUInt64(abyTable, oPoint.nUncompressedOffset);
+            AppendUInt64(abyTable, oPoint.nCompressedOffset);
+            AppendUInt64(abyTable, oPoint.nWindowOffset);
+            AppendUInt64(abyTable, (static_cast<uint64_t>(oPoint.nCRC) << 32) |
+                                       oPoint.nWindowSize);
+            AppendUInt64(abyTable, static_cast<uint64_t>(oPoint.nBits));
+        }
+        bOK = fpOut->Write(abyTable.data(), abyTable.size()) ==
+              abyTable.size();
+
+        abyHeader.clear();
+        abyHeader.insert(abyHeader.end(), INDEX_SIGNATURE,
+                         INDEX_SIGNATURE + INDEX_SIGNATURE_SIZE);
+        AppendUInt64(abyHeader, static_cast<uint64_t>(sStat.st_size));
+        AppendUInt64(abyHeader, static_cast<uint64_t>(sStat.st_mtime));
+        AppendUInt64(abyHeader, nTotalOut);
+        AppendUInt64(abyHeader, nOffsetInIndex);
+        AppendUInt64(abyHeader, aoPoints.size());
+        bOK = bOK && fpOut->Seek(0, SEEK_SET) == 0 &&
+              fpOut->Write(abyHeader.data(), abyHeader.size()) ==
+                  abyHeader.size();
+    }
+    bOK = fpOut->Close() == 0 && bOK;
+    fpOut.reset();
+    if (!bOK ||
+        VSIRename(osTmpFilename.c_str(), osIndexFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           GetAccessPoint()                           */
+/************************************************************************/
+
+// Return the last access point at or before nUncompressedOffset
+const VSIGZipIndex::AccessPoint *
+VSIGZipIndex::GetAccessPoint(vsi_l_offset nUncompressedOffset) const
+{
+    auto oIter = std::upper_bound(
+        m_aoPoints.begin(), m_aoPoints.end(), nUncompressedOffset,
+        [](vsi_l_offset nOffset, const AccessPoint &oPoint)
+        { return nOffset < oPoint.nUncompressedOffset; });
+    if (oIter == m_aoPoints.begin())
+        return nullptr;
+    --oIter;
+    return &(*oIter);
+}
+
+/************************************************************************/
+/*                             ReadWindow()                             */
+/************************************************************************/
+
+bool VSIGZipIndex::ReadWindow(const AccessPoint &oPoint,
+                              std::vector<GByte> &abyWindow) const
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osIndexFilename.c_str(), "rb"));
+    if (!fp)
+        return false;
+    std::vector<GByte> abyCompressed(oPoint.nWindowSize);
+    if (fp->Seek(oPoint.nWindowOffset, SEEK_SET) != 0 ||
+        fp->Read(abyCompressed.data(), abyCompressed.size()) !=
+            abyCompressed.size())
+    {
+        return false;
+    }
+    abyWindow.resize(WINDOW_SIZE);
+    uLongf nWindowSize = WINDOW_SIZE;
+    return uncompress(abyWindow.data(), &nWindowSize, abyCompressed.data(),
+                      static_cast<uLong>(abyCompressed.size())) == Z_OK &&
+           nWindowSize == WINDOW_SIZE;
+}
+
+/************************************************************************/
+/*                             InitStream()                             */
+/************************************************************************/
+
+// Prepare psStream, a raw inflate stream, and poBaseHandle, the gzip file,
+// to resume decompression at oPoint.
+bool VSIGZipIndex::InitStream(const AccessPoint &oPoint, z_stream *psStream,
+                              VSIVirtualHandle *poBaseHandle) const
+{
+    std::vector<GByte> abyWindow;
+    if (!ReadWindow(oPoint, abyWindow))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot read index %s",
+                 m_osIndexFilename.c_str());
+        return false;
+    }
+
+    if (inflateReset(psStream) != Z_OK)
+        return false;
+    if (oPoint.nBits)
+    {
+        GByte byVal = 0;
+        if (poBaseHandle->Seek(oPoint.nCompressedOffset - 1, SEEK_SET) != 0 ||
+            poBaseHandle->Read(&byVal, 1) != 1)
+        {
+            return false;
+        }
+        inflatePrime(psStream, oPoint.nBits, byVal >> (8 - oPoint.nBits));
+    }
+    else if (poBaseHandle->Seek(oPoint.nCompressedOffset, SEEK_SET) != 0)
+    {
+        return false;
+    }
+    return inflateSetDictionary(psStream, abyWindow.data(), WINDOW_SIZE) ==
+           Z_OK;
+}
+
+/************************************************************************/
+/*                         DecompressSegment()                          */
+/************************************************************************/
+
+// Decompress nSize bytes at uncompressed offset nOffset, located between the
+// access point of index iPoint and the next one.
+bool VSIGZipIndex::DecompressSegment(size_t iPoint, vsi_l_offset nOffset,
+                                     size_t nSize, GByte *pabyBuffer) const
+{
+    const AccessPoint &oPoint = m_aoPoints[iPoint];
+    const vsi_l_offset nStartCompressed =
+        oPoint.nCompressedOffset - (oPoint.nBits ? 1 : 0);
+    const vsi_l_offset nEndCompressed =
+        iPoint + 1 < m_aoPoints.size()
+            ? std::min(m_nCompressedSize,
+                       m_aoPoints[iPoint + 1].nCompressedOffset + 1)
+            : m_nCompressedSize;
+    if (nEndCompressed - nStartCompressed >
+        static_cast<vsi_l_offset>(std::numeric_limits<uInt>::max()))
+    {
+        return false;
+    }
+
+    std::vector<GByte> abyWindow;
+    std::vector<GByte> abyIn;
+    try
+    {
+        abyIn.resize(static_cast<size_t>(nEndCompressed - nStartCompressed));
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+    {
+        VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osFilename.c_str(), "rb"));
+        if (!fp || fp->Seek(nStartCompressed, SEEK_SET) != 0 ||
+            fp->Read(abyIn.data(), abyIn.size()) != abyIn.size() ||
+            !ReadWindow(oPoint, abyWindow))
+        {
+            return false;
+        }
+    }
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return false;
+    const Bytef *pabyIn = abyIn.data();
+    uInt nAvailIn = static_cast<uInt>(abyIn.size());
+    if (oPoint.nBits)
+    {
+        inflatePrime(&sStream, oPoint.nBits, pabyIn[0] >> (8 - oPoint.nBits));
+        ++pabyIn;
+        --nAvailIn;
+    }
+    bool bOK =
+        inflateSetDictionary(&sStream, abyWindow.data(), WINDOW_SIZE) == Z_OK;
+
+    // abyWindow is reused as a scratch buffer for the data to skip
+    vsi_l_offset nToSkip = nOffset - oPoint.nUncompressedOffset;
+    size_t nDone = 0;
+    while (bOK && (nToSkip > 0 || nDone < nSize))
+    {
+        sStream.next_in = const_cast<Bytef *>(pabyIn);
+        sStream.avail_in = nAvailIn;
+        uInt nAvailOut;
+        if (nToSkip > 0)
+        {
+            nAvailOut = static_cast<uInt>(
+                std::min<vsi_l_offset>(nToSkip, abyWindow.size()));
+            sStream.next_out = abyWindow.data();
+        }
+        else
+        {
+            nAvailOut = static_cast<uInt>(std::min<size_t>(
+                nSize - nDone, std::numeric_limits<uInt>::max()));
+            sStream.next_out = pabyBuffer + nDone;
+        }
+        sStream.avail_out = nAvailOut;
+        const int nRet = inflate(&sStream, Z_NO_FLUSH);
+        pabyIn = sStream.next_in;
+        nAvailIn = sStream.avail_in;
+        const uInt nProduced = nAvailOut - sStream.avail_out;
+        if (nToSkip > 0)
+            nToSkip -= nProduced;
+        else
+            nDone += nProduced;
+
+        if (nRet == Z_STREAM_END && m_bRawDeflate)
+        {
+            bOK = nToSkip == 0 && nDone == nSize;
+            break;
+        }
+        else if (nRet == Z_STREAM_END)
+        {
+            // Nothing more is needed, in particular when this was the last
+            // gzip member of the file.
+            if (nToSkip == 0 && nDone == nSize)
+                break;
+            // Skip the CRC32 and ISIZE of the gzip member, and the header
+            // of the next one.
+            if (nAvailIn < 8)
+            {
+                bOK = false;
+                break;
+            }
+            pabyIn += 8;
+            nAvailIn -= 8;
+            bOK = SkipGZipHeader(pabyIn, nAvailIn) &&
+                  inflateReset(&sStream) == Z_OK;
+        }
+        else if (nRet != Z_OK)
+        {
+            bOK = false;
+        }
+    }
+    inflateEnd(&sStream);
+    return bOK;
+}
+
+/************************************************************************/
+/*                            ReadParallel()                            */
+/************************************************************************/
+
+// Decompress nSize bytes at uncompressed offset nOffset into pBuffer, with
+// the spans between consecutive access points handled by different threads.
+// Returns false if the range does not span several access points, in which
+// case nothing is gained by parallelism.
+bool VSIGZipIndex::ReadParallel(vsi_l_offset nOffset, size_t nSize,
+                                void *pBuffer, int nThreads) const
+{
+    if (nThreads <= 1 || nSize == 0 || nOffset + nSize > m_nUncompressedSize)
+        return false;
+    const AccessPoint *psFirstPoint = GetAccessPoint(nOffset);
+    if (psFirstPoint == nullptr)
+        return false;
+
+    struct Segment
+    {
+        size_t iPoint;
+        vsi_l_offset nOffset;
+        size_t nSize;
+    };
+
+    std::vector<Segment> aoSegments;
+    const vsi_l_offset nEndOffset = nOffset + nSize;
+    for (size_t i = psFirstPoint - m_aoPoints.data();
+         i < m_aoPoints.size() &&
+         m_aoPoints[i].nUncompressedOffset < nEndOffset;
+         ++i)
+    {
+        const vsi_l_offset nSegmentStart =
+            std::max(nOffset, m_aoPoints[i].nUncompressedOffset);
+        const vsi_l_offset nSegmentEnd =
+            i + 1 < m_aoPoints.size()
+                ? std::min(nEndOffset, m_aoPoints[i + 1].nUncompressedOffset)
+                : nEndOffset;
+        if (nSegmentEnd > nSegmentStart)
+        {
+            aoSegments.push_back(
+                {i, nSegmentStart,
+                 static_cast<size_t>(nSegmentEnd - nSegmentStart)});
+        }
+    }
+    if (aoSegments.size() < 2)
+        return false;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return false;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    std::atomic<bool> bOK{true};
+    for (const auto &oSegment : aoSegments)
+    {
+        GByte *pabyDest =
+            static_cast<GByte *>(pBuffer) + (oSegment.nOffset - nOffset);
+        if (!poJobQueue->SubmitJob(
+                [this, &bOK, oSegment, pabyDest]()
+                {
+                    if (bOK && !DecompressSegment(oSegment.iPoint,
+                                                  oSegment.nOffset,
+                                                  oSegment.nSize, pabyDest))
+                    {
+                        bOK = false;
+                    }
+                }))
+        {
+            bOK = false;
+            break;
+        }
+    }
+    poJobQueue->WaitCompletion();
+
+    if (!bOK)
+    {
+        CPLDebug("GZIP",
+                 "Parallel decompression of %s failed. "
+                 "Falling back to sequential decompression",
+                 m_osFilename.c_str());
+    }
+    return bOK;
+}
+
+//! @endcond
@@ -0,0 +1,122 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent random-access index of /vsigzip/ files
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef CPL_VSIL_GZIP_INDEX_H_INCLUDED
+#define CPL_VSIL_GZIP_INDEX_H_INCLUDED
+
+#include "cpl_port.h"
+#include "cpl_vsi.h"
+
+#include "cpl_zlib_header.h"  // to avoid warnings when including zlib.h
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                             VSIGZipIndex                             */
+/************************************************************************/
+
+/** Index of access points of a gzip file, from which decompression can be
+ * restarted without decompressing the preceding data.
+ *
+ * This is the approach of zran.c from the zlib examples: at the end of
+ * deflate blocks spaced by CPL_VSIL_GZIP_INDEX_SPACING uncompressed bytes, the
+ * compressed and uncompressed offsets are recorded, together with the 32 KB of
+ * uncompressed data that precede them, which is the dictionary needed to
+ * resume decompression. The index is stored in a file, either next to the
+ * gzip file or in CPL_VSIL_GZIP_INDEX_DIR, so that it can be reused by later
+ * opens, including by other processes.
+ *
+ * Raw deflate streams of members of ZIP archives can also be indexed, in
+ * which case the index is stored in CPL_VSIL_GZIP_INDEX_DIR.
+ */
+class VSIGZipIndex
+{
+  public:
+    struct AccessPoint
+    {
+        vsi_l_offset nUncompressedOffset = 0;
+        // Offset of the first byte of the compressed data that has not been
+        // fully consumed.
+        vsi_l_offset nCompressedOffset = 0;
+        // Number of bits of the byte before nCompressedOffset that are
+        // still to be consumed (0 to 7).
+        int nBits = 0;
+        // CRC32 of the data of the current gzip member before this point.
+        uint32_t nCRC = 0;
+        // Location of the deflate-compressed dictionary in the index file.
+        vsi_l_offset nWindowOffset = 0;
+        uint32_t nWindowSize = 0;
+    };
+
+  private:
+    std::string m_osFilename{};
+    std::string m_osIndexFilename{};
+    // End offset of the compressed data in m_osFilename
+    vsi_l_offset m_nCompressedSize = 0;
+    vsi_l_offset m_nUncompressedSize = 0;
+    // Whether this indexes a raw deflate stream (member of an archive)
+    // rather than a gzip file
+    bool m_bRawDeflate = false;
+    std::vector<AccessPoint> m_aoPoints{};
+
+    static std::string GetMemberIndexFilename(const char *pszArchiveFilename,
+                                              const char *pszMemberName);
+    static std::shared_ptr<VSIGZipIndex>
+    OpenInternal(const char *pszFilename, const std::string &osIndexFilename,
+                 vsi_l_offset nEndOffset);
+    static bool BuildInternal(const char *pszFilename,
+                              const std::string &osIndexFilename,
+                              vsi_l_offset nStartOffset,
+                              vsi_l_offset nCompressedSize);
+
+    bool ReadWindow(const AccessPoint &oPoint,
+                    std::vector<GByte> &abyWindow) const;
+    bool DecompressSegment(size_t iPoint, vsi_l_offset nOffset, size_t nSize,
+                           GByte *pabyBuffer) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(VSIGZipIndex)
+
+  public:
+    VSIGZipIndex() = default;
+
+    static std::string GetIndexFilename(const char *pszFilename);
+    static bool IsEnabled(const char *pszFilename);
+    static std::shared_ptr<VSIGZipIndex> Open(const char *pszFilename);
+    static bool Build(const char *pszFilename);
+
+    static std::shared_ptr<VSIGZipIndex>
+    OpenMember(const char *pszArchiveFilename, const char *pszMemberName,
+               vsi_l_offset nStartOffset, vsi_l_offset nCompressedSize);
+    static bool BuildMember(const char *pszArchiveFilename,
+                            const char *pszMemberName,
+                            vsi_l_offset nStartOffset,
+                            vsi_l_offset nCompressedSize);
+
+    vsi_l_offset GetUncompressedSize() const
+    {
+        return m_nUncompressedSize;
+    }
+
+    const AccessPoint *GetAccessPoint(vsi_l_offset nUncompressedOffset) const;
+    bool InitStream(const AccessPoint &oPoint, z_stream *psStream,
+                    VSIVirtualHandle *poBaseHandle) const;
+    bool ReadParallel(vsi_l_offset nOffset, size_t nSize, void *pBuffer,
+                      int nThreads) const;
+};
+
+//! @endcond
+
+#endif  // CPL_VSIL_GZIP_INDEX_H_INCLUDED
@@ -911,7 +911,69 @@ VSIMultipartWriteHandle::VSIMultipartWriteHandle(
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Cannot allocate working buffer for %s",
                  m_poFS->GetFSPrefix().c_str());
+        return;
+    }
+
+    const std::string osNumThreads =
+        m_aosOptions.FetchNameValueDef("NUM_THREADS", "");
+    const std::string osMaxMemory =
+        m_aosOptions.FetchNameValueDef("MAX_MEMORY", "");
+    // Those are not HTTP headers to send
+    m_aosOptions.SetNameValue("NUM_THREADS", nullptr);
+    m_aosOptions.SetNameValue("MAX_MEMORY", nullptr);
+
+#if !defined(CPL_MULTIPROC_STUB)
+    // Parts can be uploaded in the background by worker threads, while the
+    // caller fills the next one. Each part in flight holds its own buffer,
+    // so their number is bounded by the MAX_MEMORY setting.
+    const char *pszNumThreads =
+        !osNumThreads.empty()
+            ? osNumThreads.c_str()
+            : VSIGetPathSpecificOption(pszFilename,
+                                       "CPL_VSIL_UPLOAD_NUM_THREADS", "1");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : std::max(1, atoi(pszNumThreads));
+    if (nThreads > 1)
+    {
+        GIntBig nMaxBuffers = static_cast<GIntBig>(nThreads) + 1;
+        const char *pszMaxMemory =
+            !osMaxMemory.empty()
+                ? osMaxMemory.c_str()
+                : VSIGetPathSpecificOption(
+                      pszFilename, "CPL_VSIL_UPLOAD_MAX_MEMORY", nullptr);
+        if (pszMaxMemory)
+        {
+            GIntBig nMaxMemory = 0;
+            if (CPLParseMemorySize(pszMaxMemory, &nMaxMemory, nullptr) ==
+                CE_None)
+            {
+                nMaxBuffers = std::min(
+                    nMaxBuffers,
+                    nMaxMemory / static_cast<GIntBig>(m_nBufferSize));
+            }
+            else
+            {
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Invalid value for MAX_MEMORY: %s", pszMaxMemory);
+            }
+        }
+        if (nMaxBuffers >= 2)
+        {
+            m_nMaxBuffers = static_cast<int>(nMaxBuffers);
+            m_nMaxParallelUploads = m_nMaxBuffers - 1;
+            m_aosThreadLocalConfigOptions.Assign(
+                CPLGetThreadLocalConfigOptions(), true);
+        }
+        else
+        {
+            CPLDebug(m_poFS->GetDebugKey(),
+                     "MAX_MEMORY does not allow for 2 buffers of %u bytes. "
+                     "Parts will be uploaded sequentially",
+                     static_cast<unsigned>(m_nBufferSize));
+        }
     }
+#endif
 }
 
 /************************************************************************/
@@ -982,8 +1044,11 @@ size_t IVSIS3LikeFSHandlerWithMultipartUpload::GetUploadChunkSizeInBytes(
 VSIMultipartWriteHandle::~VSIMultipartWriteHandle()
 {
     VSIMultipartWriteHandle::Close();
+    m_poThreadPool.reset();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     CPLFree(m_sWriteFuncHeaderData.pBuffer);
 }
 
@@ -1151,6 +1216,11 @@ bool VSIMultipartWriteHandle::UploadPart()
                  m_poFS->GetDebugKey());
         return false;
     }
+    if (m_nMaxParallelUploads > 1)
+    {
+        // At the end of the file, there is no need for a new buffer
+        return SubmitPartUpload(/* bAcquireNextBuffer = */ !m_bClosed);
+    }
     const std::string osEtag = m_poFS->UploadPart(
         m_osFilename, m_nPartNumber, m_osUploadID,
         static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
@@ -1164,6 +1234,160 @@ bool VSIMultipartWriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                          SubmitPartUpload()                          */
+/************************************************************************/
+
+/** Queue the upload of the current buffer as part m_nPartNumber, and, if
+ * bAcquireNextBuffer is set, make m_pabyBuffer point to a free buffer,
+ * waiting for the upload of a previous part to complete if the maximum
+ * number of buffers has been reached.
+ */
+bool VSIMultipartWriteHandle::SubmitPartUpload(bool bAcquireNextBuffer)
+{
+    if (!m_poThreadPool)
+    {
+        auto poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poThreadPool->Setup(m_nMaxParallelUploads, nullptr, nullptr))
+        {
+            m_bError = true;
+            return false;
+        }
+        m_poThreadPool = std::move(poThreadPool);
+    }
+
+    const int nPartNumber = m_nPartNumber;
+    GByte *pabyBuffer = m_pabyBuffer;
+    const size_t nSize = m_nBufferOff;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        if (m_bUploadError)
+        {
+            ReplayUploadErrors();
+            m_bError = true;
+            return false;
+        }
+        if (static_cast<size_t>(nPartNumber) > m_aosEtags.size())
+            m_aosEtags.resize(nPartNumber);
+        ++m_nPendingUploads;
+    }
+    m_pabyBuffer = nullptr;
+    m_nBufferOff = 0;
+    m_poThreadPool->SubmitJob(
+        [this, nPartNumber, pabyBuffer, nSize]()
+        { UploadPartJob(nPartNumber, pabyBuffer, nSize); });
+
+    if (!bAcquireNextBuffer)
+        return true;
+
+    std::unique_lock<std::mutex> oLock(m_oMutex);
+    while (!m_bUploadError && m_apabyFreeBuffers.empty() &&
+           m_nAllocatedBuffers >= m_nMaxBuffers)
+    {
+        m_oCond.wait(oLock);
+    }
+    if (m_bUploadError)
+    {
+        oLock.unlock();
+        ReplayUploadErrors();
+        m_bError = true;
+        return false;
+    }
+    if (!m_apabyFreeBuffers.empty())
+    {
+        m_pabyBuffer = m_apabyFreeBuffers.back();
+        m_apabyFreeBuffers.pop_back();
+    }
+    else
+    {
+        m_pabyBuffer = static_cast<GByte *>(VSI_MALLOC_VERBOSE(m_nBufferSize));
+        if (m_pabyBuffer == nullptr)
+        {
+            m_bError = true;
+            return false;
+        }
+        ++m_nAllocatedBuffers;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           UploadPartJob()                            */
+/************************************************************************/
+
+/** Upload a part from a worker thread. */
+void VSIMultipartWriteHandle::UploadPartJob(int nPartNumber, GByte *pabyBuffer,
+                                            size_t nSize)
+{
+    std::string osEtag;
+    // Do not bother uploading remaining parts once one has failed, as the
+    // upload will be aborted.
+    if (!m_bUploadError)
+    {
+        // Make thread-local configuration options of the thread that opened
+        // the file, such as credentials, visible from the worker thread.
+        const CPLStringList aosTLConfigOptionsBackup(
+            CPLGetThreadLocalConfigOptions());
+        CPLSetThreadLocalConfigOptions(m_aosThreadLocalConfigOptions.List());
+        {
+            auto oAccumulatorContext =
+                m_oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulatorContext);
+            // MultipartUploadAddPart() uses its own handle helper, as
+            // m_poS3HandleHelper cannot be shared between threads.
+            char *pszEtag = m_poFS->MultipartUploadAddPart(
+                m_osFilename.c_str(), m_osUploadID.c_str(), nPartNumber,
+                static_cast<vsi_l_offset>(m_nBufferSize) * (nPartNumber - 1),
+                pabyBuffer, nSize, nullptr);
+            if (pszEtag)
+                osEtag = pszEtag;
+            CPLFree(pszEtag);
+        }
+        CPLSetThreadLocalConfigOptions(aosTLConfigOptionsBackup.List());
+    }
+
+    std::lock_guard<std::mutex> oLock(m_oMutex);
+    if (osEtag.empty())
+        m_bUploadError = true;
+    else
+        m_aosEtags[nPartNumber - 1] = std::move(osEtag);
+    m_apabyFreeBuffers.push_back(pabyBuffer);
+    --m_nPendingUploads;
+    m_oCond.notify_one();
+}
+
+/************************************************************************/
+/*                       WaitForPendingUploads()                        */
+/************************************************************************/
+
+bool VSIMultipartWriteHandle::WaitForPendingUploads()
+{
+    if (!m_poThreadPool)
+        return true;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        while (m_nPendingUploads > 0)
+            m_oCond.wait(oLock);
+    }
+    ReplayUploadErrors();
+    return !m_bUploadError;
+}
+
+/************************************************************************/
+/*                         ReplayUploadErrors()                         */
+/************************************************************************/
+
+/** Emit, from the calling thread, the errors and warnings that occurred in
+ * worker threads. */
+void VSIMultipartWriteHandle::ReplayUploadErrors()
+{
+    if (!m_bErrorsReplayed)
+    {
+        m_bErrorsReplayed = true;
+        m_oErrorAccumulator.ReplayErrors();
+    }
+}
+
 std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
     const std::string &osFilename, int nPartNumber,
     const std::string &osUploadID, vsi_l_offset /* nPosition */,
@@ -1212,7 +1436,11 @@ std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
         const long response_code =
             requestHelper.perform(hCurlHandle, headers, this, poS3HandleHelper);
 
-        NetworkStatisticsLogger::LogPUT(nBufferSize);
+        double dfElapsedSec = -1;
+        if (curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME,
+                              &dfElapsedSec) != CURLE_OK)
+            dfElapsedSec = -1;
+        NetworkStatisticsLogger::LogPUT(nBufferSize, dfElapsedSec);
 
         if (response_code != 200 ||
             requestHelper.sWriteFuncHeaderData.pBuffer == nullptr)
@@ -1861,6 +2089,13 @@ int VSIMultipartWriteHandle::Close()
         }
         else
         {
+            if (!m_bError && m_nBufferOff > 0 && !UploadPart())
+                nRet = -1;
+            if (!WaitForPendingUploads())
+            {
+                m_bError = true;
+                nRet = -1;
+            }
             if (m_bError)
             {
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
@@ -1868,16 +2103,18 @@ int VSIMultipartWriteHandle::Close()
                                             m_oRetryParameters))
                     nRet = -1;
             }
-            else if (m_nBufferOff > 0 && !UploadPart())
-                nRet = -1;
-            else if (m_poFS->CompleteMultipart(
-                         m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
-                         m_poS3HandleHelper, m_oRetryParameters))
+            else if (nRet == 0)
             {
-                InvalidateParentDirectory();
+                if (m_poFS->CompleteMultipart(m_osFilename, m_osUploadID,
+                                              m_aosEtags, m_nCurOffset,
+                                              m_poS3HandleHelper,
+                                              m_oRetryParameters))
+                {
+                    InvalidateParentDirectory();
+                }
+                else
+                    nRet = -1;
             }
-            else
-                nRet = -1;
         }
     }
     return nRet;
@@ -509,6 +509,14 @@ class VSITarFilesystemHandler final : public VSIArchiveFilesystemHandler
     std::unique_ptr<VSIArchiveReader>
     CreateReader(const char *pszTarFileName) override;
 
+  protected:
+    bool SerializeFileOffset(const VSIArchiveEntryFileOffset *poOffset,
+                             GUIntBig &nValue1,
+                             GUIntBig &nValue2) const override;
+    std::unique_ptr<VSIArchiveEntryFileOffset>
+    DeserializeFileOffset(GUIntBig nValue1, GUIntBig nValue2) const override;
+
+  public:
     VSIVirtualHandleUniquePtr Open(const char *pszFilename,
                                    const char *pszAccess, bool bSetError,
                                    CSLConstList /* papszOptions */) override;
@@ -527,6 +535,37 @@ std::vector<CPLString> VSITarFilesystemHandler::GetExtensions() const
     return oList;
 }
 
+/************************************************************************/
+/*                        SerializeFileOffset()                         */
+/************************************************************************/
+
+bool VSITarFilesystemHandler::SerializeFileOffset(
+    const VSIArchiveEntryFileOffset *poOffset, GUIntBig &nValue1,
+    GUIntBig &nValue2) const
+{
+    const auto poTarOffset =
+        static_cast<const VSITarEntryFileOffset *>(poOffset);
+#ifdef HAVE_FUZZER_FRIENDLY_ARCHIVE
+    // Entries of fuzzer friendly archives also need their name and size
+    if (!poTarOffset->m_osFileName.empty())
+        return false;
+#endif
+    nValue1 = poTarOffset->m_nOffset;
+    nValue2 = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                       DeserializeFileOffset()                        */
+/************************************************************************/
+
+std::unique_ptr<VSIArchiveEntryFileOffset>
+VSITarFilesystemHandler::DeserializeFileOffset(GUIntBig nValue1,
+                                               GUIntBig /* nValue2 */) const
+{
+    return std::make_unique<VSITarEntryFileOffset>(nValue1);
+}
+
 /************************************************************************/
 /*                            CreateReader()                            */
 /************************************************************************/
@@ -80,10 +80,20 @@
 #include "cpl_config.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#ifdef HAVE_LINUX_IO_URING_H
+#include "cpl_io_uring.h"
+#endif
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi_error.h"
 
+#if defined(HAVE_PREAD64) || (defined(HAVE_PREAD_BSD) && SIZEOF_OFF_T == 8)
+#define HAS_POSITIONAL_IO
+#if defined(__linux) && defined(O_DIRECT)
+#define HAS_DIRECT_IO
+#endif
+#endif
+
 #if defined(UNIX_STDIO_64)
 
 #ifndef VSI_OPEN64
@@ -258,6 +268,12 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
 #else
     std::string m_osTmpFilename{};
 #endif
+#ifdef HAS_DIRECT_IO
+    // Descriptor opened with O_DIRECT by ReadMultiRange() when
+    // CPL_VSIL_LOCAL_DIRECT_IO is set
+    int m_fdDirect = -1;
+    bool m_bDirectIOFailed = false;
+#endif
 
   public:
     VSIUnixStdioHandle(VSIUnixStdioFilesystemHandler *poFSIn, int fdIn,
@@ -288,6 +304,34 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
                  vsi_l_offset /*nOffset*/) const override;
 #endif
 
+#ifdef HAS_POSITIONAL_IO
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+    std::unique_ptr<VSIAsyncBatch>
+    SubmitReadBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                    VSIAsyncCompletionFunc pfnCompletion,
+                    void *pCompletionUserData) override;
+    std::unique_ptr<VSIAsyncBatch>
+    SubmitWriteBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                     VSIAsyncCompletionFunc pfnCompletion,
+                     void *pCompletionUserData) override;
+
+  private:
+#ifdef HAS_DIRECT_IO
+    bool ReadMultiRangeDirect(int nRanges, void **ppData,
+                              const vsi_l_offset *panOffsets,
+                              const size_t *panSizes);
+#endif
+    bool SyncForPositionalIO(bool bWrite);
+    std::unique_ptr<VSIAsyncBatch>
+    SubmitBatch(bool bWrite, int nRequests, VSIAsyncRequest *pasRequests,
+                VSIAsyncCompletionFunc pfnCompletion,
+                void *pCompletionUserData);
+
+  public:
+#endif
+
     void CancelCreation() override;
 };
 
@@ -360,6 +404,14 @@ int VSIUnixStdioHandle::Close()
     if (ret == 0 && ret2 != 0)
         ret = ret2;
 
+#ifdef HAS_DIRECT_IO
+    if (m_fdDirect >= 0)
+    {
+        close(m_fdDirect);
+        m_fdDirect = -1;
+    }
+#endif
+
 #if !defined(__linux)
     if (!m_osTmpFilename.empty() && !m_osFilename.empty())
     {
@@ -900,6 +952,349 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
 }
 #endif
 
+#ifdef HAS_POSITIONAL_IO
+
+/************************************************************************/
+/*                          TransferFullyAt()                           */
+/************************************************************************/
+
+// Service a read or write request with pread()/pwrite(). A read of less
+// than psRequest->nSize bytes without error means that the end of file was
+// reached.
+static size_t TransferFullyAt(int fd, bool bWrite,
+                              const VSIAsyncRequest *psRequest, bool &bError)
+{
+    GByte *pabyBuffer = static_cast<GByte *>(psRequest->pBuffer);
+    size_t nTransferred = 0;
+    bError = false;
+    while (nTransferred < psRequest->nSize)
+    {
+        const vsi_l_offset nOffset = psRequest->nOffset + nTransferred;
+        const size_t nToTransfer = psRequest->nSize - nTransferred;
+#ifdef HAVE_PREAD64
+        const ssize_t nRet =
+            bWrite
+                ? pwrite64(fd, pabyBuffer + nTransferred, nToTransfer, nOffset)
+                : pread64(fd, pabyBuffer + nTransferred, nToTransfer, nOffset);
+#else
+        const ssize_t nRet =
+            bWrite ? pwrite(fd, pabyBuffer + nTransferred, nToTransfer,
+                            static_cast<off_t>(nOffset))
+                   : pread(fd, pabyBuffer + nTransferred, nToTransfer,
+                           static_cast<off_t>(nOffset));
+#endif
+        if (nRet < 0 && errno == EINTR)
+            continue;
+        if (nRet <= 0)
+        {
+            bError = nRet < 0 || bWrite;
+            break;
+        }
+        nTransferred += static_cast<size_t>(nRet);
+    }
+    return nTransferred;
+}
+
+#ifdef HAVE_LINUX_IO_URING_H
+
+/************************************************************************/
+/*                             UseIoUring()                             */
+/************************************************************************/
+
+static bool UseIoUring()
+{
+    return CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "YES")) &&
+           CPLIoUring::IsAvailable();
+}
+
+/************************************************************************/
+/*                         GetIoUringQueueDepth()                       */
+/************************************************************************/
+
+static unsigned GetIoUringQueueDepth()
+{
+    return static_cast<unsigned>(std::max(
+        1, atoi(CPLGetConfigOption("CPL_VSIL_IO_URING_QUEUE_DEPTH", "64"))));
+}
+
+#endif
+
+/************************************************************************/
+/*                             RunRequests()                            */
+/************************************************************************/
+
+// Service requests synchronously, with io_uring if available, and otherwise
+// with pread()/pwrite().
+static void
+RunRequests(int fd, bool bWrite, int nRequests,
+            const VSIAsyncRequest *pasRequests,
+            const std::function<void(int, size_t, bool)> &oCompleted)
+{
+#ifdef HAVE_LINUX_IO_URING_H
+    if (UseIoUring() &&
+        CPLIoUring::Run(fd, bWrite, nRequests, pasRequests,
+                        GetIoUringQueueDepth(), oCompleted))
+    {
+        return;
+    }
+#endif
+    for (int i = 0; i < nRequests; ++i)
+    {
+        bool bRequestError = false;
+        const size_t nTransferred =
+            TransferFullyAt(fd, bWrite, pasRequests + i, bRequestError);
+        oCompleted(i, nTransferred, bRequestError);
+    }
+}
+
+/************************************************************************/
+/*                        SyncForPositionalIO()                         */
+/************************************************************************/
+
+// Positional reads and writes bypass the buffer of the handle, so write its
+// pending data, and, before writes, discard read-ahead data that they could
+// make stale.
+bool VSIUnixStdioHandle::SyncForPositionalIO(bool bWrite)
+{
+    bool bOK = Flush() == 0;
+    if (bOK && bWrite && m_nBufferSize > 0)
+    {
+        bOK = VSI_LSEEK64(fd, m_nFilePos, SEEK_SET) >= 0;
+        m_nBufferCurPos = 0;
+        m_nBufferSize = 0;
+    }
+    if (!bOK)
+        bError = true;
+    return bOK;
+}
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    if (!SyncForPositionalIO(false))
+        return -1;
+
+#ifdef HAS_DIRECT_IO
+    if (!m_bDirectIOFailed &&
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_LOCAL_DIRECT_IO", "NO")))
+    {
+        if (ReadMultiRangeDirect(nRanges, ppData, panOffsets, panSizes))
+            return 0;
+    }
+#endif
+
+    std::vector<VSIAsyncRequest> asRequests(nRanges);
+    for (int i = 0; i < nRanges; ++i)
+    {
+        asRequests[i].nOffset = panOffsets[i];
+        asRequests[i].nSize = panSizes[i];
+        asRequests[i].pBuffer = ppData[i];
+    }
+    bool bOK = true;
+    RunRequests(fd, false, nRanges, asRequests.data(),
+                [&bOK, panSizes](int i, size_t nTransferred, bool bRequestError)
+                {
+                    if (bRequestError || nTransferred != panSizes[i])
+                        bOK = false;
+                });
+    return bOK ? 0 : -1;
+}
+
+#ifdef HAS_DIRECT_IO
+
+/************************************************************************/
+/*                        ReadMultiRangeDirect()                        */
+/************************************************************************/
+
+// Alignment of offsets, sizes and buffers required by O_DIRECT. 4096 is a
+// multiple of the logical block size of all usual devices.
+constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+// Read ranges through a descriptor opened with O_DIRECT, so that large
+// random reads neither pollute nor go through the page cache. Ranges are
+// extended to aligned boundaries and read into aligned bounce buffers.
+// Returns false if the ranges could not be read this way, in which case the
+// caller must read them through the regular descriptor.
+bool VSIUnixStdioHandle::ReadMultiRangeDirect(int nRanges, void **ppData,
+                                              const vsi_l_offset *panOffsets,
+                                              const size_t *panSizes)
+{
+    if (m_fdDirect < 0)
+    {
+        // Reopen through /proc so that this also works for unlinked files
+        char szPath[32];
+        snprintf(szPath, sizeof(szPath), "/proc/self/fd/%d", fd);
+        m_fdDirect = VSI_OPEN64(szPath, O_RDONLY | O_DIRECT);
+        if (m_fdDirect < 0)
+        {
+            CPLDebug("CPL", "Cannot open %s with O_DIRECT: %s", szPath,
+                     strerror(errno));
+            m_bDirectIOFailed = true;
+            return false;
+        }
+    }
+
+    std::vector<VSIAsyncRequest> asRequests(nRanges);
+    bool bOK = true;
+    bool bRequestFailed = false;
+    for (int i = 0; i < nRanges && bOK; ++i)
+    {
+        const vsi_l_offset nStart =
+            panOffsets[i] / DIRECT_IO_ALIGNMENT * DIRECT_IO_ALIGNMENT;
+        const vsi_l_offset nEnd =
+            (panOffsets[i] + panSizes[i] + DIRECT_IO_ALIGNMENT - 1) /
+            DIRECT_IO_ALIGNMENT * DIRECT_IO_ALIGNMENT;
+        asRequests[i].nOffset = nStart;
+        asRequests[i].nSize = static_cast<size_t>(nEnd - nStart);
+        asRequests[i].pBuffer =
+            VSIMallocAligned(DIRECT_IO_ALIGNMENT, asRequests[i].nSize);
+        if (asRequests[i].nSize > 0 && asRequests[i].pBuffer == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate " CPL_FRMT_GUIB " bytes",
+                     static_cast<GUIntBig>(asRequests[i].nSize));
+            bOK = false;
+        }
+    }
+
+    if (bOK)
+    {
+        RunRequests(m_fdDirect, false, nRanges, asRequests.data(),
+                    [&bOK, &bRequestFailed, &asRequests, ppData, panOffsets,
+                     panSizes](int i, size_t nTransferred, bool bRequestError)
+                    {
+                        // The last block of the file may be read partially
+                        const size_t nSkip = static_cast<size_t>(
+                            panOffsets[i] - asRequests[i].nOffset);
+                        if (bRequestError || nTransferred < nSkip + panSizes[i])
+                        {
+                            bRequestFailed |= bRequestError;
+                            bOK = false;
+                            return;
+                        }
+                        if (panSizes[i] > 0)
+                        {
+                            memcpy(ppData[i],
+                                   static_cast<GByte *>(asRequests[i].pBuffer) +
+                                       nSkip,
+                                   panSizes[i]);
+                        }
+                    });
+    }
+
+    for (auto &sRequest : asRequests)
+        VSIFreeAligned(sRequest.pBuffer);
+
+    if (bRequestFailed)
+    {
+        // Some file systems accept O_DIRECT at open time, but reject the
+        // reads (EINVAL), for example FUSE ones, or devices with logical
+        // blocks larger than DIRECT_IO_ALIGNMENT.
+        CPLDebug("CPL", "Read with O_DIRECT failed. Disabling direct I/O");
+        close(m_fdDirect);
+        m_fdDirect = -1;
+        m_bDirectIOFailed = true;
+    }
+    return bOK;
+}
+
+#endif  // HAS_DIRECT_IO
+
+/************************************************************************/
+/*                            SubmitBatch()                             */
+/************************************************************************/
+
+std::unique_ptr<VSIAsyncBatch>
+VSIUnixStdioHandle::SubmitBatch(bool bWrite, int nRequests,
+                                VSIAsyncRequest *pasRequests,
+                                VSIAsyncCompletionFunc pfnCompletion,
+                                void *pCompletionUserData)
+{
+    auto poBatch = std::make_unique<VSIAsyncBatch>(
+        nRequests, pasRequests, pfnCompletion, pCompletionUserData);
+
+    if (!SyncForPositionalIO(bWrite))
+    {
+        for (int i = 0; i < nRequests; ++i)
+            poBatch->Complete(i, 0, true);
+        return poBatch;
+    }
+
+    VSIAsyncBatch *poBatchRaw = poBatch.get();
+    const int fdBatch = fd;
+#ifdef HAVE_LINUX_IO_URING_H
+    if (UseIoUring())
+    {
+        // A single job keeps all requests in flight through the ring of
+        // its thread.
+        poBatch->SubmitJob(
+            [poBatchRaw, fdBatch, bWrite]()
+            {
+                RunRequests(fdBatch, bWrite, poBatchRaw->GetRequestCount(),
+                            poBatchRaw->GetRequest(0),
+                            [poBatchRaw](int i, size_t nTransferred,
+                                         bool bRequestError)
+                            {
+                                poBatchRaw->Complete(i, nTransferred,
+                                                     bRequestError);
+                            });
+            });
+        return poBatch;
+    }
+#endif
+
+    for (int i = 0; i < nRequests; ++i)
+    {
+        poBatch->SubmitJob(
+            [poBatchRaw, fdBatch, bWrite, i]()
+            {
+                bool bRequestError = false;
+                const size_t nTransferred = TransferFullyAt(
+                    fdBatch, bWrite, poBatchRaw->GetRequest(i), bRequestError);
+                poBatchRaw->Complete(i, nTransferred, bRequestError);
+            });
+    }
+    return poBatch;
+}
+
+/************************************************************************/
+/*                          SubmitReadBatch()                           */
+/************************************************************************/
+
+std::unique_ptr<VSIAsyncBatch>
+VSIUnixStdioHandle::SubmitReadBatch(int nRequests, VSIAsyncRequest *pasRequests,
+                                    VSIAsyncCompletionFunc pfnCompletion,
+                                    void *pCompletionUserData)
+{
+    return SubmitBatch(false, nRequests, pasRequests, pfnCompletion,
+                       pCompletionUserData);
+}
+
+/************************************************************************/
+/*                          SubmitWriteBatch()                          */
+/************************************************************************/
+
+std::unique_ptr<VSIAsyncBatch> VSIUnixStdioHandle::SubmitWriteBatch(
+    int nRequests, VSIAsyncRequest *pasRequests,
+    VSIAsyncCompletionFunc pfnCompletion, void *pCompletionUserData)
+{
+    if (eAccessMode == AccessMode::APPEND_READ_WRITE)
+    {
+        // pwrite() appends to the end of file in append mode on Linux
+        return VSIVirtualHandle::SubmitWriteBatch(
+            nRequests, pasRequests, pfnCompletion, pCompletionUserData);
+    }
+    return SubmitBatch(true, nRequests, pasRequests, pfnCompletion,
+                       pCompletionUserData);
+}
+
+#endif  // HAS_POSITIONAL_IO
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
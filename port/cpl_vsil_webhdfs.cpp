@@ -121,6 +121,12 @@ class VSIWebHDFSHandle final : public VSICurlHandle
 
     std::string DownloadRegion(vsi_l_offset startOffset, int nBlocks) override;
 
+    bool AllowParallelReadAhead() override
+    {
+        // Reads go through a redirection to a data node
+        return false;
+    }
+
   public:
     VSIWebHDFSHandle(VSIWebHDFSFSHandler *poFS, const char *pszFilename,
                      const char *pszURL);